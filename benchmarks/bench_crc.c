@@ -0,0 +1,142 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_crc.c
+ * @brief Throughput of the Juno_Crc*Update functions over 64 B to 16 MiB.
+ * @details
+ *  Measures the table kernels selected by the JUNO_CRC_SLICE build setting;
+ *  build once per setting (1, 4 or 8) to compare. When Juno_CrcHwInit finds
+ *  accelerated kernels, ZIP, CCITT32 and Castagnoli are measured again with
+ *  them. Every
+ *  size is processed until about 256 MiB have been checksummed. Finally the
+ *  16 MiB input is split across 1 to 8 POSIX threads with Juno_CrcParallel.
+ */
+#include "juno_bench.h"
+#include "juno/crc/crc.h"
+#include "juno/crc/crc_parallel.h"
+#include "juno/crc/crc_pthread.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define BENCH_MAX_INPUT (16u * 1024u * 1024u)
+#define BENCH_TOTAL_BYTES (256ull * 1024ull * 1024ull)
+
+typedef uint32_t (*BENCH_CRC_FCN_T)(uint32_t iCrc, const void *pcData, size_t zDataSize);
+
+static uint32_t BenchCrc_Arc(uint32_t iCrc, const void *pcData, size_t zDataSize)
+{
+    return Juno_CrcArcUpdate((uint16_t)iCrc, pcData, zDataSize);
+}
+
+static uint32_t BenchCrc_Binhex(uint32_t iCrc, const void *pcData, size_t zDataSize)
+{
+    return Juno_CrcBinhexUpdate((uint16_t)iCrc, pcData, zDataSize);
+}
+
+static uint32_t BenchCrc_Ccitt(uint32_t iCrc, const void *pcData, size_t zDataSize)
+{
+    return Juno_CrcCcittUpdate((uint16_t)iCrc, pcData, zDataSize);
+}
+
+static uint32_t BenchCrc_Kermit(uint32_t iCrc, const void *pcData, size_t zDataSize)
+{
+    return Juno_CrcKermitUpdate((uint16_t)iCrc, pcData, zDataSize);
+}
+
+static uint32_t BenchCrc_Crc64(uint32_t iCrc, const void *pcData, size_t zDataSize)
+{
+    uint64_t iCrc64 = Juno_CrcCrc64Update(iCrc, pcData, zDataSize);
+    return (uint32_t)(iCrc64 ^ (iCrc64 >> 32));
+}
+
+static void BenchCrc_Run(const char *pcName, BENCH_CRC_FCN_T pfcnCrc, const uint8_t *pcInput, size_t zSize)
+{
+    uint64_t iOps = BENCH_TOTAL_BYTES / zSize;
+    uint32_t iCrc = 0;
+    uint64_t iStart = JunoBench_NowNs();
+    for(uint64_t i = 0; i < iOps; i++)
+    {
+        // Chain the CRCs so consecutive calls cannot overlap
+        iCrc = pfcnCrc(iCrc, pcInput, zSize);
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    giJunoBenchSink += iCrc;
+    JunoBench_ReportBytes(pcName, zSize, iElapsed, iOps, zSize);
+}
+
+static void BenchCrc_RunParallel(const char *pcName, const uint8_t *pcInput, size_t zJobs)
+{
+    JUNO_CRC_JOB_T atJobs[8];
+    uint64_t iOps = BENCH_TOTAL_BYTES / BENCH_MAX_INPUT;
+    uint32_t iSerial = Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, pcInput, BENCH_MAX_INPUT);
+    uint32_t iCrc = 0;
+    uint64_t iStart = JunoBench_NowNs();
+    for(uint64_t i = 0; i < iOps; i++)
+    {
+        JUNO_RESULT_UINT64_T tResult = Juno_CrcParallel(JUNO_CRC_KIND_ZIP, JUNO_ZIP_CRC_INIT, pcInput, BENCH_MAX_INPUT, atJobs, zJobs, Juno_CrcPthreadExecutor, NULL);
+        // Count a mismatch with the serial result as a failure in the sink
+        iCrc += (tResult.tStatus == JUNO_STATUS_SUCCESS && tResult.tOk == iSerial) ? 0u : 1u;
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    giJunoBenchSink += iCrc;
+    JunoBench_ReportBytes(pcName, zJobs, iElapsed, iOps, BENCH_MAX_INPUT);
+}
+
+int main(void)
+{
+    uint8_t *pcInput = malloc(BENCH_MAX_INPUT);
+    if(!pcInput)
+    {
+        return 1;
+    }
+    uint64_t iState = 0x9E3779B97F4A7C15ull;
+    for(size_t i = 0; i < BENCH_MAX_INPUT; i++)
+    {
+        iState = iState * 6364136223846793005ull + 1442695040888963407ull;
+        pcInput[i] = (uint8_t)(iState >> 56);
+    }
+    static const size_t azSizes[] = {64, 1024, 64u * 1024u, BENCH_MAX_INPUT};
+    for(size_t i = 0; i < sizeof(azSizes) / sizeof(azSizes[0]); i++)
+    {
+        BenchCrc_Run("crc_arc", BenchCrc_Arc, pcInput, azSizes[i]);
+        BenchCrc_Run("crc_binhex", BenchCrc_Binhex, pcInput, azSizes[i]);
+        BenchCrc_Run("crc_castagnoli", Juno_CrcCastagnoliUpdate, pcInput, azSizes[i]);
+        BenchCrc_Run("crc_ccitt", BenchCrc_Ccitt, pcInput, azSizes[i]);
+        BenchCrc_Run("crc_ccitt32", Juno_CrcCcitt32Update, pcInput, azSizes[i]);
+        BenchCrc_Run("crc_crc64", BenchCrc_Crc64, pcInput, azSizes[i]);
+        BenchCrc_Run("crc_kermit", BenchCrc_Kermit, pcInput, azSizes[i]);
+        BenchCrc_Run("crc_zip", Juno_CrcZipUpdate, pcInput, azSizes[i]);
+    }
+    if(Juno_CrcHwInit(true))
+    {
+        for(size_t i = 0; i < sizeof(azSizes) / sizeof(azSizes[0]); i++)
+        {
+            BenchCrc_Run("crc_castagnoli_hw", Juno_CrcCastagnoliUpdate, pcInput, azSizes[i]);
+            BenchCrc_Run("crc_ccitt32_hw", Juno_CrcCcitt32Update, pcInput, azSizes[i]);
+            BenchCrc_Run("crc_zip_hw", Juno_CrcZipUpdate, pcInput, azSizes[i]);
+        }
+    }
+    for(size_t zJobs = 1; zJobs <= 8; zJobs *= 2)
+    {
+        BenchCrc_RunParallel(Juno_CrcHwInit(true) ? "crc_zip_hw_parallel" : "crc_zip_parallel", pcInput, zJobs);
+    }
+    free(pcInput);
+    return 0;
+}
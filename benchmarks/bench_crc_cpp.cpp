@@ -0,0 +1,114 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_crc_cpp.cpp
+ * @brief Throughput of the compile-time CRC engine against the C functions.
+ * @details
+ *  Compares juno::crc::CRC_T byte-at-a-time (SLICE 1) and slicing-by-8
+ *  instantiations with the Juno_Crc*Update functions, which use the tables
+ *  selected by JUNO_CRC_SLICE. Hardware kernels are not enabled. Every size
+ *  is processed until about 256 MiB have been checksummed.
+ */
+#include "juno_bench.h"
+#include "juno/crc/crc.h"
+#include "juno/crc/crc.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#define BENCH_MAX_INPUT (64u * 1024u)
+#define BENCH_TOTAL_BYTES (256ull * 1024ull * 1024ull)
+
+using namespace juno::crc;
+
+typedef uint64_t (*BENCH_CRC_FCN_T)(uint64_t iCrc, const void *pcData, size_t zDataSize);
+
+static uint64_t BenchCrc_CZip(uint64_t iCrc, const void *pcData, size_t zDataSize)
+{
+    return Juno_CrcZipUpdate(uint32_t(iCrc), pcData, zDataSize);
+}
+
+static uint64_t BenchCrc_CCcitt32(uint64_t iCrc, const void *pcData, size_t zDataSize)
+{
+    return Juno_CrcCcitt32Update(uint32_t(iCrc), pcData, zDataSize);
+}
+
+static uint64_t BenchCrc_CCrc64(uint64_t iCrc, const void *pcData, size_t zDataSize)
+{
+    return Juno_CrcCrc64Update(iCrc, pcData, zDataSize);
+}
+
+static uint64_t BenchCrc_CArc(uint64_t iCrc, const void *pcData, size_t zDataSize)
+{
+    return Juno_CrcArcUpdate(uint16_t(iCrc), pcData, zDataSize);
+}
+
+/// Engine update with the same chaining as the C functions
+template<typename ENGINE_T>
+static uint64_t BenchCrc_Engine(uint64_t iCrc, const void *pcData, size_t zDataSize)
+{
+    return ENGINE_T::Update(typename ENGINE_T::VALUE_T(iCrc), pcData, zDataSize);
+}
+
+static void BenchCrc_Run(const char *pcName, BENCH_CRC_FCN_T pfcnCrc, const uint8_t *pcInput, size_t zSize)
+{
+    uint64_t iOps = BENCH_TOTAL_BYTES / zSize;
+    uint64_t iCrc = 0;
+    uint64_t iStart = JunoBench_NowNs();
+    for(uint64_t i = 0; i < iOps; i++)
+    {
+        // Chain the CRCs so consecutive calls cannot overlap
+        iCrc = pfcnCrc(iCrc, pcInput, zSize);
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    giJunoBenchSink += iCrc;
+    JunoBench_ReportBytes(pcName, zSize, iElapsed, iOps, zSize);
+}
+
+int main(void)
+{
+    uint8_t *pcInput = static_cast<uint8_t *>(malloc(BENCH_MAX_INPUT));
+    if(!pcInput)
+    {
+        return 1;
+    }
+    uint64_t iState = 0x9E3779B97F4A7C15ull;
+    for(size_t i = 0; i < BENCH_MAX_INPUT; i++)
+    {
+        iState = iState * 6364136223846793005ull + 1442695040888963407ull;
+        pcInput[i] = uint8_t(iState >> 56);
+    }
+    static const size_t azSizes[] = {64, 1024, BENCH_MAX_INPUT};
+    for(size_t i = 0; i < sizeof(azSizes) / sizeof(azSizes[0]); i++)
+    {
+        BenchCrc_Run("c_arc", BenchCrc_CArc, pcInput, azSizes[i]);
+        BenchCrc_Run("cpp_arc", BenchCrc_Engine<CRC16_ARC_T<1>>, pcInput, azSizes[i]);
+        BenchCrc_Run("cpp_arc_slice8", BenchCrc_Engine<CRC16_ARC_T<8>>, pcInput, azSizes[i]);
+        BenchCrc_Run("c_ccitt32", BenchCrc_CCcitt32, pcInput, azSizes[i]);
+        BenchCrc_Run("cpp_mpeg2", BenchCrc_Engine<CRC32_MPEG2_T<1>>, pcInput, azSizes[i]);
+        BenchCrc_Run("cpp_mpeg2_slice8", BenchCrc_Engine<CRC32_MPEG2_T<8>>, pcInput, azSizes[i]);
+        BenchCrc_Run("c_zip", BenchCrc_CZip, pcInput, azSizes[i]);
+        BenchCrc_Run("cpp_iso_hdlc", BenchCrc_Engine<CRC32_ISO_HDLC_T<1>>, pcInput, azSizes[i]);
+        BenchCrc_Run("cpp_iso_hdlc_slice8", BenchCrc_Engine<CRC32_ISO_HDLC_T<8>>, pcInput, azSizes[i]);
+        BenchCrc_Run("c_crc64", BenchCrc_CCrc64, pcInput, azSizes[i]);
+        BenchCrc_Run("cpp_xz", BenchCrc_Engine<CRC64_XZ_T<1>>, pcInput, azSizes[i]);
+        BenchCrc_Run("cpp_xz_slice8", BenchCrc_Engine<CRC64_XZ_T<8>>, pcInput, azSizes[i]);
+    }
+    free(pcInput);
+    return 0;
+}
@@ -0,0 +1,168 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_crc_stream.c
+ * @brief Throughput of streaming CRC-32 (ZIP) over a 256 MiB file.
+ * @details
+ *  Compares a plain read-then-checksum loop, Juno_CrcStreamMmapFile and
+ *  Juno_CrcStreamAsyncIo over a file-descriptor backed async I/O source with
+ *  64 KiB to 8 MiB buffers. The accelerated kernels are enabled when
+ *  available so the I/O path dominates. The file is written once and then
+ *  read from the page cache; cold-cache runs need the cache dropped between
+ *  passes.
+ */
+#include "juno_bench.h"
+#include "juno/crc/crc.h"
+#include "juno/crc/crc_posix.h"
+#include "juno/crc/crc_stream.h"
+#include "juno/io/async_io_api.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define BENCH_FILE_SIZE (256u * 1024u * 1024u)
+#define BENCH_PASSES (4u)
+#define BENCH_MAX_BUFF (8u * 1024u * 1024u)
+
+/// Async I/O source reading a file descriptor
+typedef struct BENCH_FD_IO_TAG JUNO_MODULE_DERIVE(JUNO_ASYNC_IO_ROOT_T,
+    int iFd;
+) BENCH_FD_IO_T;
+
+static JUNO_STATUS_T BenchFdIo_Read(JUNO_ASYNC_IO_ROOT_T *ptIo, char *pcBuff, size_t *pzBuffSize)
+{
+    ssize_t zRead = read(((BENCH_FD_IO_T *)ptIo)->iFd, pcBuff, *pzBuffSize);
+    if(zRead < 0)
+    {
+        return JUNO_STATUS_READ_ERROR;
+    }
+    *pzBuffSize = (size_t)zRead;
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Regular files are always readable
+static JUNO_STATUS_T BenchFdIo_Poll(JUNO_ASYNC_IO_ROOT_T *ptIo, JUNO_TIME_MICROS_T iTimeoutUs, bool *pbHasData)
+{
+    (void)ptIo;
+    (void)iTimeoutUs;
+    *pbHasData = true;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static const JUNO_ASYNC_IO_API_T gtBenchFdIoApi = {BenchFdIo_Read, NULL, NULL, NULL, NULL, NULL, BenchFdIo_Poll};
+
+static void BenchCrcStream_RunRead(const char *pcPath, char *pcBuff, size_t zBuffSize)
+{
+    uint64_t iCrc = 0;
+    uint64_t iStart = JunoBench_NowNs();
+    for(uint32_t i = 0; i < BENCH_PASSES; i++)
+    {
+        JUNO_CRC_STREAM_T tStream;
+        Juno_CrcStreamInit(&tStream, JUNO_CRC_KIND_ZIP);
+        int iFd = open(pcPath, O_RDONLY);
+        ssize_t zRead = 0;
+        while(iFd >= 0 && (zRead = read(iFd, pcBuff, zBuffSize)) > 0)
+        {
+            Juno_CrcStreamUpdate(&tStream, pcBuff, (size_t)zRead);
+        }
+        close(iFd);
+        iCrc += Juno_CrcStreamFinal(&tStream).tOk;
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    giJunoBenchSink += iCrc;
+    JunoBench_ReportBytes("crc_stream_read", zBuffSize, iElapsed, BENCH_PASSES, BENCH_FILE_SIZE);
+}
+
+static void BenchCrcStream_RunMmap(const char *pcPath)
+{
+    uint64_t iCrc = 0;
+    uint64_t iStart = JunoBench_NowNs();
+    for(uint32_t i = 0; i < BENCH_PASSES; i++)
+    {
+        JUNO_CRC_STREAM_T tStream;
+        Juno_CrcStreamInit(&tStream, JUNO_CRC_KIND_ZIP);
+        Juno_CrcStreamMmapFile(&tStream, pcPath);
+        iCrc += Juno_CrcStreamFinal(&tStream).tOk;
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    giJunoBenchSink += iCrc;
+    JunoBench_ReportBytes("crc_stream_mmap", JUNO_CRC_POSIX_WINDOW, iElapsed, BENCH_PASSES, BENCH_FILE_SIZE);
+}
+
+static void BenchCrcStream_RunAsyncIo(const char *pcPath, char *pcBuffers, size_t zBuffSize)
+{
+    uint64_t iCrc = 0;
+    uint64_t iStart = JunoBench_NowNs();
+    for(uint32_t i = 0; i < BENCH_PASSES; i++)
+    {
+        JUNO_CRC_STREAM_T tStream;
+        Juno_CrcStreamInit(&tStream, JUNO_CRC_KIND_ZIP);
+        BENCH_FD_IO_T tIo = {{&gtBenchFdIoApi, NULL, NULL}, open(pcPath, O_RDONLY)};
+        if(tIo.iFd >= 0)
+        {
+            Juno_CrcStreamAsyncIo(&tStream, &tIo.tRoot, BENCH_FILE_SIZE, 0, pcBuffers, zBuffSize);
+            close(tIo.iFd);
+        }
+        iCrc += Juno_CrcStreamFinal(&tStream).tOk;
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    giJunoBenchSink += iCrc;
+    JunoBench_ReportBytes("crc_stream_async_io", zBuffSize, iElapsed, BENCH_PASSES, BENCH_FILE_SIZE);
+}
+
+int main(void)
+{
+    char *pcBuffers = malloc(2u * BENCH_MAX_BUFF);
+    char acPath[] = "bench_crc_stream_XXXXXX";
+    int iFd = mkstemp(acPath);
+    if(!pcBuffers || iFd < 0)
+    {
+        free(pcBuffers);
+        return 1;
+    }
+    uint64_t iState = 0x9E3779B97F4A7C15ull;
+    for(size_t zWritten = 0; zWritten < BENCH_FILE_SIZE; zWritten += BENCH_MAX_BUFF)
+    {
+        for(size_t i = 0; i < BENCH_MAX_BUFF; i++)
+        {
+            iState = iState * 6364136223846793005ull + 1442695040888963407ull;
+            pcBuffers[i] = (char)(iState >> 56);
+        }
+        if(write(iFd, pcBuffers, BENCH_MAX_BUFF) != (ssize_t)BENCH_MAX_BUFF)
+        {
+            close(iFd);
+            unlink(acPath);
+            free(pcBuffers);
+            return 1;
+        }
+    }
+    close(iFd);
+    Juno_CrcHwInit(true);
+    static const size_t azBuffSizes[] = {64u * 1024u, 1024u * 1024u, BENCH_MAX_BUFF};
+    for(size_t i = 0; i < sizeof(azBuffSizes) / sizeof(azBuffSizes[0]); i++)
+    {
+        BenchCrcStream_RunRead(acPath, pcBuffers, azBuffSizes[i]);
+        BenchCrcStream_RunAsyncIo(acPath, pcBuffers, azBuffSizes[i]);
+    }
+    BenchCrcStream_RunMmap(acPath);
+    unlink(acPath);
+    free(pcBuffers);
+    return 0;
+}
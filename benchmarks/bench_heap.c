@@ -0,0 +1,274 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_heap.c
+ * @brief Insert and Pop cost of the binary heap versus the fast and indexed heaps.
+ * @details
+ *  Fills a heap of 64, 1024 or 16384 8-byte elements with pseudo-random keys
+ *  and drains it, timing Insert and Pop separately. Each size runs with the
+ *  original heap, the fast heap calling Compare, the fast heap comparing
+ *  an inline uint32_t key, and the indexed heap. All variants use the
+ *  trivial pointer API.
+ *
+ *  Reprioritizing one element of a full heap is timed with the indexed
+ *  heap's Update and Remove + InsertHandle, against changing a key in place
+ *  and rebuilding the fast heap with Heapify.
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/heap_api.h"
+#include "juno/ds/heap_fast.h"
+#include "juno/ds/heap_indexed.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_MAX_CAPACITY 16384
+#define BENCH_TOTAL_OPS (1u << 18)
+
+typedef struct BENCH_HEAP_ELEM_TAG
+{
+    uint32_t iKey;
+    uint32_t iId;
+} BENCH_HEAP_ELEM_T;
+
+typedef struct BENCH_HEAP_ARRAY_TAG JUNO_MODULE_DERIVE(JUNO_DS_ARRAY_ROOT_T,
+    BENCH_HEAP_ELEM_T *ptBuffer;
+) BENCH_HEAP_ARRAY_T;
+
+/// Either heap, sharing the root
+typedef union BENCH_HEAP_TAG
+{
+    JUNO_DS_HEAP_ROOT_T tRoot;
+    JUNO_DS_HEAP_FAST_T tFast;
+    JUNO_DS_HEAP_INDEXED_T tIndexed;
+} BENCH_HEAP_T;
+
+static JUNO_STATUS_T BenchHeapArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchHeapArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchHeapArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_DS_HEAP_COMPARE_RESULT_T BenchHeap_CompareMin(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild);
+static JUNO_STATUS_T BenchHeap_Swap(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tLeft, JUNO_POINTER_T tRight);
+
+static const JUNO_POINTER_API_T gtBenchHeapElemApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchHeapArrayApi = {
+    BenchHeapArray_SetAt,
+    BenchHeapArray_GetAt,
+    BenchHeapArray_RemoveAt
+};
+
+static const JUNO_DS_HEAP_POINTER_API_T gtBenchHeapPointerApi = {
+    BenchHeap_CompareMin,
+    BenchHeap_Swap
+};
+
+static BENCH_HEAP_ELEM_T gatBuffer[BENCH_MAX_CAPACITY];
+static BENCH_HEAP_ELEM_T gtScratch;
+static uint32_t gaiKeys[BENCH_MAX_CAPACITY];
+static size_t gazHeap[BENCH_MAX_CAPACITY];
+static size_t gazPositions[BENCH_MAX_CAPACITY];
+
+#define BenchHeapElem_PointerInit(addr) JunoMemory_PointerInit(&gtBenchHeapElemApi, BENCH_HEAP_ELEM_T, addr)
+
+static JUNO_STATUS_T BenchHeapArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerCopy(BenchHeapElem_PointerInit(&((BENCH_HEAP_ARRAY_T *)ptArray)->ptBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchHeapArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk = BenchHeapElem_PointerInit(&((BENCH_HEAP_ARRAY_T *)ptArray)->ptBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchHeapArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerReset(BenchHeapElem_PointerInit(&((BENCH_HEAP_ARRAY_T *)ptArray)->ptBuffer[iIndex]));
+}
+
+static JUNO_DS_HEAP_COMPARE_RESULT_T BenchHeap_CompareMin(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild)
+{
+    (void)ptHeap;
+    JUNO_DS_HEAP_COMPARE_RESULT_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = ((const BENCH_HEAP_ELEM_T *)tParent.pvAddr)->iKey <= ((const BENCH_HEAP_ELEM_T *)tChild.pvAddr)->iKey;
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchHeap_Swap(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tLeft, JUNO_POINTER_T tRight)
+{
+    (void)ptHeap;
+    BENCH_HEAP_ELEM_T tTemp = *(BENCH_HEAP_ELEM_T *)tLeft.pvAddr;
+    *(BENCH_HEAP_ELEM_T *)tLeft.pvAddr = *(BENCH_HEAP_ELEM_T *)tRight.pvAddr;
+    *(BENCH_HEAP_ELEM_T *)tRight.pvAddr = tTemp;
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Fill and drain the heap until BENCH_TOTAL_OPS elements went through it
+static JUNO_STATUS_T RunHeap(const char *pcName, JUNO_DS_HEAP_ROOT_T *ptHeap, size_t zCapacity)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    size_t zRounds = BENCH_TOTAL_OPS / zCapacity;
+    uint64_t iInsertNs = 0;
+    uint64_t iPopNs = 0;
+    BENCH_HEAP_ELEM_T tElem = {0};
+    for(size_t iRound = 0; iRound < zRounds; iRound++)
+    {
+        uint64_t iStart = JunoBench_NowNs();
+        for(size_t i = 0; i < zCapacity; i++)
+        {
+            tElem.iKey = gaiKeys[i];
+            tElem.iId = (uint32_t)i;
+            tStatus = ptHeap->ptApi->Insert(ptHeap, BenchHeapElem_PointerInit(&tElem));
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        }
+        uint64_t iMid = JunoBench_NowNs();
+        for(size_t i = 0; i < zCapacity; i++)
+        {
+            tStatus = ptHeap->ptApi->Pop(ptHeap, BenchHeapElem_PointerInit(&tElem));
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+            giJunoBenchSink += tElem.iKey;
+        }
+        iInsertNs += iMid - iStart;
+        iPopNs += JunoBench_NowNs() - iMid;
+    }
+    char acName[64];
+    snprintf(acName, sizeof(acName), "%s_insert", pcName);
+    JunoBench_Report(acName, zCapacity, iInsertNs, (uint64_t)zRounds * zCapacity);
+    snprintf(acName, sizeof(acName), "%s_pop", pcName);
+    JunoBench_Report(acName, zCapacity, iPopNs, (uint64_t)zRounds * zCapacity);
+    return tStatus;
+}
+
+/// Reprioritize random handles of a full indexed heap
+static JUNO_STATUS_T RunIndexedUpdate(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zCapacity)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &ptHeap->tRoot;
+    BENCH_HEAP_ELEM_T tElem = {0};
+    for(size_t i = 0; i < zCapacity; i++)
+    {
+        tElem.iKey = gaiKeys[i];
+        tElem.iId = (uint32_t)i;
+        tStatus = ptRoot->ptApi->Insert(ptRoot, BenchHeapElem_PointerInit(&tElem));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t i = 0; i < BENCH_TOTAL_OPS; i++)
+    {
+        size_t zHandle = gaiKeys[i % BENCH_MAX_CAPACITY] % zCapacity;
+        tElem.iKey = gaiKeys[(i * 7) % BENCH_MAX_CAPACITY];
+        tStatus = JunoDs_HeapIndexedUpdate(ptHeap, zHandle, BenchHeapElem_PointerInit(&tElem));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    uint64_t iMid = JunoBench_NowNs();
+    for(size_t i = 0; i < BENCH_TOTAL_OPS; i++)
+    {
+        size_t zHandle = gaiKeys[i % BENCH_MAX_CAPACITY] % zCapacity;
+        tElem.iKey = gaiKeys[(i * 7) % BENCH_MAX_CAPACITY];
+        tStatus = JunoDs_HeapIndexedRemove(ptHeap, zHandle);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = JunoDs_HeapIndexedInsertHandle(ptHeap, zHandle, BenchHeapElem_PointerInit(&tElem));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    JunoBench_Report("heap_indexed_update", zCapacity, iMid - iStart, BENCH_TOTAL_OPS);
+    JunoBench_Report("heap_indexed_remove_insert", zCapacity, JunoBench_NowNs() - iMid, BENCH_TOTAL_OPS);
+    return tStatus;
+}
+
+/// Reprioritize random slots of a full fast heap by rebuilding it
+static JUNO_STATUS_T RunFastRebuild(JUNO_DS_HEAP_FAST_T *ptHeap, size_t zCapacity)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &ptHeap->tRoot;
+    BENCH_HEAP_ELEM_T tElem = {0};
+    for(size_t i = 0; i < zCapacity; i++)
+    {
+        tElem.iKey = gaiKeys[i];
+        tElem.iId = (uint32_t)i;
+        tStatus = ptRoot->ptApi->Insert(ptRoot, BenchHeapElem_PointerInit(&tElem));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    // Each rebuild is O(n), so keep the element count per size comparable
+    size_t zOps = BENCH_TOTAL_OPS / zCapacity;
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t i = 0; i < zOps; i++)
+    {
+        gatBuffer[gaiKeys[i % BENCH_MAX_CAPACITY] % zCapacity].iKey = gaiKeys[(i * 7) % BENCH_MAX_CAPACITY];
+        tStatus = ptRoot->ptApi->Heapify(ptRoot);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    JunoBench_Report("heap_fast_rebuild", zCapacity, JunoBench_NowNs() - iStart, zOps);
+    return tStatus;
+}
+
+int main(void)
+{
+    uint64_t iState = 0x9E3779B97F4A7C15ull;
+    for(size_t i = 0; i < BENCH_MAX_CAPACITY; i++)
+    {
+        iState = iState * 6364136223846793005ull + 1442695040888963407ull;
+        gaiKeys[i] = (uint32_t)(iState >> 32);
+    }
+    printf("%-32s %8s\n", "benchmark", "elements");
+    static const size_t azCapacities[] = {64, 1024, BENCH_MAX_CAPACITY};
+    for(size_t i = 0; i < sizeof(azCapacities) / sizeof(azCapacities[0]); i++)
+    {
+        BENCH_HEAP_ARRAY_T tArray = {0};
+        tArray.ptBuffer = gatBuffer;
+        JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&tArray.tRoot, &gtBenchHeapArrayApi, azCapacities[i], NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        BENCH_HEAP_T tHeap = {0};
+        tStatus = JunoDs_Heap_Init(&tHeap.tRoot, &gtBenchHeapPointerApi, &tArray.tRoot, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunHeap("heap", &tHeap.tRoot, azCapacities[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = JunoDs_HeapFastInit(&tHeap.tFast, &gtBenchHeapPointerApi, &tArray.tRoot, BenchHeapElem_PointerInit(&gtScratch), NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunHeap("heap_fast", &tHeap.tRoot, azCapacities[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = JunoDs_HeapFastSetKey(&tHeap.tFast, JUNO_DS_HEAP_KEY_U32, offsetof(BENCH_HEAP_ELEM_T, iKey), true);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunHeap("heap_fast_key", &tHeap.tRoot, azCapacities[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = JunoDs_HeapIndexedInit(&tHeap.tIndexed, &gtBenchHeapPointerApi, &tArray.tRoot, gazHeap, gazPositions, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunHeap("heap_indexed", &tHeap.tRoot, azCapacities[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunIndexedUpdate(&tHeap.tIndexed, azCapacities[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = JunoDs_HeapFastInit(&tHeap.tFast, &gtBenchHeapPointerApi, &tArray.tRoot, BenchHeapElem_PointerInit(&gtScratch), NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunFastRebuild(&tHeap.tFast, azCapacities[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    }
+    return 0;
+}
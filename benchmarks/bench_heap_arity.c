@@ -0,0 +1,217 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_heap_arity.c
+ * @brief Hold-model cost of 2-, 4- and 8-ary heaps across element sizes.
+ * @details
+ *  Fills a min-heap with N pseudo-random keys, then repeatedly pops the
+ *  root and inserts it again with a later key, like an event queue with N
+ *  pending entries. Each hold is one Pop and one Insert. The sweep covers
+ *  arity 2, 4 and 8; elements of 8, 32 and 128 bytes; and N = 1k, 16k and
+ *  128k. It runs the Compare/Swap heap and the fast heap. Elements are
+ *  opaque byte blocks with a uint32_t key first, copied with the trivial
+ *  pointer API.
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/heap_api.h"
+#include "juno/ds/heap_fast.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define BENCH_MAX_CAPACITY (128u * 1024u)
+#define BENCH_MAX_ELEMENT 128u
+#define BENCH_HOLDS (1u << 17)
+
+/// Array of zElementSize-byte elements
+typedef struct BENCH_ARITY_ARRAY_TAG JUNO_MODULE_DERIVE(JUNO_DS_ARRAY_ROOT_T,
+    uint8_t *pcBuffer;
+    size_t zElementSize;
+) BENCH_ARITY_ARRAY_T;
+
+/// Either heap, sharing the root
+typedef union BENCH_ARITY_HEAP_TAG
+{
+    JUNO_DS_HEAP_ROOT_T tRoot;
+    JUNO_DS_HEAP_FAST_T tFast;
+} BENCH_ARITY_HEAP_T;
+
+static JUNO_STATUS_T BenchArityArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchArityArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchArityArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_DS_HEAP_COMPARE_RESULT_T BenchArity_CompareMin(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild);
+static JUNO_STATUS_T BenchArity_Swap(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tLeft, JUNO_POINTER_T tRight);
+
+static const JUNO_POINTER_API_T gtBenchArityElemApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchArityArrayApi = {
+    BenchArityArray_SetAt,
+    BenchArityArray_GetAt,
+    BenchArityArray_RemoveAt
+};
+
+static const JUNO_DS_HEAP_POINTER_API_T gtBenchArityPointerApi = {
+    BenchArity_CompareMin,
+    BenchArity_Swap
+};
+
+static alignas(uint64_t) uint8_t gacBuffer[BENCH_MAX_CAPACITY * BENCH_MAX_ELEMENT];
+static alignas(uint64_t) uint8_t gacScratch[BENCH_MAX_ELEMENT];
+static alignas(uint64_t) uint8_t gacElem[BENCH_MAX_ELEMENT];
+
+/// Descriptor of a zSize-byte element at pvAddr
+static inline JUNO_POINTER_T BenchArity_Pointer(void *pvAddr, size_t zSize)
+{
+    JUNO_POINTER_T tPointer = {&gtBenchArityElemApi, pvAddr, zSize, alignof(uint64_t)};
+    return tPointer;
+}
+
+static inline uint32_t BenchArity_Key(JUNO_POINTER_T tPointer)
+{
+    uint32_t iKey;
+    memcpy(&iKey, tPointer.pvAddr, sizeof(iKey));
+    return iKey;
+}
+
+static JUNO_STATUS_T BenchArityArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tSlot = BenchArityArray_GetAt(ptArray, iIndex);
+    JUNO_ASSERT_OK(tSlot, return tSlot.tStatus);
+    return JunoMemory_PointerCopy(tSlot.tOk, tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchArityArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    BENCH_ARITY_ARRAY_T *ptArityArray = (BENCH_ARITY_ARRAY_T *)ptArray;
+    tResult.tOk = BenchArity_Pointer(ptArityArray->pcBuffer + iIndex * ptArityArray->zElementSize, ptArityArray->zElementSize);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArityArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tSlot = BenchArityArray_GetAt(ptArray, iIndex);
+    JUNO_ASSERT_OK(tSlot, return tSlot.tStatus);
+    return JunoMemory_PointerReset(tSlot.tOk);
+}
+
+static JUNO_DS_HEAP_COMPARE_RESULT_T BenchArity_CompareMin(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild)
+{
+    (void)ptHeap;
+    JUNO_DS_HEAP_COMPARE_RESULT_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = BenchArity_Key(tParent) <= BenchArity_Key(tChild);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArity_Swap(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tLeft, JUNO_POINTER_T tRight)
+{
+    (void)ptHeap;
+    uint8_t acTemp[BENCH_MAX_ELEMENT];
+    memcpy(acTemp, tLeft.pvAddr, tLeft.zSize);
+    memcpy(tLeft.pvAddr, tRight.pvAddr, tLeft.zSize);
+    memcpy(tRight.pvAddr, acTemp, tLeft.zSize);
+    return JUNO_STATUS_SUCCESS;
+}
+
+static uint64_t giState = 0x9E3779B97F4A7C15ull;
+
+static inline uint32_t BenchArity_Rand(void)
+{
+    giState = giState * 6364136223846793005ull + 1442695040888963407ull;
+    return (uint32_t)(giState >> 40);
+}
+
+/// Fill the heap with N entries, then time BENCH_HOLDS Pop + Insert pairs
+static JUNO_STATUS_T RunHold(const char *pcName, JUNO_DS_HEAP_ROOT_T *ptHeap, size_t zCapacity, size_t zElementSize)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_POINTER_T tElem = BenchArity_Pointer(gacElem, zElementSize);
+    memset(gacElem, 0, sizeof(gacElem));
+    giState = 0x9E3779B97F4A7C15ull;
+    for(size_t i = 0; i < zCapacity; i++)
+    {
+        uint32_t iKey = BenchArity_Rand();
+        memcpy(gacElem, &iKey, sizeof(iKey));
+        tStatus = ptHeap->ptApi->Insert(ptHeap, tElem);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t i = 0; i < BENCH_HOLDS; i++)
+    {
+        tStatus = ptHeap->ptApi->Pop(ptHeap, tElem);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        // Reschedule the popped event at a later time
+        uint32_t iKey = BenchArity_Key(tElem) + (BenchArity_Rand() >> 4);
+        memcpy(gacElem, &iKey, sizeof(iKey));
+        tStatus = ptHeap->ptApi->Insert(ptHeap, tElem);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    giJunoBenchSink += BenchArity_Key(tElem);
+    char acName[64];
+    snprintf(acName, sizeof(acName), "%s_d%zu_e%zu", pcName, ptHeap->zArity, zElementSize);
+    JunoBench_Report(acName, zCapacity, iElapsed, BENCH_HOLDS);
+    return tStatus;
+}
+
+int main(void)
+{
+    static const size_t azCapacities[] = {1024, 16384, BENCH_MAX_CAPACITY};
+    static const size_t azElementSizes[] = {8, 32, BENCH_MAX_ELEMENT};
+    static const size_t azArities[] = {2, 4, 8};
+    printf("%-32s %8s\n", "benchmark", "elements");
+    for(size_t iCapacity = 0; iCapacity < sizeof(azCapacities) / sizeof(azCapacities[0]); iCapacity++)
+    {
+        for(size_t iSize = 0; iSize < sizeof(azElementSizes) / sizeof(azElementSizes[0]); iSize++)
+        {
+            BENCH_ARITY_ARRAY_T tArray = {0};
+            tArray.pcBuffer = gacBuffer;
+            tArray.zElementSize = azElementSizes[iSize];
+            JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&tArray.tRoot, &gtBenchArityArrayApi, azCapacities[iCapacity], NULL, NULL);
+            JUNO_ASSERT_SUCCESS(tStatus, return 1);
+            JUNO_POINTER_T tScratch = BenchArity_Pointer(gacScratch, azElementSizes[iSize]);
+            for(size_t iArity = 0; iArity < sizeof(azArities) / sizeof(azArities[0]); iArity++)
+            {
+                BENCH_ARITY_HEAP_T tHeap = {0};
+                tStatus = JunoDs_Heap_Init(&tHeap.tRoot, &gtBenchArityPointerApi, &tArray.tRoot, NULL, NULL);
+                JUNO_ASSERT_SUCCESS(tStatus, return 1);
+                tStatus = JunoDs_Heap_SetArity(&tHeap.tRoot, azArities[iArity]);
+                JUNO_ASSERT_SUCCESS(tStatus, return 1);
+                tStatus = RunHold("heap", &tHeap.tRoot, azCapacities[iCapacity], azElementSizes[iSize]);
+                JUNO_ASSERT_SUCCESS(tStatus, return 1);
+                tStatus = JunoDs_HeapFastInit(&tHeap.tFast, &gtBenchArityPointerApi, &tArray.tRoot, tScratch, NULL, NULL);
+                JUNO_ASSERT_SUCCESS(tStatus, return 1);
+                tStatus = JunoDs_Heap_SetArity(&tHeap.tRoot, azArities[iArity]);
+                JUNO_ASSERT_SUCCESS(tStatus, return 1);
+                tStatus = RunHold("heap_fast", &tHeap.tRoot, azCapacities[iCapacity], azElementSizes[iSize]);
+                JUNO_ASSERT_SUCCESS(tStatus, return 1);
+            }
+        }
+    }
+    return 0;
+}
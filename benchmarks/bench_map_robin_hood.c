@@ -0,0 +1,249 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_map_robin_hood.c
+ * @brief Linear probing versus Robin Hood probing at 50/75/90% load.
+ * @details
+ *  Both maps use the same backing storage, hash and trivial pointer API. For
+ *  each load factor the benchmark reports the average and worst-case probe
+ *  length of the stored keys (0 = found at its home slot) and the lookup cost
+ *  of hits and of misses.
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/ds/map_robin_hood.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_MAP_CAPACITY 1024
+#define BENCH_ROUNDS 200
+
+typedef struct BENCH_ENTRY_TAG
+{
+    uint32_t iKey;
+    uint32_t iValue;
+    bool bUsed;
+} BENCH_ENTRY_T;
+
+typedef struct BENCH_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    BENCH_ENTRY_T *ptBuffer;
+} BENCH_ARRAY_T;
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_RESULT_SIZE_T BenchEntry_Hash(JUNO_POINTER_T tItem);
+static JUNO_RESULT_BOOL_T BenchEntry_IsNull(JUNO_POINTER_T tItem);
+static JUNO_RESULT_BOOL_T BenchEntry_Equals(const JUNO_POINTER_T tLeft, const JUNO_POINTER_T tRight);
+
+static const JUNO_POINTER_API_T gtBenchEntryApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchArrayApi = {
+    BenchArray_SetAt,
+    BenchArray_GetAt,
+    BenchArray_RemoveAt
+};
+
+static const JUNO_MAP_HASHABLE_POINTER_API_T gtBenchHashableApi = {
+    BenchEntry_Hash,
+    BenchEntry_IsNull
+};
+
+static const JUNO_VALUE_POINTER_API_T gtBenchValueApi = {
+    BenchEntry_Equals
+};
+
+#define BenchEntry_PointerInit(addr) JunoMemory_PointerInit(&gtBenchEntryApi, BENCH_ENTRY_T, addr)
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerCopy(BenchEntry_PointerInit(&((BENCH_ARRAY_T *)ptArray)->ptBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk = BenchEntry_PointerInit(&((BENCH_ARRAY_T *)ptArray)->ptBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerReset(BenchEntry_PointerInit(&((BENCH_ARRAY_T *)ptArray)->ptBuffer[iIndex]));
+}
+
+static JUNO_RESULT_SIZE_T BenchEntry_Hash(JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    // Murmur3 finalizer, every key bit affects the home slot
+    uint32_t iHash = ((const BENCH_ENTRY_T *)tItem.pvAddr)->iKey;
+    iHash ^= iHash >> 16;
+    iHash *= 0x85EBCA6Bu;
+    iHash ^= iHash >> 13;
+    iHash *= 0xC2B2AE35u;
+    iHash ^= iHash >> 16;
+    tResult.tOk = (size_t)iHash;
+    return tResult;
+}
+
+static JUNO_RESULT_BOOL_T BenchEntry_IsNull(JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_BOOL_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = !((const BENCH_ENTRY_T *)tItem.pvAddr)->bUsed;
+    return tResult;
+}
+
+static JUNO_RESULT_BOOL_T BenchEntry_Equals(const JUNO_POINTER_T tLeft, const JUNO_POINTER_T tRight)
+{
+    JUNO_RESULT_BOOL_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = ((const BENCH_ENTRY_T *)tLeft.pvAddr)->iKey == ((const BENCH_ENTRY_T *)tRight.pvAddr)->iKey;
+    return tResult;
+}
+
+static BENCH_ENTRY_T gtMapBuffer[BENCH_MAP_CAPACITY];
+static size_t gzDistances[BENCH_MAP_CAPACITY];
+static uint32_t giKeys[BENCH_MAP_CAPACITY];
+
+/// Generate distinct pseudo-random keys; misses flip the unused top bit
+static void MakeKeys(void)
+{
+    uint32_t iState = 12345u;
+    for(size_t i = 0; i < BENCH_MAP_CAPACITY; i++)
+    {
+        iState = iState * 1664525u + 1013904223u;
+        // Index in the low bits keeps the keys distinct
+        giKeys[i] = ((iState & 0x7FFFFu) << 10) | (uint32_t)i;
+    }
+}
+
+/// Home slot of a key
+static size_t HomeSlot(uint32_t iKey)
+{
+    BENCH_ENTRY_T tKey = {iKey, 0, true};
+    return BenchEntry_Hash(BenchEntry_PointerInit(&tKey)).tOk % BENCH_MAP_CAPACITY;
+}
+
+/// Report the average and maximum probe length of the stored keys
+static void ReportProbes(const char *pcName, size_t zLoad, size_t zKeys)
+{
+    size_t zTotal = 0;
+    size_t zMax = 0;
+    for(size_t iSlot = 0; iSlot < BENCH_MAP_CAPACITY; iSlot++)
+    {
+        if(!gtMapBuffer[iSlot].bUsed)
+        {
+            continue;
+        }
+        size_t iHome = HomeSlot(gtMapBuffer[iSlot].iKey);
+        size_t zProbe = (iSlot + BENCH_MAP_CAPACITY - iHome) % BENCH_MAP_CAPACITY;
+        zTotal += zProbe;
+        zMax = zProbe > zMax ? zProbe : zMax;
+    }
+    printf("%-32s %8zu %10.2f avg probe %6zu max probe\n", pcName, zLoad, (double)zTotal / (double)zKeys, zMax);
+}
+
+/// Time BENCH_ROUNDS lookups of zKeys keys, hits or misses
+static JUNO_STATUS_T TimeGets(JUNO_MAP_ROOT_T *ptMap, const char *pcName, size_t zLoad, size_t zKeys, bool bHit)
+{
+    JUNO_STATUS_T tExpected = bHit ? JUNO_STATUS_SUCCESS : JUNO_STATUS_DNE_ERROR;
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t iRound = 0; iRound < BENCH_ROUNDS; iRound++)
+    {
+        for(size_t i = 0; i < zKeys; i++)
+        {
+            BENCH_ENTRY_T tKey = {bHit ? giKeys[i] : giKeys[i] ^ 0x80000000u, 0, true};
+            JUNO_RESULT_POINTER_T tResult = ptMap->ptApi->Get(ptMap, BenchEntry_PointerInit(&tKey));
+            if(tResult.tStatus != tExpected)
+            {
+                return JUNO_STATUS_ERR;
+            }
+            giJunoBenchSink += tResult.tStatus;
+        }
+    }
+    JunoBench_Report(pcName, zLoad, JunoBench_NowNs() - iStart, (uint64_t)BENCH_ROUNDS * zKeys);
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Fill a map to the given load and measure probes, hits and misses
+static JUNO_STATUS_T RunMap(bool bRobinHood, size_t zLoad)
+{
+    size_t zKeys = BENCH_MAP_CAPACITY * zLoad / 100;
+    for(size_t i = 0; i < BENCH_MAP_CAPACITY; i++)
+    {
+        gtMapBuffer[i] = (BENCH_ENTRY_T){0};
+    }
+    BENCH_ARRAY_T tArray = {0};
+    tArray.ptBuffer = gtMapBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&tArray.tRoot, &gtBenchArrayApi, BENCH_MAP_CAPACITY, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_ROBIN_HOOD_T tRobinHood = {0};
+    JUNO_MAP_ROOT_T tLinear = {0};
+    JUNO_MAP_ROOT_T *ptMap = &tLinear;
+    if(bRobinHood)
+    {
+        ptMap = &tRobinHood.tRoot;
+        tStatus = JunoDs_MapRobinHoodInit(&tRobinHood, &gtBenchHashableApi, &gtBenchValueApi, &tArray.tRoot, gzDistances, NULL, NULL);
+    }
+    else
+    {
+        tStatus = JunoDs_MapInit(&tLinear, &gtBenchHashableApi, &gtBenchValueApi, &tArray.tRoot, NULL, NULL);
+    }
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(size_t i = 0; i < zKeys; i++)
+    {
+        BENCH_ENTRY_T tEntry = {giKeys[i], (uint32_t)i, true};
+        tStatus = ptMap->ptApi->Set(ptMap, BenchEntry_PointerInit(&tEntry));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    ReportProbes(bRobinHood ? "robin_hood_probe" : "linear_probe", zLoad, zKeys);
+    tStatus = TimeGets(ptMap, bRobinHood ? "robin_hood_get_hit" : "linear_get_hit", zLoad, zKeys, true);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return TimeGets(ptMap, bRobinHood ? "robin_hood_get_miss" : "linear_get_miss", zLoad, zKeys, false);
+}
+
+int main(void)
+{
+    static const size_t zLoads[] = {50, 75, 90};
+    printf("%-32s %8s\n", "benchmark", "load %");
+    MakeKeys();
+    for(size_t i = 0; i < sizeof(zLoads) / sizeof(zLoads[0]); i++)
+    {
+        JUNO_STATUS_T tStatus = RunMap(false, zLoads[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunMap(true, zLoads[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    }
+    return 0;
+}
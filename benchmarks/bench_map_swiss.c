@@ -0,0 +1,220 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_map_swiss.c
+ * @brief Linear probing versus Swiss-table group probing on large tables.
+ * @details
+ *  Both maps use the same backing storage, hash and trivial pointer API and
+ *  are filled to 87.5% load with pseudo-random keys. Reports the cost of
+ *  looking up every stored key (hits) and as many absent keys (misses).
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/ds/map_swiss.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_MAX_CAPACITY 65536
+#define BENCH_LOOKUPS 2000000
+
+typedef struct BENCH_ENTRY_TAG
+{
+    uint32_t iKey;
+    uint32_t iValue;
+    bool bUsed;
+} BENCH_ENTRY_T;
+
+typedef struct BENCH_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    BENCH_ENTRY_T *ptBuffer;
+} BENCH_ARRAY_T;
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_RESULT_SIZE_T BenchEntry_Hash(JUNO_POINTER_T tItem);
+static JUNO_RESULT_BOOL_T BenchEntry_IsNull(JUNO_POINTER_T tItem);
+static JUNO_RESULT_BOOL_T BenchEntry_Equals(const JUNO_POINTER_T tLeft, const JUNO_POINTER_T tRight);
+
+static const JUNO_POINTER_API_T gtBenchEntryApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchArrayApi = {
+    BenchArray_SetAt,
+    BenchArray_GetAt,
+    BenchArray_RemoveAt
+};
+
+static const JUNO_MAP_HASHABLE_POINTER_API_T gtBenchHashableApi = {
+    BenchEntry_Hash,
+    BenchEntry_IsNull
+};
+
+static const JUNO_VALUE_POINTER_API_T gtBenchValueApi = {
+    BenchEntry_Equals
+};
+
+#define BenchEntry_PointerInit(addr) JunoMemory_PointerInit(&gtBenchEntryApi, BENCH_ENTRY_T, addr)
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerCopy(BenchEntry_PointerInit(&((BENCH_ARRAY_T *)ptArray)->ptBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk = BenchEntry_PointerInit(&((BENCH_ARRAY_T *)ptArray)->ptBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerReset(BenchEntry_PointerInit(&((BENCH_ARRAY_T *)ptArray)->ptBuffer[iIndex]));
+}
+
+static JUNO_RESULT_SIZE_T BenchEntry_Hash(JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    // Murmur3 finalizer, every key bit affects the home slot
+    uint32_t iHash = ((const BENCH_ENTRY_T *)tItem.pvAddr)->iKey;
+    iHash ^= iHash >> 16;
+    iHash *= 0x85EBCA6Bu;
+    iHash ^= iHash >> 13;
+    iHash *= 0xC2B2AE35u;
+    iHash ^= iHash >> 16;
+    tResult.tOk = (size_t)iHash;
+    return tResult;
+}
+
+static JUNO_RESULT_BOOL_T BenchEntry_IsNull(JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_BOOL_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = !((const BENCH_ENTRY_T *)tItem.pvAddr)->bUsed;
+    return tResult;
+}
+
+static JUNO_RESULT_BOOL_T BenchEntry_Equals(const JUNO_POINTER_T tLeft, const JUNO_POINTER_T tRight)
+{
+    JUNO_RESULT_BOOL_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = ((const BENCH_ENTRY_T *)tLeft.pvAddr)->iKey == ((const BENCH_ENTRY_T *)tRight.pvAddr)->iKey;
+    return tResult;
+}
+
+static BENCH_ENTRY_T gtMapBuffer[BENCH_MAX_CAPACITY];
+static uint8_t giCtrl[BENCH_MAX_CAPACITY];
+static uint32_t giKeys[BENCH_MAX_CAPACITY];
+
+/// Generate distinct pseudo-random keys; misses flip the unused top bit
+static void MakeKeys(void)
+{
+    uint32_t iState = 12345u;
+    for(size_t i = 0; i < BENCH_MAX_CAPACITY; i++)
+    {
+        iState = iState * 1664525u + 1013904223u;
+        // Index in the low bits keeps the keys distinct
+        giKeys[i] = ((iState & 0x7FFFu) << 16) | (uint32_t)i;
+    }
+}
+
+/// Time BENCH_LOOKUPS lookups cycling over zKeys keys, hits or misses
+static JUNO_STATUS_T TimeGets(JUNO_MAP_ROOT_T *ptMap, const char *pcName, size_t zCapacity, size_t zKeys, bool bHit)
+{
+    JUNO_STATUS_T tExpected = bHit ? JUNO_STATUS_SUCCESS : JUNO_STATUS_DNE_ERROR;
+    size_t iKey = 0;
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t i = 0; i < BENCH_LOOKUPS; i++)
+    {
+        BENCH_ENTRY_T tKey = {bHit ? giKeys[iKey] : giKeys[iKey] ^ 0x80000000u, 0, true};
+        JUNO_RESULT_POINTER_T tResult = ptMap->ptApi->Get(ptMap, BenchEntry_PointerInit(&tKey));
+        if(tResult.tStatus != tExpected)
+        {
+            return JUNO_STATUS_ERR;
+        }
+        giJunoBenchSink += tResult.tStatus;
+        iKey = iKey + 1 == zKeys ? 0 : iKey + 1;
+    }
+    JunoBench_Report(pcName, zCapacity, JunoBench_NowNs() - iStart, BENCH_LOOKUPS);
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Fill a map of zCapacity slots to 87.5% load and time hits and misses
+static JUNO_STATUS_T RunMap(bool bSwiss, size_t zCapacity)
+{
+    size_t zKeys = zCapacity / 8 * 7;
+    for(size_t i = 0; i < zCapacity; i++)
+    {
+        gtMapBuffer[i] = (BENCH_ENTRY_T){0};
+    }
+    BENCH_ARRAY_T tArray = {0};
+    tArray.ptBuffer = gtMapBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&tArray.tRoot, &gtBenchArrayApi, zCapacity, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_SWISS_T tSwiss = {0};
+    JUNO_MAP_ROOT_T tLinear = {0};
+    JUNO_MAP_ROOT_T *ptMap = &tLinear;
+    if(bSwiss)
+    {
+        ptMap = &tSwiss.tRoot;
+        tStatus = JunoDs_MapSwissInit(&tSwiss, &gtBenchHashableApi, &gtBenchValueApi, &tArray.tRoot, giCtrl, NULL, NULL);
+    }
+    else
+    {
+        tStatus = JunoDs_MapInit(&tLinear, &gtBenchHashableApi, &gtBenchValueApi, &tArray.tRoot, NULL, NULL);
+    }
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(size_t i = 0; i < zKeys; i++)
+    {
+        BENCH_ENTRY_T tEntry = {giKeys[i], (uint32_t)i, true};
+        tStatus = ptMap->ptApi->Set(ptMap, BenchEntry_PointerInit(&tEntry));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    tStatus = TimeGets(ptMap, bSwiss ? "swiss_get_hit" : "linear_get_hit", zCapacity, zKeys, true);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return TimeGets(ptMap, bSwiss ? "swiss_get_miss" : "linear_get_miss", zCapacity, zKeys, false);
+}
+
+int main(void)
+{
+    static const size_t zCapacities[] = {4096, 16384, 65536};
+    printf("%-32s %8s\n", "benchmark", "capacity");
+    MakeKeys();
+    for(size_t i = 0; i < sizeof(zCapacities) / sizeof(zCapacities[0]); i++)
+    {
+        JUNO_STATUS_T tStatus = RunMap(false, zCapacities[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunMap(true, zCapacities[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    }
+    return 0;
+}
@@ -0,0 +1,231 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_pow2.c
+ * @brief Modulo versus mask index wraparound for the queue and the map.
+ * @details
+ *  Each structure is initialized once with its generic init and once with
+ *  its power-of-two init over the same storage, then driven through ptApi.
+ *  Elements use the trivial pointer API so the index arithmetic dominates.
+ *  Map lookups run at 75% load with a well-mixed hash, so each one wraps
+ *  the index once per probe; the average probe count is printed after the
+ *  map results.
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_QUEUE_CAPACITY 64
+#define BENCH_MAP_CAPACITY 1024
+#define BENCH_MAP_KEYS 768
+#define BENCH_ROUNDS 2000
+
+typedef struct BENCH_ENTRY_TAG
+{
+    uint32_t iKey;
+    uint32_t iValue;
+    bool bUsed;
+} BENCH_ENTRY_T;
+
+typedef struct BENCH_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    BENCH_ENTRY_T *ptBuffer;
+} BENCH_ARRAY_T;
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_RESULT_SIZE_T BenchEntry_Hash(JUNO_POINTER_T tItem);
+static JUNO_RESULT_BOOL_T BenchEntry_IsNull(JUNO_POINTER_T tItem);
+static JUNO_RESULT_BOOL_T BenchEntry_Equals(const JUNO_POINTER_T tLeft, const JUNO_POINTER_T tRight);
+
+static const JUNO_POINTER_API_T gtBenchEntryApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchArrayApi = {
+    BenchArray_SetAt,
+    BenchArray_GetAt,
+    BenchArray_RemoveAt
+};
+
+static const JUNO_MAP_HASHABLE_POINTER_API_T gtBenchHashableApi = {
+    BenchEntry_Hash,
+    BenchEntry_IsNull
+};
+
+static const JUNO_VALUE_POINTER_API_T gtBenchValueApi = {
+    BenchEntry_Equals
+};
+
+#define BenchEntry_PointerInit(addr) JunoMemory_PointerInit(&gtBenchEntryApi, BENCH_ENTRY_T, addr)
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerCopy(BenchEntry_PointerInit(&((BENCH_ARRAY_T *)ptArray)->ptBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk = BenchEntry_PointerInit(&((BENCH_ARRAY_T *)ptArray)->ptBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerReset(BenchEntry_PointerInit(&((BENCH_ARRAY_T *)ptArray)->ptBuffer[iIndex]));
+}
+
+static JUNO_RESULT_SIZE_T BenchEntry_Hash(JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    // MurmurHash3's 64-bit finalizer: well-mixed low bits, so the 75% load
+    // gives realistic collision chains and each lookup wraps several probes.
+    // (A multiplicative hash of sequential keys is collision-free here and
+    // would leave a single wrap per lookup.)
+    uint64_t iHash = ((const BENCH_ENTRY_T *)tItem.pvAddr)->iKey;
+    iHash ^= iHash >> 33;
+    iHash *= 0xff51afd7ed558ccdull;
+    iHash ^= iHash >> 33;
+    iHash *= 0xc4ceb9fe1a85ec53ull;
+    iHash ^= iHash >> 33;
+    tResult.tOk = (size_t)iHash;
+    return tResult;
+}
+
+static JUNO_RESULT_BOOL_T BenchEntry_IsNull(JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_BOOL_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = !((const BENCH_ENTRY_T *)tItem.pvAddr)->bUsed;
+    return tResult;
+}
+
+static JUNO_RESULT_BOOL_T BenchEntry_Equals(const JUNO_POINTER_T tLeft, const JUNO_POINTER_T tRight)
+{
+    JUNO_RESULT_BOOL_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = ((const BENCH_ENTRY_T *)tLeft.pvAddr)->iKey == ((const BENCH_ENTRY_T *)tRight.pvAddr)->iKey;
+    return tResult;
+}
+
+static BENCH_ENTRY_T gtQueueBuffer[BENCH_QUEUE_CAPACITY];
+static BENCH_ENTRY_T gtMapBuffer[BENCH_MAP_CAPACITY];
+
+typedef JUNO_STATUS_T (*BENCH_QUEUE_INIT_T)(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_DS_ARRAY_ROOT_T *ptQueueArray, JUNO_FAILURE_HANDLER_T pfcnFailureHdlr, JUNO_USER_DATA_T *pvFailureUserData);
+typedef JUNO_STATUS_T (*BENCH_MAP_INIT_T)(JUNO_MAP_ROOT_T *ptMapRoot, const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi, const JUNO_VALUE_POINTER_API_T *ptValuePointerApi, JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_FAILURE_HANDLER_T pfcnFailureHandler, JUNO_USER_DATA_T *pvUserData);
+
+/// Fill and drain the queue, one op is an Enqueue/Dequeue pair
+static JUNO_STATUS_T RunQueue(const char *pcName, BENCH_QUEUE_INIT_T pfcnInit)
+{
+    BENCH_ARRAY_T tArray = {0};
+    tArray.ptBuffer = gtQueueBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&tArray.tRoot, &gtBenchArrayApi, BENCH_QUEUE_CAPACITY, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_QUEUE_ROOT_T tQueue = {0};
+    tStatus = pfcnInit(&tQueue, &tArray.tRoot, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    BENCH_ENTRY_T tItem = {0};
+    BENCH_ENTRY_T tOut = {0};
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t iRound = 0; iRound < BENCH_ROUNDS * 10; iRound++)
+    {
+        // Push less than the capacity so the indices keep wrapping
+        for(size_t i = 0; i < BENCH_QUEUE_CAPACITY - 3; i++)
+        {
+            tItem.iKey = (uint32_t)i;
+            tStatus = tQueue.ptApi->Enqueue(&tQueue, BenchEntry_PointerInit(&tItem));
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        }
+        for(size_t i = 0; i < BENCH_QUEUE_CAPACITY - 3; i++)
+        {
+            tStatus = tQueue.ptApi->Dequeue(&tQueue, BenchEntry_PointerInit(&tOut));
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+            giJunoBenchSink += tOut.iKey;
+        }
+    }
+    JunoBench_Report(pcName, BENCH_QUEUE_CAPACITY, JunoBench_NowNs() - iStart, (uint64_t)BENCH_ROUNDS * 10 * (BENCH_QUEUE_CAPACITY - 3));
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Insert BENCH_MAP_KEYS keys (75% load), then time lookups of every key
+static JUNO_STATUS_T RunMap(const char *pcName, BENCH_MAP_INIT_T pfcnInit)
+{
+    for(size_t i = 0; i < BENCH_MAP_CAPACITY; i++)
+    {
+        gtMapBuffer[i] = (BENCH_ENTRY_T){0};
+    }
+    BENCH_ARRAY_T tArray = {0};
+    tArray.ptBuffer = gtMapBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&tArray.tRoot, &gtBenchArrayApi, BENCH_MAP_CAPACITY, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_ROOT_T tMap = {0};
+    tStatus = pfcnInit(&tMap, &gtBenchHashableApi, &gtBenchValueApi, &tArray.tRoot, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(uint32_t i = 0; i < BENCH_MAP_KEYS; i++)
+    {
+        BENCH_ENTRY_T tEntry = {i, i, true};
+        tStatus = tMap.ptApi->Set(&tMap, BenchEntry_PointerInit(&tEntry));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t iRound = 0; iRound < BENCH_ROUNDS; iRound++)
+    {
+        for(uint32_t i = 0; i < BENCH_MAP_KEYS; i++)
+        {
+            BENCH_ENTRY_T tKey = {i, 0, true};
+            JUNO_RESULT_POINTER_T tResult = tMap.ptApi->Get(&tMap, BenchEntry_PointerInit(&tKey));
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult.tStatus);
+            giJunoBenchSink += ((const BENCH_ENTRY_T *)tResult.tOk.pvAddr)->iValue;
+        }
+    }
+    JunoBench_Report(pcName, BENCH_MAP_CAPACITY, JunoBench_NowNs() - iStart, (uint64_t)BENCH_ROUNDS * BENCH_MAP_KEYS);
+    JUNO_MAP_STATS_RESULT_T tStats = JunoDs_MapStats(&tMap);
+    JUNO_ASSERT_OK(tStats, return tStats.tStatus);
+    printf("%-32s %8s %.2f probes/lookup\n", "", "", 1.0 + (double)tStats.tOk.zTotalProbe / (double)tStats.tOk.zOccupied);
+    return JUNO_STATUS_SUCCESS;
+}
+
+int main(void)
+{
+    printf("%-32s %8s\n", "benchmark", "capacity");
+    JUNO_STATUS_T tStatus = RunQueue("queue_modulo", JunoDs_QueueInit);
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    tStatus = RunQueue("queue_mask", JunoDs_QueueInitPow2);
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    tStatus = RunMap("map_get_modulo", JunoDs_MapInit);
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    tStatus = RunMap("map_get_mask", JunoDs_MapInitPow2);
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    return 0;
+}
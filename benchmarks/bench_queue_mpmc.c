@@ -0,0 +1,285 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_queue_mpmc.c
+ * @brief Multi-producer/multi-consumer scaling of the MPMC queue versus a
+ *        mutex-guarded JunoDs_QueueInit queue.
+ * @details
+ *  P producer threads split a fixed number of items; C consumer threads
+ *  drain them. Threads yield while the queue is full or empty. The reported
+ *  parameter is P * 100 + C.
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/ds/queue_mpmc.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_CAPACITY 1024
+#define BENCH_ITEMS 960000
+#define BENCH_MAX_THREADS 16
+
+typedef struct BENCH_MSG_TAG
+{
+    uint64_t iSeq;
+    uint64_t iPayload;
+} BENCH_MSG_T;
+
+typedef struct BENCH_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    BENCH_MSG_T atBuffer[BENCH_CAPACITY];
+} BENCH_ARRAY_T;
+
+/// A JunoDs_QueueInit queue with every operation guarded by a mutex
+typedef struct BENCH_MTX_QUEUE_TAG
+{
+    JUNO_DS_QUEUE_ROOT_T tRoot;
+    pthread_mutex_t tMtx;
+} BENCH_MTX_QUEUE_T;
+
+/// Work split for one producer thread
+typedef struct BENCH_PRODUCER_TAG
+{
+    uint64_t iFirst;
+    uint64_t iCount;
+} BENCH_PRODUCER_T;
+
+static JUNO_STATUS_T BenchMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T BenchMsg_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchMtx_Enqueue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T BenchMtx_Dequeue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn);
+static JUNO_RESULT_POINTER_T BenchMtx_Peek(JUNO_DS_QUEUE_ROOT_T *ptQueue);
+
+static const JUNO_POINTER_API_T gtBenchMsgPointerApi = {
+    BenchMsg_Copy,
+    BenchMsg_Reset
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchArrayApi = {
+    BenchArray_SetAt,
+    BenchArray_GetAt,
+    BenchArray_RemoveAt
+};
+
+static const JUNO_DS_QUEUE_API_T gtBenchMtxQueueApi = {
+    BenchMtx_Enqueue,
+    BenchMtx_Dequeue,
+    BenchMtx_Peek
+};
+
+#define BenchMsg_PointerInit(addr) JunoMemory_PointerInit(&gtBenchMsgPointerApi, BENCH_MSG_T, addr)
+#define BenchMsg_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, BENCH_MSG_T, gtBenchMsgPointerApi)
+
+static JUNO_STATUS_T BenchMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = BenchMsg_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = BenchMsg_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(BENCH_MSG_T *)tDest.pvAddr = *(BENCH_MSG_T *)tSrc.pvAddr;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T BenchMsg_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = BenchMsg_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(BENCH_MSG_T *)tPointer.pvAddr = (BENCH_MSG_T){0};
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    return BenchMsg_Copy(BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    tResult.tOk = BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    return BenchMsg_Reset(BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]));
+}
+
+static JUNO_STATUS_T BenchMtx_Enqueue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem)
+{
+    BENCH_MTX_QUEUE_T *ptMtxQueue = (BENCH_MTX_QUEUE_T *)ptQueue;
+    pthread_mutex_lock(&ptMtxQueue->tMtx);
+    JUNO_STATUS_T tStatus = JunoDs_QueuePush(ptQueue, tItem);
+    pthread_mutex_unlock(&ptMtxQueue->tMtx);
+    return tStatus;
+}
+
+static JUNO_STATUS_T BenchMtx_Dequeue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn)
+{
+    BENCH_MTX_QUEUE_T *ptMtxQueue = (BENCH_MTX_QUEUE_T *)ptQueue;
+    pthread_mutex_lock(&ptMtxQueue->tMtx);
+    JUNO_STATUS_T tStatus = JunoDs_QueuePop(ptQueue, tReturn);
+    pthread_mutex_unlock(&ptMtxQueue->tMtx);
+    return tStatus;
+}
+
+static JUNO_RESULT_POINTER_T BenchMtx_Peek(JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    BENCH_MTX_QUEUE_T *ptMtxQueue = (BENCH_MTX_QUEUE_T *)ptQueue;
+    pthread_mutex_lock(&ptMtxQueue->tMtx);
+    JUNO_RESULT_POINTER_T tResult = JunoDs_QueuePeek(ptQueue);
+    pthread_mutex_unlock(&ptMtxQueue->tMtx);
+    return tResult;
+}
+static BENCH_ARRAY_T gtArray;
+static JUNO_DS_MPMC_RING_T gtRing;
+static atomic_size_t gazSequences[BENCH_CAPACITY];
+static JUNO_DS_QUEUE_ROOT_T gtMpmcQueue;
+static BENCH_MTX_QUEUE_T gtMtxQueue;
+static JUNO_DS_QUEUE_ROOT_T *gptQueue;
+static atomic_uint_fast64_t giConsumed;
+static atomic_uint_fast64_t giChecksum;
+
+static void *Producer(void *pvArg)
+{
+    const BENCH_PRODUCER_T *ptWork = (const BENCH_PRODUCER_T *)pvArg;
+    BENCH_MSG_T tMsg = {0};
+    for(uint64_t i = 0; i < ptWork->iCount; i++)
+    {
+        tMsg.iSeq = ptWork->iFirst + i;
+        while(gptQueue->ptApi->Enqueue(gptQueue, BenchMsg_PointerInit(&tMsg)) != JUNO_STATUS_SUCCESS)
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void *Consumer(void *pvArg)
+{
+    (void)pvArg;
+    BENCH_MSG_T tMsg = {0};
+    uint64_t iSum = 0;
+    while(atomic_load_explicit(&giConsumed, memory_order_relaxed) < BENCH_ITEMS)
+    {
+        if(gptQueue->ptApi->Dequeue(gptQueue, BenchMsg_PointerInit(&tMsg)) == JUNO_STATUS_SUCCESS)
+        {
+            iSum += tMsg.iSeq;
+            atomic_fetch_add_explicit(&giConsumed, 1, memory_order_relaxed);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    atomic_fetch_add(&giChecksum, iSum);
+    return NULL;
+}
+
+static int Run(const char *pcName, int bMpmc, size_t zProducers, size_t zConsumers)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&gtArray.tRoot, &gtBenchArrayApi, BENCH_CAPACITY, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    if(bMpmc)
+    {
+        tStatus = JunoDs_QueueMpmcInit(&gtMpmcQueue, &gtRing, &gtArray.tRoot, gazSequences, 0, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        gptQueue = &gtMpmcQueue;
+    }
+    else
+    {
+        tStatus = JunoDs_QueueInit(&gtMtxQueue.tRoot, &gtArray.tRoot, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        gtMtxQueue.tRoot.ptApi = &gtBenchMtxQueueApi;
+        pthread_mutex_init(&gtMtxQueue.tMtx, NULL);
+        gptQueue = &gtMtxQueue.tRoot;
+    }
+    atomic_store(&giConsumed, 0);
+    atomic_store(&giChecksum, 0);
+    BENCH_PRODUCER_T atWork[BENCH_MAX_THREADS];
+    pthread_t atProducers[BENCH_MAX_THREADS];
+    pthread_t atConsumers[BENCH_MAX_THREADS];
+    uint64_t iPerProducer = BENCH_ITEMS / zProducers;
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t i = 0; i < zConsumers; i++)
+    {
+        pthread_create(&atConsumers[i], NULL, Consumer, NULL);
+    }
+    for(size_t i = 0; i < zProducers; i++)
+    {
+        atWork[i].iFirst = i * iPerProducer;
+        atWork[i].iCount = iPerProducer;
+        pthread_create(&atProducers[i], NULL, Producer, &atWork[i]);
+    }
+    for(size_t i = 0; i < zProducers; i++)
+    {
+        pthread_join(atProducers[i], NULL);
+    }
+    for(size_t i = 0; i < zConsumers; i++)
+    {
+        pthread_join(atConsumers[i], NULL);
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    uint64_t iExpected = (uint64_t)BENCH_ITEMS * (BENCH_ITEMS - 1) / 2;
+    if(atomic_load(&giChecksum) != iExpected)
+    {
+        printf("%s: checksum mismatch\n", pcName);
+        return 1;
+    }
+    JunoBench_Report(pcName, zProducers * 100 + zConsumers, iElapsed, BENCH_ITEMS);
+    return 0;
+}
+
+int main(void)
+{
+    static const size_t azThreads[] = {1, 2, 4, 8, 16};
+    printf("%-32s %8s\n", "benchmark", "P*100+C");
+    int iErr = 0;
+    for(size_t i = 0; i < sizeof(azThreads) / sizeof(azThreads[0]); i++)
+    {
+        size_t zThreads = azThreads[i];
+        iErr |= Run("queue_mutex_mpmc", 0, zThreads, zThreads);
+        iErr |= Run("queue_mpmc", 1, zThreads, zThreads);
+        if(zThreads > 1)
+        {
+            // Worker threads feeding a single consumer pipe
+            iErr |= Run("queue_mutex_mpsc", 0, zThreads, 1);
+            iErr |= Run("queue_mpmc_mpsc", 1, zThreads, 1);
+        }
+    }
+    return iErr;
+}
@@ -0,0 +1,290 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_queue_spsc.c
+ * @brief Cross-thread throughput and latency of the SPSC queue versus a
+ *        mutex-guarded JunoDs_QueueInit queue.
+ * @details
+ *  Throughput: one producer thread streams items to one consumer thread,
+ *  both yielding while the queue is full or empty.
+ *  Latency: two queues form a ping-pong; the reported figure is one round
+ *  trip (two hand-offs).
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/ds/queue_spsc.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_CAPACITY 1024
+#define BENCH_ITEMS 2000000
+#define BENCH_ROUND_TRIPS 200000
+
+typedef struct BENCH_MSG_TAG
+{
+    uint64_t iSeq;
+    uint64_t iPayload;
+} BENCH_MSG_T;
+
+typedef struct BENCH_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    BENCH_MSG_T atBuffer[BENCH_CAPACITY];
+} BENCH_ARRAY_T;
+
+/// A JunoDs_QueueInit queue with every operation guarded by a mutex
+typedef struct BENCH_MTX_QUEUE_TAG
+{
+    JUNO_DS_QUEUE_ROOT_T tRoot;
+    pthread_mutex_t tMtx;
+} BENCH_MTX_QUEUE_T;
+
+/// One queue under test plus its storage
+typedef struct BENCH_CHANNEL_TAG
+{
+    JUNO_DS_QUEUE_ROOT_T *ptQueue;
+    BENCH_ARRAY_T tArray;
+    JUNO_DS_SPSC_RING_T tRing;
+    JUNO_DS_QUEUE_ROOT_T tSpsc;
+    BENCH_MTX_QUEUE_T tMtxQueue;
+} BENCH_CHANNEL_T;
+
+static JUNO_STATUS_T BenchMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T BenchMsg_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchMtx_Enqueue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T BenchMtx_Dequeue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn);
+static JUNO_RESULT_POINTER_T BenchMtx_Peek(JUNO_DS_QUEUE_ROOT_T *ptQueue);
+
+static const JUNO_POINTER_API_T gtBenchMsgPointerApi = {
+    BenchMsg_Copy,
+    BenchMsg_Reset
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchArrayApi = {
+    BenchArray_SetAt,
+    BenchArray_GetAt,
+    BenchArray_RemoveAt
+};
+
+static const JUNO_DS_QUEUE_API_T gtBenchMtxQueueApi = {
+    BenchMtx_Enqueue,
+    BenchMtx_Dequeue,
+    BenchMtx_Peek
+};
+
+#define BenchMsg_PointerInit(addr) JunoMemory_PointerInit(&gtBenchMsgPointerApi, BENCH_MSG_T, addr)
+#define BenchMsg_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, BENCH_MSG_T, gtBenchMsgPointerApi)
+
+static JUNO_STATUS_T BenchMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = BenchMsg_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = BenchMsg_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(BENCH_MSG_T *)tDest.pvAddr = *(BENCH_MSG_T *)tSrc.pvAddr;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T BenchMsg_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = BenchMsg_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(BENCH_MSG_T *)tPointer.pvAddr = (BENCH_MSG_T){0};
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    return BenchMsg_Copy(BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    tResult.tOk = BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    return BenchMsg_Reset(BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]));
+}
+
+static JUNO_STATUS_T BenchMtx_Enqueue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem)
+{
+    BENCH_MTX_QUEUE_T *ptMtxQueue = (BENCH_MTX_QUEUE_T *)ptQueue;
+    pthread_mutex_lock(&ptMtxQueue->tMtx);
+    JUNO_STATUS_T tStatus = JunoDs_QueuePush(ptQueue, tItem);
+    pthread_mutex_unlock(&ptMtxQueue->tMtx);
+    return tStatus;
+}
+
+static JUNO_STATUS_T BenchMtx_Dequeue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn)
+{
+    BENCH_MTX_QUEUE_T *ptMtxQueue = (BENCH_MTX_QUEUE_T *)ptQueue;
+    pthread_mutex_lock(&ptMtxQueue->tMtx);
+    JUNO_STATUS_T tStatus = JunoDs_QueuePop(ptQueue, tReturn);
+    pthread_mutex_unlock(&ptMtxQueue->tMtx);
+    return tStatus;
+}
+
+static JUNO_RESULT_POINTER_T BenchMtx_Peek(JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    BENCH_MTX_QUEUE_T *ptMtxQueue = (BENCH_MTX_QUEUE_T *)ptQueue;
+    pthread_mutex_lock(&ptMtxQueue->tMtx);
+    JUNO_RESULT_POINTER_T tResult = JunoDs_QueuePeek(ptQueue);
+    pthread_mutex_unlock(&ptMtxQueue->tMtx);
+    return tResult;
+}
+
+static BENCH_CHANNEL_T gtForward;
+static BENCH_CHANNEL_T gtBackward;
+
+static JUNO_STATUS_T ChannelInit(BENCH_CHANNEL_T *ptChannel, int bSpsc)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&ptChannel->tArray.tRoot, &gtBenchArrayApi, BENCH_CAPACITY, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(bSpsc)
+    {
+        ptChannel->ptQueue = &ptChannel->tSpsc;
+        return JunoDs_QueueSpscInit(&ptChannel->tSpsc, &ptChannel->tRing, &ptChannel->tArray.tRoot, NULL, NULL);
+    }
+    ptChannel->ptQueue = &ptChannel->tMtxQueue.tRoot;
+    tStatus = JunoDs_QueueInit(&ptChannel->tMtxQueue.tRoot, &ptChannel->tArray.tRoot, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptChannel->tMtxQueue.tRoot.ptApi = &gtBenchMtxQueueApi;
+    pthread_mutex_init(&ptChannel->tMtxQueue.tMtx, NULL);
+    return tStatus;
+}
+
+static void ChannelSend(BENCH_CHANNEL_T *ptChannel, BENCH_MSG_T *ptMsg)
+{
+    JUNO_DS_QUEUE_ROOT_T *ptQueue = ptChannel->ptQueue;
+    while(ptQueue->ptApi->Enqueue(ptQueue, BenchMsg_PointerInit(ptMsg)) != JUNO_STATUS_SUCCESS)
+    {
+        // Let the consumer run on machines with fewer cores than threads
+        sched_yield();
+    }
+}
+
+static void ChannelRecv(BENCH_CHANNEL_T *ptChannel, BENCH_MSG_T *ptMsg)
+{
+    JUNO_DS_QUEUE_ROOT_T *ptQueue = ptChannel->ptQueue;
+    while(ptQueue->ptApi->Dequeue(ptQueue, BenchMsg_PointerInit(ptMsg)) != JUNO_STATUS_SUCCESS)
+    {
+        sched_yield();
+    }
+}
+
+static void *StreamProducer(void *pvArg)
+{
+    (void)pvArg;
+    BENCH_MSG_T tMsg = {0};
+    for(uint64_t i = 0; i < BENCH_ITEMS; i++)
+    {
+        tMsg.iSeq = i;
+        ChannelSend(&gtForward, &tMsg);
+    }
+    return NULL;
+}
+
+static void *PongThread(void *pvArg)
+{
+    (void)pvArg;
+    BENCH_MSG_T tMsg = {0};
+    for(uint64_t i = 0; i < BENCH_ROUND_TRIPS; i++)
+    {
+        ChannelRecv(&gtForward, &tMsg);
+        ChannelSend(&gtBackward, &tMsg);
+    }
+    return NULL;
+}
+
+static int RunThroughput(const char *pcName, int bSpsc)
+{
+    if(ChannelInit(&gtForward, bSpsc) != JUNO_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+    pthread_t tProducer;
+    uint64_t iStart = JunoBench_NowNs();
+    pthread_create(&tProducer, NULL, StreamProducer, NULL);
+    BENCH_MSG_T tMsg = {0};
+    for(uint64_t i = 0; i < BENCH_ITEMS; i++)
+    {
+        ChannelRecv(&gtForward, &tMsg);
+        if(tMsg.iSeq != i)
+        {
+            printf("%s: out of order item %llu\n", pcName, (unsigned long long)tMsg.iSeq);
+            return 1;
+        }
+    }
+    pthread_join(tProducer, NULL);
+    JunoBench_Report(pcName, BENCH_CAPACITY, JunoBench_NowNs() - iStart, BENCH_ITEMS);
+    return 0;
+}
+
+static int RunLatency(const char *pcName, int bSpsc)
+{
+    if(ChannelInit(&gtForward, bSpsc) != JUNO_STATUS_SUCCESS || ChannelInit(&gtBackward, bSpsc) != JUNO_STATUS_SUCCESS)
+    {
+        return 1;
+    }
+    pthread_t tPong;
+    pthread_create(&tPong, NULL, PongThread, NULL);
+    BENCH_MSG_T tMsg = {0};
+    uint64_t iStart = JunoBench_NowNs();
+    for(uint64_t i = 0; i < BENCH_ROUND_TRIPS; i++)
+    {
+        tMsg.iSeq = i;
+        ChannelSend(&gtForward, &tMsg);
+        ChannelRecv(&gtBackward, &tMsg);
+        giJunoBenchSink += tMsg.iSeq;
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    pthread_join(tPong, NULL);
+    JunoBench_Report(pcName, BENCH_CAPACITY, iElapsed, BENCH_ROUND_TRIPS);
+    return 0;
+}
+
+int main(void)
+{
+    printf("%-32s %8s\n", "benchmark", "capacity");
+    int iErr = RunThroughput("queue_mutex_throughput", 0);
+    iErr |= RunThroughput("queue_spsc_throughput", 1);
+    iErr |= RunLatency("queue_mutex_round_trip", 0);
+    iErr |= RunLatency("queue_spsc_round_trip", 1);
+    return iErr;
+}
@@ -0,0 +1,212 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_queue_trivial.c
+ * @brief Queue Push/Pop with user-written Copy/Reset versus the trivial fast path.
+ * @details
+ *  The same queue and backing array are driven with two pointer APIs per
+ *  element size: one with hand-written, type-verifying Copy/Reset called
+ *  through the API, and one using JunoMemory_PointerCopyTrivial and
+ *  JunoMemory_PointerResetTrivial, which the containers copy inline.
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_CAPACITY 64
+#define BENCH_ROUNDS 20000
+
+typedef struct BENCH_ELEM16_TAG
+{
+    uint32_t aiWords[4];
+} BENCH_ELEM16_T;
+
+typedef struct BENCH_ELEM256_TAG
+{
+    uint32_t aiWords[64];
+} BENCH_ELEM256_T;
+
+/// Byte array of elements described by a pointer API, size and alignment
+typedef struct BENCH_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    const JUNO_POINTER_API_T *ptElemApi;
+    size_t zElemSize;
+    size_t zElemAlignment;
+    uint8_t *piBuffer;
+} BENCH_ARRAY_T;
+
+static JUNO_STATUS_T BenchElem16_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T BenchElem16_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T BenchElem256_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T BenchElem256_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+static const JUNO_POINTER_API_T gtBenchElem16Api = {
+    BenchElem16_Copy,
+    BenchElem16_Reset
+};
+
+static const JUNO_POINTER_API_T gtBenchElem256Api = {
+    BenchElem256_Copy,
+    BenchElem256_Reset
+};
+
+static const JUNO_POINTER_API_T gtBenchElem16TrivialApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_POINTER_API_T gtBenchElem256TrivialApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchArrayApi = {
+    BenchArray_SetAt,
+    BenchArray_GetAt,
+    BenchArray_RemoveAt
+};
+
+static JUNO_STATUS_T BenchElem16_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_ASSERT_POINTER_TYPE(tStatus, tDest, BENCH_ELEM16_T, gtBenchElem16Api);
+    JUNO_ASSERT_POINTER_TYPE(tStatus, tSrc, BENCH_ELEM16_T, gtBenchElem16Api);
+    *(BENCH_ELEM16_T *)tDest.pvAddr = *(const BENCH_ELEM16_T *)tSrc.pvAddr;
+    return tStatus;
+}
+
+static JUNO_STATUS_T BenchElem16_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_ASSERT_POINTER_TYPE(tStatus, tPointer, BENCH_ELEM16_T, gtBenchElem16Api);
+    *(BENCH_ELEM16_T *)tPointer.pvAddr = (BENCH_ELEM16_T){0};
+    return tStatus;
+}
+
+static JUNO_STATUS_T BenchElem256_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_ASSERT_POINTER_TYPE(tStatus, tDest, BENCH_ELEM256_T, gtBenchElem256Api);
+    JUNO_ASSERT_POINTER_TYPE(tStatus, tSrc, BENCH_ELEM256_T, gtBenchElem256Api);
+    *(BENCH_ELEM256_T *)tDest.pvAddr = *(const BENCH_ELEM256_T *)tSrc.pvAddr;
+    return tStatus;
+}
+
+static JUNO_STATUS_T BenchElem256_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_ASSERT_POINTER_TYPE(tStatus, tPointer, BENCH_ELEM256_T, gtBenchElem256Api);
+    *(BENCH_ELEM256_T *)tPointer.pvAddr = (BENCH_ELEM256_T){0};
+    return tStatus;
+}
+
+static inline JUNO_POINTER_T BenchArray_Slot(const BENCH_ARRAY_T *ptBenchArray, size_t iIndex)
+{
+    return (JUNO_POINTER_T){
+        ptBenchArray->ptElemApi,
+        &ptBenchArray->piBuffer[iIndex * ptBenchArray->zElemSize],
+        ptBenchArray->zElemSize,
+        ptBenchArray->zElemAlignment
+    };
+}
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerCopy(BenchArray_Slot((BENCH_ARRAY_T *)ptArray, iIndex), tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk = BenchArray_Slot((BENCH_ARRAY_T *)ptArray, iIndex);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerReset(BenchArray_Slot((BENCH_ARRAY_T *)ptArray, iIndex));
+}
+
+static alignas(BENCH_ELEM256_T) uint8_t giBuffer[BENCH_CAPACITY * sizeof(BENCH_ELEM256_T)];
+static alignas(BENCH_ELEM256_T) uint8_t giItem[sizeof(BENCH_ELEM256_T)];
+static alignas(BENCH_ELEM256_T) uint8_t giOut[sizeof(BENCH_ELEM256_T)];
+
+/// Fill and drain the queue BENCH_ROUNDS times, one op is a Push/Pop pair
+static JUNO_STATUS_T RunQueue(const char *pcName, const JUNO_POINTER_API_T *ptElemApi, size_t zSize, size_t zAlignment)
+{
+    BENCH_ARRAY_T tArray = {0};
+    tArray.ptElemApi = ptElemApi;
+    tArray.zElemSize = zSize;
+    tArray.zElemAlignment = zAlignment;
+    tArray.piBuffer = giBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&tArray.tRoot, &gtBenchArrayApi, BENCH_CAPACITY, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_QUEUE_ROOT_T tQueue = {0};
+    tStatus = JunoDs_QueueInit(&tQueue, &tArray.tRoot, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_POINTER_T tItem = {ptElemApi, giItem, zSize, zAlignment};
+    JUNO_POINTER_T tOut = {ptElemApi, giOut, zSize, zAlignment};
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t iRound = 0; iRound < BENCH_ROUNDS; iRound++)
+    {
+        for(size_t i = 0; i < BENCH_CAPACITY; i++)
+        {
+            giItem[0] = (uint8_t)i;
+            tStatus = JunoDs_QueuePush(&tQueue, tItem);
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        }
+        for(size_t i = 0; i < BENCH_CAPACITY; i++)
+        {
+            tStatus = JunoDs_QueuePop(&tQueue, tOut);
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+            giJunoBenchSink += giOut[0];
+        }
+    }
+    JunoBench_Report(pcName, zSize, JunoBench_NowNs() - iStart, (uint64_t)BENCH_ROUNDS * BENCH_CAPACITY);
+    return JUNO_STATUS_SUCCESS;
+}
+
+int main(void)
+{
+    printf("%-32s %8s\n", "benchmark", "bytes");
+    JUNO_STATUS_T tStatus = RunQueue("queue_push_pop_vtable", &gtBenchElem16Api, sizeof(BENCH_ELEM16_T), alignof(BENCH_ELEM16_T));
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    tStatus = RunQueue("queue_push_pop_trivial", &gtBenchElem16TrivialApi, sizeof(BENCH_ELEM16_T), alignof(BENCH_ELEM16_T));
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    tStatus = RunQueue("queue_push_pop_vtable", &gtBenchElem256Api, sizeof(BENCH_ELEM256_T), alignof(BENCH_ELEM256_T));
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    tStatus = RunQueue("queue_push_pop_trivial", &gtBenchElem256TrivialApi, sizeof(BENCH_ELEM256_T), alignof(BENCH_ELEM256_T));
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    return 0;
+}
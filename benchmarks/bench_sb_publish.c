@@ -0,0 +1,223 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_sb_publish.c
+ * @brief Publish latency of the linear broker versus the topic-indexed broker.
+ * @details
+ *  Every pipe subscribes to its own MID. Each round publishes once to every
+ *  MID (timed), then drains all pipes (untimed). The batch variants publish
+ *  the whole round with a single PublishBatch call.
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/sb/broker_api.h"
+#include "juno/sb/broker_indexed.h"
+#include "juno/status.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define BENCH_MAX_PIPES 512
+#define BENCH_PIPE_CAPACITY 1
+#define BENCH_ROUNDS 2000
+
+typedef struct BENCH_MSG_TAG
+{
+    uint32_t iPayload;
+} BENCH_MSG_T;
+
+typedef struct BENCH_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    BENCH_MSG_T atBuffer[BENCH_PIPE_CAPACITY];
+} BENCH_ARRAY_T;
+
+static JUNO_STATUS_T BenchMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T BenchMsg_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+static const JUNO_POINTER_API_T gtBenchMsgPointerApi = {
+    BenchMsg_Copy,
+    BenchMsg_Reset
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchArrayApi = {
+    BenchArray_SetAt,
+    BenchArray_GetAt,
+    BenchArray_RemoveAt
+};
+
+#define BenchMsg_PointerInit(addr) JunoMemory_PointerInit(&gtBenchMsgPointerApi, BENCH_MSG_T, addr)
+#define BenchMsg_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, BENCH_MSG_T, gtBenchMsgPointerApi)
+
+static JUNO_STATUS_T BenchMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = BenchMsg_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = BenchMsg_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(BENCH_MSG_T *)tDest.pvAddr = *(BENCH_MSG_T *)tSrc.pvAddr;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T BenchMsg_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = BenchMsg_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(BENCH_MSG_T *)tPointer.pvAddr = (BENCH_MSG_T){0};
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    JUNO_POINTER_T tDest = BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]);
+    return BenchMsg_Copy(tDest, tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    tResult.tOk = BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    return BenchMsg_Reset(BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]));
+}
+
+static BENCH_ARRAY_T gtPipeArrays[BENCH_MAX_PIPES];
+static JUNO_SB_PIPE_T gtPipes[BENCH_MAX_PIPES];
+static JUNO_SB_PIPE_T *gptPipeRegistry[BENCH_MAX_PIPES];
+static JUNO_SB_TOPIC_T gtTopicTable[BENCH_MAX_PIPES];
+static BENCH_MSG_T gtBatchMsgs[BENCH_MAX_PIPES];
+static JUNO_SB_PUBLISH_ENTRY_T gtBatchEntries[BENCH_MAX_PIPES];
+
+static JUNO_STATUS_T RegisterPipes(JUNO_SB_BROKER_ROOT_T *ptBroker, size_t zPipes)
+{
+    for(size_t i = 0; i < zPipes; i++)
+    {
+        JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&gtPipeArrays[i].tRoot, &gtBenchArrayApi, BENCH_PIPE_CAPACITY, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = JunoSb_PipeInit(&gtPipes[i], (JUNO_SB_MID_T)i, &gtPipeArrays[i].tRoot, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = ptBroker->ptApi->RegisterSubscriber(ptBroker, &gtPipes[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T DrainPipes(size_t zPipes)
+{
+    BENCH_MSG_T tOut = {0};
+    JUNO_POINTER_T tOutPtr = BenchMsg_PointerInit(&tOut);
+    for(size_t i = 0; i < zPipes; i++)
+    {
+        JUNO_STATUS_T tStatus = JunoDs_QueuePop(&gtPipes[i].tRoot, tOutPtr);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        giJunoBenchSink += tOut.iPayload;
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T RunPublish(const char *pcName, JUNO_SB_BROKER_ROOT_T *ptBroker, size_t zPipes)
+{
+    BENCH_MSG_T tMsg = {0};
+    JUNO_POINTER_T tMsgPtr = BenchMsg_PointerInit(&tMsg);
+    uint64_t iElapsed = 0;
+    for(size_t iRound = 0; iRound < BENCH_ROUNDS; iRound++)
+    {
+        uint64_t iStart = JunoBench_NowNs();
+        for(size_t i = 0; i < zPipes; i++)
+        {
+            tMsg.iPayload = (uint32_t)i;
+            JUNO_STATUS_T tStatus = ptBroker->ptApi->Publish(ptBroker, (JUNO_SB_MID_T)i, tMsgPtr);
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        }
+        iElapsed += JunoBench_NowNs() - iStart;
+        JUNO_STATUS_T tStatus = DrainPipes(zPipes);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    JunoBench_Report(pcName, zPipes, iElapsed, (uint64_t)BENCH_ROUNDS * zPipes);
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T RunPublishBatch(const char *pcName, JUNO_SB_BROKER_ROOT_T *ptBroker, size_t zPipes)
+{
+    for(size_t i = 0; i < zPipes; i++)
+    {
+        gtBatchMsgs[i].iPayload = (uint32_t)i;
+        gtBatchEntries[i].tMid = (JUNO_SB_MID_T)i;
+        gtBatchEntries[i].tMsg = BenchMsg_PointerInit(&gtBatchMsgs[i]);
+    }
+    uint64_t iElapsed = 0;
+    for(size_t iRound = 0; iRound < BENCH_ROUNDS; iRound++)
+    {
+        uint64_t iStart = JunoBench_NowNs();
+        JUNO_RESULT_SIZE_T tResult = ptBroker->ptApi->PublishBatch(ptBroker, gtBatchEntries, zPipes);
+        iElapsed += JunoBench_NowNs() - iStart;
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult.tStatus);
+        JUNO_STATUS_T tStatus = DrainPipes(zPipes);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    JunoBench_Report(pcName, zPipes, iElapsed, (uint64_t)BENCH_ROUNDS * zPipes);
+    return JUNO_STATUS_SUCCESS;
+}
+
+int main(void)
+{
+    static const size_t azPipeCounts[] = {8, 64, 512};
+    printf("%-32s %8s\n", "benchmark", "pipes");
+    for(size_t i = 0; i < sizeof(azPipeCounts) / sizeof(azPipeCounts[0]); i++)
+    {
+        size_t zPipes = azPipeCounts[i];
+        JUNO_SB_BROKER_ROOT_T tLinear = {0};
+        JUNO_STATUS_T tStatus = JunoSb_BrokerInit(&tLinear, gptPipeRegistry, zPipes, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RegisterPipes(&tLinear, zPipes);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunPublish("sb_publish_linear", &tLinear, zPipes);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunPublishBatch("sb_publish_batch_linear", &tLinear, zPipes);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+
+        JUNO_SB_BROKER_INDEXED_T tIndexed = {0};
+        tStatus = JunoSb_BrokerIndexedInit(&tIndexed, gptPipeRegistry, zPipes, gtTopicTable, zPipes, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RegisterPipes(&tIndexed.tRoot, zPipes);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunPublish("sb_publish_indexed", &tIndexed.tRoot, zPipes);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunPublishBatch("sb_publish_batch_indexed", &tIndexed.tRoot, zPipes);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    }
+    return 0;
+}
@@ -0,0 +1,221 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_sb_publish_ref.c
+ * @brief Copy publish versus reference-counted publish of a large message.
+ * @details
+ *  A 1 KB message is fanned out to a set of subscribers on one MID. Each
+ *  round publishes once and drains every pipe; both are timed, since the
+ *  reference-counted path defers the release work to the subscribers.
+ */
+#include "juno_bench.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/memory/memory_block.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/sb/broker_api.h"
+#include "juno/sb/msg_ref.h"
+#include "juno/status.h"
+#include <stdalign.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define BENCH_MAX_PIPES 16
+#define BENCH_POOL_LENGTH 4
+#define BENCH_ROUNDS 20000
+#define BENCH_MID 1
+
+typedef struct BENCH_MSG_TAG
+{
+    uint32_t iSeq;
+    uint8_t aiPayload[1020];
+} BENCH_MSG_T;
+
+typedef struct BENCH_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    BENCH_MSG_T atBuffer[1];
+} BENCH_ARRAY_T;
+
+static JUNO_STATUS_T BenchMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T BenchMsg_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+static const JUNO_POINTER_API_T gtBenchMsgPointerApi = {
+    BenchMsg_Copy,
+    BenchMsg_Reset
+};
+
+static const JUNO_DS_ARRAY_API_T gtBenchArrayApi = {
+    BenchArray_SetAt,
+    BenchArray_GetAt,
+    BenchArray_RemoveAt
+};
+
+#define BenchMsg_PointerInit(addr) JunoMemory_PointerInit(&gtBenchMsgPointerApi, BENCH_MSG_T, addr)
+#define BenchMsg_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, BENCH_MSG_T, gtBenchMsgPointerApi)
+
+static JUNO_STATUS_T BenchMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = BenchMsg_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = BenchMsg_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(BENCH_MSG_T *)tDest.pvAddr = *(BENCH_MSG_T *)tSrc.pvAddr;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T BenchMsg_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = BenchMsg_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(BENCH_MSG_T *)tPointer.pvAddr = (BENCH_MSG_T){0};
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T BenchArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    JUNO_POINTER_T tDest = BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]);
+    return BenchMsg_Copy(tDest, tItem);
+}
+
+static JUNO_RESULT_POINTER_T BenchArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    tResult.tOk = BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    BENCH_ARRAY_T *ptBenchArray = (BENCH_ARRAY_T *)ptArray;
+    return BenchMsg_Reset(BenchMsg_PointerInit(&ptBenchArray->atBuffer[iIndex]));
+}
+
+static BENCH_ARRAY_T gtCopyArrays[BENCH_MAX_PIPES];
+static JUNO_SB_MSG_REF_T gtRefs[BENCH_MAX_PIPES][1];
+static JUNO_SB_MSG_REF_ARRAY_T gtRefArrays[BENCH_MAX_PIPES];
+static JUNO_SB_PIPE_T gtPipes[BENCH_MAX_PIPES];
+static JUNO_SB_PIPE_T *gptPipeRegistry[BENCH_MAX_PIPES];
+
+static BENCH_MSG_T gtPoolMemory[BENCH_POOL_LENGTH];
+static JUNO_MEMORY_BLOCK_METADATA_T gtPoolMetadata[BENCH_POOL_LENGTH];
+static size_t gzRefCounts[BENCH_POOL_LENGTH];
+static JUNO_MEMORY_ALLOC_BLOCK_T gtAlloc;
+static JUNO_SB_MSG_POOL_T gtPool;
+
+static JUNO_STATUS_T RunPublishCopy(size_t zPipes)
+{
+    JUNO_SB_BROKER_ROOT_T tBroker = {0};
+    JUNO_STATUS_T tStatus = JunoSb_BrokerInit(&tBroker, gptPipeRegistry, zPipes, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(size_t i = 0; i < zPipes; i++)
+    {
+        tStatus = JunoDs_ArrayInit(&gtCopyArrays[i].tRoot, &gtBenchArrayApi, 1, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = JunoSb_PipeInit(&gtPipes[i], BENCH_MID, &gtCopyArrays[i].tRoot, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = tBroker.ptApi->RegisterSubscriber(&tBroker, &gtPipes[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    static BENCH_MSG_T tMsg;
+    static BENCH_MSG_T tOut;
+    JUNO_POINTER_T tOutPtr = BenchMsg_PointerInit(&tOut);
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t iRound = 0; iRound < BENCH_ROUNDS; iRound++)
+    {
+        tMsg.iSeq = (uint32_t)iRound;
+        tStatus = tBroker.ptApi->Publish(&tBroker, BENCH_MID, BenchMsg_PointerInit(&tMsg));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        for(size_t i = 0; i < zPipes; i++)
+        {
+            tStatus = JunoDs_QueuePop(&gtPipes[i].tRoot, tOutPtr);
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+            giJunoBenchSink += tOut.iSeq;
+        }
+    }
+    JunoBench_Report("sb_publish_copy_1k", zPipes, JunoBench_NowNs() - iStart, BENCH_ROUNDS);
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T RunPublishRef(size_t zPipes)
+{
+    JUNO_STATUS_T tStatus = JunoMemory_BlockInit(&gtAlloc, &gtBenchMsgPointerApi, gtPoolMemory, gtPoolMetadata,
+                                                 sizeof(BENCH_MSG_T), alignof(BENCH_MSG_T), BENCH_POOL_LENGTH,
+                                                 NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoSb_MsgPoolInit(&gtPool, &gtAlloc, gzRefCounts, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_SB_BROKER_ROOT_T tBroker = {0};
+    tStatus = JunoSb_BrokerInit(&tBroker, gptPipeRegistry, zPipes, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(size_t i = 0; i < zPipes; i++)
+    {
+        tStatus = JunoSb_MsgRefArrayInit(&gtRefArrays[i], gtRefs[i], 1, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = JunoSb_PipeInit(&gtPipes[i], BENCH_MID, &gtRefArrays[i].tRoot, NULL, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = tBroker.ptApi->RegisterSubscriber(&tBroker, &gtPipes[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    static BENCH_MSG_T tMsg;
+    JUNO_SB_MSG_REF_T tRef = {0};
+    JUNO_POINTER_T tRefPtr = JunoSb_MsgRefPointerInit(&gtPool, &tRef);
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t iRound = 0; iRound < BENCH_ROUNDS; iRound++)
+    {
+        tMsg.iSeq = (uint32_t)iRound;
+        tStatus = JunoSb_PublishRef(&tBroker, &gtPool, BENCH_MID, BenchMsg_PointerInit(&tMsg));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        for(size_t i = 0; i < zPipes; i++)
+        {
+            tStatus = JunoDs_QueuePop(&gtPipes[i].tRoot, tRefPtr);
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+            giJunoBenchSink += ((const BENCH_MSG_T *)tRef.tMsg.pvAddr)->iSeq;
+            tStatus = JunoSb_MsgRefRelease(&tRef);
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        }
+    }
+    JunoBench_Report("sb_publish_ref_1k", zPipes, JunoBench_NowNs() - iStart, BENCH_ROUNDS);
+    return JUNO_STATUS_SUCCESS;
+}
+
+int main(void)
+{
+    static const size_t azPipeCounts[] = {1, 6, 16};
+    printf("%-32s %8s\n", "benchmark", "pipes");
+    for(size_t i = 0; i < sizeof(azPipeCounts) / sizeof(azPipeCounts[0]); i++)
+    {
+        JUNO_STATUS_T tStatus = RunPublishCopy(azPipeCounts[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunPublishRef(azPipeCounts[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    }
+    return 0;
+}
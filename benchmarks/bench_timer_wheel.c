@@ -0,0 +1,197 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file bench_timer_wheel.c
+ * @brief Timer wheel versus a linear scan of expiry timestamps.
+ * @details
+ *  N timers are kept running with delays of 1 to 1024 ticks, like ack and
+ *  retransmit timeouts. A fired timer restarts itself with a new delay. Each
+ *  tick also restarts N/64 random timers, like acks arriving before their
+ *  timeout.
+ *  - wheel_tick: WheelAdvance by one tick plus the restarts, per tick.
+ *  - scan_tick: the same work done by comparing every expiry with Now().
+ *  - wheel_restart: a single Restart of a running timer.
+ *  The time source is a fake clock moved by the benchmark.
+ */
+#include "juno_bench.h"
+#include "juno/macros.h"
+#include "juno/status.h"
+#include "juno/time/time_api.h"
+#include "juno/time/timer_wheel.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_MAX_TIMERS (64u * 1024u)
+#define BENCH_TICKS 4096u
+#define BENCH_LEVEL_BITS 6
+#define BENCH_LEVELS 4
+/// About one millisecond
+#define BENCH_TICK_SUBSECS 4294967u
+
+static JUNO_TIMESTAMP_T gtNow = {0};
+static JUNO_TIMESTAMP_T gtTick = {0, BENCH_TICK_SUBSECS};
+static JUNO_TIME_ROOT_T gtTime = {0};
+static JUNO_TIME_WHEEL_T gtWheel = {0};
+static JUNO_TIME_TIMER_T *gptSlots[JUNO_TIME_WHEEL_SLOTS(BENCH_LEVEL_BITS, BENCH_LEVELS)];
+static JUNO_TIME_TIMER_T gatTimers[BENCH_MAX_TIMERS];
+static JUNO_TIMESTAMP_T gatExpiries[BENCH_MAX_TIMERS];
+
+static JUNO_TIMESTAMP_RESULT_T BenchWheel_Now(const JUNO_TIME_ROOT_T *ptTime)
+{
+    (void)ptTime;
+    JUNO_TIMESTAMP_RESULT_T tResult = {JUNO_STATUS_SUCCESS, gtNow};
+    return tResult;
+}
+
+static JUNO_STATUS_T BenchWheel_SleepTo(const JUNO_TIME_ROOT_T *ptTime, JUNO_TIMESTAMP_T tTimeToWakeup)
+{
+    (void)ptTime; (void)tTimeToWakeup;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T BenchWheel_Sleep(const JUNO_TIME_ROOT_T *ptTime, JUNO_TIMESTAMP_T tDuration)
+{
+    (void)ptTime; (void)tDuration;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static const JUNO_TIME_API_T gtBenchTimeApi = JunoTime_TimeApiInit(BenchWheel_Now, BenchWheel_SleepTo, BenchWheel_Sleep);
+
+static uint64_t giState = 0x9E3779B97F4A7C15ull;
+
+static inline uint32_t BenchWheel_Rand(void)
+{
+    giState = giState * 6364136223846793005ull + 1442695040888963407ull;
+    return (uint32_t)(giState >> 40);
+}
+
+/// A delay of 1 to 1024 ticks
+static inline JUNO_TIMESTAMP_T BenchWheel_Delay(void)
+{
+    uint64_t iSubSeconds = (uint64_t)(1 + BenchWheel_Rand() % 1024) * BENCH_TICK_SUBSECS;
+    JUNO_TIMESTAMP_T tDelay = {(JUNO_TIME_SECONDS_T)(iSubSeconds / UINT32_MAX), (JUNO_TIME_SUBSECONDS_T)(iSubSeconds % UINT32_MAX)};
+    return tDelay;
+}
+
+static JUNO_STATUS_T BenchWheel_Expired(JUNO_TIME_TIMER_T *ptTimer, JUNO_USER_DATA_T *pvUserData)
+{
+    (void)pvUserData;
+    return JunoTime_TimerStart(&gtWheel, ptTimer, BenchWheel_Delay());
+}
+
+static JUNO_STATUS_T RunWheel(size_t zTimers)
+{
+    gtNow = (JUNO_TIMESTAMP_T){100, 0};
+    giState = 0x9E3779B97F4A7C15ull;
+    JUNO_STATUS_T tStatus = JunoTime_WheelInit(&gtWheel, &gtTime, gptSlots, JUNO_TIME_WHEEL_SLOTS(BENCH_LEVEL_BITS, BENCH_LEVELS), BENCH_LEVEL_BITS, BENCH_LEVELS, gtTick, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(size_t i = 0; i < zTimers; i++)
+    {
+        tStatus = JunoTime_TimerInit(&gatTimers[i], BenchWheel_Expired, NULL);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = JunoTime_TimerStart(&gtWheel, &gatTimers[i], BenchWheel_Delay());
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    size_t zFired = 0;
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t iTick = 0; iTick < BENCH_TICKS; iTick++)
+    {
+        for(size_t i = 0; i < zTimers / 64; i++)
+        {
+            tStatus = JunoTime_TimerRestart(&gtWheel, &gatTimers[BenchWheel_Rand() % zTimers], BenchWheel_Delay());
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        }
+        tStatus = JunoTime_AddTime(&gtTime, &gtNow, gtTick);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        JUNO_RESULT_SIZE_T tResult = JunoTime_WheelPoll(&gtWheel);
+        JUNO_ASSERT_OK(tResult, return tResult.tStatus);
+        zFired += tResult.tOk;
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    giJunoBenchSink += zFired;
+    JunoBench_Report("wheel_tick", zTimers, iElapsed, BENCH_TICKS);
+    iStart = JunoBench_NowNs();
+    for(size_t i = 0; i < BENCH_TICKS * 16; i++)
+    {
+        tStatus = JunoTime_TimerRestart(&gtWheel, &gatTimers[BenchWheel_Rand() % zTimers], BenchWheel_Delay());
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    iElapsed = JunoBench_NowNs() - iStart;
+    JunoBench_Report("wheel_restart", zTimers, iElapsed, BENCH_TICKS * 16);
+    return tStatus;
+}
+
+/// The per-app pattern the wheel replaces: compare every expiry with Now() each tick
+static JUNO_STATUS_T RunScan(size_t zTimers)
+{
+    gtNow = (JUNO_TIMESTAMP_T){100, 0};
+    giState = 0x9E3779B97F4A7C15ull;
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    for(size_t i = 0; i < zTimers; i++)
+    {
+        gatExpiries[i] = gtNow;
+        tStatus = JunoTime_AddTime(&gtTime, &gatExpiries[i], BenchWheel_Delay());
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    size_t zFired = 0;
+    uint64_t iStart = JunoBench_NowNs();
+    for(size_t iTick = 0; iTick < BENCH_TICKS; iTick++)
+    {
+        for(size_t i = 0; i < zTimers / 64; i++)
+        {
+            JUNO_TIMESTAMP_T *ptExpiry = &gatExpiries[BenchWheel_Rand() % zTimers];
+            *ptExpiry = gtNow;
+            tStatus = JunoTime_AddTime(&gtTime, ptExpiry, BenchWheel_Delay());
+            JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        }
+        tStatus = JunoTime_AddTime(&gtTime, &gtNow, gtTick);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        JUNO_TIMESTAMP_RESULT_T tNow = BenchWheel_Now(&gtTime);
+        JUNO_ASSERT_OK(tNow, return tNow.tStatus);
+        for(size_t i = 0; i < zTimers; i++)
+        {
+            if(!JunoTime_TimestampLessThan(tNow.tOk, gatExpiries[i]))
+            {
+                gatExpiries[i] = tNow.tOk;
+                tStatus = JunoTime_AddTime(&gtTime, &gatExpiries[i], BenchWheel_Delay());
+                JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+                zFired += 1;
+            }
+        }
+    }
+    uint64_t iElapsed = JunoBench_NowNs() - iStart;
+    giJunoBenchSink += zFired;
+    JunoBench_Report("scan_tick", zTimers, iElapsed, BENCH_TICKS);
+    return tStatus;
+}
+
+int main(void)
+{
+    static const size_t azTimers[] = {1024, 8192, BENCH_MAX_TIMERS};
+    printf("%-32s %8s\n", "benchmark", "timers");
+    JUNO_STATUS_T tStatus = JunoTime_TimeInit(&gtTime, &gtBenchTimeApi, NULL, NULL);
+    JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    for(size_t i = 0; i < sizeof(azTimers) / sizeof(azTimers[0]); i++)
+    {
+        tStatus = RunWheel(azTimers[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+        tStatus = RunScan(azTimers[i]);
+        JUNO_ASSERT_SUCCESS(tStatus, return 1);
+    }
+    return 0;
+}
@@ -0,0 +1,60 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file juno_bench.h
+ * @brief Minimal timing helpers shared by the LibJuno benchmarks.
+ * @details
+ *  Benchmarks are hosted programs. This header must be included before any
+ *  system header so that the POSIX clock API is visible.
+ */
+#ifndef JUNO_BENCH_H
+#define JUNO_BENCH_H
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+/// Sink written by benchmarks so the optimizer keeps the measured work.
+static volatile uint64_t giJunoBenchSink;
+
+/// @brief Monotonic time in nanoseconds.
+static inline uint64_t JunoBench_NowNs(void)
+{
+    struct timespec tNow;
+    clock_gettime(CLOCK_MONOTONIC, &tNow);
+    return (uint64_t)tNow.tv_sec * 1000000000ull + (uint64_t)tNow.tv_nsec;
+}
+
+/// @brief Print one benchmark result line as nanoseconds per operation.
+static inline void JunoBench_Report(const char *pcName, size_t zParam, uint64_t iElapsedNs, uint64_t iOps)
+{
+    double dNsPerOp = iOps ? (double)iElapsedNs / (double)iOps : 0.0;
+    printf("%-32s %8zu %14llu ops %10.2f ns/op\n", pcName, zParam, (unsigned long long)iOps, dNsPerOp);
+}
+
+/// @brief Print one benchmark result line as nanoseconds per operation and GB/s.
+static inline void JunoBench_ReportBytes(const char *pcName, size_t zParam, uint64_t iElapsedNs, uint64_t iOps, size_t zBytesPerOp)
+{
+    double dNsPerOp = iOps ? (double)iElapsedNs / (double)iOps : 0.0;
+    double dGbPerSec = iElapsedNs ? (double)iOps * (double)zBytesPerOp / (double)iElapsedNs : 0.0;
+    printf("%-32s %8zu %14llu ops %10.2f ns/op %8.2f GB/s\n", pcName, zParam, (unsigned long long)iOps, dNsPerOp, dGbPerSec);
+}
+
+#endif // JUNO_BENCH_H
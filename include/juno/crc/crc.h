@@ -16,7 +16,8 @@
 */
 /**
  * @file crc.h
- * @brief CRC update routines (ARC, BinHex, CCITT, CCITT32, Kermit, ZIP).
+ * @brief CRC update routines (ARC, BinHex, Castagnoli, CCITT, CCITT32, CRC-64,
+ *        Kermit, ZIP).
  * @defgroup juno_crc CRC utilities
  * @ingroup juno_math
  * @details
@@ -29,11 +30,12 @@
  *  - Passing a NULL data pointer or zero length returns 0 (no update).
  *    This differs from returning the variant's seed value for some CRCs
  *    (e.g., CCITT/CCITT32/ZIP) and is intentional; see tests and callers.
- *  - All functions are pure and reentrant: no global state is modified.
+ *  - All update functions are reentrant and modify no global state. The only
+ *    global is the kernel selection made by Juno_CrcHwInit.
  *  - CRC-32 ZIP applies a final XOR (0xFFFFFFFF) before returning when data
  *    is processed. For multi-chunk streaming with ZIP, undo that XOR on the
  *    returned value (res ^ 0xFFFFFFFF) before passing it back as the next
- *    iCrc.
+ *    iCrc. Castagnoli and CRC-64 follow the same convention.
  *
  *  Example (streaming across two chunks)
  *  @code{.c}
@@ -54,6 +56,7 @@
 extern "C"
 {
 #endif
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -168,6 +171,87 @@ uint16_t Juno_CrcKermitUpdate(uint16_t iCrc, const void *pcData, size_t zDataSiz
  */
 uint32_t Juno_CrcZipUpdate(uint32_t iCrc, const void *pcData, size_t zDataSize);
 
+/**
+ * @brief Initial seed for CRC-32C (Castagnoli) computations (0xFFFFFFFF).
+ * @details Expands to -1 (all ones) as a C integer literal; when passed to the
+ *  32-bit function parameter it yields 0xFFFFFFFF.
+ */
+#define JUNO_CASTAGNOLI_CRC_INIT (-1)
+/**
+ * @brief Update CRC-32C (Castagnoli, polynomial 0x1EDC6F41) with new data.
+ * @details Reflected CRC with a final XOR (0xFFFFFFFF), used by iSCSI, SCTP,
+ *  ext4 and many storage formats. Like ZIP, undo the final XOR on the
+ *  returned value before passing it back as the next @p iCrc. Uses the SSE4.2
+ *  or ARMv8 CRC32C instructions once Juno_CrcHwInit selects them.
+ * @param iCrc     Running CRC value (use JUNO_CASTAGNOLI_CRC_INIT initially).
+ * @param pcData   Pointer to data buffer (can be NULL when @p zDataSize is 0).
+ * @param zDataSize Size of data buffer in bytes.
+ * @return Updated CRC-32C value; returns 0 when @p pcData is NULL or @p zDataSize is 0.
+ */
+uint32_t Juno_CrcCastagnoliUpdate(uint32_t iCrc, const void *pcData, size_t zDataSize);
+
+/**
+ * @brief Initial seed for CRC-64/XZ computations (0xFFFFFFFFFFFFFFFF).
+ * @details Expands to -1 (all ones) as a C integer literal; when passed to the
+ *  64-bit function parameter it yields all ones.
+ */
+#define JUNO_CRC64_CRC_INIT (-1)
+/**
+ * @brief Update CRC-64/XZ (ECMA-182 polynomial, reflected) with new data.
+ * @details Applies a final XOR (all ones) like ZIP; undo it on the returned
+ *  value before passing it back as the next @p iCrc.
+ * @param iCrc     Running CRC value (use JUNO_CRC64_CRC_INIT initially).
+ * @param pcData   Pointer to data buffer (can be NULL when @p zDataSize is 0).
+ * @param zDataSize Size of data buffer in bytes.
+ * @return Updated CRC-64 value; returns 0 when @p pcData is NULL or @p zDataSize is 0.
+ */
+uint64_t Juno_CrcCrc64Update(uint64_t iCrc, const void *pcData, size_t zDataSize);
+
+/**
+ * @name CRC combination
+ * @brief Merge the CRCs of two adjacent buffers without revisiting the data.
+ * @details Given @p iCrcA, the CRC of a leading buffer A (from any seed), and
+ *  @p iCrcB, the CRC of the @p zLengthB bytes that follow it computed from the
+ *  variant's JUNO_*_CRC_INIT seed, each function returns the CRC of A
+ *  followed by B, equal to continuing the CRC of A over B. The returned
+ *  value is in the same form the update function returns (for ZIP, with the
+ *  final XOR applied). When @p zLengthB is 0, @p iCrcA is returned.
+ *
+ *  The cost is O(log zLengthB) polynomial multiplications modulo the CRC
+ *  polynomial and does not depend on the data.
+ * @{
+ */
+uint16_t Juno_CrcArcCombine(uint16_t iCrcA, uint16_t iCrcB, size_t zLengthB);
+uint16_t Juno_CrcBinhexCombine(uint16_t iCrcA, uint16_t iCrcB, size_t zLengthB);
+uint16_t Juno_CrcCcittCombine(uint16_t iCrcA, uint16_t iCrcB, size_t zLengthB);
+uint32_t Juno_CrcCcitt32Combine(uint32_t iCrcA, uint32_t iCrcB, size_t zLengthB);
+uint16_t Juno_CrcKermitCombine(uint16_t iCrcA, uint16_t iCrcB, size_t zLengthB);
+uint32_t Juno_CrcZipCombine(uint32_t iCrcA, uint32_t iCrcB, size_t zLengthB);
+uint32_t Juno_CrcCastagnoliCombine(uint32_t iCrcA, uint32_t iCrcB, size_t zLengthB);
+uint64_t Juno_CrcCrc64Combine(uint64_t iCrcA, uint64_t iCrcB, size_t zLengthB);
+/** @} */
+
+/**
+ * @brief Select the hardware-accelerated CRC-32 kernels.
+ * @details Detects the CPU features once and routes inputs of 64 bytes or more
+ *  through Juno_CrcZipUpdate, Juno_CrcCcitt32Update and
+ *  Juno_CrcCastagnoliUpdate to accelerated kernels: PCLMULQDQ folding for ZIP
+ *  and CCITT32 and the SSE4.2 crc32 instruction for Castagnoli on x86-64, and
+ *  the CRC32/CRC32C instructions for ZIP and Castagnoli on aarch64 Linux. Results are bit-identical to the table-driven kernels, which
+ *  stay in use until this is called. Passing false restores the table-driven
+ *  kernels.
+ *
+ *  The selection is stored in plain, non-atomic globals that every CRC update
+ *  reads. This call, including Juno_CrcHwInit(false), must return before any
+ *  other thread uses a CRC function, for example before those threads are
+ *  created; calling it while another thread is inside a CRC function is a
+ *  data race. Freestanding builds, other targets and builds defining
+ *  JUNO_CRC_PORTABLE always use the table-driven kernels.
+ * @param bEnable true to select accelerated kernels when the CPU supports them.
+ * @return true when at least one accelerated kernel is active after the call.
+ */
+bool Juno_CrcHwInit(bool bEnable);
+
 #ifdef __cplusplus
 }
 #endif
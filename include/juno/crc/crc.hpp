@@ -0,0 +1,278 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file crc.hpp
+ * @brief Compile-time generated CRC engine for arbitrary catalogue CRCs (C++11).
+ * @ingroup juno_crc
+ * @details
+ *  juno::crc::CRC_T is parameterized like the Rocksoft/"reveng" catalogue:
+ *  width, polynomial (normal form), reflect-in, reflect-out, init and
+ *  xor-out. Its lookup table (and, with SLICE = 8, the slicing-by-8 rows) is
+ *  a constexpr array built by the compiler, so there is no runtime
+ *  initialization and every instantiation inlines its own kernel.
+ *
+ *  Streaming follows the hash Init/Update/Final pattern; Update works on the
+ *  raw register, so chunks can be chained without undoing a final XOR:
+ *  @code{.cpp}
+ *  typedef juno::crc::CRC32_ISO_HDLC_T<8> ZIP_T;
+ *  uint32_t iReg = ZIP_T::Init();
+ *  iReg = ZIP_T::Update(iReg, pcChunk1, zLen1);
+ *  iReg = ZIP_T::Update(iReg, pcChunk2, zLen2);
+ *  uint32_t iCrc = ZIP_T::Final(iReg);                  // == ZIP_T::Compute(...)
+ *  static_assert(ZIP_T::Checksum("123456789", 9) == 0xCBF43926u, "check");
+ *  @endcode
+ *
+ *  T must be an unsigned integer type of at least max(W, 8) bits. Normal
+ *  (MSB-first) CRCs keep their register in the top W bits of T so widths
+ *  below 8 work without special cases.
+ */
+// @{"req": ["REQ-CRC-017"]}
+#ifndef JUNO_CRC_HPP
+#define JUNO_CRC_HPP
+#include <stddef.h>
+#include <stdint.h>
+
+namespace juno
+{
+namespace crc
+{
+
+/// Compile-time list of indices (C++11 has no std::index_sequence)
+template<size_t... Is>
+struct INDICES_T {};
+
+template<typename LEFT_T, typename RIGHT_T>
+struct CONCAT_INDICES_T;
+
+template<size_t... Ls, size_t... Rs>
+struct CONCAT_INDICES_T<INDICES_T<Ls...>, INDICES_T<Rs...>>
+{
+    typedef INDICES_T<Ls..., (sizeof...(Ls) + Rs)...> TYPE_T;
+};
+
+/// Indices 0 .. N-1, built by halving so 2048 entries stay far below the instantiation depth limit
+template<size_t N>
+struct MAKE_INDICES_T
+{
+    typedef typename CONCAT_INDICES_T<typename MAKE_INDICES_T<N / 2>::TYPE_T, typename MAKE_INDICES_T<N - N / 2>::TYPE_T>::TYPE_T TYPE_T;
+};
+
+template<>
+struct MAKE_INDICES_T<0>
+{
+    typedef INDICES_T<> TYPE_T;
+};
+
+template<>
+struct MAKE_INDICES_T<1>
+{
+    typedef INDICES_T<0> TYPE_T;
+};
+
+/// Constexpr table storage of an engine: SLICE rows of 256 entries, row-major
+template<typename ENGINE_T, typename INDICES>
+struct CRC_TABLE_T;
+
+template<typename ENGINE_T, size_t... Is>
+struct CRC_TABLE_T<ENGINE_T, INDICES_T<Is...>>
+{
+    static constexpr typename ENGINE_T::VALUE_T atEntries[sizeof...(Is)] = {ENGINE_T::Entry(Is / 256, Is % 256)...};
+};
+
+template<typename ENGINE_T, size_t... Is>
+constexpr typename ENGINE_T::VALUE_T CRC_TABLE_T<ENGINE_T, INDICES_T<Is...>>::atEntries[sizeof...(Is)];
+
+/**
+ * @brief Table-driven CRC engine generated at compile time.
+ * @tparam T Unsigned register type, at least max(W, 8) bits.
+ * @tparam W CRC width in bits.
+ * @tparam POLY Generator polynomial in normal form, without the x^W term.
+ * @tparam REFIN Input bytes are processed LSB first.
+ * @tparam REFOUT The final register is bit-reflected before the XOR.
+ * @tparam INIT Initial register value (catalogue form).
+ * @tparam XOROUT Value XORed into the final CRC.
+ * @tparam SLICE Bytes per table step: 1 (256 entries) or 8 (2048 entries).
+ */
+template<typename T, unsigned W, T POLY, bool REFIN, bool REFOUT, T INIT, T XOROUT, unsigned SLICE = 1>
+struct CRC_T
+{
+    typedef T VALUE_T;
+    /// Bits in the register type
+    static constexpr unsigned TBITS = sizeof(T) * 8;
+    static_assert(T(~T(0)) > T(0), "CRC register type must be unsigned");
+    static_assert(TBITS >= 8 && W >= 1 && W <= TBITS, "CRC width must fit the register type");
+    static_assert(SLICE == 1 || SLICE == 8, "SLICE must be 1 or 8");
+    /// Left shift that aligns a normal CRC with the top of the register
+    static constexpr unsigned SHIFT = TBITS - W;
+    /// The low W bits
+    static constexpr T MASK = T(T(~T(0)) >> SHIFT);
+
+    /// Reverse the low zBits bits of iValue
+    static constexpr T Reflect(T iValue, unsigned zBits)
+    {
+        return zBits == 0 ? T(0) : T(T(T(iValue & 1u) << (zBits - 1)) | Reflect(T(iValue >> 1), zBits - 1));
+    }
+
+    /// Polynomial in register orientation
+    static constexpr T RegisterPoly()
+    {
+        return REFIN ? Reflect(POLY, W) : T(T(POLY & MASK) << SHIFT);
+    }
+
+    /// Shift the register by zBits zero bits
+    static constexpr T Shift(T iReg, unsigned zBits)
+    {
+        return zBits == 0 ? iReg :
+            Shift(REFIN ?
+                ((iReg & 1u) ? T(T(iReg >> 1) ^ RegisterPoly()) : T(iReg >> 1)) :
+                (((iReg >> (TBITS - 1)) & 1u) ? T(T(iReg << 1) ^ RegisterPoly()) : T(iReg << 1)),
+                zBits - 1);
+    }
+
+    /// CRC register contribution of one byte value
+    static constexpr T Base(unsigned iIndex)
+    {
+        return REFIN ? Shift(T(iIndex), 8) : Shift(T(T(iIndex) << (TBITS - 8)), 8);
+    }
+
+    /// Append a zero byte to a table value
+    static constexpr T NextRow(T iValue)
+    {
+        return REFIN ? T(T(iValue >> 8) ^ Base(iValue & 0xffu)) : T(T(iValue << 8) ^ Base((iValue >> (TBITS - 8)) & 0xffu));
+    }
+
+    /// Table row zRow (byte followed by zRow zero bytes), entry iIndex
+    static constexpr T Entry(size_t zRow, size_t iIndex)
+    {
+        return zRow == 0 ? Base(unsigned(iIndex)) : NextRow(Entry(zRow - 1, iIndex));
+    }
+
+    /// Register value before the first byte
+    static constexpr T Init()
+    {
+        return REFIN ? Reflect(T(INIT & MASK), W) : T(T(INIT & MASK) << SHIFT);
+    }
+
+    /// Register after one byte, computed without the table (for constant evaluation)
+    static constexpr T StepByte(T iReg, uint8_t iByte)
+    {
+        return REFIN ? T(T(iReg >> 8) ^ Base((iReg ^ iByte) & 0xffu)) :
+            T(T(iReg << 8) ^ Base(((iReg >> (TBITS - 8)) ^ iByte) & 0xffu));
+    }
+
+    /// Final CRC value from a register
+    static constexpr T Final(T iReg)
+    {
+        return T((REFIN == REFOUT ?
+            (REFIN ? iReg : T(iReg >> SHIFT)) :
+            Reflect(REFIN ? iReg : T(iReg >> SHIFT), W)) ^ (XOROUT & MASK));
+    }
+
+    /// Continue a register over zDataSize bytes
+    static inline T Update(T iReg, const void *pvData, size_t zDataSize)
+    {
+        const uint8_t *pcData = static_cast<const uint8_t *>(pvData);
+        const T *atTable = CRC_TABLE_T<CRC_T, typename MAKE_INDICES_T<SLICE * 256>::TYPE_T>::atEntries;
+        if(SLICE == 8)
+        {
+            for(; zDataSize >= 8; zDataSize -= 8, pcData += 8)
+            {
+                T iNext = 0;
+                // Register bytes meet the first data bytes; all 8 rows are used
+                for(unsigned k = 0; k < 8; k++)
+                {
+                    unsigned iByte = pcData[k];
+                    if(k * 8 < TBITS)
+                    {
+                        iByte ^= unsigned(REFIN ? (iReg >> (8 * k)) : (iReg >> (TBITS - 8 - 8 * k))) & 0xffu;
+                    }
+                    iNext ^= atTable[(SLICE - 1 - k) * 256 + iByte];
+                }
+                iReg = iNext;
+            }
+        }
+        for(; zDataSize; zDataSize--, pcData++)
+        {
+            iReg = REFIN ? T(T(iReg >> 8) ^ atTable[(iReg ^ *pcData) & 0xffu]) :
+                T(T(iReg << 8) ^ atTable[((iReg >> (TBITS - 8)) ^ *pcData) & 0xffu]);
+        }
+        return iReg;
+    }
+
+    /// CRC of one buffer
+    static inline T Compute(const void *pvData, size_t zDataSize)
+    {
+        return Final(Update(Init(), pvData, zDataSize));
+    }
+
+    /// Register over a constant byte string (recursive; bounded by the constexpr depth limit)
+    static constexpr T UpdateConst(T iReg, const char *pcData, size_t zDataSize)
+    {
+        return zDataSize == 0 ? iReg : UpdateConst(StepByte(iReg, uint8_t(*pcData)), pcData + 1, zDataSize - 1);
+    }
+
+    /// CRC of a constant byte string, usable in static_assert and constant initializers
+    static constexpr T Checksum(const char *pcData, size_t zDataSize)
+    {
+        return Final(UpdateConst(Init(), pcData, zDataSize));
+    }
+};
+
+/**
+ * @name Catalogue CRCs
+ * @brief Instantiations matching the C functions in crc.h and common peers.
+ * @{
+ */
+/// CRC-16/ARC, same as Juno_CrcArcUpdate
+template<unsigned SLICE = 1>
+using CRC16_ARC_T = CRC_T<uint16_t, 16, 0x8005u, true, true, 0x0000u, 0x0000u, SLICE>;
+/// CRC-16/XMODEM, same as Juno_CrcBinhexUpdate
+template<unsigned SLICE = 1>
+using CRC16_XMODEM_T = CRC_T<uint16_t, 16, 0x1021u, false, false, 0x0000u, 0x0000u, SLICE>;
+/// CRC-16/IBM-3740 (CCITT-FALSE), same as Juno_CrcCcittUpdate
+template<unsigned SLICE = 1>
+using CRC16_IBM_3740_T = CRC_T<uint16_t, 16, 0x1021u, false, false, 0xFFFFu, 0x0000u, SLICE>;
+/// CRC-16/KERMIT, same as Juno_CrcKermitUpdate
+template<unsigned SLICE = 1>
+using CRC16_KERMIT_T = CRC_T<uint16_t, 16, 0x1021u, true, true, 0x0000u, 0x0000u, SLICE>;
+/// CRC-16/MODBUS
+template<unsigned SLICE = 1>
+using CRC16_MODBUS_T = CRC_T<uint16_t, 16, 0x8005u, true, true, 0xFFFFu, 0x0000u, SLICE>;
+/// CRC-32/MPEG-2, same as Juno_CrcCcitt32Update
+template<unsigned SLICE = 1>
+using CRC32_MPEG2_T = CRC_T<uint32_t, 32, 0x04C11DB7u, false, false, 0xFFFFFFFFu, 0x00000000u, SLICE>;
+/// CRC-32/ISO-HDLC (PKZIP), same as Juno_CrcZipUpdate
+template<unsigned SLICE = 1>
+using CRC32_ISO_HDLC_T = CRC_T<uint32_t, 32, 0x04C11DB7u, true, true, 0xFFFFFFFFu, 0xFFFFFFFFu, SLICE>;
+/// CRC-32/ISCSI (CRC-32C), same as Juno_CrcCastagnoliUpdate
+template<unsigned SLICE = 1>
+using CRC32_ISCSI_T = CRC_T<uint32_t, 32, 0x1EDC6F41u, true, true, 0xFFFFFFFFu, 0xFFFFFFFFu, SLICE>;
+/// CRC-64/XZ, same as Juno_CrcCrc64Update
+template<unsigned SLICE = 1>
+using CRC64_XZ_T = CRC_T<uint64_t, 64, 0x42F0E1EBA9EA3693ull, true, true, 0xFFFFFFFFFFFFFFFFull, 0xFFFFFFFFFFFFFFFFull, SLICE>;
+/** @} */
+
+}
+}
+
+#endif // JUNO_CRC_HPP
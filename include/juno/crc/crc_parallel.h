@@ -0,0 +1,136 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file crc_parallel.h
+ * @brief Chunked CRC over large buffers with a caller-supplied executor.
+ * @ingroup juno_crc
+ * @details
+ *  Juno_CrcParallel splits a buffer into one chunk per job, hands the jobs to
+ *  a caller-supplied executor, and merges the chunk CRCs with the
+ *  Juno_Crc*Combine functions. The result is bit-identical to one call of the
+ *  variant's update function over the whole buffer.
+ *
+ *  The executor owns the concurrency policy: it must call Juno_CrcJobRun
+ *  exactly once for every job, on any thread and in any order, and return
+ *  only when all jobs have completed. This keeps the library free of OS
+ *  dependencies; juno/crc/crc_pthread.h provides a POSIX reference executor.
+ *
+ *  @code{.c}
+ *  JUNO_CRC_JOB_T atJobs[8];
+ *  JUNO_RESULT_UINT64_T tCrc = Juno_CrcParallel(JUNO_CRC_KIND_ZIP, JUNO_ZIP_CRC_INIT,
+ *      pcImage, zImageSize, atJobs, 8, Juno_CrcPthreadExecutor, NULL);
+ *  @endcode
+ */
+#ifndef JUNO_CRC_PARALLEL_H
+#define JUNO_CRC_PARALLEL_H
+#include "juno/crc/crc.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// CRC variant computed by a job or stream
+typedef enum JUNO_CRC_KIND_TAG
+{
+    JUNO_CRC_KIND_ARC = 0,
+    JUNO_CRC_KIND_BINHEX = 1,
+    JUNO_CRC_KIND_CCITT = 2,
+    JUNO_CRC_KIND_CCITT32 = 3,
+    JUNO_CRC_KIND_KERMIT = 4,
+    JUNO_CRC_KIND_ZIP = 5,
+    JUNO_CRC_KIND_CASTAGNOLI = 6,
+    JUNO_CRC_KIND_CRC64 = 7,
+} JUNO_CRC_KIND_T;
+
+typedef struct JUNO_CRC_JOB_TAG JUNO_CRC_JOB_T;
+
+/// One chunk of a parallel CRC computation
+// @{"req": ["REQ-CRC-014"]}
+struct JUNO_CRC_JOB_TAG
+{
+    /// CRC variant of the chunk
+    JUNO_CRC_KIND_T tKind;
+    /// Seed before Juno_CrcJobRun, CRC of the chunk after it (low bits for
+    /// variants narrower than 64 bits)
+    uint64_t iCrc;
+    /// Start of the chunk
+    const uint8_t *pcData;
+    /// Size of the chunk in bytes
+    size_t zDataSize;
+};
+
+/**
+ * @brief Run every job and return once all of them have completed.
+ * @param ptJobs Jobs to run with Juno_CrcJobRun.
+ * @param zJobs Number of jobs.
+ * @param pvUserData User data passed to Juno_CrcParallel.
+ * @return JUNO_STATUS_SUCCESS when every job ran, error otherwise.
+ */
+typedef JUNO_STATUS_T (*JUNO_CRC_EXECUTOR_T)(JUNO_CRC_JOB_T *ptJobs, size_t zJobs, JUNO_USER_DATA_T *pvUserData);
+
+/**
+ * @brief Compute the CRC of one job's chunk, replacing its seed.
+ * @param ptJob Job prepared by Juno_CrcParallel.
+ */
+// @{"req": ["REQ-CRC-014"]}
+void Juno_CrcJobRun(JUNO_CRC_JOB_T *ptJob);
+
+/**
+ * @brief Compute a CRC by splitting the buffer across jobs.
+ * @details Uses at most @p zJobs jobs and never creates an empty chunk.
+ *  Chunks are a multiple of 64 bytes except the last, so every chunk can use
+ *  the block kernels. The result matches the variant's update function
+ *  called with @p iCrc over the whole buffer, including its return of 0 for
+ *  an empty buffer.
+ * @param tKind CRC variant.
+ * @param iCrc Seed of the first chunk (use the variant's JUNO_*_CRC_INIT).
+ * @param pcData Buffer to checksum.
+ * @param zDataSize Size of the buffer in bytes.
+ * @param ptJobs Job storage, at least @p zJobs entries.
+ * @param zJobs Maximum number of chunks.
+ * @param pfcnExecutor Executor that runs the jobs.
+ * @param pvUserData User data for the executor.
+ * @return The CRC on success; JUNO_STATUS_NULLPTR_ERROR,
+ *         JUNO_STATUS_INVALID_SIZE_ERROR, JUNO_STATUS_INVALID_TYPE_ERROR or
+ *         the executor's error otherwise.
+ */
+// @{"req": ["REQ-CRC-014"]}
+JUNO_RESULT_UINT64_T Juno_CrcParallel(
+    JUNO_CRC_KIND_T tKind,
+    uint64_t iCrc,
+    const void *pcData,
+    size_t zDataSize,
+    JUNO_CRC_JOB_T *ptJobs,
+    size_t zJobs,
+    JUNO_CRC_EXECUTOR_T pfcnExecutor,
+    JUNO_USER_DATA_T *pvUserData
+);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_CRC_PARALLEL_H
@@ -0,0 +1,367 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file crc_posix.h
+ * @brief Stream CRCs over memory-mapped files and async I/O sources.
+ * @ingroup juno_crc
+ * @details
+ *  Header-only so the library itself never depends on POSIX; include it from
+ *  hosted code and link with the platform's threads library. Both helpers
+ *  append to a JUNO_CRC_STREAM_T, so any variant works and the file or stream
+ *  can be preceded or followed by other data before Juno_CrcStreamFinal.
+ *
+ *  Juno_CrcStreamMmapFile maps the file JUNO_CRC_POSIX_WINDOW bytes at a time
+ *  with sequential access hints, and asks the kernel to start reading the
+ *  next window before checksumming the current one, so disk reads overlap
+ *  the CRC. Windows are unmapped as soon as they are checksummed, keeping the
+ *  address space use bounded for files of any size. The file must not be
+ *  truncated while it is checksummed; on 32-bit targets define
+ *  _FILE_OFFSET_BITS=64 for files over 2 GiB.
+ *
+ *  Juno_CrcStreamAsyncIo double-buffers a JUNO_ASYNC_IO_ROOT_T source: one
+ *  helper thread, started once per call, fills one buffer while the calling
+ *  thread checksums the other. The source is non-blocking, so a 0-byte Read
+ *  does not mean the stream has ended: the caller passes the stream length,
+ *  and each Read is preceded by a Poll that waits for data up to a timeout.
+ *  Read and Poll are never called concurrently. When the thread cannot be
+ *  created the buffers are filled on the calling thread, so the result never
+ *  depends on thread availability.
+ *
+ *  @code{.c}
+ *  JUNO_CRC_STREAM_T tStream;
+ *  Juno_CrcStreamInit(&tStream, JUNO_CRC_KIND_ZIP);
+ *  JUNO_STATUS_T tStatus = Juno_CrcStreamMmapFile(&tStream, "bundle.tar");
+ *  JUNO_RESULT_UINT64_T tCrc = Juno_CrcStreamFinal(&tStream);
+ *  @endcode
+ */
+#ifndef JUNO_CRC_POSIX_H
+#define JUNO_CRC_POSIX_H
+#include "juno/crc/crc_stream.h"
+#include "juno/io/async_io_api.h"
+#include "juno/status.h"
+#include "juno/time/time_api.h"
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Bytes mapped and checksummed per step of Juno_CrcStreamMmapFile
+#define JUNO_CRC_POSIX_WINDOW (8u * 1024u * 1024u)
+
+/// One buffer of Juno_CrcStreamAsyncIo and the outcome of filling it
+typedef struct JUNO_CRC_POSIX_FILL_TAG
+{
+    JUNO_ASYNC_IO_ROOT_T *ptIo;
+    /// Longest wait for data before a Read
+    JUNO_TIME_MICROS_T iTimeoutUs;
+    char *pcBuff;
+    /// Bytes to read into pcBuff
+    size_t zWant;
+    /// Bytes read into pcBuff
+    size_t zFilled;
+    /// Status of the last Poll or Read
+    JUNO_STATUS_T tStatus;
+} JUNO_CRC_POSIX_FILL_T;
+
+/// Helper thread of Juno_CrcStreamAsyncIo and its one-request mailbox
+typedef struct JUNO_CRC_POSIX_FILLER_TAG
+{
+    pthread_t tThread;
+    pthread_mutex_t tMutex;
+    pthread_cond_t tCond;
+    /// Buffer to fill, NULL once the helper has filled it
+    JUNO_CRC_POSIX_FILL_T *ptRequest;
+    bool bStop;
+} JUNO_CRC_POSIX_FILLER_T;
+
+/// Read exactly zWant bytes, waiting up to iTimeoutUs for each chunk
+static inline void JunoCrc_PosixFill(JUNO_CRC_POSIX_FILL_T *ptFill)
+{
+    ptFill->zFilled = 0;
+    ptFill->tStatus = JUNO_STATUS_SUCCESS;
+    while(ptFill->zFilled < ptFill->zWant)
+    {
+        bool bHasData = false;
+        ptFill->tStatus = ptFill->ptIo->ptApi->Poll(ptFill->ptIo, ptFill->iTimeoutUs, &bHasData);
+        if(ptFill->tStatus != JUNO_STATUS_SUCCESS)
+        {
+            return;
+        }
+        if(!bHasData)
+        {
+            ptFill->tStatus = JUNO_STATUS_TIMEOUT_ERROR;
+            return;
+        }
+        size_t zRead = ptFill->zWant - ptFill->zFilled;
+        ptFill->tStatus = ptFill->ptIo->ptApi->Read(ptFill->ptIo, &ptFill->pcBuff[ptFill->zFilled], &zRead);
+        if(ptFill->tStatus != JUNO_STATUS_SUCCESS)
+        {
+            return;
+        }
+        if(!zRead)
+        {
+            // Ready but empty: the source closed before the stream length
+            ptFill->tStatus = JUNO_STATUS_READ_ERROR;
+            return;
+        }
+        ptFill->zFilled += zRead;
+    }
+}
+
+/// Helper thread: fill each posted buffer until asked to stop
+static inline void *JunoCrc_PosixFillerEntry(void *pvFiller)
+{
+    JUNO_CRC_POSIX_FILLER_T *ptFiller = (JUNO_CRC_POSIX_FILLER_T *)pvFiller;
+    pthread_mutex_lock(&ptFiller->tMutex);
+    for(;;)
+    {
+        while(!ptFiller->ptRequest && !ptFiller->bStop)
+        {
+            pthread_cond_wait(&ptFiller->tCond, &ptFiller->tMutex);
+        }
+        if(!ptFiller->ptRequest)
+        {
+            break;
+        }
+        JUNO_CRC_POSIX_FILL_T *ptFill = ptFiller->ptRequest;
+        pthread_mutex_unlock(&ptFiller->tMutex);
+        JunoCrc_PosixFill(ptFill);
+        pthread_mutex_lock(&ptFiller->tMutex);
+        ptFiller->ptRequest = NULL;
+        pthread_cond_broadcast(&ptFiller->tCond);
+    }
+    pthread_mutex_unlock(&ptFiller->tMutex);
+    return NULL;
+}
+
+/// Start the helper thread; false when it cannot be started
+static inline bool JunoCrc_PosixFillerStart(JUNO_CRC_POSIX_FILLER_T *ptFiller)
+{
+    ptFiller->ptRequest = NULL;
+    ptFiller->bStop = false;
+    if(pthread_mutex_init(&ptFiller->tMutex, NULL) != 0)
+    {
+        return false;
+    }
+    if(pthread_cond_init(&ptFiller->tCond, NULL) != 0)
+    {
+        pthread_mutex_destroy(&ptFiller->tMutex);
+        return false;
+    }
+    if(pthread_create(&ptFiller->tThread, NULL, JunoCrc_PosixFillerEntry, ptFiller) != 0)
+    {
+        pthread_cond_destroy(&ptFiller->tCond);
+        pthread_mutex_destroy(&ptFiller->tMutex);
+        return false;
+    }
+    return true;
+}
+
+/// Hand a buffer to the helper thread
+static inline void JunoCrc_PosixFillerPost(JUNO_CRC_POSIX_FILLER_T *ptFiller, JUNO_CRC_POSIX_FILL_T *ptFill)
+{
+    pthread_mutex_lock(&ptFiller->tMutex);
+    ptFiller->ptRequest = ptFill;
+    pthread_cond_broadcast(&ptFiller->tCond);
+    pthread_mutex_unlock(&ptFiller->tMutex);
+}
+
+/// Wait until the helper thread has filled the posted buffer
+static inline void JunoCrc_PosixFillerWait(JUNO_CRC_POSIX_FILLER_T *ptFiller)
+{
+    pthread_mutex_lock(&ptFiller->tMutex);
+    while(ptFiller->ptRequest)
+    {
+        pthread_cond_wait(&ptFiller->tCond, &ptFiller->tMutex);
+    }
+    pthread_mutex_unlock(&ptFiller->tMutex);
+}
+
+/// Stop and join the helper thread; no buffer may be outstanding
+static inline void JunoCrc_PosixFillerStop(JUNO_CRC_POSIX_FILLER_T *ptFiller)
+{
+    pthread_mutex_lock(&ptFiller->tMutex);
+    ptFiller->bStop = true;
+    pthread_cond_broadcast(&ptFiller->tCond);
+    pthread_mutex_unlock(&ptFiller->tMutex);
+    pthread_join(ptFiller->tThread, NULL);
+    pthread_cond_destroy(&ptFiller->tCond);
+    pthread_mutex_destroy(&ptFiller->tMutex);
+}
+
+/// Size of the next buffer, taken from the bytes still to read
+static inline size_t JunoCrc_PosixNextSize(uint64_t *piRemaining, size_t zBuffSize)
+{
+    size_t zWant = *piRemaining < zBuffSize ? (size_t)*piRemaining : zBuffSize;
+    *piRemaining -= zWant;
+    return zWant;
+}
+
+/**
+ * @brief Append the contents of a file to a CRC stream through mmap.
+ * @param ptStream Initialized stream.
+ * @param pcPath Path of the file.
+ * @return JUNO_STATUS_SUCCESS, JUNO_STATUS_NULLPTR_ERROR,
+ *         JUNO_STATUS_FILE_ERROR when the file cannot be opened or mapped, or
+ *         the stream's error.
+ */
+// @{"req": ["REQ-CRC-018"]}
+static inline JUNO_STATUS_T Juno_CrcStreamMmapFile(JUNO_CRC_STREAM_T *ptStream, const char *pcPath)
+{
+    if(!(ptStream && pcPath))
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    int iFd = open(pcPath, O_RDONLY);
+    if(iFd < 0)
+    {
+        return JUNO_STATUS_FILE_ERROR;
+    }
+    struct stat tStat;
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    if(fstat(iFd, &tStat) != 0 || tStat.st_size < 0)
+    {
+        tStatus = JUNO_STATUS_FILE_ERROR;
+    }
+    uint64_t iSize = tStatus == JUNO_STATUS_SUCCESS ? (uint64_t)tStat.st_size : 0;
+    // Hints only; failures do not affect the result
+    (void)posix_fadvise(iFd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    for(uint64_t iOffset = 0; iOffset < iSize && tStatus == JUNO_STATUS_SUCCESS; iOffset += JUNO_CRC_POSIX_WINDOW)
+    {
+        size_t zWindow = iSize - iOffset < JUNO_CRC_POSIX_WINDOW ? (size_t)(iSize - iOffset) : JUNO_CRC_POSIX_WINDOW;
+        if(iOffset + zWindow < iSize)
+        {
+            // Start reading the next window while this one is checksummed
+            (void)posix_fadvise(iFd, (off_t)(iOffset + zWindow), JUNO_CRC_POSIX_WINDOW, POSIX_FADV_WILLNEED);
+        }
+        void *pvMap = mmap(NULL, zWindow, PROT_READ, MAP_SHARED, iFd, (off_t)iOffset);
+        if(pvMap == MAP_FAILED)
+        {
+            tStatus = JUNO_STATUS_FILE_ERROR;
+            break;
+        }
+        (void)posix_madvise(pvMap, zWindow, POSIX_MADV_SEQUENTIAL);
+        tStatus = Juno_CrcStreamUpdate(ptStream, pvMap, zWindow);
+        munmap(pvMap, zWindow);
+    }
+    close(iFd);
+    return tStatus;
+}
+
+/**
+ * @brief Append a fixed-length stream read from an async I/O source to a CRC stream.
+ * @details Reads exactly @p iLength bytes. Before each Read the source is
+ *  polled for up to @p iTimeoutUs; a poll that finds no data fails the call
+ *  rather than truncating the stream. One helper thread serves the whole
+ *  call, so buffers of 64 KiB or more keep the per-buffer handoff
+ *  negligible.
+ * @param ptStream Initialized stream.
+ * @param ptIo Source read with ptIo->ptApi->Poll and ptIo->ptApi->Read.
+ * @param iLength Number of bytes in the stream.
+ * @param iTimeoutUs Longest wait for more data before each Read.
+ * @param pcBuffers Two adjacent buffers, 2 * @p zBuffSize bytes in total.
+ * @param zBuffSize Size of one buffer in bytes.
+ * @return JUNO_STATUS_SUCCESS, JUNO_STATUS_NULLPTR_ERROR,
+ *         JUNO_STATUS_INVALID_SIZE_ERROR when @p zBuffSize is 0,
+ *         JUNO_STATUS_TIMEOUT_ERROR when no data arrives within
+ *         @p iTimeoutUs, JUNO_STATUS_READ_ERROR when the source reports data
+ *         but reads 0 bytes, or the error of Poll, Read or the stream.
+ */
+// @{"req": ["REQ-CRC-018"]}
+static inline JUNO_STATUS_T Juno_CrcStreamAsyncIo(
+    JUNO_CRC_STREAM_T *ptStream,
+    JUNO_ASYNC_IO_ROOT_T *ptIo,
+    uint64_t iLength,
+    JUNO_TIME_MICROS_T iTimeoutUs,
+    char *pcBuffers,
+    size_t zBuffSize
+)
+{
+    if(!(ptStream && ptIo && ptIo->ptApi && ptIo->ptApi->Read && ptIo->ptApi->Poll && pcBuffers))
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    if(!zBuffSize)
+    {
+        return JUNO_STATUS_INVALID_SIZE_ERROR;
+    }
+    JUNO_CRC_POSIX_FILL_T atFill[2] = {
+        {ptIo, iTimeoutUs, pcBuffers, 0, 0, JUNO_STATUS_SUCCESS},
+        {ptIo, iTimeoutUs, &pcBuffers[zBuffSize], 0, 0, JUNO_STATUS_SUCCESS},
+    };
+    uint64_t iRemaining = iLength;
+    atFill[0].zWant = JunoCrc_PosixNextSize(&iRemaining, zBuffSize);
+    JunoCrc_PosixFill(&atFill[0]);
+    JUNO_CRC_POSIX_FILLER_T tFiller;
+    bool bThread = iRemaining && atFill[0].tStatus == JUNO_STATUS_SUCCESS && JunoCrc_PosixFillerStart(&tFiller);
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    for(size_t iCur = 0;; iCur ^= 1)
+    {
+        JUNO_CRC_POSIX_FILL_T *ptCur = &atFill[iCur];
+        JUNO_CRC_POSIX_FILL_T *ptNext = &atFill[iCur ^ 1];
+        tStatus = ptCur->tStatus;
+        if(tStatus != JUNO_STATUS_SUCCESS)
+        {
+            break;
+        }
+        ptNext->zWant = JunoCrc_PosixNextSize(&iRemaining, zBuffSize);
+        if(ptNext->zWant && bThread)
+        {
+            JunoCrc_PosixFillerPost(&tFiller, ptNext);
+        }
+        tStatus = Juno_CrcStreamUpdate(ptStream, ptCur->pcBuff, ptCur->zFilled);
+        if(ptNext->zWant)
+        {
+            if(bThread)
+            {
+                JunoCrc_PosixFillerWait(&tFiller);
+            }
+            else
+            {
+                JunoCrc_PosixFill(ptNext);
+            }
+        }
+        if(tStatus != JUNO_STATUS_SUCCESS || !ptNext->zWant)
+        {
+            break;
+        }
+    }
+    if(bThread)
+    {
+        JunoCrc_PosixFillerStop(&tFiller);
+    }
+    return tStatus;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_CRC_POSIX_H
@@ -0,0 +1,100 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file crc_pthread.h
+ * @brief POSIX threads reference executor for Juno_CrcParallel.
+ * @ingroup juno_crc
+ * @details
+ *  Header-only so the library itself never depends on pthreads; include it
+ *  from hosted code and link with the platform's threads library.
+ *  Juno_CrcPthreadExecutor runs the first job on the calling thread and one
+ *  thread per remaining job, then joins them. A job whose thread cannot be
+ *  created runs on the calling thread instead, so the result never depends
+ *  on thread availability.
+ */
+#ifndef JUNO_CRC_PTHREAD_H
+#define JUNO_CRC_PTHREAD_H
+#include "juno/crc/crc_parallel.h"
+#include "juno/status.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Most jobs Juno_CrcPthreadExecutor accepts in one call
+#define JUNO_CRC_PTHREAD_MAX_JOBS (64u)
+
+/// Thread entry running one CRC job
+static inline void *JunoCrc_PthreadEntry(void *pvJob)
+{
+    Juno_CrcJobRun((JUNO_CRC_JOB_T *)pvJob);
+    return NULL;
+}
+
+/**
+ * @brief JUNO_CRC_EXECUTOR_T running each job on its own POSIX thread.
+ * @param ptJobs Jobs to run.
+ * @param zJobs Number of jobs, at most JUNO_CRC_PTHREAD_MAX_JOBS.
+ * @param pvUserData Unused.
+ * @return JUNO_STATUS_SUCCESS, or JUNO_STATUS_INVALID_SIZE_ERROR when
+ *         @p zJobs exceeds JUNO_CRC_PTHREAD_MAX_JOBS.
+ */
+// @{"req": ["REQ-CRC-014"]}
+static inline JUNO_STATUS_T Juno_CrcPthreadExecutor(JUNO_CRC_JOB_T *ptJobs, size_t zJobs, JUNO_USER_DATA_T *pvUserData)
+{
+    (void)pvUserData;
+    if(zJobs > JUNO_CRC_PTHREAD_MAX_JOBS)
+    {
+        return JUNO_STATUS_INVALID_SIZE_ERROR;
+    }
+    pthread_t atThreads[JUNO_CRC_PTHREAD_MAX_JOBS];
+    bool abStarted[JUNO_CRC_PTHREAD_MAX_JOBS] = {false};
+    for(size_t i = 1; i < zJobs; i++)
+    {
+        abStarted[i] = pthread_create(&atThreads[i], NULL, JunoCrc_PthreadEntry, &ptJobs[i]) == 0;
+        if(!abStarted[i])
+        {
+            Juno_CrcJobRun(&ptJobs[i]);
+        }
+    }
+    if(zJobs)
+    {
+        Juno_CrcJobRun(&ptJobs[0]);
+    }
+    for(size_t i = 1; i < zJobs; i++)
+    {
+        if(abStarted[i])
+        {
+            pthread_join(atThreads[i], NULL);
+        }
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_CRC_PTHREAD_H
@@ -0,0 +1,107 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file crc_stream.h
+ * @brief Incremental CRC of any variant fed in arbitrary chunks.
+ * @ingroup juno_crc
+ * @details
+ *  A JUNO_CRC_STREAM_T keeps the CRC register of one variant between calls
+ *  and undoes the variant's final XOR at every chunk boundary, so callers
+ *  never juggle JUNO_*_CRC_INIT seeds or XOR conventions. Feeding the same
+ *  bytes in any chunking yields the same result as one call of the variant's
+ *  update function over all of them.
+ *
+ *  @code{.c}
+ *  JUNO_CRC_STREAM_T tStream;
+ *  Juno_CrcStreamInit(&tStream, JUNO_CRC_KIND_CASTAGNOLI);
+ *  Juno_CrcStreamUpdate(&tStream, pcHeader, zHeaderSize);
+ *  Juno_CrcStreamUpdate(&tStream, pcBody, zBodySize);
+ *  JUNO_RESULT_UINT64_T tCrc = Juno_CrcStreamFinal(&tStream);
+ *  @endcode
+ *
+ *  juno/crc/crc_posix.h drives a stream over memory-mapped files and async
+ *  I/O sources on hosted POSIX targets.
+ */
+#ifndef JUNO_CRC_STREAM_H
+#define JUNO_CRC_STREAM_H
+#include "juno/crc/crc_parallel.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_CRC_STREAM_TAG JUNO_CRC_STREAM_T;
+
+/// Running CRC of a byte stream
+// @{"req": ["REQ-CRC-018"]}
+struct JUNO_CRC_STREAM_TAG
+{
+    /// CRC variant of the stream
+    JUNO_CRC_KIND_T tKind;
+    /// CRC register, the seed of the next update call
+    uint64_t iCrc;
+    /// Bytes processed so far
+    uint64_t iLength;
+};
+
+/**
+ * @brief Start a stream with the variant's JUNO_*_CRC_INIT seed.
+ * @param ptStream Stream to initialize.
+ * @param tKind CRC variant.
+ * @return JUNO_STATUS_SUCCESS, JUNO_STATUS_NULLPTR_ERROR or
+ *         JUNO_STATUS_INVALID_TYPE_ERROR.
+ */
+// @{"req": ["REQ-CRC-018"]}
+JUNO_STATUS_T Juno_CrcStreamInit(JUNO_CRC_STREAM_T *ptStream, JUNO_CRC_KIND_T tKind);
+
+/**
+ * @brief Append a chunk to the stream.
+ * @param ptStream Initialized stream.
+ * @param pcData Chunk to checksum (can be NULL when @p zDataSize is 0).
+ * @param zDataSize Size of the chunk in bytes.
+ * @return JUNO_STATUS_SUCCESS, JUNO_STATUS_NULLPTR_ERROR or
+ *         JUNO_STATUS_INVALID_TYPE_ERROR.
+ */
+// @{"req": ["REQ-CRC-018"]}
+JUNO_STATUS_T Juno_CrcStreamUpdate(JUNO_CRC_STREAM_T *ptStream, const void *pcData, size_t zDataSize);
+
+/**
+ * @brief CRC of everything appended so far.
+ * @details The value has the form the variant's update function returns,
+ *  including its final XOR, and is 0 for an empty stream like the update
+ *  functions. The stream can keep receiving data afterwards.
+ * @param ptStream Initialized stream.
+ * @return The CRC, or JUNO_STATUS_NULLPTR_ERROR or
+ *         JUNO_STATUS_INVALID_TYPE_ERROR.
+ */
+// @{"req": ["REQ-CRC-018"]}
+JUNO_RESULT_UINT64_T Juno_CrcStreamFinal(const JUNO_CRC_STREAM_T *ptStream);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_CRC_STREAM_H
@@ -41,6 +41,10 @@
  *  - Implementations must define how SetAt copies into storage, how GetAt
  *    returns a pointer descriptor to the slot, and how RemoveAt clears a slot
  *    (typically via the pointer API's Reset).
+ *  - GetAt must have no side effects. Containers store trivially-copyable
+ *    items (JunoMemory_PointerIsTrivial) with JunoDs_ArrayStore, which copies
+ *    into the slot returned by GetAt instead of calling SetAt, so for those
+ *    items SetAt must do nothing beyond that copy.
  */
 #ifndef JUNO_DS_ARRAY_API_H
 #define JUNO_DS_ARRAY_API_H
@@ -172,6 +176,30 @@ static inline JUNO_STATUS_T JunoDs_ArrayInit(JUNO_DS_ARRAY_ROOT_T *ptArray, cons
     return tStatus;
 }
 
+/**
+ * @brief Store tItem at iIndex, inline for trivially-copyable items.
+ * @ingroup juno_ds_array
+ * @details When tItem's API is trivial and GetAt returns a slot with the same
+ *  API, the bytes are copied into the slot without calling SetAt. Otherwise
+ *  SetAt is called. Containers use this in place of
+ *  `ptArray->ptApi->SetAt(ptArray, tItem, iIndex)`.
+ * @return JUNO_STATUS_SUCCESS on success, error code otherwise.
+ */
+// @{"req": ["REQ-ARRAY-002", "REQ-POINTER-006"]}
+static inline JUNO_STATUS_T JunoDs_ArrayStore(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    if(JunoMemory_PointerIsTrivial(tItem.ptApi))
+    {
+        JUNO_RESULT_POINTER_T tSlot = ptArray->ptApi->GetAt(ptArray, iIndex);
+        JUNO_ASSERT_SUCCESS(tSlot.tStatus, return tSlot.tStatus);
+        if(tSlot.tOk.ptApi == tItem.ptApi)
+        {
+            return JunoMemory_PointerCopy(tSlot.tOk, tItem);
+        }
+    }
+    return ptArray->ptApi->SetAt(ptArray, tItem, iIndex);
+}
+
 #ifdef __cplusplus
 }
 #endif
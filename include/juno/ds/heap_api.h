@@ -35,10 +35,16 @@
  *    by the backing array.
  *  - Time complexity: Insert O(log n), Pop O(log n), Update O(log n),
  *    SiftDown O(log n), Heapify O(n).
+ *  - The tree is binary by default. JunoDs_Heap_SetArity selects a 4-ary or
+ *    8-ary layout: node i has children d*i+1 .. d*i+d, so siblings are
+ *    adjacent in storage and the tree is log2(d) times shallower. Sifting
+ *    up compares once per level; sifting down compares up to d times per
+ *    level, so wider trees favor Pop-heavy workloads on large heaps.
  *  - Non-thread-safe by default; protect externally as needed.
  *
  *  Invariants (enforced by implementation and Verify):
  *  - 0 <= zLength <= ptHeapArray->zCapacity
+ *  - zArity is 2, 4 or 8
  *  - All required function pointers are non-NULL (heap API, pointer API, array API)
  *  - Backing array verifies via JunoDs_ArrayVerify.
  *
@@ -101,6 +107,7 @@ struct JUNO_DS_HEAP_ROOT_TAG JUNO_MODULE_ROOT(JUNO_DS_HEAP_API_T,
     const JUNO_DS_HEAP_POINTER_API_T *ptHeapPointerApi; /**< Element compare/swap callbacks. */
     JUNO_DS_ARRAY_ROOT_T *ptHeapArray;                  /**< Backing array defining capacity and element ops. */
     size_t zLength;                                     /**< Current number of elements in the heap. */
+    size_t zArity;                                      /**< Children per node: 2, 4 or 8 (JunoDs_Heap_SetArity). */
 );
 
 /**
@@ -192,6 +199,43 @@ JUNO_STATUS_T JunoDs_Heap_Pop(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tRetur
  */
 JUNO_STATUS_T JunoDs_Heap_Init(JUNO_DS_HEAP_ROOT_T *ptHeap, const JUNO_DS_HEAP_POINTER_API_T *ptHeapPointerApi, JUNO_DS_ARRAY_ROOT_T *ptHeapArray, JUNO_FAILURE_HANDLER_T pfcnFailureHdlr, JUNO_USER_DATA_T *pvUserData);
 
+/** @brief Default number of children per heap node. */
+#define JUNO_DS_HEAP_ARITY_DEFAULT 2
+
+/**
+ * @brief Select the number of children per node.
+ * @ingroup juno_ds_heap
+ * @details Applies to every heap implementation sharing the root. Call it
+ *  while the heap is empty, or call Heapify afterwards.
+ * @param ptHeap Initialized heap.
+ * @param zArity 2, 4 or 8.
+ * @return JUNO_STATUS_SUCCESS on success; JUNO_STATUS_INVALID_SIZE_ERROR for
+ *         any other arity; or verification errors.
+ */
+// @{"req": ["REQ-HEAP-015"]}
+JUNO_STATUS_T JunoDs_Heap_SetArity(JUNO_DS_HEAP_ROOT_T *ptHeap, size_t zArity);
+
+/**
+ * @brief Check that zArity is a supported number of children per node.
+ * @ingroup juno_ds_heap
+ */
+// @{"req": ["REQ-HEAP-015"]}
+static inline bool JunoDs_Heap_ArityValid(size_t zArity)
+{
+    return zArity == 2 || zArity == 4 || zArity == 8;
+}
+
+/**
+ * @brief log2 of a valid arity, so child and parent indices need no division.
+ * @ingroup juno_ds_heap
+ */
+// @{"req": ["REQ-HEAP-015"]}
+static inline size_t JunoDs_Heap_ArityShift(const JUNO_DS_HEAP_ROOT_T *ptHeap)
+{
+    // 2 -> 1, 4 -> 2, 8 -> 3
+    return (ptHeap->zArity >> 2) + 1;
+}
+
 /**
  * @brief Sift down from a starting index to restore the heap property.
  *
@@ -238,6 +282,11 @@ static inline JUNO_STATUS_T JunoDs_Heap_Verify(JUNO_DS_HEAP_ROOT_T *ptHeap)
         ptHeap->ptApi->Heapify &&
         ptHeap->ptApi->Pop
     );
+    if(!JunoDs_Heap_ArityValid(ptHeap->zArity))
+    {
+        JUNO_FAIL_ROOT(JUNO_STATUS_INVALID_SIZE_ERROR, ptHeap, "Heap arity must be 2, 4 or 8");
+        return JUNO_STATUS_INVALID_SIZE_ERROR;
+    }
     return JunoDs_ArrayVerify(ptHeap->ptHeapArray);
 }
 #ifdef __cplusplus
@@ -0,0 +1,140 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file heap_fast.h
+ * @brief Binary heap over contiguous storage with hole-based sifting.
+ * @defgroup juno_ds_heap_fast Fast Heap
+ * @ingroup juno_ds_heap
+ * @details
+ *  Implements JUNO_DS_HEAP_API_T for the same heap root, pointer API and
+ *  backing array as JunoDs_Heap_Init, with a cheaper inner loop:
+ *  - The heap is verified once per operation, not once per level.
+ *  - Element addresses are computed from slot 0 instead of calling GetAt,
+ *    so the backing array must store its elements contiguously.
+ *    JunoDs_HeapFastInit checks every slot once.
+ *  - Sifting moves a "hole" instead of swapping: each level costs one
+ *    element copy, and the sifted element is written once at its final
+ *    slot. Copies go through JunoMemory_PointerCopy, so trivially-copyable
+ *    elements are copied inline. Swap is never called.
+ *  - JunoDs_HeapFastSetKey replaces the Compare callback with an inline
+ *    comparison of an integer key stored at a fixed offset in each element.
+ *  - The root's zArity applies, so JunoDs_Heap_SetArity selects a 4-ary or
+ *    8-ary layout.
+ *
+ *  Heapify sifts through a caller-supplied scratch element. An error from
+ *  Compare or Copy in the middle of an operation leaves the heap contents
+ *  unspecified.
+ */
+#ifndef JUNO_DS_HEAP_FAST_H
+#define JUNO_DS_HEAP_FAST_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/heap_api.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/status.h"
+#include <stdbool.h>
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_DS_HEAP_FAST_TAG JUNO_DS_HEAP_FAST_T;
+
+/**
+ * @brief Key type compared inline by the fast heap.
+ * @ingroup juno_ds_heap_fast
+ */
+typedef enum JUNO_DS_HEAP_KEY_TAG
+{
+    /// Compare elements with ptHeapPointerApi->Compare
+    JUNO_DS_HEAP_KEY_NONE = 0,
+    JUNO_DS_HEAP_KEY_U32 = 1,
+    JUNO_DS_HEAP_KEY_U64 = 2,
+    JUNO_DS_HEAP_KEY_I32 = 3,
+    JUNO_DS_HEAP_KEY_I64 = 4,
+} JUNO_DS_HEAP_KEY_T;
+
+/**
+ * @brief Fast heap instance.
+ * @ingroup juno_ds_heap_fast
+ */
+// @{"req": ["REQ-HEAP-009"]}
+struct JUNO_DS_HEAP_FAST_TAG JUNO_MODULE_DERIVE(JUNO_DS_HEAP_ROOT_T,
+    /// Descriptor of slot 0; slot i is i * tElement.zSize bytes after it.
+    JUNO_POINTER_T tElement;
+    /// Scratch element used by Heapify.
+    JUNO_POINTER_T tScratch;
+    /// Key compared inline, JUNO_DS_HEAP_KEY_NONE to call Compare.
+    JUNO_DS_HEAP_KEY_T tKey;
+    /// Byte offset of the key in an element.
+    size_t zKeyOffset;
+    /// true when the smallest key is at the root.
+    bool bMinHeap;
+);
+
+/**
+ * @brief Initialize a fast heap.
+ * @ingroup juno_ds_heap_fast
+ * @param ptHeap Heap to initialize; starts empty and uses Compare.
+ * @param ptHeapPointerApi Element callbacks; Compare defines the order (Swap
+ *        must be set but is not used).
+ * @param ptHeapArray Backing array with contiguous, equally sized slots.
+ * @param tScratch Storage for one element of the array's type.
+ * @param pfcnFailureHdlr Optional failure handler.
+ * @param pvUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success; JUNO_STATUS_INVALID_TYPE_ERROR when
+ *         the slots are not contiguous or tScratch is not an element; or
+ *         verification errors.
+ */
+// @{"req": ["REQ-HEAP-009"]}
+JUNO_STATUS_T JunoDs_HeapFastInit(
+    JUNO_DS_HEAP_FAST_T *ptHeap,
+    const JUNO_DS_HEAP_POINTER_API_T *ptHeapPointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptHeapArray,
+    JUNO_POINTER_T tScratch,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvUserData
+);
+
+/**
+ * @brief Order the heap by an integer key compared inline.
+ * @ingroup juno_ds_heap_fast
+ * @details Only valid for elements whose order is fully defined by the key.
+ *  Pass JUNO_DS_HEAP_KEY_NONE to go back to the Compare callback. Call it
+ *  while the heap is empty, or call Heapify afterwards.
+ * @param ptHeap Initialized fast heap.
+ * @param tKey Key type.
+ * @param zKeyOffset Byte offset of the key in an element (offsetof).
+ * @param bMinHeap true for the smallest key at the root, false for the largest.
+ * @return JUNO_STATUS_SUCCESS on success; JUNO_STATUS_INVALID_SIZE_ERROR when
+ *         the key does not fit in an element or is misaligned;
+ *         JUNO_STATUS_INVALID_TYPE_ERROR for an unknown key type.
+ */
+// @{"req": ["REQ-HEAP-010"]}
+JUNO_STATUS_T JunoDs_HeapFastSetKey(JUNO_DS_HEAP_FAST_T *ptHeap, JUNO_DS_HEAP_KEY_T tKey, size_t zKeyOffset, bool bMinHeap);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_DS_HEAP_FAST_H
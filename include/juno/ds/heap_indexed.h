@@ -0,0 +1,219 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+/**
+ * @file heap_indexed.h
+ * @brief Indexed binary heap with O(log n) update and remove by handle.
+ * @defgroup juno_ds_heap_indexed Indexed Heap
+ * @ingroup juno_ds_heap
+ * @details
+ *  Every slot of the backing array is an element addressed by a handle, its
+ *  index in the array. Elements never move: the heap orders handles in a
+ *  caller-supplied handle array and records where each handle sits in a
+ *  caller-supplied position array, so a queued element can be reprioritized
+ *  or removed in O(log n) and the root is read in O(1) without a copy.
+ *
+ *  The handle array is a permutation of all handles:
+ *  - pzHeap[0, zLength) are the queued handles in heap order.
+ *  - pzHeap[zLength, zCapacity) are the free handles.
+ *  - pzPositions[h] is the slot of handle h in pzHeap, so h is queued when
+ *    pzPositions[h] < zLength.
+ *  Insert takes the first free handle in O(1); InsertHandle queues a
+ *  specific one.
+ *
+ *  The root API is JUNO_DS_HEAP_API_T, with Compare from ptHeapPointerApi
+ *  defining the order (Swap must be set but is not used). Like the fast
+ *  heap, element addresses are computed from slot 0, so the backing array
+ *  must store its elements contiguously; JunoDs_HeapIndexedInit checks every
+ *  slot once. Heapify restores the order of the queued handles after their
+ *  elements were modified in place through JunoDs_HeapIndexedGet.
+ *  The root's zArity applies, so JunoDs_Heap_SetArity selects a 4-ary or
+ *  8-ary layout.
+ *
+ *  Removing a handle leaves its element in the backing array until the
+ *  handle is reused. An error from Compare in the middle of an operation
+ *  leaves the order unspecified; the handle and position arrays stay
+ *  consistent.
+ */
+#ifndef JUNO_DS_HEAP_INDEXED_H
+#define JUNO_DS_HEAP_INDEXED_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/heap_api.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_DS_HEAP_INDEXED_TAG JUNO_DS_HEAP_INDEXED_T;
+
+/**
+ * @brief A queued element and its handle.
+ * @ingroup juno_ds_heap_indexed
+ */
+typedef struct JUNO_DS_HEAP_ENTRY_TAG
+{
+    /// Handle of the element.
+    size_t zHandle;
+    /// The element in the backing array.
+    JUNO_POINTER_T tElement;
+} JUNO_DS_HEAP_ENTRY_T;
+
+/** @brief Result carrying a queued element and its handle. */
+JUNO_MODULE_RESULT(JUNO_DS_HEAP_ENTRY_RESULT_T, JUNO_DS_HEAP_ENTRY_T);
+
+/**
+ * @brief Indexed heap instance.
+ * @ingroup juno_ds_heap_indexed
+ */
+// @{"req": ["REQ-HEAP-011"]}
+struct JUNO_DS_HEAP_INDEXED_TAG JUNO_MODULE_DERIVE(JUNO_DS_HEAP_ROOT_T,
+    /// Descriptor of element 0; element h is h * tElement.zSize bytes after it.
+    JUNO_POINTER_T tElement;
+    /// Handles, queued in heap order then free (length == capacity).
+    size_t *pzHeap;
+    /// Slot of every handle in pzHeap (length == capacity).
+    size_t *pzPositions;
+);
+
+/**
+ * @brief Initialize an empty indexed heap with every handle free.
+ * @ingroup juno_ds_heap_indexed
+ * @param ptHeap Heap to initialize.
+ * @param ptHeapPointerApi Element callbacks; Compare defines the order.
+ * @param ptHeapArray Backing array with contiguous, equally sized slots.
+ * @param pzHeap Handle storage, one entry per array slot.
+ * @param pzPositions Position storage, one entry per array slot.
+ * @param pfcnFailureHdlr Optional failure handler.
+ * @param pvUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success; JUNO_STATUS_INVALID_TYPE_ERROR when
+ *         the slots are not contiguous; or verification errors.
+ */
+// @{"req": ["REQ-HEAP-011"]}
+JUNO_STATUS_T JunoDs_HeapIndexedInit(
+    JUNO_DS_HEAP_INDEXED_T *ptHeap,
+    const JUNO_DS_HEAP_POINTER_API_T *ptHeapPointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptHeapArray,
+    size_t *pzHeap,
+    size_t *pzPositions,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvUserData
+);
+
+/**
+ * @brief Queue a copy of tValue under the first free handle.
+ * @ingroup juno_ds_heap_indexed
+ * @param ptHeap Indexed heap.
+ * @param tValue Element to copy in.
+ * @return The handle on success; JUNO_STATUS_ERR when full;
+ *         JUNO_STATUS_INVALID_TYPE_ERROR when tValue is not an element.
+ * @note Complexity O(log n).
+ */
+// @{"req": ["REQ-HEAP-012"]}
+JUNO_DS_HEAP_INDEX_RESULT_T JunoDs_HeapIndexedInsert(JUNO_DS_HEAP_INDEXED_T *ptHeap, JUNO_POINTER_T tValue);
+
+/**
+ * @brief Queue a copy of tValue under a specific free handle.
+ * @ingroup juno_ds_heap_indexed
+ * @param ptHeap Indexed heap.
+ * @param zHandle Handle to queue.
+ * @param tValue Element to copy in.
+ * @return JUNO_STATUS_SUCCESS on success; JUNO_STATUS_OOB_ERROR for a handle
+ *         outside the array; JUNO_STATUS_REF_IN_USE_ERROR when the handle is
+ *         already queued; JUNO_STATUS_INVALID_TYPE_ERROR when tValue is not
+ *         an element.
+ * @note Complexity O(log n).
+ */
+// @{"req": ["REQ-HEAP-012"]}
+JUNO_STATUS_T JunoDs_HeapIndexedInsertHandle(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle, JUNO_POINTER_T tValue);
+
+/**
+ * @brief Replace the element of a queued handle and restore the heap order.
+ * @ingroup juno_ds_heap_indexed
+ * @details The element moves toward the root or the leaves, whichever its
+ *  new value requires (decrease-key and increase-key).
+ * @param ptHeap Indexed heap.
+ * @param zHandle Queued handle.
+ * @param tValue New element value to copy in.
+ * @return JUNO_STATUS_SUCCESS on success; JUNO_STATUS_OOB_ERROR for a handle
+ *         outside the array; JUNO_STATUS_DNE_ERROR when the handle is not
+ *         queued; JUNO_STATUS_INVALID_TYPE_ERROR when tValue is not an element.
+ * @note Complexity O(log n).
+ */
+// @{"req": ["REQ-HEAP-013"]}
+JUNO_STATUS_T JunoDs_HeapIndexedUpdate(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle, JUNO_POINTER_T tValue);
+
+/**
+ * @brief Dequeue a handle wherever it is in the heap.
+ * @ingroup juno_ds_heap_indexed
+ * @param ptHeap Indexed heap.
+ * @param zHandle Queued handle; it becomes free.
+ * @return JUNO_STATUS_SUCCESS on success; JUNO_STATUS_OOB_ERROR for a handle
+ *         outside the array; JUNO_STATUS_DNE_ERROR when the handle is not
+ *         queued.
+ * @note Complexity O(log n).
+ */
+// @{"req": ["REQ-HEAP-013"]}
+JUNO_STATUS_T JunoDs_HeapIndexedRemove(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle);
+
+/**
+ * @brief Get the root handle and its element without copying it.
+ * @ingroup juno_ds_heap_indexed
+ * @param ptHeap Indexed heap.
+ * @return The root entry on success; JUNO_STATUS_ERR when empty.
+ * @note Complexity O(1).
+ */
+// @{"req": ["REQ-HEAP-014"]}
+JUNO_DS_HEAP_ENTRY_RESULT_T JunoDs_HeapIndexedPeek(JUNO_DS_HEAP_INDEXED_T *ptHeap);
+
+/**
+ * @brief Get the element of a handle without copying it.
+ * @ingroup juno_ds_heap_indexed
+ * @details Modifying a queued element in place requires Update or Heapify
+ *  afterwards.
+ * @param ptHeap Indexed heap.
+ * @param zHandle Handle, queued or free.
+ * @return The element on success; JUNO_STATUS_OOB_ERROR for a handle outside
+ *         the array.
+ */
+// @{"req": ["REQ-HEAP-014"]}
+JUNO_RESULT_POINTER_T JunoDs_HeapIndexedGet(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle);
+
+/**
+ * @brief Check whether a handle is queued.
+ * @ingroup juno_ds_heap_indexed
+ * @param ptHeap Indexed heap.
+ * @param zHandle Handle to check.
+ * @return true when queued; JUNO_STATUS_OOB_ERROR for a handle outside the
+ *         array.
+ */
+// @{"req": ["REQ-HEAP-014"]}
+JUNO_RESULT_BOOL_T JunoDs_HeapIndexedContains(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_DS_HEAP_INDEXED_H
@@ -75,8 +75,57 @@ struct JUNO_MAP_ROOT_TAG JUNO_MODULE_ROOT(JUNO_MAP_API_T,
     const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi; /**< Key hash and null-check callbacks. */
     const JUNO_VALUE_POINTER_API_T *ptValuePointerApi;           /**< Equality comparator for keys. */
     JUNO_DS_ARRAY_ROOT_T *ptHashMap;                             /**< Backing array used as the hash table. */
+    size_t zEqualsCalls;                                         /**< Equals calls since init or JunoDs_MapStatsReset. */
 );
 
+/**
+ * @brief Iteration cursor over the occupied slots of a map.
+ * @ingroup juno_ds_map
+ * @details Zero-initialize to start at the first slot.
+ */
+// @{"req": ["REQ-MAP-024"]}
+typedef struct JUNO_MAP_CURSOR_TAG
+{
+    /// Next slot to visit.
+    size_t iSlot;
+} JUNO_MAP_CURSOR_T;
+
+/**
+ * @brief Occupancy and probe statistics of a map.
+ * @ingroup juno_ds_map
+ * @details Each map measures probe distances the way it probes: slots from
+ *  the home slot for the linear-probing, Robin Hood and cached-hash maps,
+ *  groups from the home group for the Swiss-table map and 0 for the
+ *  perfect-hash map. The mean probe distance is zTotalProbe / zOccupied.
+ */
+// @{"req": ["REQ-MAP-026"]}
+typedef struct JUNO_MAP_STATS_TAG
+{
+    /// Number of slots.
+    size_t zCapacity;
+    /// Number of occupied slots.
+    size_t zOccupied;
+    /// Sum of the probe distances of the occupied slots.
+    size_t zTotalProbe;
+    /// Largest probe distance.
+    size_t zMaxProbe;
+    /// Equals calls since init or JunoDs_MapStatsReset.
+    size_t zEqualsCalls;
+} JUNO_MAP_STATS_T;
+
+/** @brief Result type carrying map statistics. */
+JUNO_MODULE_RESULT(JUNO_MAP_STATS_RESULT_T, JUNO_MAP_STATS_T);
+/** @brief Probe distance of a slot, none when the slot is empty. */
+JUNO_MODULE_OPTION(JUNO_MAP_PROBE_OPTION_T, size_t);
+/** @brief Result type carrying an optional probe distance. */
+JUNO_MODULE_RESULT(JUNO_MAP_PROBE_OPTION_RESULT_T, JUNO_MAP_PROBE_OPTION_T);
+/**
+ * @brief Report the probe distance of a slot of a verified map.
+ * @ingroup juno_ds_map
+ * @details Returns none for an empty slot. iSlot is below the capacity.
+ */
+typedef JUNO_MAP_PROBE_OPTION_RESULT_T (*JUNO_MAP_PROBE_DISTANCE_T)(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot);
+
 /**
  * @brief Hashing and null-check operations for map keys/values.
  * @ingroup juno_ds_map
@@ -144,6 +193,31 @@ static inline JUNO_STATUS_T JunoDs_MapVerify(JUNO_MAP_ROOT_T *ptMap)
     return tStatus;
 }
 
+/**
+ * @brief Compare a key against a stored entry and count the call.
+ * @ingroup juno_ds_map
+ * @details Map implementations call Equals through this helper so that
+ *  JunoDs_MapStats can report the number of key comparisons.
+ */
+// @{"req": ["REQ-MAP-026"]}
+static inline JUNO_RESULT_BOOL_T JunoDs_MapEquals(JUNO_MAP_ROOT_T *ptMap, const JUNO_POINTER_T tKey, const JUNO_POINTER_T tEntry)
+{
+    ptMap->zEqualsCalls += 1;
+    return ptMap->ptValuePointerApi->Equals(tKey, tEntry);
+}
+
+/**
+ * @brief Circular distance from a home position to a later position.
+ * @ingroup juno_ds_map
+ * @details Both positions must be below zCount; used by the probe distance
+ *  functions of the map implementations.
+ */
+// @{"req": ["REQ-MAP-026"]}
+static inline size_t JunoDs_MapWrapDistance(size_t iPos, size_t iHome, size_t zCount)
+{
+    return iPos >= iHome ? iPos - iHome : iPos + zCount - iHome;
+}
+
 /**
  * @brief Initialize the map root with hashing/equality APIs and backing array.
  * @ingroup juno_ds_map
@@ -157,6 +231,18 @@ static inline JUNO_STATUS_T JunoDs_MapVerify(JUNO_MAP_ROOT_T *ptMap)
  */
 JUNO_STATUS_T JunoDs_MapInit(JUNO_MAP_ROOT_T *ptMapRoot, const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi, const JUNO_VALUE_POINTER_API_T *ptValuePointerApi, JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_FAILURE_HANDLER_T pfcnFailureHandler, JUNO_USER_DATA_T *pvUserData);
 
+/**
+ * @brief Initialize a map whose capacity is a power of two.
+ * @ingroup juno_ds_map
+ * @details Same as JunoDs_MapInit, but the map API (ptApi) wraps probe
+ *  indices with a mask instead of a modulo. JunoDs_MapGet/Set/Remove remain
+ *  valid on the map.
+ * @return JUNO_STATUS_SUCCESS on success; JUNO_STATUS_INVALID_SIZE_ERROR if the
+ *         array capacity is not a power of two; or a verification error.
+ */
+// @{"req": ["REQ-MAP-011"]}
+JUNO_STATUS_T JunoDs_MapInitPow2(JUNO_MAP_ROOT_T *ptMapRoot, const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi, const JUNO_VALUE_POINTER_API_T *ptValuePointerApi, JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_FAILURE_HANDLER_T pfcnFailureHandler, JUNO_USER_DATA_T *pvUserData);
+
 /**
  * @brief Retrieve an entry by key via linear probing.
  * @ingroup juno_ds_map
@@ -188,6 +274,71 @@ JUNO_STATUS_T JunoDs_MapSet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
  *         encountered); or errors from hashing/pointer/array operations.
  */
 JUNO_STATUS_T JunoDs_MapRemove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tKey);
+
+/**
+ * @brief Visit the next occupied slot in storage order.
+ * @ingroup juno_ds_map
+ * @details Works with every map implementation whose slots are cleared with
+ *  the array's RemoveAt, using IsValueNull to skip empty slots. Modifying
+ *  the map while iterating may skip or repeat entries.
+ * @param ptJunoMap Map instance.
+ * @param ptCursor Cursor, zero-initialized before the first call.
+ * @return A pointer to the next occupied entry, or JUNO_STATUS_OOB_ERROR when
+ *         every slot has been visited.
+ */
+// @{"req": ["REQ-MAP-024"]}
+JUNO_RESULT_POINTER_T JunoDs_MapNext(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_MAP_CURSOR_T *ptCursor);
+
+/**
+ * @brief Insert or update several entries.
+ * @ingroup juno_ds_map
+ * @details The map is verified once for the whole batch when it uses the
+ *  linear-probing API (JunoDs_MapInit or JunoDs_MapInitPow2); other map
+ *  implementations are driven through ptApi->Set. Entries are written in
+ *  order and the call stops at the first error.
+ * @param ptJunoMap Map instance.
+ * @param ptItems Entries to write.
+ * @param zItems Number of entries.
+ * @return The number of entries written. On error, tStatus holds the error
+ *         and tOk the index of the failed entry.
+ */
+// @{"req": ["REQ-MAP-025"]}
+JUNO_RESULT_SIZE_T JunoDs_MapSetMany(JUNO_MAP_ROOT_T *ptJunoMap, const JUNO_POINTER_T *ptItems, size_t zItems);
+
+/**
+ * @brief Compute occupancy and probe statistics of a linear-probing map.
+ * @ingroup juno_ds_map
+ * @details Applies to maps set up by JunoDs_MapInit or JunoDs_MapInitPow2.
+ *  The other map implementations provide their own statistics function,
+ *  such as JunoDs_MapRobinHoodStats.
+ * @param ptJunoMap Map instance.
+ * @return The statistics, JUNO_STATUS_INVALID_TYPE_ERROR for another map
+ *         implementation, or an error from verification, hashing or array
+ *         access.
+ */
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapStats(JUNO_MAP_ROOT_T *ptJunoMap);
+
+/**
+ * @brief Compute map statistics by measuring every slot with pfcnProbeDistance.
+ * @ingroup juno_ds_map
+ * @details Shared by the statistics functions of the map implementations,
+ *  which pass the probe distance function matching their placement rules.
+ * @param ptJunoMap Map instance.
+ * @param pfcnProbeDistance Probe distance of a slot, none when it is empty.
+ * @return The statistics, or an error from verification or pfcnProbeDistance.
+ */
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapStatsScan(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_MAP_PROBE_DISTANCE_T pfcnProbeDistance);
+
+/**
+ * @brief Reset the Equals call counter.
+ * @ingroup juno_ds_map
+ * @param ptJunoMap Map instance.
+ * @return JUNO_STATUS_SUCCESS, or JUNO_STATUS_NULLPTR_ERROR for a NULL map.
+ */
+// @{"req": ["REQ-MAP-026"]}
+JUNO_STATUS_T JunoDs_MapStatsReset(JUNO_MAP_ROOT_T *ptJunoMap);
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,104 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file map_cached_hash.h
+ * @brief Linear-probing hash map that caches each slot's hash.
+ * @defgroup juno_ds_map_cached_hash Cached-Hash Map
+ * @ingroup juno_ds_map
+ * @details
+ *  Implements JUNO_MAP_API_T over the same user-supplied backing array and
+ *  pointer APIs as the linear-probing map, plus a caller-supplied array with
+ *  one hash tag per slot. A tag is the key's hash with its top bit set; 0
+ *  marks an empty slot, so the top bit of the hash is not compared.
+ *
+ *  - Probing reads only the tag array. Equals is called only when a tag
+ *    matches the key's full hash, and IsValueNull is never called.
+ *  - Remove uses the cached home slots to move later entries of the probe
+ *    chain back into the freed slot (backward-shift deletion), so no chain
+ *    is broken and no key is hashed again.
+ *
+ *  Hashes that differ only in the top bit share a tag; keys are still
+ *  compared with Equals, so this only costs an extra comparison.
+ */
+#ifndef JUNO_DS_MAP_CACHED_HASH_H
+#define JUNO_DS_MAP_CACHED_HASH_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/status.h"
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_MAP_CACHED_HASH_TAG JUNO_MAP_CACHED_HASH_T;
+
+/**
+ * @brief Cached-hash map instance.
+ * @ingroup juno_ds_map_cached_hash
+ */
+// @{"req": ["REQ-MAP-015"]}
+struct JUNO_MAP_CACHED_HASH_TAG JUNO_MODULE_DERIVE(JUNO_MAP_ROOT_T,
+    /// Hash tag per slot, 0 for an empty slot (length == capacity).
+    size_t *pzHashes;
+);
+
+/**
+ * @brief Initialize a cached-hash map.
+ * @ingroup juno_ds_map_cached_hash
+ * @param ptMap Map to initialize; starts empty.
+ * @param ptHashablePointerApi Hash callback for keys (IsValueNull must be present but is unused).
+ * @param ptValuePointerApi Equality comparator for keys.
+ * @param ptArray Backing array providing capacity and element storage ops.
+ * @param pzHashes Hash tag storage, one entry per slot; zeroed by this call.
+ * @param pfcnFailureHandler Optional failure handler.
+ * @param pvUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-MAP-015"]}
+JUNO_STATUS_T JunoDs_MapCachedHashInit(
+    JUNO_MAP_CACHED_HASH_T *ptMap,
+    const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi,
+    const JUNO_VALUE_POINTER_API_T *ptValuePointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    size_t *pzHashes,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvUserData
+);
+
+/**
+ * @brief Compute occupancy and probe statistics of a cached-hash map.
+ * @ingroup juno_ds_map_cached_hash
+ * @details Probe distances are slots from the home slot of each stored tag.
+ * @param ptMap Map instance.
+ * @return The statistics, or an error from verification or array access.
+ */
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapCachedHashStats(JUNO_MAP_CACHED_HASH_T *ptMap);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_DS_MAP_CACHED_HASH_H
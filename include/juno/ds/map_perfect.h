@@ -0,0 +1,154 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file map_perfect.h
+ * @brief Single-probe map over a key set fixed at build time.
+ * @defgroup juno_ds_map_perfect Perfect-Hash Map
+ * @ingroup juno_ds_map
+ * @details
+ *  scripts/create_perfect_hash.py takes the key hashes of a fixed key set
+ *  (e.g. message IDs or command codes, whose Hash is the value itself) and
+ *  emits a JUNO_MAP_PERFECT_TABLE_T using hash-and-displace: the key's
+ *  bucket selects a displacement, and the displacement seeds a second mix
+ *  that lands every key of the set in its own slot. The table is minimal,
+ *  so the backing array needs exactly zKeys slots.
+ *
+ *  JunoDs_MapPerfectInit installs a JUNO_MAP_API_T over such a table:
+ *  - Every operation computes the slot with JunoDs_MapPerfectSlot and
+ *    probes only that slot. There is no probe loop, so the cost is the
+ *    same for every key, which keeps WCET analysis simple.
+ *  - A key whose hash is not the one generated for its slot is not part of
+ *    the set: Get returns JUNO_STATUS_DNE_ERROR, Set returns
+ *    JUNO_STATUS_DNE_ERROR, and Remove is a no-op.
+ *  - Get and Remove call IsValueNull and Equals on the one candidate slot, so keys
+ *    whose Hash is not injective are still compared.
+ */
+#ifndef JUNO_DS_MAP_PERFECT_H
+#define JUNO_DS_MAP_PERFECT_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/status.h"
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_MAP_PERFECT_TABLE_TAG JUNO_MAP_PERFECT_TABLE_T;
+typedef struct JUNO_MAP_PERFECT_TAG JUNO_MAP_PERFECT_T;
+
+/**
+ * @brief Generated perfect-hash table.
+ * @ingroup juno_ds_map_perfect
+ */
+// @{"req": ["REQ-MAP-021"]}
+struct JUNO_MAP_PERFECT_TABLE_TAG
+{
+    /// Displacement per bucket (length == zBuckets).
+    const uint32_t *piDisplacements;
+    /// Number of buckets.
+    size_t zBuckets;
+    /// Key hash assigned to each slot (length == zKeys).
+    const size_t *pzKeys;
+    /// Number of keys and slots.
+    size_t zKeys;
+    /// Seed of the bucket mix.
+    uint32_t iSeed;
+};
+
+/**
+ * @brief Perfect-hash map instance.
+ * @ingroup juno_ds_map_perfect
+ */
+// @{"req": ["REQ-MAP-022"]}
+struct JUNO_MAP_PERFECT_TAG JUNO_MODULE_DERIVE(JUNO_MAP_ROOT_T,
+    /// Generated table for the key set.
+    const JUNO_MAP_PERFECT_TABLE_T *ptTable;
+);
+
+/**
+ * @brief Mix a key hash with a seed (splitmix64 finalizer).
+ * @details Must match mix() in scripts/create_perfect_hash.py.
+ */
+// @{"req": ["REQ-MAP-021"]}
+static inline uint64_t JunoDs_MapPerfectMix(uint64_t iHash, uint32_t iSeed)
+{
+    uint64_t iZ = iHash + 0x9E3779B97F4A7C15ull * ((uint64_t)iSeed + 1u);
+    iZ = (iZ ^ (iZ >> 30)) * 0xBF58476D1CE4E5B9ull;
+    iZ = (iZ ^ (iZ >> 27)) * 0x94D049BB133111EBull;
+    return iZ ^ (iZ >> 31);
+}
+
+/**
+ * @brief Slot of a key hash in a generated table.
+ * @details Only meaningful for hashes of the generated key set; compare
+ *          ptTable->pzKeys[slot] with the hash to test membership.
+ */
+// @{"req": ["REQ-MAP-021"]}
+static inline size_t JunoDs_MapPerfectSlot(const JUNO_MAP_PERFECT_TABLE_T *ptTable, size_t zHash)
+{
+    size_t iBucket = (size_t)(JunoDs_MapPerfectMix(zHash, ptTable->iSeed) % ptTable->zBuckets);
+    return (size_t)(JunoDs_MapPerfectMix(zHash, ptTable->piDisplacements[iBucket]) % ptTable->zKeys);
+}
+
+/**
+ * @brief Initialize a perfect-hash map.
+ * @ingroup juno_ds_map_perfect
+ * @param ptMap Map to initialize.
+ * @param ptHashablePointerApi Hash and null-check callbacks; Hash must produce the values given to the generator.
+ * @param ptValuePointerApi Equality comparator for keys.
+ * @param ptArray Backing array with at least ptTable->zKeys slots.
+ * @param ptTable Generated table.
+ * @param pfcnFailureHandler Optional failure handler.
+ * @param pvUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success, JUNO_STATUS_INVALID_SIZE_ERROR if
+ *         the array or table is too small, error otherwise.
+ */
+// @{"req": ["REQ-MAP-022"]}
+JUNO_STATUS_T JunoDs_MapPerfectInit(
+    JUNO_MAP_PERFECT_T *ptMap,
+    const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi,
+    const JUNO_VALUE_POINTER_API_T *ptValuePointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    const JUNO_MAP_PERFECT_TABLE_T *ptTable,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvUserData
+);
+
+/**
+ * @brief Compute occupancy and probe statistics of a perfect-hash map.
+ * @ingroup juno_ds_map_perfect
+ * @details Probe distances are always 0, since every key has one slot.
+ * @param ptMap Map instance.
+ * @return The statistics, or an error from verification or array access.
+ */
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapPerfectStats(JUNO_MAP_PERFECT_T *ptMap);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_DS_MAP_PERFECT_H
@@ -0,0 +1,110 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file map_robin_hood.h
+ * @brief Open-addressed hash map with Robin Hood probing and backward-shift deletion.
+ * @defgroup juno_ds_map_robin_hood Robin Hood Map
+ * @ingroup juno_ds_map
+ * @details
+ *  Implements JUNO_MAP_API_T over the same user-supplied backing array and
+ *  pointer APIs as the linear-probing map, plus a caller-supplied array of
+ *  per-slot probe distances.
+ *
+ *  Entries are kept ordered by home slot within each cluster ("rich" entries
+ *  close to home yield to "poor" ones far from home), which bounds the
+ *  variance of probe lengths:
+ *  - Get stops as soon as it reaches a slot whose resident is closer to its
+ *    home than the key would be, so misses are as cheap as hits.
+ *  - Equals is only called on residents with the same probe distance, i.e.
+ *    the same home slot as the key.
+ *  - Remove shifts the following entries of the cluster back by one slot
+ *    instead of leaving a tombstone, so no probe chain is ever broken.
+ *
+ *  Slot occupancy is tracked by the distance array (0 = empty, otherwise
+ *  probe distance + 1); IsValueNull is not consulted. The backing array's
+ *  SetAt/GetAt/RemoveAt are used to move entries.
+ */
+#ifndef JUNO_DS_MAP_ROBIN_HOOD_H
+#define JUNO_DS_MAP_ROBIN_HOOD_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/status.h"
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_MAP_ROBIN_HOOD_TAG JUNO_MAP_ROBIN_HOOD_T;
+
+/**
+ * @brief Robin Hood map instance.
+ * @ingroup juno_ds_map_robin_hood
+ */
+// @{"req": ["REQ-MAP-012"]}
+struct JUNO_MAP_ROBIN_HOOD_TAG JUNO_MODULE_DERIVE(JUNO_MAP_ROOT_T,
+    /// Probe distance + 1 per slot, 0 for an empty slot (length == capacity).
+    size_t *pzDistances;
+    /// Number of occupied slots.
+    size_t zLength;
+);
+
+/**
+ * @brief Initialize a Robin Hood map.
+ * @ingroup juno_ds_map_robin_hood
+ * @param ptMap Map to initialize; starts empty.
+ * @param ptHashablePointerApi Hash callback for keys (IsValueNull must be present but is unused).
+ * @param ptValuePointerApi Equality comparator for keys.
+ * @param ptArray Backing array providing capacity and element storage ops.
+ * @param pzDistances Distance storage, one entry per slot; zeroed by this call.
+ * @param pfcnFailureHandler Optional failure handler.
+ * @param pvUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-MAP-012"]}
+JUNO_STATUS_T JunoDs_MapRobinHoodInit(
+    JUNO_MAP_ROBIN_HOOD_T *ptMap,
+    const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi,
+    const JUNO_VALUE_POINTER_API_T *ptValuePointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    size_t *pzDistances,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvUserData
+);
+
+/**
+ * @brief Compute occupancy and probe statistics of a Robin Hood map.
+ * @ingroup juno_ds_map_robin_hood
+ * @details Probe distances are the stored distance of each slot.
+ * @param ptMap Map instance.
+ * @return The statistics, or an error from verification or array access.
+ */
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapRobinHoodStats(JUNO_MAP_ROBIN_HOOD_T *ptMap);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_DS_MAP_ROBIN_HOOD_H
@@ -0,0 +1,118 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file map_swiss.h
+ * @brief Open-addressed hash map probing 16 control bytes per step.
+ * @defgroup juno_ds_map_swiss Swiss-Table Map
+ * @ingroup juno_ds_map
+ * @details
+ *  Implements JUNO_MAP_API_T over the same user-supplied backing array and
+ *  pointer APIs as the linear-probing map, plus a caller-supplied array of
+ *  one control byte per slot. The table is split into groups of
+ *  JUNO_MAP_SWISS_GROUP_SIZE slots; the capacity must be a non-zero
+ *  multiple of the group size.
+ *
+ *  A control byte is JUNO_MAP_SWISS_CTRL_EMPTY, JUNO_MAP_SWISS_CTRL_DELETED,
+ *  or the low 7 bits of the stored key's hash. The remaining hash bits pick
+ *  the first group, and groups are probed in order with wraparound:
+ *  - Each step compares the 16 control bytes of a group against the key's
+ *    7-bit fragment at once (SSE2 or NEON on hosted builds, a scalar loop
+ *    otherwise or when JUNO_MAP_SWISS_SCALAR is defined). Equals is only
+ *    called on matching bytes.
+ *  - A lookup stops at the first group containing an empty slot.
+ *  - Remove marks the slot empty when its group still has an empty slot,
+ *    otherwise it leaves a deleted marker (tombstone) that Set reuses.
+ *
+ *  IsValueNull is not consulted; occupancy is read from the control bytes.
+ */
+#ifndef JUNO_DS_MAP_SWISS_H
+#define JUNO_DS_MAP_SWISS_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/status.h"
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Number of slots probed per step.
+#define JUNO_MAP_SWISS_GROUP_SIZE (16u)
+/// Control byte of a never-used slot.
+#define JUNO_MAP_SWISS_CTRL_EMPTY (0x80u)
+/// Control byte of a removed slot.
+#define JUNO_MAP_SWISS_CTRL_DELETED (0xFEu)
+
+typedef struct JUNO_MAP_SWISS_TAG JUNO_MAP_SWISS_T;
+
+/**
+ * @brief Swiss-table map instance.
+ * @ingroup juno_ds_map_swiss
+ */
+// @{"req": ["REQ-MAP-018"]}
+struct JUNO_MAP_SWISS_TAG JUNO_MODULE_DERIVE(JUNO_MAP_ROOT_T,
+    /// Control byte per slot (length == capacity).
+    uint8_t *piCtrl;
+);
+
+/**
+ * @brief Initialize a Swiss-table map.
+ * @ingroup juno_ds_map_swiss
+ * @param ptMap Map to initialize; starts empty.
+ * @param ptHashablePointerApi Hash callback for keys (IsValueNull must be present but is unused).
+ * @param ptValuePointerApi Equality comparator for keys.
+ * @param ptArray Backing array; zCapacity must be a multiple of JUNO_MAP_SWISS_GROUP_SIZE.
+ * @param piCtrl Control byte storage, one entry per slot; set to empty by this call.
+ * @param pfcnFailureHandler Optional failure handler.
+ * @param pvUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success, JUNO_STATUS_INVALID_SIZE_ERROR if
+ *         the capacity is not a multiple of the group size, error otherwise.
+ */
+// @{"req": ["REQ-MAP-018"]}
+JUNO_STATUS_T JunoDs_MapSwissInit(
+    JUNO_MAP_SWISS_T *ptMap,
+    const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi,
+    const JUNO_VALUE_POINTER_API_T *ptValuePointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    uint8_t *piCtrl,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvUserData
+);
+
+/**
+ * @brief Compute occupancy and probe statistics of a Swiss-table map.
+ * @ingroup juno_ds_map_swiss
+ * @details Probe distances are groups from the home group; deleted slots are not counted.
+ * @param ptMap Map instance.
+ * @return The statistics, or an error from verification, hashing or array access.
+ */
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapSwissStats(JUNO_MAP_SWISS_T *ptMap);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_DS_MAP_SWISS_H
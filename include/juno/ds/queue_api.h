@@ -137,6 +137,18 @@ JUNO_RESULT_POINTER_T JunoDs_QueuePeek(JUNO_DS_QUEUE_ROOT_T *ptQueue);
 /// @return JUNO_STATUS_SUCCESS on success; error if array verification fails.
 JUNO_STATUS_T JunoDs_QueueInit(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_DS_ARRAY_ROOT_T *ptQueueArray, JUNO_FAILURE_HANDLER_T pfcnFailureHdlr, JUNO_USER_DATA_T *pvFailureUserData);
 
+/// @brief Initialize a queue whose capacity is a power of two.
+/// @details Index wraparound uses a mask instead of a modulo. The queue API
+///          (ptApi) uses the mask; JunoDs_QueuePush/Pop remain valid on it.
+/// @param ptQueue Queue root to initialize.
+/// @param ptQueueArray Backing array; its capacity must be a power of two.
+/// @param pfcnFailureHdlr Optional failure handler.
+/// @param pvFailureUserData Optional failure handler user data.
+/// @return JUNO_STATUS_SUCCESS on success, JUNO_STATUS_INVALID_SIZE_ERROR if the
+///         capacity is not a power of two, or a verification error.
+// @{"req": ["REQ-QUEUE-015"]}
+JUNO_STATUS_T JunoDs_QueueInitPow2(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_DS_ARRAY_ROOT_T *ptQueueArray, JUNO_FAILURE_HANDLER_T pfcnFailureHdlr, JUNO_USER_DATA_T *pvFailureUserData);
+
 #ifdef __cplusplus
 }
 #endif
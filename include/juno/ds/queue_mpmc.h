@@ -0,0 +1,134 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file queue_mpmc.h
+ * @brief Bounded lock-free multi-producer/multi-consumer queue.
+ * @defgroup juno_ds_queue_mpmc MPMC Queue
+ * @ingroup juno_ds_queue
+ * @details
+ *  Implements JUNO_DS_QUEUE_API_T over a caller-supplied backing array and a
+ *  caller-supplied array of per-slot sequence numbers (Vyukov's bounded
+ *  queue). Any number of threads may enqueue and dequeue concurrently; all
+ *  storage is static.
+ *
+ *  Each slot's sequence number says whose turn it is: a producer may fill
+ *  slot (pos % capacity) when its sequence equals pos, and a consumer may
+ *  drain it when its sequence equals pos + 1. Producers and consumers claim
+ *  positions with a compare-and-swap on their own cache-line aligned
+ *  counter, copy the element outside of any lock, then publish the slot by
+ *  storing its next sequence with release ordering.
+ *
+ *  Operations never block:
+ *  - Enqueue on a full queue and Dequeue/Peek on an empty queue return
+ *    JUNO_STATUS_OOB_ERROR.
+ *  - When the position CAS loses to other threads more than zRetryLimit
+ *    times in a row the operation returns JUNO_STATUS_TIMEOUT_ERROR
+ *    (zRetryLimit == 0 retries until it succeeds or sees full/empty).
+ *
+ *  Constraints:
+ *  - The capacity of the backing array must be a power of two of at least 2.
+ *  - Peek returns the front element without claiming it; the descriptor is
+ *    only stable when a single thread consumes.
+ *  - Use the queue's ptApi (or the JunoDs_QueueMpmc* functions), not
+ *    JunoDs_QueuePush/Pop/Peek.
+ *  - A claimed slot is always released to the other side so the queue
+ *    cannot stall. If the backing array fails to store the element, Enqueue
+ *    returns the error and publishes the slot flagged as failed. Dequeue of
+ *    that slot consumes it without copying and returns
+ *    JUNO_STATUS_INVALID_DATA_ERROR; Peek at it returns the same error.
+ *
+ *  Sequence numbers are stored as (pos << 1); the low bit is the failed-store
+ *  flag.
+ */
+#ifndef JUNO_DS_QUEUE_MPMC_H
+#define JUNO_DS_QUEUE_MPMC_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/mp/atomic.h"
+#include "juno/status.h"
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_DS_MPMC_RING_TAG JUNO_DS_MPMC_RING_T;
+
+/**
+ * @brief MPMC ring state, used as the backing array of an MPMC queue.
+ * @ingroup juno_ds_queue_mpmc
+ */
+// @{"req": ["REQ-QUEUE-012"]}
+struct JUNO_DS_MPMC_RING_TAG JUNO_MODULE_DERIVE(JUNO_DS_ARRAY_ROOT_T,
+    /// Caller-supplied element storage.
+    JUNO_DS_ARRAY_ROOT_T *ptArray;
+    /// Caller-supplied sequence number per slot (length == zCapacity).
+    JUNO_MP_ATOMIC_SIZE_T *ptSequences;
+    /// Maximum lost CAS races before returning JUNO_STATUS_TIMEOUT_ERROR, 0 for no limit.
+    size_t zRetryLimit;
+    /// Next position to enqueue.
+    JUNO_MP_ALIGNAS(JUNO_MP_CACHE_LINE_SIZE) JUNO_MP_ATOMIC_SIZE_T zEnqueuePos;
+    /// Next position to dequeue.
+    JUNO_MP_ALIGNAS(JUNO_MP_CACHE_LINE_SIZE) JUNO_MP_ATOMIC_SIZE_T zDequeuePos;
+);
+
+/// @brief Try to enqueue an item (any thread).
+// @{"req": ["REQ-QUEUE-013", "REQ-QUEUE-014"]}
+JUNO_STATUS_T JunoDs_QueueMpmcPush(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem);
+/// @brief Try to dequeue the front item into tReturn (any thread).
+// @{"req": ["REQ-QUEUE-013", "REQ-QUEUE-014"]}
+JUNO_STATUS_T JunoDs_QueueMpmcPop(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn);
+/// @brief Peek at the front item without claiming it.
+// @{"req": ["REQ-QUEUE-014"]}
+JUNO_RESULT_POINTER_T JunoDs_QueueMpmcPeek(JUNO_DS_QUEUE_ROOT_T *ptQueue);
+
+/**
+ * @brief Initialize an MPMC queue over a backing array.
+ * @param ptQueue Queue root to initialize (may be the root of a JUNO_SB_PIPE_T).
+ * @param ptRing Ring state; installed as ptQueue->ptQueueArray.
+ * @param ptArray Initialized backing array; its capacity must be a power of two.
+ * @param ptSequences Sequence storage, one entry per array slot.
+ * @param zRetryLimit Maximum lost CAS races per operation, 0 for no limit.
+ * @param pfcnFailureHdlr Failure callback for assertions in this module.
+ * @param pvFailureUserData Opaque user data for the failure handler.
+ * @return JUNO_STATUS_SUCCESS on success; JUNO_STATUS_INVALID_SIZE_ERROR if the
+ *         capacity is not a power of two of at least 2; other errors if
+ *         verification fails.
+ */
+// @{"req": ["REQ-QUEUE-012"]}
+JUNO_STATUS_T JunoDs_QueueMpmcInit(
+    JUNO_DS_QUEUE_ROOT_T *ptQueue,
+    JUNO_DS_MPMC_RING_T *ptRing,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    JUNO_MP_ATOMIC_SIZE_T *ptSequences,
+    size_t zRetryLimit,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvFailureUserData
+);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_DS_QUEUE_MPMC_H
@@ -0,0 +1,140 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file queue_spsc.h
+ * @brief Lock-free single-producer/single-consumer queue.
+ * @defgroup juno_ds_queue_spsc SPSC Queue
+ * @ingroup juno_ds_queue
+ * @details
+ *  Implements JUNO_DS_QUEUE_API_T over a caller-supplied backing array so that
+ *  exactly one producer thread and one consumer thread may use the queue
+ *  concurrently without a lock. Because it is an ordinary queue root it can
+ *  back a JUNO_SB_PIPE_T, letting a broker on one thread publish into a pipe
+ *  drained by another.
+ *
+ *  The ring state (JUNO_DS_SPSC_RING_T) wraps the backing array and is
+ *  installed as the queue's ptQueueArray. Head and tail are C11 atomic
+ *  positions kept on separate cache lines; each side also caches the other
+ *  side's position on its own line so the shared line is only read when the
+ *  cached view says the queue is full (producer) or empty (consumer).
+ *
+ *  Positions are bounded, not free-running: each one runs over
+ *  [0, 2 * capacity) and wraps to 0, and maps to slot position % capacity.
+ *  The queue holds (tail - head) mod 2 * capacity items, so head == tail
+ *  means empty and a distance of capacity means full. Positions stay below
+ *  2 * capacity, so they never overflow.
+ *
+ *  Threading contract:
+ *  - Enqueue is producer-only; Dequeue, Peek, Available and Drop are
+ *    consumer-only.
+ *  - The descriptor returned by Peek stays valid until the consumer's next
+ *    Dequeue or Drop. Peek followed by Drop consumes an item in place.
+ *  - Init must complete before either thread uses the queue.
+ *  - The backing array's SetAt/GetAt/RemoveAt must only touch the slot they
+ *    are given (true for plain arrays).
+ *  - Use the queue's ptApi (or the JunoDs_QueueSpsc* functions). The
+ *    JunoDs_QueuePush/Pop/Peek functions implement the non-concurrent queue
+ *    and do not dispatch through ptApi.
+ *  - iStartIndex and zLength of the queue root are unused.
+ *
+ *  Error behavior:
+ *  - Enqueue on a full queue and Dequeue/Peek on an empty queue return
+ *    JUNO_STATUS_OOB_ERROR, like JunoDs_QueuePush/Pop/Peek.
+ */
+#ifndef JUNO_DS_QUEUE_SPSC_H
+#define JUNO_DS_QUEUE_SPSC_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/mp/atomic.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_DS_SPSC_RING_TAG JUNO_DS_SPSC_RING_T;
+
+/**
+ * @brief SPSC ring state, used as the backing array of an SPSC queue.
+ * @ingroup juno_ds_queue_spsc
+ */
+// @{"req": ["REQ-QUEUE-009"]}
+struct JUNO_DS_SPSC_RING_TAG JUNO_MODULE_DERIVE(JUNO_DS_ARRAY_ROOT_T,
+    /// Caller-supplied element storage.
+    JUNO_DS_ARRAY_ROOT_T *ptArray;
+    /// Next position to write, in [0, 2 * capacity) (written by the producer).
+    JUNO_MP_ALIGNAS(JUNO_MP_CACHE_LINE_SIZE) JUNO_MP_ATOMIC_SIZE_T zTail;
+    /// Producer's last observed value of zHead.
+    size_t zHeadCache;
+    /// Next position to read, in [0, 2 * capacity) (written by the consumer).
+    JUNO_MP_ALIGNAS(JUNO_MP_CACHE_LINE_SIZE) JUNO_MP_ATOMIC_SIZE_T zHead;
+    /// Consumer's last observed value of zTail.
+    size_t zTailCache;
+);
+
+/// @brief Enqueue an item (producer thread only).
+// @{"req": ["REQ-QUEUE-010"]}
+JUNO_STATUS_T JunoDs_QueueSpscPush(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem);
+/// @brief Dequeue the front item into tReturn (consumer thread only).
+// @{"req": ["REQ-QUEUE-010"]}
+JUNO_STATUS_T JunoDs_QueueSpscPop(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn);
+/// @brief Peek at the front item (consumer thread only).
+// @{"req": ["REQ-QUEUE-010"]}
+JUNO_RESULT_POINTER_T JunoDs_QueueSpscPeek(JUNO_DS_QUEUE_ROOT_T *ptQueue);
+/**
+ * @brief Count the items ready for the consumer (consumer thread only).
+ * @details Reloads the producer position once, so the following Peek and
+ *  Drop calls for those items do not touch the producer's cache line.
+ */
+// @{"req": ["REQ-QUEUE-010"]}
+JUNO_RESULT_SIZE_T JunoDs_QueueSpscAvailable(JUNO_DS_QUEUE_ROOT_T *ptQueue);
+/// @brief Release the front item without copying it out (consumer thread only).
+// @{"req": ["REQ-QUEUE-010", "REQ-QUEUE-011"]}
+JUNO_STATUS_T JunoDs_QueueSpscDrop(JUNO_DS_QUEUE_ROOT_T *ptQueue);
+
+/**
+ * @brief Initialize an SPSC queue over a backing array.
+ * @param ptQueue Queue root to initialize (may be the root of a JUNO_SB_PIPE_T).
+ * @param ptRing Ring state; installed as ptQueue->ptQueueArray.
+ * @param ptArray Initialized backing array defining capacity and element ops.
+ * @param pfcnFailureHdlr Failure callback for assertions in this module.
+ * @param pvFailureUserData Opaque user data for the failure handler.
+ * @return JUNO_STATUS_SUCCESS on success; error if verification fails.
+ */
+// @{"req": ["REQ-QUEUE-009"]}
+JUNO_STATUS_T JunoDs_QueueSpscInit(
+    JUNO_DS_QUEUE_ROOT_T *ptQueue,
+    JUNO_DS_SPSC_RING_T *ptRing,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvFailureUserData
+);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_DS_QUEUE_SPSC_H
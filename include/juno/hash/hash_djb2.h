@@ -27,6 +27,10 @@
  * @details
  *  Computes the classic djb2 hash over a byte buffer using the recurrence
  *  h = h * 33 + x. The initial value is 5381. Returns the result as size_t.
+ *
+ *  Keys split over several buffers can be hashed in place with
+ *  JunoHash_Djb2Init, JunoHash_Djb2Update and JunoHash_Djb2Final. The result
+ *  equals JunoHash_Djb2 over the concatenated bytes.
  */
 #ifndef JUNO_HASH_DJB2_H
 #define JUNO_HASH_DJB2_H
@@ -37,6 +41,8 @@ extern "C"
 {
 #endif
 
+/// djb2 initial value
+#define JUNO_HASH_DJB2_INIT  (5381u)
 
 /**
  * @brief Compute djb2 hash over a byte buffer.
@@ -53,7 +59,7 @@ static inline JUNO_RESULT_SIZE_T JunoHash_Djb2(const uint8_t *pcBuff, size_t zBu
         tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
         return tResult;
     }
-    size_t zHash = 5381;
+    size_t zHash = JUNO_HASH_DJB2_INIT;
     for(size_t i = 0; i < zBuffSize; i++)
     {
         zHash = ((zHash << 5) + zHash) + pcBuff[i];
@@ -62,6 +68,72 @@ static inline JUNO_RESULT_SIZE_T JunoHash_Djb2(const uint8_t *pcBuff, size_t zBu
     tResult.tOk = zHash;
     return tResult;
 }
+
+
+/// Running state of a streaming djb2 hash
+typedef struct JUNO_HASH_DJB2_STATE_TAG JUNO_HASH_DJB2_STATE_T;
+struct JUNO_HASH_DJB2_STATE_TAG
+{
+    size_t zHash;
+};
+
+/**
+ * @brief Start a streaming djb2 hash.
+ * @param ptState State to initialize.
+ * @return JUNO_STATUS_SUCCESS, or JUNO_STATUS_NULLPTR_ERROR if ptState is NULL.
+ */
+// @{"req": ["REQ-HASH-007"]}
+static inline JUNO_STATUS_T JunoHash_Djb2Init(JUNO_HASH_DJB2_STATE_T *ptState)
+{
+    if(!(ptState))
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    ptState->zHash = JUNO_HASH_DJB2_INIT;
+    return JUNO_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Add bytes to a streaming djb2 hash.
+ * @param ptState Initialized state.
+ * @param pcBuff Pointer to input bytes (must not be NULL).
+ * @param zBuffSize Number of bytes to add.
+ * @return JUNO_STATUS_SUCCESS, or JUNO_STATUS_NULLPTR_ERROR for a NULL argument.
+ */
+// @{"req": ["REQ-HASH-007"]}
+static inline JUNO_STATUS_T JunoHash_Djb2Update(JUNO_HASH_DJB2_STATE_T *ptState, const uint8_t *pcBuff, size_t zBuffSize)
+{
+    if(!(ptState && pcBuff))
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    size_t zHash = ptState->zHash;
+    for(size_t i = 0; i < zBuffSize; i++)
+    {
+        zHash = ((zHash << 5) + zHash) + pcBuff[i];
+    }
+    ptState->zHash = zHash;
+    return JUNO_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get the djb2 hash of all bytes added so far.
+ * @param ptState Initialized state, left unchanged.
+ * @return Result containing the hash value or an error for invalid input.
+ */
+// @{"req": ["REQ-HASH-007"]}
+static inline JUNO_RESULT_SIZE_T JunoHash_Djb2Final(const JUNO_HASH_DJB2_STATE_T *ptState)
+{
+    JUNO_RESULT_SIZE_T tResult = {0, 0};
+    if(!(ptState))
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    tResult.tOk = ptState->zHash;
+    return tResult;
+}
 #ifdef __cplusplus
 }
 #endif
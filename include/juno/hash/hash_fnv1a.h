@@ -0,0 +1,143 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file hash_fnv1a.h
+ * @brief 64-bit FNV-1a hash implementation.
+ * @ingroup juno_hash
+ * @details
+ *  Computes the 64-bit Fowler-Noll-Vo 1a hash over a byte buffer using the
+ *  recurrence h = (h ^ x) * 0x100000001B3 with offset basis
+ *  0xCBF29CE484222325. The result is truncated to size_t on targets where
+ *  size_t is narrower than 64 bits.
+ *
+ *  Keys split over several buffers can be hashed in place with
+ *  JunoHash_Fnv1a64Init, JunoHash_Fnv1a64Update and JunoHash_Fnv1a64Final.
+ *  The result equals JunoHash_Fnv1a64 over the concatenated bytes.
+ */
+#ifndef JUNO_HASH_FNV1A_H
+#define JUNO_HASH_FNV1A_H
+#include "juno/status.h"
+#include "juno/types.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// FNV-1a 64-bit offset basis
+#define JUNO_HASH_FNV1A_64_BASIS   (0xCBF29CE484222325ULL)
+/// FNV-1a 64-bit prime
+#define JUNO_HASH_FNV1A_64_PRIME   (0x100000001B3ULL)
+
+/**
+ * @brief Compute the 64-bit FNV-1a hash over a byte buffer.
+ * @param pcBuff Pointer to input bytes (must not be NULL unless zBuffSize==0).
+ * @param zBuffSize Number of bytes to hash.
+ * @return Result containing the hash value or an error for invalid input.
+ */
+// @{"req": ["REQ-HASH-004", "REQ-HASH-006"]}
+static inline JUNO_RESULT_SIZE_T JunoHash_Fnv1a64(const uint8_t *pcBuff, size_t zBuffSize)
+{
+    JUNO_RESULT_SIZE_T tResult = {0, 0};
+    if(!(pcBuff))
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    uint64_t iHash = JUNO_HASH_FNV1A_64_BASIS;
+    for(size_t i = 0; i < zBuffSize; i++)
+    {
+        iHash = (iHash ^ pcBuff[i]) * JUNO_HASH_FNV1A_64_PRIME;
+    }
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    tResult.tOk = (size_t)iHash;
+    return tResult;
+}
+
+/// Running state of a streaming FNV-1a-64 hash
+typedef struct JUNO_HASH_FNV1A64_STATE_TAG JUNO_HASH_FNV1A64_STATE_T;
+struct JUNO_HASH_FNV1A64_STATE_TAG
+{
+    uint64_t iHash;
+};
+
+/**
+ * @brief Start a streaming FNV-1a-64 hash.
+ * @param ptState State to initialize.
+ * @return JUNO_STATUS_SUCCESS, or JUNO_STATUS_NULLPTR_ERROR if ptState is NULL.
+ */
+// @{"req": ["REQ-HASH-007"]}
+static inline JUNO_STATUS_T JunoHash_Fnv1a64Init(JUNO_HASH_FNV1A64_STATE_T *ptState)
+{
+    if(!(ptState))
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    ptState->iHash = JUNO_HASH_FNV1A_64_BASIS;
+    return JUNO_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Add bytes to a streaming FNV-1a-64 hash.
+ * @param ptState Initialized state.
+ * @param pcBuff Pointer to input bytes (must not be NULL).
+ * @param zBuffSize Number of bytes to add.
+ * @return JUNO_STATUS_SUCCESS, or JUNO_STATUS_NULLPTR_ERROR for a NULL argument.
+ */
+// @{"req": ["REQ-HASH-007"]}
+static inline JUNO_STATUS_T JunoHash_Fnv1a64Update(JUNO_HASH_FNV1A64_STATE_T *ptState, const uint8_t *pcBuff, size_t zBuffSize)
+{
+    if(!(ptState && pcBuff))
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    uint64_t iHash = ptState->iHash;
+    for(size_t i = 0; i < zBuffSize; i++)
+    {
+        iHash = (iHash ^ pcBuff[i]) * JUNO_HASH_FNV1A_64_PRIME;
+    }
+    ptState->iHash = iHash;
+    return JUNO_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get the FNV-1a-64 hash of all bytes added so far.
+ * @param ptState Initialized state, left unchanged.
+ * @return Result containing the hash value or an error for invalid input.
+ */
+// @{"req": ["REQ-HASH-007"]}
+static inline JUNO_RESULT_SIZE_T JunoHash_Fnv1a64Final(const JUNO_HASH_FNV1A64_STATE_T *ptState)
+{
+    JUNO_RESULT_SIZE_T tResult = {0, 0};
+    if(!(ptState))
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    tResult.tOk = (size_t)ptState->iHash;
+    return tResult;
+}
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_HASH_FNV1A_H
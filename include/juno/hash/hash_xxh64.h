@@ -0,0 +1,306 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file hash_xxh64.h
+ * @brief xxHash64 implementation.
+ * @ingroup juno_hash
+ * @details
+ *  Computes XXH64 over a byte buffer. Inputs of 32 bytes or more are consumed
+ *  as four independent 64-bit lanes, so the multiplies of consecutive words
+ *  overlap instead of forming one serial chain. The tail is consumed in 8, 4
+ *  and 1 byte steps.
+ *
+ *  Words are assembled from bytes in little-endian order, so the buffer may
+ *  have any alignment and the result is the same on every target. Compilers
+ *  fold the byte loads into a single load where the target allows unaligned
+ *  access. The result is truncated to size_t on targets where size_t is
+ *  narrower than 64 bits.
+ *
+ *  Keys split over several buffers can be hashed in place with
+ *  JunoHash_Xxh64Init, JunoHash_Xxh64Update and JunoHash_Xxh64Final. The
+ *  state buffers at most one partial stripe, and the result equals
+ *  JunoHash_Xxh64 over the concatenated bytes.
+ */
+#ifndef JUNO_HASH_XXH64_H
+#define JUNO_HASH_XXH64_H
+#include "juno/status.h"
+#include "juno/types.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#define JUNO_HASH_XXH64_PRIME1  (0x9E3779B185EBCA87ULL)
+#define JUNO_HASH_XXH64_PRIME2  (0xC2B2AE3D27D4EB4FULL)
+#define JUNO_HASH_XXH64_PRIME3  (0x165667B19E3779F9ULL)
+#define JUNO_HASH_XXH64_PRIME4  (0x85EBCA77C2B2AE63ULL)
+#define JUNO_HASH_XXH64_PRIME5  (0x27D4EB2F165667C5ULL)
+/// Bytes consumed per iteration of the four-lane loop
+#define JUNO_HASH_XXH64_STRIPE  (32u)
+
+/// Load a little-endian 64-bit word from a buffer of any alignment
+static inline uint64_t JunoHash_Xxh64Load64(const uint8_t *pcBuff)
+{
+    return (uint64_t)pcBuff[0] |
+        ((uint64_t)pcBuff[1] << 8) |
+        ((uint64_t)pcBuff[2] << 16) |
+        ((uint64_t)pcBuff[3] << 24) |
+        ((uint64_t)pcBuff[4] << 32) |
+        ((uint64_t)pcBuff[5] << 40) |
+        ((uint64_t)pcBuff[6] << 48) |
+        ((uint64_t)pcBuff[7] << 56);
+}
+
+/// Load a little-endian 32-bit word from a buffer of any alignment
+static inline uint64_t JunoHash_Xxh64Load32(const uint8_t *pcBuff)
+{
+    return (uint64_t)pcBuff[0] |
+        ((uint64_t)pcBuff[1] << 8) |
+        ((uint64_t)pcBuff[2] << 16) |
+        ((uint64_t)pcBuff[3] << 24);
+}
+
+static inline uint64_t JunoHash_Xxh64Rotl(uint64_t iValue, unsigned int iBits)
+{
+    return (iValue << iBits) | (iValue >> (64u - iBits));
+}
+
+/// Mix one 64-bit input word into a lane accumulator
+static inline uint64_t JunoHash_Xxh64Round(uint64_t iAcc, uint64_t iInput)
+{
+    iAcc += iInput * JUNO_HASH_XXH64_PRIME2;
+    iAcc = JunoHash_Xxh64Rotl(iAcc, 31);
+    return iAcc * JUNO_HASH_XXH64_PRIME1;
+}
+
+/// Fold a lane accumulator into the hash
+static inline uint64_t JunoHash_Xxh64MergeRound(uint64_t iHash, uint64_t iLane)
+{
+    iHash ^= JunoHash_Xxh64Round(0, iLane);
+    return iHash * JUNO_HASH_XXH64_PRIME1 + JUNO_HASH_XXH64_PRIME4;
+}
+
+/// Consume one 32 byte stripe into the four lanes
+static inline void JunoHash_Xxh64Stripe(uint64_t aiLanes[4], const uint8_t *pcBuff)
+{
+    aiLanes[0] = JunoHash_Xxh64Round(aiLanes[0], JunoHash_Xxh64Load64(pcBuff));
+    aiLanes[1] = JunoHash_Xxh64Round(aiLanes[1], JunoHash_Xxh64Load64(pcBuff + 8));
+    aiLanes[2] = JunoHash_Xxh64Round(aiLanes[2], JunoHash_Xxh64Load64(pcBuff + 16));
+    aiLanes[3] = JunoHash_Xxh64Round(aiLanes[3], JunoHash_Xxh64Load64(pcBuff + 24));
+}
+
+/// Set the lanes to their seeded initial values
+static inline void JunoHash_Xxh64LanesInit(uint64_t aiLanes[4], uint64_t iSeed)
+{
+    aiLanes[0] = iSeed + JUNO_HASH_XXH64_PRIME1 + JUNO_HASH_XXH64_PRIME2;
+    aiLanes[1] = iSeed + JUNO_HASH_XXH64_PRIME2;
+    aiLanes[2] = iSeed;
+    aiLanes[3] = iSeed - JUNO_HASH_XXH64_PRIME1;
+}
+
+/// Fold the four lanes into one value
+static inline uint64_t JunoHash_Xxh64Converge(const uint64_t aiLanes[4])
+{
+    uint64_t iHash = JunoHash_Xxh64Rotl(aiLanes[0], 1) + JunoHash_Xxh64Rotl(aiLanes[1], 7) +
+        JunoHash_Xxh64Rotl(aiLanes[2], 12) + JunoHash_Xxh64Rotl(aiLanes[3], 18);
+    iHash = JunoHash_Xxh64MergeRound(iHash, aiLanes[0]);
+    iHash = JunoHash_Xxh64MergeRound(iHash, aiLanes[1]);
+    iHash = JunoHash_Xxh64MergeRound(iHash, aiLanes[2]);
+    return JunoHash_Xxh64MergeRound(iHash, aiLanes[3]);
+}
+
+/// Consume the last zTail (< 32) bytes and apply the final avalanche
+static inline uint64_t JunoHash_Xxh64Finalize(uint64_t iHash, const uint8_t *pcBuff, size_t zTail)
+{
+    const uint8_t *pcEnd = pcBuff + zTail;
+    // Consume the tail without reading past the end of the buffer
+    for(; pcEnd - pcBuff >= 8; pcBuff += 8)
+    {
+        iHash ^= JunoHash_Xxh64Round(0, JunoHash_Xxh64Load64(pcBuff));
+        iHash = JunoHash_Xxh64Rotl(iHash, 27) * JUNO_HASH_XXH64_PRIME1 + JUNO_HASH_XXH64_PRIME4;
+    }
+    if(pcEnd - pcBuff >= 4)
+    {
+        iHash ^= JunoHash_Xxh64Load32(pcBuff) * JUNO_HASH_XXH64_PRIME1;
+        iHash = JunoHash_Xxh64Rotl(iHash, 23) * JUNO_HASH_XXH64_PRIME2 + JUNO_HASH_XXH64_PRIME3;
+        pcBuff += 4;
+    }
+    for(; pcBuff < pcEnd; pcBuff++)
+    {
+        iHash ^= (uint64_t)(*pcBuff) * JUNO_HASH_XXH64_PRIME5;
+        iHash = JunoHash_Xxh64Rotl(iHash, 11) * JUNO_HASH_XXH64_PRIME1;
+    }
+    // Final avalanche
+    iHash ^= iHash >> 33;
+    iHash *= JUNO_HASH_XXH64_PRIME2;
+    iHash ^= iHash >> 29;
+    iHash *= JUNO_HASH_XXH64_PRIME3;
+    iHash ^= iHash >> 32;
+    return iHash;
+}
+
+/**
+ * @brief Compute the XXH64 hash over a byte buffer.
+ * @param pcBuff Pointer to input bytes (must not be NULL unless zBuffSize==0).
+ * @param zBuffSize Number of bytes to hash.
+ * @param iSeed Hash seed, 0 for the reference XXH64 values.
+ * @return Result containing the hash value or an error for invalid input.
+ */
+// @{"req": ["REQ-HASH-005", "REQ-HASH-006"]}
+static inline JUNO_RESULT_SIZE_T JunoHash_Xxh64(const uint8_t *pcBuff, size_t zBuffSize, uint64_t iSeed)
+{
+    JUNO_RESULT_SIZE_T tResult = {0, 0};
+    if(!(pcBuff))
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    size_t zTail = zBuffSize;
+    uint64_t iHash = 0;
+    if(zBuffSize >= JUNO_HASH_XXH64_STRIPE)
+    {
+        uint64_t aiLanes[4];
+        JunoHash_Xxh64LanesInit(aiLanes, iSeed);
+        for(; zTail >= JUNO_HASH_XXH64_STRIPE; zTail -= JUNO_HASH_XXH64_STRIPE)
+        {
+            JunoHash_Xxh64Stripe(aiLanes, pcBuff);
+            pcBuff += JUNO_HASH_XXH64_STRIPE;
+        }
+        iHash = JunoHash_Xxh64Converge(aiLanes);
+    }
+    else
+    {
+        iHash = iSeed + JUNO_HASH_XXH64_PRIME5;
+    }
+    iHash += (uint64_t)zBuffSize;
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    tResult.tOk = (size_t)JunoHash_Xxh64Finalize(iHash, pcBuff, zTail);
+    return tResult;
+}
+
+/// Running state of a streaming XXH64 hash
+typedef struct JUNO_HASH_XXH64_STATE_TAG JUNO_HASH_XXH64_STATE_T;
+struct JUNO_HASH_XXH64_STATE_TAG
+{
+    /// Lane accumulators
+    uint64_t aiLanes[4];
+    /// Hash seed
+    uint64_t iSeed;
+    /// Total number of bytes added
+    uint64_t iLength;
+    /// Bytes of the current partial stripe
+    uint8_t acStripe[JUNO_HASH_XXH64_STRIPE];
+    /// Number of bytes in acStripe
+    size_t zStripeLength;
+};
+
+/**
+ * @brief Start a streaming XXH64 hash.
+ * @param ptState State to initialize.
+ * @param iSeed Hash seed, 0 for the reference XXH64 values.
+ * @return JUNO_STATUS_SUCCESS, or JUNO_STATUS_NULLPTR_ERROR if ptState is NULL.
+ */
+// @{"req": ["REQ-HASH-007"]}
+static inline JUNO_STATUS_T JunoHash_Xxh64Init(JUNO_HASH_XXH64_STATE_T *ptState, uint64_t iSeed)
+{
+    if(!(ptState))
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    JunoHash_Xxh64LanesInit(ptState->aiLanes, iSeed);
+    ptState->iSeed = iSeed;
+    ptState->iLength = 0;
+    ptState->zStripeLength = 0;
+    return JUNO_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Add bytes to a streaming XXH64 hash.
+ * @details Whole stripes are consumed directly from pcBuff; only a partial
+ *          stripe at either end is copied into the state.
+ * @param ptState Initialized state.
+ * @param pcBuff Pointer to input bytes (must not be NULL).
+ * @param zBuffSize Number of bytes to add.
+ * @return JUNO_STATUS_SUCCESS, or JUNO_STATUS_NULLPTR_ERROR for a NULL argument.
+ */
+// @{"req": ["REQ-HASH-007"]}
+static inline JUNO_STATUS_T JunoHash_Xxh64Update(JUNO_HASH_XXH64_STATE_T *ptState, const uint8_t *pcBuff, size_t zBuffSize)
+{
+    if(!(ptState && pcBuff))
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    ptState->iLength += (uint64_t)zBuffSize;
+    if(ptState->zStripeLength)
+    {
+        // Complete the partial stripe from the previous update
+        for(; zBuffSize && ptState->zStripeLength < JUNO_HASH_XXH64_STRIPE; zBuffSize--)
+        {
+            ptState->acStripe[ptState->zStripeLength++] = *pcBuff++;
+        }
+        if(ptState->zStripeLength < JUNO_HASH_XXH64_STRIPE)
+        {
+            return JUNO_STATUS_SUCCESS;
+        }
+        JunoHash_Xxh64Stripe(ptState->aiLanes, ptState->acStripe);
+        ptState->zStripeLength = 0;
+    }
+    for(; zBuffSize >= JUNO_HASH_XXH64_STRIPE; zBuffSize -= JUNO_HASH_XXH64_STRIPE)
+    {
+        JunoHash_Xxh64Stripe(ptState->aiLanes, pcBuff);
+        pcBuff += JUNO_HASH_XXH64_STRIPE;
+    }
+    for(; zBuffSize; zBuffSize--)
+    {
+        ptState->acStripe[ptState->zStripeLength++] = *pcBuff++;
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+/**
+ * @brief Get the XXH64 hash of all bytes added so far.
+ * @param ptState Initialized state, left unchanged.
+ * @return Result containing the hash value or an error for invalid input.
+ */
+// @{"req": ["REQ-HASH-007"]}
+static inline JUNO_RESULT_SIZE_T JunoHash_Xxh64Final(const JUNO_HASH_XXH64_STATE_T *ptState)
+{
+    JUNO_RESULT_SIZE_T tResult = {0, 0};
+    if(!(ptState))
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    // Fewer than 32 bytes in total never touched the lanes
+    uint64_t iHash = ptState->iLength >= JUNO_HASH_XXH64_STRIPE ?
+        JunoHash_Xxh64Converge(ptState->aiLanes) :
+        ptState->iSeed + JUNO_HASH_XXH64_PRIME5;
+    iHash += ptState->iLength;
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    tResult.tOk = (size_t)JunoHash_Xxh64Finalize(iHash, ptState->acStripe, ptState->zStripeLength);
+    return tResult;
+}
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_HASH_XXH64_H
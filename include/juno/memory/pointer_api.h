@@ -37,6 +37,7 @@
 #include "juno/macros.h"
 #include "juno/status.h"
 #include "juno/module.h"
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdalign.h>
 #include <stdint.h> // for uintptr_t used in type/alignment verification macros
@@ -198,6 +199,109 @@ static inline JUNO_STATUS_T JunoMemory_PointerVerify(const JUNO_POINTER_T tPoint
     return tStatus;
 }
 
+/**
+ * @brief Trivial Copy: size-checked byte copy of tSrc into tDest.
+ * @ingroup juno_memory_pointer
+ * @details Use as the Copy of a pointer API for trivially-copyable types.
+ *  Containers recognize it and copy inline instead of calling through the API.
+ * @return JUNO_STATUS_SUCCESS on success, JUNO_STATUS_INVALID_SIZE_ERROR if the
+ *         descriptors differ in size or alignment.
+ */
+// @{"req": ["REQ-POINTER-006"]}
+JUNO_STATUS_T JunoMemory_PointerCopyTrivial(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+
+/**
+ * @brief Trivial Reset: zero the bytes of the pointee.
+ * @ingroup juno_memory_pointer
+ * @details Use as the Reset of a pointer API for trivially-copyable types.
+ */
+// @{"req": ["REQ-POINTER-006"]}
+JUNO_STATUS_T JunoMemory_PointerResetTrivial(JUNO_POINTER_T tPointer);
+
+/**
+ * @brief Check whether a pointer API uses the trivial Copy and Reset.
+ * @ingroup juno_memory_pointer
+ */
+// @{"req": ["REQ-POINTER-006"]}
+static inline bool JunoMemory_PointerIsTrivial(const JUNO_POINTER_API_T *ptPointerApi)
+{
+    return ptPointerApi &&
+        ptPointerApi->Copy == JunoMemory_PointerCopyTrivial &&
+        ptPointerApi->Reset == JunoMemory_PointerResetTrivial;
+}
+
+/// @brief Byte copy used by the trivial fast path.
+/// @details Out of line so the compiler vectorizes the loop once instead of
+///  at each inlined call site, where it may not.
+void JunoMemory_PointerCopyBytes(void *pvDest, const void *pvSrc, size_t zSize);
+
+/// @brief Byte reset used by the trivial fast path.
+void JunoMemory_PointerResetBytes(void *pvAddr, size_t zSize);
+
+/**
+ * @brief Copy tSrc into tDest, inline for trivially-copyable types.
+ * @ingroup juno_memory_pointer
+ * @details When both descriptors share a trivial API the bytes are copied
+ *  directly after a size and alignment check; otherwise tDest's Copy is called.
+ *  Containers use this in place of `tDest.ptApi->Copy(tDest, tSrc)` and
+ *  report its errors through their own failure handler.
+ * @return JUNO_STATUS_SUCCESS on success, error code otherwise.
+ */
+// @{"req": ["REQ-POINTER-002", "REQ-POINTER-006"]}
+static inline JUNO_STATUS_T JunoMemory_PointerCopy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    if(tDest.ptApi == tSrc.ptApi && JunoMemory_PointerIsTrivial(tDest.ptApi))
+    {
+        JUNO_ASSERT_EXISTS(tDest.pvAddr && tSrc.pvAddr);
+        if(tDest.zSize != tSrc.zSize || tDest.zAlignment != tSrc.zAlignment)
+        {
+            return JUNO_STATUS_INVALID_SIZE_ERROR;
+        }
+        JunoMemory_PointerCopyBytes(tDest.pvAddr, tSrc.pvAddr, tDest.zSize);
+        return JUNO_STATUS_SUCCESS;
+    }
+    JUNO_ASSERT_EXISTS(tDest.ptApi && tDest.ptApi->Copy);
+    return tDest.ptApi->Copy(tDest, tSrc);
+}
+
+/**
+ * @brief Copy tSrc into tDest through ptApi, inline for trivially-copyable types.
+ * @ingroup juno_memory_pointer
+ * @details Same as JunoMemory_PointerCopy when both descriptors use ptApi;
+ *  otherwise `ptApi->Copy(tDest, tSrc)` is called. Pass the API the call
+ *  site dispatched through before the fast path existed, e.g. the source's
+ *  when reading out of a container.
+ * @return JUNO_STATUS_SUCCESS on success, error code otherwise.
+ */
+// @{"req": ["REQ-POINTER-002", "REQ-POINTER-006"]}
+static inline JUNO_STATUS_T JunoMemory_PointerCopyWith(const JUNO_POINTER_API_T *ptApi, JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    if(tDest.ptApi == ptApi && tSrc.ptApi == ptApi)
+    {
+        return JunoMemory_PointerCopy(tDest, tSrc);
+    }
+    JUNO_ASSERT_EXISTS(ptApi && ptApi->Copy);
+    return ptApi->Copy(tDest, tSrc);
+}
+
+/**
+ * @brief Reset the pointee, inline for trivially-copyable types.
+ * @ingroup juno_memory_pointer
+ * @return JUNO_STATUS_SUCCESS on success, error code otherwise.
+ */
+// @{"req": ["REQ-POINTER-003", "REQ-POINTER-006"]}
+static inline JUNO_STATUS_T JunoMemory_PointerReset(JUNO_POINTER_T tPointer)
+{
+    if(JunoMemory_PointerIsTrivial(tPointer.ptApi))
+    {
+        JUNO_ASSERT_EXISTS(tPointer.pvAddr);
+        JunoMemory_PointerResetBytes(tPointer.pvAddr, tPointer.zSize);
+        return JUNO_STATUS_SUCCESS;
+    }
+    JUNO_ASSERT_EXISTS(tPointer.ptApi && tPointer.ptApi->Reset);
+    return tPointer.ptApi->Reset(tPointer);
+}
+
 #ifdef __cplusplus
 }
 #endif
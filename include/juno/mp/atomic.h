@@ -0,0 +1,57 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file atomic.h
+ * @brief Atomic index type and cache-line sizing shared by the lock-free queues.
+ * @defgroup juno_mp_atomic Atomics
+ * @ingroup juno_mp_mtx
+ * @details
+ *  C translation units use C11 `<stdatomic.h>`; C++ translation units see the
+ *  layout-compatible `std::atomic<size_t>` so structures containing atomic
+ *  indices can be declared from either language. Only the C implementation
+ *  operates on the atomics.
+ *
+ *  JUNO_MP_CACHE_LINE_SIZE may be overridden at build time for targets whose
+ *  destructive interference size is not 64 bytes.
+ */
+#ifndef JUNO_MP_ATOMIC_H
+#define JUNO_MP_ATOMIC_H
+#include <stddef.h>
+#ifdef __cplusplus
+#include <atomic>
+/// Atomic size_t usable in structures shared between C and C++.
+#define JUNO_MP_ATOMIC_SIZE_T std::atomic<size_t>
+#define JUNO_MP_ALIGNAS(x) alignas(x)
+#else
+#include <stdatomic.h>
+/// Atomic size_t usable in structures shared between C and C++.
+#define JUNO_MP_ATOMIC_SIZE_T atomic_size_t
+#define JUNO_MP_ALIGNAS(x) _Alignas(x)
+#endif
+
+#ifndef JUNO_MP_CACHE_LINE_SIZE
+/// Alignment used to keep producer and consumer state on separate cache lines.
+#define JUNO_MP_CACHE_LINE_SIZE 64
+#endif
+
+#endif // JUNO_MP_ATOMIC_H
@@ -0,0 +1,157 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file bridge.h
+ * @brief Lock-free bridge that forwards messages from one thread's broker to another's.
+ * @defgroup juno_sb_bridge Broker Bridge
+ * @ingroup juno_sb
+ * @details
+ *  A bridge moves messages between two brokers owned by different threads
+ *  without IPC:
+ *  - Routes (JUNO_SB_BRIDGE_ROUTE_T) are pipes registered on the source
+ *    broker, one per forwarded MID. Publishing a matching MID on the source
+ *    broker copies the message into the bridge's ring.
+ *  - The bridge itself is an application (JUNO_APP_ROOT_T). Its OnProcess,
+ *    run by the destination thread's scheduler, drains up to zBatchLimit
+ *    messages and re-publishes each one on the destination broker under its
+ *    original MID.
+ *
+ *  The bridge owns two SPSC queues (juno/ds/queue_spsc.h), so every route
+ *  of a bridge must be registered on brokers owned by the same source
+ *  thread, and only the destination thread may drain it. One queue carries
+ *  the messages and the other carries their MIDs. A route enqueues the
+ *  message before its MID and the drain dequeues the MID before releasing
+ *  the message, so a visible MID always has its message behind it and the
+ *  MID queue can never be full when the message queue was not.
+ *
+ *  Storage is caller-owned: a backing array of the message type, which
+ *  defines the ring capacity, and one JUNO_SB_MID_T per slot.
+ *
+ *  Error behavior:
+ *  - A source Publish into a full ring returns JUNO_STATUS_OOB_ERROR.
+ *  - Routes cannot be dequeued directly (JUNO_STATUS_INVALID_TYPE_ERROR).
+ *  - A destination Publish error drops that message and is returned by the
+ *    drain; messages after it stay in the ring for the next drain.
+ */
+#ifndef JUNO_SB_BRIDGE_H
+#define JUNO_SB_BRIDGE_H
+#include "juno/app/app_api.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/ds/queue_spsc.h"
+#include "juno/module.h"
+#include "juno/mp/atomic.h"
+#include "juno/sb/broker_api.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_SB_BRIDGE_TAG JUNO_SB_BRIDGE_T;
+typedef struct JUNO_SB_BRIDGE_ROUTE_TAG JUNO_SB_BRIDGE_ROUTE_T;
+typedef struct JUNO_SB_BRIDGE_MID_ARRAY_TAG JUNO_SB_BRIDGE_MID_ARRAY_T;
+
+/// Array over the caller's MID storage, backing the bridge's MID queue.
+// @{"req": ["REQ-SB-023"]}
+struct JUNO_SB_BRIDGE_MID_ARRAY_TAG JUNO_MODULE_DERIVE(JUNO_DS_ARRAY_ROOT_T,
+    /// MID storage (length == message array capacity).
+    JUNO_SB_MID_T *ptMids;
+);
+
+/// The bridge drain application and its queues.
+// @{"req": ["REQ-SB-023"]}
+struct JUNO_SB_BRIDGE_TAG JUNO_MODULE_DERIVE(JUNO_APP_ROOT_T,
+    /// Broker that drained messages are re-published on.
+    JUNO_SB_BROKER_ROOT_T *ptDestBroker;
+    /// Maximum messages re-published per OnProcess, 0 for all available.
+    size_t zBatchLimit;
+    /// SPSC ring state over the caller's message array.
+    JUNO_DS_SPSC_RING_T tMsgRing;
+    /// SPSC queue of forwarded messages.
+    JUNO_DS_QUEUE_ROOT_T tMsgQueue;
+    /// Array over the caller's MID storage.
+    JUNO_SB_BRIDGE_MID_ARRAY_T tMids;
+    /// SPSC ring state over tMids.
+    JUNO_DS_SPSC_RING_T tMidRing;
+    /// SPSC queue of the MID of each forwarded message.
+    JUNO_DS_QUEUE_ROOT_T tMidQueue;
+);
+
+/// A subscriber pipe on the source broker that forwards its MID into a bridge.
+// @{"req": ["REQ-SB-024"]}
+struct JUNO_SB_BRIDGE_ROUTE_TAG JUNO_MODULE_DERIVE(JUNO_SB_PIPE_T,
+    /// The bridge this route feeds.
+    JUNO_SB_BRIDGE_T *ptBridge;
+);
+
+/**
+ * @brief Initialize a bridge.
+ * @param ptBridge Bridge to initialize.
+ * @param ptDestBroker Destination broker, owned by the draining thread.
+ * @param ptArray Initialized message storage defining the ring capacity.
+ * @param ptSlotMids MID storage, one entry per array slot.
+ * @param zBatchLimit Maximum messages re-published per OnProcess, 0 for no limit.
+ * @param pfcnFailureHandler Optional failure handler.
+ * @param pvFailureUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-SB-023"]}
+JUNO_STATUS_T JunoSb_BridgeInit(
+    JUNO_SB_BRIDGE_T *ptBridge,
+    JUNO_SB_BROKER_ROOT_T *ptDestBroker,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    JUNO_SB_MID_T *ptSlotMids,
+    size_t zBatchLimit,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvFailureUserData
+);
+
+/**
+ * @brief Initialize a route that forwards iMid into a bridge.
+ * @details Register &ptRoute->tRoot with the source broker afterwards.
+ * @param ptRoute Route to initialize.
+ * @param ptBridge Initialized bridge.
+ * @param iMid Message ID forwarded by this route.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-SB-024"]}
+JUNO_STATUS_T JunoSb_BridgeRouteInit(JUNO_SB_BRIDGE_ROUTE_T *ptRoute, JUNO_SB_BRIDGE_T *ptBridge, JUNO_SB_MID_T iMid);
+
+/**
+ * @brief Re-publish up to zMax forwarded messages on the destination broker.
+ * @details Destination thread only. OnProcess calls this with zBatchLimit.
+ * @param ptBridge Bridge to drain.
+ * @param zMax Maximum messages to re-publish, 0 for all available.
+ * @return The number of messages taken from the ring; on error tStatus holds
+ *         the destination Publish error and the failed message is counted.
+ */
+// @{"req": ["REQ-SB-025"]}
+JUNO_RESULT_SIZE_T JunoSb_BridgeDrain(JUNO_SB_BRIDGE_T *ptBridge, size_t zMax);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_SB_BRIDGE_H
@@ -43,7 +43,12 @@
  *  
  *  Thread safety: Intentionally NOT thread-safe. Each thread owns its broker.
  *  If you need to publish from another thread, use your IPC to send the
- *  message to that thread first, then publish locally.
+ *  message to that thread first, then publish locally. For threads sharing
+ *  memory, a pipe backed by an SPSC queue (juno/sb/pipe_spsc.h) can be
+ *  published into by the broker's thread and drained by one other thread;
+ *  an MPMC-backed pipe (juno/sb/pipe_mpmc.h) may be shared by several brokers
+ *  and consumers. To forward MIDs into another thread's broker, use a bridge
+ *  (juno/sb/bridge.h).
  *  
  *  @see examples/example_project for single-threaded usage
  */
@@ -56,6 +61,7 @@
 #include "juno/status.h"
 #include "juno/module.h"
 #include "juno/ds/queue_api.h"
+#include "juno/types.h"
 #include <stddef.h>
 #include <stdint.h>
 #ifdef __cplusplus
@@ -66,6 +72,7 @@ extern "C"
 typedef struct JUNO_SB_BROKER_ROOT_TAG JUNO_SB_BROKER_ROOT_T;
 typedef struct JUNO_SB_BROKER_API_TAG JUNO_SB_BROKER_API_T;
 typedef struct JUNO_SB_PIPE_TAG JUNO_SB_PIPE_T;
+typedef struct JUNO_SB_PUBLISH_ENTRY_TAG JUNO_SB_PUBLISH_ENTRY_T;
 typedef uint32_t JUNO_SB_MID_T;
 
 /// A subscriber pipe that carries messages for a specific MID.
@@ -75,6 +82,16 @@ struct JUNO_SB_PIPE_TAG JUNO_MODULE_DERIVE(JUNO_DS_QUEUE_ROOT_T,
     JUNO_SB_MID_T iMsgId;
 );
 
+/// A single (MID, message) pair in a batched publish.
+// @{"req": ["REQ-SB-017"]}
+struct JUNO_SB_PUBLISH_ENTRY_TAG
+{
+    /// Message ID / topic.
+    JUNO_SB_MID_T tMid;
+    /// Message handle (copied/enqueued per pointer trait).
+    JUNO_POINTER_T tMsg;
+};
+
 /// Broker root containing the registry of subscriber pipes.
 // @{"req": ["REQ-SB-001"]}
 struct JUNO_SB_BROKER_ROOT_TAG JUNO_MODULE_ROOT(JUNO_SB_BROKER_API_T,
@@ -96,6 +113,13 @@ struct JUNO_SB_BROKER_API_TAG
     JUNO_STATUS_T (*Publish)(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_MID_T tMid, JUNO_POINTER_T tMsg);
     /// @brief Register a subscriber pipe with the broker.
     JUNO_STATUS_T (*RegisterSubscriber)(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_PIPE_T *ptPipe);
+    /// @brief Publish an array of messages in order with a single broker verification.
+    /// @param ptBroker Broker instance.
+    /// @param ptEntries Array of (MID, message) pairs.
+    /// @param zEntries Number of entries in ptEntries.
+    /// @return On success tOk is zEntries. On failure tOk is the index of the
+    ///         entry that failed; every entry before it was fully published.
+    JUNO_RESULT_SIZE_T (*PublishBatch)(JUNO_SB_BROKER_ROOT_T *ptBroker, const JUNO_SB_PUBLISH_ENTRY_T *ptEntries, size_t zEntries);
 };
 
 /// @brief Verify a broker API table has required functions.
@@ -104,7 +128,8 @@ static inline JUNO_STATUS_T JunoSb_BrokerApiVerify(const JUNO_SB_BROKER_API_T *p
     JUNO_ASSERT_EXISTS(
         ptBrokerApi &&
         ptBrokerApi->Publish &&
-        ptBrokerApi->RegisterSubscriber
+        ptBrokerApi->RegisterSubscriber &&
+        ptBrokerApi->PublishBatch
     );
     return JUNO_STATUS_SUCCESS;
 }
@@ -0,0 +1,115 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file broker_indexed.h
+ * @brief Topic-indexed Software Bus broker.
+ * @defgroup juno_sb_indexed Topic-indexed Broker
+ * @ingroup juno_sb
+ * @details
+ *  A broker derivation that builds a MID -> subscriber index at registration
+ *  time so that Publish only touches the pipes subscribed to the published
+ *  MID. The index lives in caller-supplied storage; no heap is used.
+ *
+ *  Layout:
+ *  - The pipe registry is kept grouped by MID: all pipes for a MID are
+ *    contiguous and appear in registration order.
+ *  - The topic table holds one entry per distinct MID, sorted ascending by
+ *    MID. Each entry records where its group starts in the registry and how
+ *    many pipes it contains.
+ *
+ *  Complexity:
+ *  - Publish: O(log T + k) where T is the number of distinct MIDs and k is
+ *    the number of subscribers to the published MID.
+ *  - RegisterSubscriber: O(N + T) to keep the registry grouped and the
+ *    topic table sorted. Registration is expected to happen at startup.
+ *
+ *  Pipes are verified once when they are registered. Publish does not
+ *  re-verify every pipe in the registry; the queue Enqueue of each matching
+ *  pipe performs its own verification.
+ *
+ *  Thread safety: same as the base broker, intentionally NOT thread-safe.
+ */
+// @{"req": ["REQ-SB-014"]}
+#ifndef JUNO_SB_BROKER_INDEXED_H
+#define JUNO_SB_BROKER_INDEXED_H
+#include "juno/module.h"
+#include "juno/status.h"
+#include "juno/sb/broker_api.h"
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_SB_TOPIC_TAG JUNO_SB_TOPIC_T;
+typedef struct JUNO_SB_BROKER_INDEXED_TAG JUNO_SB_BROKER_INDEXED_T;
+
+/// A topic table entry describing the registry group of a single MID.
+struct JUNO_SB_TOPIC_TAG
+{
+    /// The message ID of this topic.
+    JUNO_SB_MID_T iMsgId;
+    /// Index of the first pipe for this MID in the pipe registry.
+    size_t iStart;
+    /// Number of pipes subscribed to this MID.
+    size_t zCount;
+};
+
+/// Broker derivation that indexes the pipe registry by MID.
+// @{"req": ["REQ-SB-014"]}
+struct JUNO_SB_BROKER_INDEXED_TAG JUNO_MODULE_DERIVE(JUNO_SB_BROKER_ROOT_T,
+    /// The topic table, sorted ascending by MID.
+    JUNO_SB_TOPIC_T *ptTopicTable;
+    /// The current number of distinct topics.
+    size_t zTopicLength;
+    /// Maximum number of distinct topics.
+    size_t zTopicCapacity;
+);
+
+/**
+ * @brief Initialize a topic-indexed broker.
+ * @param ptBroker Broker instance to initialize.
+ * @param ptPipeRegistry Pipe registry storage (kept grouped by MID).
+ * @param zRegistryCapacity Maximum number of pipes.
+ * @param ptTopicTable Topic table storage (one entry per distinct MID).
+ * @param zTopicCapacity Maximum number of distinct MIDs.
+ * @param pfcnFailureHdlr Optional failure handler.
+ * @param pvFailureUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-SB-014"]}
+JUNO_STATUS_T JunoSb_BrokerIndexedInit(
+    JUNO_SB_BROKER_INDEXED_T *ptBroker,
+    JUNO_SB_PIPE_T **ptPipeRegistry,
+    size_t zRegistryCapacity,
+    JUNO_SB_TOPIC_T *ptTopicTable,
+    size_t zTopicCapacity,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvFailureUserData
+);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_SB_BROKER_INDEXED_H
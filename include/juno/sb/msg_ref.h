@@ -0,0 +1,171 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file msg_ref.h
+ * @brief Reference-counted message handles for zero-copy Software Bus fan-out.
+ * @defgroup juno_sb_msg_ref Reference-counted Messages
+ * @ingroup juno_sb
+ * @details
+ *  A message pool pairs a caller-initialized fixed block allocator with a
+ *  caller-owned array of reference counts (one per block). Publishing through
+ *  JunoSb_PublishRef copies the payload into a pool block exactly once and
+ *  enqueues a small JUNO_SB_MSG_REF_T handle into every subscribed pipe.
+ *
+ *  Handle semantics are expressed through the pointer API of the pool
+ *  (ptPool->ptApi), so pipes need no special casing:
+ *  - Copy acquires a reference on the source block (releasing any reference
+ *    the destination handle already held).
+ *  - Reset releases the reference held by the handle and clears it.
+ *  When the last reference is released the block is returned to the
+ *  allocator with Put.
+ *
+ *  Subscriber pipes store handles, typically in a JUNO_SB_MSG_REF_ARRAY_T.
+ *  Dequeuing a handle hands one reference to the subscriber, which must call
+ *  JunoSb_MsgRefRelease when it is done with the payload. Handles used as
+ *  Dequeue destinations must start zero-initialized.
+ *
+ *  The block allocator's pointer API must be the pointer API of the message
+ *  type, since the payload is copied with the message's own Copy.
+ *
+ *  Thread safety: reference counts are plain counters. A pool belongs to a
+ *  single thread, like the broker.
+ */
+// @{"req": ["REQ-SB-019"]}
+#ifndef JUNO_SB_MSG_REF_H
+#define JUNO_SB_MSG_REF_H
+#include "juno/ds/array_api.h"
+#include "juno/memory/memory_block.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/sb/broker_api.h"
+#include "juno/status.h"
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_SB_MSG_POOL_TAG JUNO_SB_MSG_POOL_T;
+typedef struct JUNO_SB_MSG_REF_TAG JUNO_SB_MSG_REF_T;
+typedef struct JUNO_SB_MSG_REF_ARRAY_TAG JUNO_SB_MSG_REF_ARRAY_T;
+
+/// A handle holding one reference to a pooled message.
+// @{"req": ["REQ-SB-019"]}
+struct JUNO_SB_MSG_REF_TAG
+{
+    /// The pool that owns the message block, NULL for an empty handle.
+    JUNO_SB_MSG_POOL_T *ptPool;
+    /// The pooled message block.
+    JUNO_POINTER_T tMsg;
+};
+
+/// Message pool. The root API is the pointer API of the pool's handles.
+// @{"req": ["REQ-SB-019"]}
+struct JUNO_SB_MSG_POOL_TAG JUNO_MODULE_ROOT(JUNO_POINTER_API_T,
+    /// Block allocator holding the message payloads.
+    JUNO_MEMORY_ALLOC_BLOCK_T *ptAlloc;
+    /// Reference count per block (length == ptAlloc->zLength).
+    size_t *pzRefCounts;
+);
+
+/// Array of message handles, usable as the backing store of a pipe.
+// @{"req": ["REQ-SB-022"]}
+struct JUNO_SB_MSG_REF_ARRAY_TAG JUNO_MODULE_DERIVE(JUNO_DS_ARRAY_ROOT_T,
+    /// Handle storage (length == zCapacity).
+    JUNO_SB_MSG_REF_T *ptRefs;
+);
+
+/**
+ * @def JunoSb_MsgRefPointerInit(ptPool, ptRef)
+ * @brief Create a pointer descriptor for a handle of the given pool.
+ * @param ptPool Message pool providing the handle pointer API.
+ * @param ptRef Address of the JUNO_SB_MSG_REF_T.
+ */
+#define JunoSb_MsgRefPointerInit(ptPool, ptRef) JunoMemory_PointerInit((ptPool)->ptApi, JUNO_SB_MSG_REF_T, ptRef)
+
+/**
+ * @brief Initialize a message pool.
+ * @param ptPool Pool to initialize.
+ * @param ptAlloc Initialized block allocator for the message payloads.
+ * @param pzRefCounts Reference count storage, one entry per allocator block.
+ * @param pfcnFailureHandler Optional failure handler.
+ * @param pvFailureUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-SB-019"]}
+JUNO_STATUS_T JunoSb_MsgPoolInit(
+    JUNO_SB_MSG_POOL_T *ptPool,
+    JUNO_MEMORY_ALLOC_BLOCK_T *ptAlloc,
+    size_t *pzRefCounts,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvFailureUserData
+);
+
+/**
+ * @brief Release the reference held by a handle and clear it.
+ * @details The block is returned to the allocator when this was the last
+ *          reference. Releasing an empty handle is a no-op.
+ * @param ptRef Handle to release.
+ * @return JUNO_STATUS_SUCCESS on success, JUNO_STATUS_INVALID_REF_ERROR if the
+ *         handle does not reference a live block of its pool.
+ */
+// @{"req": ["REQ-SB-021"]}
+JUNO_STATUS_T JunoSb_MsgRefRelease(JUNO_SB_MSG_REF_T *ptRef);
+
+/**
+ * @brief Publish a message by reference.
+ * @details Copies tMsg into a pool block once, publishes a handle to it on
+ *          ptBroker, then releases the publisher's reference. Each pipe that
+ *          accepted the handle holds one reference. On a publish error the
+ *          pipes that already received the handle keep their references.
+ * @param ptBroker Broker to publish on.
+ * @param ptPool Message pool to copy the payload into.
+ * @param tMid Message ID / topic.
+ * @param tMsg The message to publish.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-SB-020"]}
+JUNO_STATUS_T JunoSb_PublishRef(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_MSG_POOL_T *ptPool, JUNO_SB_MID_T tMid, JUNO_POINTER_T tMsg);
+
+/**
+ * @brief Initialize an array of message handles.
+ * @param ptArray Array to initialize.
+ * @param ptRefs Handle storage, zero-initialized by this call.
+ * @param zCapacity Number of handles in ptRefs.
+ * @param pfcnFailureHandler Optional failure handler.
+ * @param pvFailureUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-SB-022"]}
+JUNO_STATUS_T JunoSb_MsgRefArrayInit(
+    JUNO_SB_MSG_REF_ARRAY_T *ptArray,
+    JUNO_SB_MSG_REF_T *ptRefs,
+    size_t zCapacity,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvFailureUserData
+);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_SB_MSG_REF_H
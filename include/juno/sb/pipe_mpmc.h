@@ -0,0 +1,58 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file pipe_mpmc.h
+ * @brief Software Bus pipes backed by a lock-free MPMC queue.
+ * @ingroup juno_sb
+ * @details
+ *  A pipe initialized with JunoSb_PipeMpmcInit may be registered with brokers
+ *  owned by several threads and drained by several consumer threads. Each
+ *  broker remains single-threaded; only the pipe is shared.
+ */
+#ifndef JUNO_SB_PIPE_MPMC_H
+#define JUNO_SB_PIPE_MPMC_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_mpmc.h"
+#include "juno/macros.h"
+#include "juno/mp/atomic.h"
+#include "juno/sb/broker_api.h"
+#include "juno/status.h"
+#include <stddef.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @brief Initialize a pipe for a specific MID backed by an MPMC queue over ptArray.
+// @{"req": ["REQ-SB-005", "REQ-QUEUE-012"]}
+static inline JUNO_STATUS_T JunoSb_PipeMpmcInit(JUNO_SB_PIPE_T *ptPipe, JUNO_SB_MID_T iMid, JUNO_DS_MPMC_RING_T *ptRing, JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_MP_ATOMIC_SIZE_T *ptSequences, size_t zRetryLimit, JUNO_FAILURE_HANDLER_T pfcnFailureHandler, JUNO_USER_DATA_T *pvUserData)
+{
+    JUNO_ASSERT_EXISTS(ptPipe);
+    ptPipe->iMsgId = iMid;
+    return JunoDs_QueueMpmcInit(&ptPipe->tRoot, ptRing, ptArray, ptSequences, zRetryLimit, pfcnFailureHandler, pvUserData);
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_SB_PIPE_MPMC_H
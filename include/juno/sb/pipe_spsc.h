@@ -0,0 +1,56 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file pipe_spsc.h
+ * @brief Software Bus pipes backed by a lock-free SPSC queue.
+ * @ingroup juno_sb
+ * @details
+ *  A pipe initialized with JunoSb_PipeSpscInit may be published into by the
+ *  thread that owns the broker while a single other thread dequeues from it.
+ *  The broker itself remains single-threaded; only the pipe crosses threads.
+ */
+#ifndef JUNO_SB_PIPE_SPSC_H
+#define JUNO_SB_PIPE_SPSC_H
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_spsc.h"
+#include "juno/macros.h"
+#include "juno/sb/broker_api.h"
+#include "juno/status.h"
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// @brief Initialize a pipe for a specific MID backed by an SPSC queue over ptArray.
+// @{"req": ["REQ-SB-005", "REQ-QUEUE-009"]}
+static inline JUNO_STATUS_T JunoSb_PipeSpscInit(JUNO_SB_PIPE_T *ptPipe, JUNO_SB_MID_T iMid, JUNO_DS_SPSC_RING_T *ptRing, JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_FAILURE_HANDLER_T pfcnFailureHandler, JUNO_USER_DATA_T *pvUserData)
+{
+    JUNO_ASSERT_EXISTS(ptPipe);
+    ptPipe->iMsgId = iMid;
+    return JunoDs_QueueSpscInit(&ptPipe->tRoot, ptRing, ptArray, pfcnFailureHandler, pvUserData);
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_SB_PIPE_SPSC_H
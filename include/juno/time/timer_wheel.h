@@ -0,0 +1,241 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+    This API has been generated by LibJuno:
+    https://www.robinonsay.com/libjuno/
+*/
+
+/**
+ * @file timer_wheel.h
+ * @brief Hierarchical timer wheel driven by a Juno Time module.
+ * @defgroup juno_time_wheel Timer Wheel
+ * @ingroup juno_time
+ * @details
+ *  A timer wheel keeps thousands of timeouts without scanning them on every
+ *  poll. Time is divided into ticks of a fixed duration (tTick) measured from
+ *  the time source's Now() at initialization. Timers are intrusive nodes owned
+ *  by the caller and are linked into caller-provided slot storage, so the wheel
+ *  performs no allocation.
+ *
+ *  The slot storage is split into zLevels levels of 2^zLevelBits slots. Level 0
+ *  holds timers due within the next 2^zLevelBits ticks, one slot per tick.
+ *  Each level above covers 2^zLevelBits times the span of the level below and
+ *  is cascaded down one slot at a time as the wheel turns. Timers due beyond
+ *  the range of the top level are parked in it and re-cascaded until in range.
+ *
+ *  - Start, StartAt, Stop and Restart are O(1).
+ *  - Advance(tNow) processes every tick boundary that tNow has reached and
+ *    calls the callbacks of all timers that expired, in batch.
+ *  - A timer never fires before its expiry and fires on the first tick
+ *    boundary at or after it, so it is late by less than one tick plus the
+ *    caller's polling latency.
+ *
+ *  Callbacks may start, stop or restart any timer, including the one firing.
+ *  Callbacks must not call Advance or Poll on the same wheel.
+ *
+ *  Thread safety: a wheel and its timers belong to a single thread.
+ */
+// @{"req": ["REQ-TIME-020"]}
+#ifndef JUNO_TIMER_WHEEL_H
+#define JUNO_TIMER_WHEEL_H
+#include "juno/module.h"
+#include "juno/status.h"
+#include "juno/time/time_api.h"
+#include "juno/types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef struct JUNO_TIME_WHEEL_TAG JUNO_TIME_WHEEL_T;
+typedef struct JUNO_TIME_TIMER_TAG JUNO_TIME_TIMER_T;
+
+/// Tick count of a timer wheel
+typedef uint64_t JUNO_TIME_TICK_T;
+
+/**
+ * @brief Timer expiry callback.
+ * @param ptTimer The timer that expired. It is inactive when called.
+ * @param pvUserData The user data given to JunoTime_TimerInit.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+typedef JUNO_STATUS_T (*JUNO_TIME_TIMER_CALLBACK_T)(JUNO_TIME_TIMER_T *ptTimer, JUNO_USER_DATA_T *pvUserData);
+
+/**
+ * @def JUNO_TIME_WHEEL_SLOTS(zLevelBits, zLevels)
+ * @brief Number of slots a wheel with the given geometry needs.
+ */
+#define JUNO_TIME_WHEEL_SLOTS(zLevelBits, zLevels) ((size_t)(zLevels) << (zLevelBits))
+
+/// Largest supported number of bits per level
+#define JUNO_TIME_WHEEL_LEVEL_BITS_MAX 16
+
+/// An intrusive timer. The fields are managed by the wheel.
+// @{"req": ["REQ-TIME-021"]}
+struct JUNO_TIME_TIMER_TAG
+{
+    /// Next timer in the same slot
+    JUNO_TIME_TIMER_T *ptNext;
+    /// Link that points to this timer, NULL when the timer is inactive
+    JUNO_TIME_TIMER_T **pptPrev;
+    /// Tick on which the timer fires
+    JUNO_TIME_TICK_T iExpiryTick;
+    /// Requested expiry time
+    JUNO_TIMESTAMP_T tExpiry;
+    /// Callback called when the timer expires
+    JUNO_TIME_TIMER_CALLBACK_T pfcnCallback;
+    /// User data passed to the callback
+    JUNO_USER_DATA_T *pvUserData;
+};
+
+/// Timer wheel
+// @{"req": ["REQ-TIME-020"]}
+struct JUNO_TIME_WHEEL_TAG JUNO_MODULE_ROOT(void,
+    /// Time source used for Now() and time math
+    const JUNO_TIME_ROOT_T *ptTime;
+    /// Slot heads, level by level (length == zLevels << zLevelBits)
+    JUNO_TIME_TIMER_T **ptSlots;
+    /// log2 of the number of slots per level
+    size_t zLevelBits;
+    /// Number of levels
+    size_t zLevels;
+    /// Duration of one tick
+    JUNO_TIMESTAMP_T tTick;
+    /// Time at which the next tick begins
+    JUNO_TIMESTAMP_T tNextTick;
+    /// Last tick processed
+    JUNO_TIME_TICK_T iNowTick;
+    /// Number of active timers
+    size_t zActive;
+);
+
+/// Return true if the timer is active in a wheel.
+static inline bool JunoTime_TimerIsActive(const JUNO_TIME_TIMER_T *ptTimer)
+{
+    return ptTimer && ptTimer->pptPrev;
+}
+
+/**
+ * @brief Initialize a timer wheel.
+ * @details The first tick begins tTick after ptTime's Now().
+ * @param ptWheel Wheel to initialize.
+ * @param ptTime Time source providing Now, AddTime and SubtractTime.
+ * @param ptSlots Slot storage, cleared by this call.
+ * @param zSlots Number of slots in ptSlots, must be zLevels << zLevelBits.
+ * @param zLevelBits log2 of the number of slots per level, 1 to
+ *        JUNO_TIME_WHEEL_LEVEL_BITS_MAX.
+ * @param zLevels Number of levels, at least 1 and at most 63 / zLevelBits.
+ * @param tTick Duration of one tick, must be nonzero.
+ * @param pfcnFailureHandler Optional failure handler.
+ * @param pvFailureUserData Optional failure handler user data.
+ * @return JUNO_STATUS_SUCCESS on success, JUNO_STATUS_INVALID_SIZE_ERROR for
+ *         an invalid geometry or tick, error otherwise.
+ */
+// @{"req": ["REQ-TIME-020"]}
+JUNO_STATUS_T JunoTime_WheelInit(
+    JUNO_TIME_WHEEL_T *ptWheel,
+    const JUNO_TIME_ROOT_T *ptTime,
+    JUNO_TIME_TIMER_T **ptSlots,
+    size_t zSlots,
+    size_t zLevelBits,
+    size_t zLevels,
+    JUNO_TIMESTAMP_T tTick,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvFailureUserData
+);
+
+/**
+ * @brief Initialize an inactive timer.
+ * @param ptTimer Timer to initialize.
+ * @param pfcnCallback Callback called when the timer expires.
+ * @param pvUserData User data passed to the callback.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-TIME-021"]}
+JUNO_STATUS_T JunoTime_TimerInit(JUNO_TIME_TIMER_T *ptTimer, JUNO_TIME_TIMER_CALLBACK_T pfcnCallback, JUNO_USER_DATA_T *pvUserData);
+
+/**
+ * @brief Start a timer that expires at an absolute time.
+ * @details An expiry that has already passed fires on the next tick.
+ * @param ptWheel Wheel to start the timer in.
+ * @param ptTimer Inactive timer.
+ * @param tExpiry Expiry time.
+ * @return JUNO_STATUS_SUCCESS on success, JUNO_STATUS_REF_IN_USE_ERROR if the
+ *         timer is already active, error otherwise.
+ */
+// @{"req": ["REQ-TIME-022"]}
+JUNO_STATUS_T JunoTime_TimerStartAt(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIME_TIMER_T *ptTimer, JUNO_TIMESTAMP_T tExpiry);
+
+/**
+ * @brief Start a timer that expires tDelay after Now().
+ * @param ptWheel Wheel to start the timer in.
+ * @param ptTimer Inactive timer.
+ * @param tDelay Delay until expiry.
+ * @return JUNO_STATUS_SUCCESS on success, JUNO_STATUS_REF_IN_USE_ERROR if the
+ *         timer is already active, error otherwise.
+ */
+// @{"req": ["REQ-TIME-022"]}
+JUNO_STATUS_T JunoTime_TimerStart(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIME_TIMER_T *ptTimer, JUNO_TIMESTAMP_T tDelay);
+
+/**
+ * @brief Stop a timer without calling its callback.
+ * @details Stopping an inactive timer is a no-op.
+ * @param ptWheel Wheel the timer was started in.
+ * @param ptTimer Timer to stop.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-TIME-023"]}
+JUNO_STATUS_T JunoTime_TimerStop(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIME_TIMER_T *ptTimer);
+
+/**
+ * @brief Stop a timer if active and start it again tDelay after Now().
+ * @param ptWheel Wheel to start the timer in.
+ * @param ptTimer Timer to restart.
+ * @param tDelay Delay until expiry.
+ * @return JUNO_STATUS_SUCCESS on success, error otherwise.
+ */
+// @{"req": ["REQ-TIME-023"]}
+JUNO_STATUS_T JunoTime_TimerRestart(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIME_TIMER_T *ptTimer, JUNO_TIMESTAMP_T tDelay);
+
+/**
+ * @brief Process every tick boundary reached by tNow and fire expired timers.
+ * @details When a callback fails, the remaining timers of the same tick still
+ *          fire, then Advance stops and returns the first failure. The next
+ *          call resumes from the following tick.
+ * @param ptWheel Wheel to advance.
+ * @param tNow Current time. Times before the next tick boundary do nothing.
+ * @return The number of timers fired, with the first callback failure.
+ */
+// @{"req": ["REQ-TIME-024"]}
+JUNO_RESULT_SIZE_T JunoTime_WheelAdvance(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIMESTAMP_T tNow);
+
+/**
+ * @brief Advance the wheel to the time source's Now().
+ * @param ptWheel Wheel to advance.
+ * @return The number of timers fired, error otherwise.
+ */
+// @{"req": ["REQ-TIME-024"]}
+JUNO_RESULT_SIZE_T JunoTime_WheelPoll(JUNO_TIME_WHEEL_T *ptWheel);
+
+#ifdef __cplusplus
+}
+#endif
+#endif // JUNO_TIMER_WHEEL_H
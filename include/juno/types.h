@@ -52,6 +52,10 @@ JUNO_MODULE_RESULT(JUNO_RESULT_BOOL_T, bool);
  *  @ingroup juno_types
  */
 JUNO_MODULE_RESULT(JUNO_RESULT_UINT32_T, uint32_t);
+/** @brief Result type carrying a 64-bit unsigned integer payload.
+ *  @ingroup juno_types
+ */
+JUNO_MODULE_RESULT(JUNO_RESULT_UINT64_T, uint64_t);
 /** @brief Result type carrying a double-precision floating-point payload.
  *  @ingroup juno_types
  */
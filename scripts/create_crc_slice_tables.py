@@ -0,0 +1,89 @@
+"""
+Generate the slicing-by-8 CRC tables in src/crc/*_slice.h.
+
+Each table is derived from the 256-entry byte table already in
+src/crc/<name>.h, so the sliced kernels produce bit-identical results.
+Row k holds the CRC contribution of a byte followed by k zero bytes:
+
+    reflected:  T[k][i] = (T[k-1][i] >> 8) ^ T[0][T[k-1][i] & 0xff]
+    normal:     T[k][i] = (T[k-1][i] << 8) ^ T[0][T[k-1][i] >> (width - 8)]
+
+Rows 4..7 are only compiled when JUNO_CRC_SLICE is 8:
+
+    python3 scripts/create_crc_slice_tables.py
+"""
+from pathlib import Path
+import re
+
+ROOT = Path(__file__).resolve().parent.parent
+CRC_DIR = ROOT / "src" / "crc"
+SLICES = 8
+
+# name: (width, reflected)
+CRCS = {
+    "arc": (16, True),
+    "binhex": (16, False),
+    "castagnoli": (32, True),
+    "ccitt": (16, False),
+    "ccitt32": (32, False),
+    "crc64": (64, True),
+    "kermit": (16, True),
+    "zip": (32, True),
+}
+
+
+def read_table(name: str) -> list:
+    text = (CRC_DIR / f"{name}.h").read_text()
+    body = text[text.index(f"{name}_crctab[256]"):]
+    body = body[body.index("{") + 1:body.index("}")]
+    table = [int(value, 16) for value in re.findall(r"0x[0-9a-fA-F]+", body)]
+    assert len(table) == 256, name
+    return table
+
+
+def slice_rows(table: list, width: int, reflected: bool) -> list:
+    mask = (1 << width) - 1
+    rows = [table]
+    for _ in range(1, SLICES):
+        prev = rows[-1]
+        if reflected:
+            rows.append([(v >> 8) ^ table[v & 0xFF] for v in prev])
+        else:
+            rows.append([((v << 8) & mask) ^ table[v >> (width - 8)] for v in prev])
+    return rows
+
+
+def format_row(row: list, width: int) -> str:
+    digits = width // 4
+    per_line = {16: 8, 32: 4, 64: 2}[width]
+    suffix = "ull" if width == 64 else ""
+    lines = []
+    for i in range(0, len(row), per_line):
+        values = ", ".join(f"0x{v:0{digits}x}{suffix}" for v in row[i:i + per_line])
+        lines.append(f"        {values},")
+    return "    {\n" + "\n".join(lines) + "\n    },\n"
+
+
+def emit(name: str, width: int, reflected: bool, header: str) -> str:
+    rows = slice_rows(read_table(name), width, reflected)
+    out = header
+    out += "#include <stdint.h>\n"
+    out += f"// Generated by scripts/create_crc_slice_tables.py from {name}_crctab\n"
+    out += f"static const uint{width}_t {name}_crctab_slice[JUNO_CRC_SLICE][256] = {{\n"
+    for k, row in enumerate(rows):
+        if k == 4:
+            out += "#if JUNO_CRC_SLICE == 8\n"
+        out += format_row(row, width)
+    out += "#endif\n};\n"
+    return out
+
+
+def main():
+    text = (CRC_DIR / "arc.h").read_text()
+    header = text[:text.index("#include")]
+    for name, (width, reflected) in CRCS.items():
+        (CRC_DIR / f"{name}_slice.h").write_text(emit(name, width, reflected, header))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,133 @@
+"""
+Generate a minimal perfect-hash table for a fixed key set.
+
+The output header defines a JUNO_MAP_PERFECT_TABLE_T (see
+include/juno/ds/map_perfect.h) for use with JunoDs_MapPerfectInit or
+JunoDs_MapPerfectSlot. Keys are the values returned by the map's Hash
+callback, e.g. message IDs or command codes:
+
+    python3 scripts/create_perfect_hash.py sb_mids 0x1800 0x1801 0x1880 -o sb_mids_table.h
+"""
+from pathlib import Path
+from argparse import ArgumentParser
+import sys
+
+MASK64 = (1 << 64) - 1
+MAX_DISPLACEMENT = 1 << 20
+MAX_SEED = 1 << 8
+
+
+def mix(value: int, seed: int) -> int:
+    """Mirror of JunoDs_MapPerfectMix."""
+    z = (value + 0x9E3779B97F4A7C15 * (seed + 1)) & MASK64
+    z = ((z ^ (z >> 30)) * 0xBF58476D1CE4E5B9) & MASK64
+    z = ((z ^ (z >> 27)) * 0x94D049BB133111EB) & MASK64
+    return z ^ (z >> 31)
+
+
+def slot_of(key: int, seed: int, displacements: list, n_keys: int) -> int:
+    """Mirror of JunoDs_MapPerfectSlot."""
+    bucket = mix(key, seed) % len(displacements)
+    return mix(key, displacements[bucket]) % n_keys
+
+
+def generate(keys: list):
+    """Hash-and-displace: place the largest buckets first, searching for a
+    displacement that lands every key of the bucket in a free slot."""
+    n_keys = len(keys)
+    n_buckets = max(1, (n_keys + 1) // 2)
+    for seed in range(MAX_SEED):
+        buckets = [[] for _ in range(n_buckets)]
+        for key in keys:
+            buckets[mix(key, seed) % n_buckets].append(key)
+        order = sorted(range(n_buckets), key=lambda b: len(buckets[b]), reverse=True)
+        displacements = [0] * n_buckets
+        slots = [None] * n_keys
+        placed = True
+        for bucket in order:
+            members = buckets[bucket]
+            if not members:
+                break
+            for displacement in range(MAX_DISPLACEMENT):
+                candidate = [mix(key, displacement) % n_keys for key in members]
+                if len(set(candidate)) == len(candidate) and all(slots[s] is None for s in candidate):
+                    for key, s in zip(members, candidate):
+                        slots[s] = key
+                    displacements[bucket] = displacement
+                    break
+            else:
+                placed = False
+                break
+        if placed:
+            return seed, displacements, slots
+    raise RuntimeError("No perfect hash found, try a different key set")
+
+
+def to_camel(name: str) -> str:
+    return ''.join(word.capitalize() for word in name.split('_'))
+
+
+def render(name: str, keys: list, seed: int, displacements: list, slots: list) -> str:
+    camel = to_camel(name)
+    guard = f"{name.upper()}_PERFECT_TABLE_H"
+    disp = ",\n".join(f"    {d}u" for d in displacements)
+    keys_text = ",\n".join(f"    {hex(k)}u" for k in slots)
+    return f"""/**
+    This file has been generated by LibJuno scripts/create_perfect_hash.py.
+    Do not edit. Keys: {', '.join(hex(k) for k in keys)}
+*/
+#ifndef {guard}
+#define {guard}
+#include "juno/ds/map_perfect.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/// Number of keys and slots in the {name} table.
+#define {name.upper()}_PERFECT_KEYS ({len(slots)}u)
+
+static const uint32_t gi{camel}Displacements[{len(displacements)}] =
+{{
+{disp}
+}};
+
+static const size_t gz{camel}Keys[{len(slots)}] =
+{{
+{keys_text}
+}};
+
+static const JUNO_MAP_PERFECT_TABLE_T gt{camel}PerfectTable =
+{{
+    gi{camel}Displacements,
+    {len(displacements)},
+    gz{camel}Keys,
+    {len(slots)},
+    {seed}u
+}};
+
+#endif // {guard}
+"""
+
+
+def main():
+    parser = ArgumentParser(description="Generate a minimal perfect-hash table for JunoDs_MapPerfectInit")
+    parser.add_argument("name", help="Table name in snake_case, e.g. sb_mids")
+    parser.add_argument("keys", nargs="+", help="Key hashes (decimal or 0x hex)")
+    parser.add_argument("-o", "--output", help="Output header, stdout if omitted")
+    args = parser.parse_args()
+    keys = [int(key, 0) for key in args.keys]
+    if len(set(keys)) != len(keys):
+        parser.error("Keys must be unique")
+    if any(key < 0 or key > 0xFFFFFFFF for key in keys):
+        parser.error("Keys must fit in 32 bits so the table is valid for any size_t")
+    seed, displacements, slots = generate(keys)
+    for key in keys:
+        assert slots[slot_of(key, seed, displacements, len(keys))] == key
+    text = render(args.name, keys, seed, displacements, slots)
+    if args.output:
+        Path(args.output).write_text(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == '__main__':
+    main()
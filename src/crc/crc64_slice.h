@@ -0,0 +1,1062 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+#include <stdint.h>
+// Generated by scripts/create_crc_slice_tables.py from crc64_crctab
+static const uint64_t crc64_crctab_slice[JUNO_CRC_SLICE][256] = {
+    {
+        0x0000000000000000ull, 0xb32e4cbe03a75f6full,
+        0xf4843657a840a05bull, 0x47aa7ae9abe7ff34ull,
+        0x7bd0c384ff8f5e33ull, 0xc8fe8f3afc28015cull,
+        0x8f54f5d357cffe68ull, 0x3c7ab96d5468a107ull,
+        0xf7a18709ff1ebc66ull, 0x448fcbb7fcb9e309ull,
+        0x0325b15e575e1c3dull, 0xb00bfde054f94352ull,
+        0x8c71448d0091e255ull, 0x3f5f08330336bd3aull,
+        0x78f572daa8d1420eull, 0xcbdb3e64ab761d61ull,
+        0x7d9ba13851336649ull, 0xceb5ed8652943926ull,
+        0x891f976ff973c612ull, 0x3a31dbd1fad4997dull,
+        0x064b62bcaebc387aull, 0xb5652e02ad1b6715ull,
+        0xf2cf54eb06fc9821ull, 0x41e11855055bc74eull,
+        0x8a3a2631ae2dda2full, 0x39146a8fad8a8540ull,
+        0x7ebe1066066d7a74ull, 0xcd905cd805ca251bull,
+        0xf1eae5b551a2841cull, 0x42c4a90b5205db73ull,
+        0x056ed3e2f9e22447ull, 0xb6409f5cfa457b28ull,
+        0xfb374270a266cc92ull, 0x48190ecea1c193fdull,
+        0x0fb374270a266cc9ull, 0xbc9d3899098133a6ull,
+        0x80e781f45de992a1ull, 0x33c9cd4a5e4ecdceull,
+        0x7463b7a3f5a932faull, 0xc74dfb1df60e6d95ull,
+        0x0c96c5795d7870f4ull, 0xbfb889c75edf2f9bull,
+        0xf812f32ef538d0afull, 0x4b3cbf90f69f8fc0ull,
+        0x774606fda2f72ec7ull, 0xc4684a43a15071a8ull,
+        0x83c230aa0ab78e9cull, 0x30ec7c140910d1f3ull,
+        0x86ace348f355aadbull, 0x3582aff6f0f2f5b4ull,
+        0x7228d51f5b150a80ull, 0xc10699a158b255efull,
+        0xfd7c20cc0cdaf4e8ull, 0x4e526c720f7dab87ull,
+        0x09f8169ba49a54b3ull, 0xbad65a25a73d0bdcull,
+        0x710d64410c4b16bdull, 0xc22328ff0fec49d2ull,
+        0x85895216a40bb6e6ull, 0x36a71ea8a7ace989ull,
+        0x0adda7c5f3c4488eull, 0xb9f3eb7bf06317e1ull,
+        0xfe5991925b84e8d5ull, 0x4d77dd2c5823b7baull,
+        0x64b62bcaebc387a1ull, 0xd7986774e864d8ceull,
+        0x90321d9d438327faull, 0x231c512340247895ull,
+        0x1f66e84e144cd992ull, 0xac48a4f017eb86fdull,
+        0xebe2de19bc0c79c9ull, 0x58cc92a7bfab26a6ull,
+        0x9317acc314dd3bc7ull, 0x2039e07d177a64a8ull,
+        0x67939a94bc9d9b9cull, 0xd4bdd62abf3ac4f3ull,
+        0xe8c76f47eb5265f4ull, 0x5be923f9e8f53a9bull,
+        0x1c4359104312c5afull, 0xaf6d15ae40b59ac0ull,
+        0x192d8af2baf0e1e8ull, 0xaa03c64cb957be87ull,
+        0xeda9bca512b041b3ull, 0x5e87f01b11171edcull,
+        0x62fd4976457fbfdbull, 0xd1d305c846d8e0b4ull,
+        0x96797f21ed3f1f80ull, 0x2557339fee9840efull,
+        0xee8c0dfb45ee5d8eull, 0x5da24145464902e1ull,
+        0x1a083bacedaefdd5ull, 0xa9267712ee09a2baull,
+        0x955cce7fba6103bdull, 0x267282c1b9c65cd2ull,
+        0x61d8f8281221a3e6ull, 0xd2f6b4961186fc89ull,
+        0x9f8169ba49a54b33ull, 0x2caf25044a02145cull,
+        0x6b055fede1e5eb68ull, 0xd82b1353e242b407ull,
+        0xe451aa3eb62a1500ull, 0x577fe680b58d4a6full,
+        0x10d59c691e6ab55bull, 0xa3fbd0d71dcdea34ull,
+        0x6820eeb3b6bbf755ull, 0xdb0ea20db51ca83aull,
+        0x9ca4d8e41efb570eull, 0x2f8a945a1d5c0861ull,
+        0x13f02d374934a966ull, 0xa0de61894a93f609ull,
+        0xe7741b60e174093dull, 0x545a57dee2d35652ull,
+        0xe21ac88218962d7aull, 0x5134843c1b317215ull,
+        0x169efed5b0d68d21ull, 0xa5b0b26bb371d24eull,
+        0x99ca0b06e7197349ull, 0x2ae447b8e4be2c26ull,
+        0x6d4e3d514f59d312ull, 0xde6071ef4cfe8c7dull,
+        0x15bb4f8be788911cull, 0xa6950335e42fce73ull,
+        0xe13f79dc4fc83147ull, 0x521135624c6f6e28ull,
+        0x6e6b8c0f1807cf2full, 0xdd45c0b11ba09040ull,
+        0x9aefba58b0476f74ull, 0x29c1f6e6b3e0301bull,
+        0xc96c5795d7870f42ull, 0x7a421b2bd420502dull,
+        0x3de861c27fc7af19ull, 0x8ec62d7c7c60f076ull,
+        0xb2bc941128085171ull, 0x0192d8af2baf0e1eull,
+        0x4638a2468048f12aull, 0xf516eef883efae45ull,
+        0x3ecdd09c2899b324ull, 0x8de39c222b3eec4bull,
+        0xca49e6cb80d9137full, 0x7967aa75837e4c10ull,
+        0x451d1318d716ed17ull, 0xf6335fa6d4b1b278ull,
+        0xb199254f7f564d4cull, 0x02b769f17cf11223ull,
+        0xb4f7f6ad86b4690bull, 0x07d9ba1385133664ull,
+        0x4073c0fa2ef4c950ull, 0xf35d8c442d53963full,
+        0xcf273529793b3738ull, 0x7c0979977a9c6857ull,
+        0x3ba3037ed17b9763ull, 0x888d4fc0d2dcc80cull,
+        0x435671a479aad56dull, 0xf0783d1a7a0d8a02ull,
+        0xb7d247f3d1ea7536ull, 0x04fc0b4dd24d2a59ull,
+        0x3886b22086258b5eull, 0x8ba8fe9e8582d431ull,
+        0xcc0284772e652b05ull, 0x7f2cc8c92dc2746aull,
+        0x325b15e575e1c3d0ull, 0x8175595b76469cbfull,
+        0xc6df23b2dda1638bull, 0x75f16f0cde063ce4ull,
+        0x498bd6618a6e9de3ull, 0xfaa59adf89c9c28cull,
+        0xbd0fe036222e3db8ull, 0x0e21ac88218962d7ull,
+        0xc5fa92ec8aff7fb6ull, 0x76d4de52895820d9ull,
+        0x317ea4bb22bfdfedull, 0x8250e80521188082ull,
+        0xbe2a516875702185ull, 0x0d041dd676d77eeaull,
+        0x4aae673fdd3081deull, 0xf9802b81de97deb1ull,
+        0x4fc0b4dd24d2a599ull, 0xfceef8632775faf6ull,
+        0xbb44828a8c9205c2ull, 0x086ace348f355aadull,
+        0x34107759db5dfbaaull, 0x873e3be7d8faa4c5ull,
+        0xc094410e731d5bf1ull, 0x73ba0db070ba049eull,
+        0xb86133d4dbcc19ffull, 0x0b4f7f6ad86b4690ull,
+        0x4ce50583738cb9a4ull, 0xffcb493d702be6cbull,
+        0xc3b1f050244347ccull, 0x709fbcee27e418a3ull,
+        0x3735c6078c03e797ull, 0x841b8ab98fa4b8f8ull,
+        0xadda7c5f3c4488e3ull, 0x1ef430e13fe3d78cull,
+        0x595e4a08940428b8ull, 0xea7006b697a377d7ull,
+        0xd60abfdbc3cbd6d0ull, 0x6524f365c06c89bfull,
+        0x228e898c6b8b768bull, 0x91a0c532682c29e4ull,
+        0x5a7bfb56c35a3485ull, 0xe955b7e8c0fd6beaull,
+        0xaeffcd016b1a94deull, 0x1dd181bf68bdcbb1ull,
+        0x21ab38d23cd56ab6ull, 0x9285746c3f7235d9ull,
+        0xd52f0e859495caedull, 0x6601423b97329582ull,
+        0xd041dd676d77eeaaull, 0x636f91d96ed0b1c5ull,
+        0x24c5eb30c5374ef1ull, 0x97eba78ec690119eull,
+        0xab911ee392f8b099ull, 0x18bf525d915feff6ull,
+        0x5f1528b43ab810c2ull, 0xec3b640a391f4fadull,
+        0x27e05a6e926952ccull, 0x94ce16d091ce0da3ull,
+        0xd3646c393a29f297ull, 0x604a2087398eadf8ull,
+        0x5c3099ea6de60cffull, 0xef1ed5546e415390ull,
+        0xa8b4afbdc5a6aca4ull, 0x1b9ae303c601f3cbull,
+        0x56ed3e2f9e224471ull, 0xe5c372919d851b1eull,
+        0xa26908783662e42aull, 0x114744c635c5bb45ull,
+        0x2d3dfdab61ad1a42ull, 0x9e13b115620a452dull,
+        0xd9b9cbfcc9edba19ull, 0x6a978742ca4ae576ull,
+        0xa14cb926613cf817ull, 0x1262f598629ba778ull,
+        0x55c88f71c97c584cull, 0xe6e6c3cfcadb0723ull,
+        0xda9c7aa29eb3a624ull, 0x69b2361c9d14f94bull,
+        0x2e184cf536f3067full, 0x9d36004b35545910ull,
+        0x2b769f17cf112238ull, 0x9858d3a9ccb67d57ull,
+        0xdff2a94067518263ull, 0x6cdce5fe64f6dd0cull,
+        0x50a65c93309e7c0bull, 0xe388102d33392364ull,
+        0xa4226ac498dedc50ull, 0x170c267a9b79833full,
+        0xdcd7181e300f9e5eull, 0x6ff954a033a8c131ull,
+        0x28532e49984f3e05ull, 0x9b7d62f79be8616aull,
+        0xa707db9acf80c06dull, 0x14299724cc279f02ull,
+        0x5383edcd67c06036ull, 0xe0ada17364673f59ull,
+    },
+    {
+        0x0000000000000000ull, 0x54e979925cd0f10dull,
+        0xa9d2f324b9a1e21aull, 0xfd3b8ab6e5711317ull,
+        0xc17d4962dc4ddab1ull, 0x959430f0809d2bbcull,
+        0x68afba4665ec38abull, 0x3c46c3d4393cc9a6ull,
+        0x10223dee1795abe7ull, 0x44cb447c4b455aeaull,
+        0xb9f0cecaae3449fdull, 0xed19b758f2e4b8f0ull,
+        0xd15f748ccbd87156ull, 0x85b60d1e9708805bull,
+        0x788d87a87279934cull, 0x2c64fe3a2ea96241ull,
+        0x20447bdc2f2b57ceull, 0x74ad024e73fba6c3ull,
+        0x899688f8968ab5d4ull, 0xdd7ff16aca5a44d9ull,
+        0xe13932bef3668d7full, 0xb5d04b2cafb67c72ull,
+        0x48ebc19a4ac76f65ull, 0x1c02b80816179e68ull,
+        0x3066463238befc29ull, 0x648f3fa0646e0d24ull,
+        0x99b4b516811f1e33ull, 0xcd5dcc84ddcfef3eull,
+        0xf11b0f50e4f32698ull, 0xa5f276c2b823d795ull,
+        0x58c9fc745d52c482ull, 0x0c2085e60182358full,
+        0x4088f7b85e56af9cull, 0x14618e2a02865e91ull,
+        0xe95a049ce7f74d86ull, 0xbdb37d0ebb27bc8bull,
+        0x81f5beda821b752dull, 0xd51cc748decb8420ull,
+        0x28274dfe3bba9737ull, 0x7cce346c676a663aull,
+        0x50aaca5649c3047bull, 0x0443b3c41513f576ull,
+        0xf9783972f062e661ull, 0xad9140e0acb2176cull,
+        0x91d78334958edecaull, 0xc53efaa6c95e2fc7ull,
+        0x380570102c2f3cd0ull, 0x6cec098270ffcdddull,
+        0x60cc8c64717df852ull, 0x3425f5f62dad095full,
+        0xc91e7f40c8dc1a48ull, 0x9df706d2940ceb45ull,
+        0xa1b1c506ad3022e3ull, 0xf558bc94f1e0d3eeull,
+        0x086336221491c0f9ull, 0x5c8a4fb0484131f4ull,
+        0x70eeb18a66e853b5ull, 0x2407c8183a38a2b8ull,
+        0xd93c42aedf49b1afull, 0x8dd53b3c839940a2ull,
+        0xb193f8e8baa58904ull, 0xe57a817ae6757809ull,
+        0x18410bcc03046b1eull, 0x4ca8725e5fd49a13ull,
+        0x8111ef70bcad5f38ull, 0xd5f896e2e07dae35ull,
+        0x28c31c54050cbd22ull, 0x7c2a65c659dc4c2full,
+        0x406ca61260e08589ull, 0x1485df803c307484ull,
+        0xe9be5536d9416793ull, 0xbd572ca48591969eull,
+        0x9133d29eab38f4dfull, 0xc5daab0cf7e805d2ull,
+        0x38e121ba129916c5ull, 0x6c0858284e49e7c8ull,
+        0x504e9bfc77752e6eull, 0x04a7e26e2ba5df63ull,
+        0xf99c68d8ced4cc74ull, 0xad75114a92043d79ull,
+        0xa15594ac938608f6ull, 0xf5bced3ecf56f9fbull,
+        0x088767882a27eaecull, 0x5c6e1e1a76f71be1ull,
+        0x6028ddce4fcbd247ull, 0x34c1a45c131b234aull,
+        0xc9fa2eeaf66a305dull, 0x9d135778aabac150ull,
+        0xb177a9428413a311ull, 0xe59ed0d0d8c3521cull,
+        0x18a55a663db2410bull, 0x4c4c23f46162b006ull,
+        0x700ae020585e79a0ull, 0x24e399b2048e88adull,
+        0xd9d81304e1ff9bbaull, 0x8d316a96bd2f6ab7ull,
+        0xc19918c8e2fbf0a4ull, 0x9570615abe2b01a9ull,
+        0x684bebec5b5a12beull, 0x3ca2927e078ae3b3ull,
+        0x00e451aa3eb62a15ull, 0x540d28386266db18ull,
+        0xa936a28e8717c80full, 0xfddfdb1cdbc73902ull,
+        0xd1bb2526f56e5b43ull, 0x85525cb4a9beaa4eull,
+        0x7869d6024ccfb959ull, 0x2c80af90101f4854ull,
+        0x10c66c44292381f2ull, 0x442f15d675f370ffull,
+        0xb9149f60908263e8ull, 0xedfde6f2cc5292e5ull,
+        0xe1dd6314cdd0a76aull, 0xb5341a8691005667ull,
+        0x480f903074714570ull, 0x1ce6e9a228a1b47dull,
+        0x20a02a76119d7ddbull, 0x744953e44d4d8cd6ull,
+        0x8972d952a83c9fc1ull, 0xdd9ba0c0f4ec6eccull,
+        0xf1ff5efada450c8dull, 0xa51627688695fd80ull,
+        0x582dadde63e4ee97ull, 0x0cc4d44c3f341f9aull,
+        0x308217980608d63cull, 0x646b6e0a5ad82731ull,
+        0x9950e4bcbfa93426ull, 0xcdb99d2ee379c52bull,
+        0x90fb71cad654a0f5ull, 0xc41208588a8451f8ull,
+        0x392982ee6ff542efull, 0x6dc0fb7c3325b3e2ull,
+        0x518638a80a197a44ull, 0x056f413a56c98b49ull,
+        0xf854cb8cb3b8985eull, 0xacbdb21eef686953ull,
+        0x80d94c24c1c10b12ull, 0xd43035b69d11fa1full,
+        0x290bbf007860e908ull, 0x7de2c69224b01805ull,
+        0x41a405461d8cd1a3ull, 0x154d7cd4415c20aeull,
+        0xe876f662a42d33b9ull, 0xbc9f8ff0f8fdc2b4ull,
+        0xb0bf0a16f97ff73bull, 0xe4567384a5af0636ull,
+        0x196df93240de1521ull, 0x4d8480a01c0ee42cull,
+        0x71c2437425322d8aull, 0x252b3ae679e2dc87ull,
+        0xd810b0509c93cf90ull, 0x8cf9c9c2c0433e9dull,
+        0xa09d37f8eeea5cdcull, 0xf4744e6ab23aadd1ull,
+        0x094fc4dc574bbec6ull, 0x5da6bd4e0b9b4fcbull,
+        0x61e07e9a32a7866dull, 0x350907086e777760ull,
+        0xc8328dbe8b066477ull, 0x9cdbf42cd7d6957aull,
+        0xd073867288020f69ull, 0x849affe0d4d2fe64ull,
+        0x79a1755631a3ed73ull, 0x2d480cc46d731c7eull,
+        0x110ecf10544fd5d8ull, 0x45e7b682089f24d5ull,
+        0xb8dc3c34edee37c2ull, 0xec3545a6b13ec6cfull,
+        0xc051bb9c9f97a48eull, 0x94b8c20ec3475583ull,
+        0x698348b826364694ull, 0x3d6a312a7ae6b799ull,
+        0x012cf2fe43da7e3full, 0x55c58b6c1f0a8f32ull,
+        0xa8fe01dafa7b9c25ull, 0xfc177848a6ab6d28ull,
+        0xf037fdaea72958a7ull, 0xa4de843cfbf9a9aaull,
+        0x59e50e8a1e88babdull, 0x0d0c771842584bb0ull,
+        0x314ab4cc7b648216ull, 0x65a3cd5e27b4731bull,
+        0x989847e8c2c5600cull, 0xcc713e7a9e159101ull,
+        0xe015c040b0bcf340ull, 0xb4fcb9d2ec6c024dull,
+        0x49c73364091d115aull, 0x1d2e4af655cde057ull,
+        0x216889226cf129f1ull, 0x7581f0b03021d8fcull,
+        0x88ba7a06d550cbebull, 0xdc53039489803ae6ull,
+        0x11ea9eba6af9ffcdull, 0x4503e72836290ec0ull,
+        0xb8386d9ed3581dd7ull, 0xecd1140c8f88ecdaull,
+        0xd097d7d8b6b4257cull, 0x847eae4aea64d471ull,
+        0x794524fc0f15c766ull, 0x2dac5d6e53c5366bull,
+        0x01c8a3547d6c542aull, 0x5521dac621bca527ull,
+        0xa81a5070c4cdb630ull, 0xfcf329e2981d473dull,
+        0xc0b5ea36a1218e9bull, 0x945c93a4fdf17f96ull,
+        0x6967191218806c81ull, 0x3d8e608044509d8cull,
+        0x31aee56645d2a803ull, 0x65479cf41902590eull,
+        0x987c1642fc734a19ull, 0xcc956fd0a0a3bb14ull,
+        0xf0d3ac04999f72b2ull, 0xa43ad596c54f83bfull,
+        0x59015f20203e90a8ull, 0x0de826b27cee61a5ull,
+        0x218cd888524703e4ull, 0x7565a11a0e97f2e9ull,
+        0x885e2bacebe6e1feull, 0xdcb7523eb73610f3ull,
+        0xe0f191ea8e0ad955ull, 0xb418e878d2da2858ull,
+        0x492362ce37ab3b4full, 0x1dca1b5c6b7bca42ull,
+        0x5162690234af5051ull, 0x058b1090687fa15cull,
+        0xf8b09a268d0eb24bull, 0xac59e3b4d1de4346ull,
+        0x901f2060e8e28ae0ull, 0xc4f659f2b4327bedull,
+        0x39cdd344514368faull, 0x6d24aad60d9399f7ull,
+        0x414054ec233afbb6ull, 0x15a92d7e7fea0abbull,
+        0xe892a7c89a9b19acull, 0xbc7bde5ac64be8a1ull,
+        0x803d1d8eff772107ull, 0xd4d4641ca3a7d00aull,
+        0x29efeeaa46d6c31dull, 0x7d0697381a063210ull,
+        0x712612de1b84079full, 0x25cf6b4c4754f692ull,
+        0xd8f4e1faa225e585ull, 0x8c1d9868fef51488ull,
+        0xb05b5bbcc7c9dd2eull, 0xe4b2222e9b192c23ull,
+        0x1989a8987e683f34ull, 0x4d60d10a22b8ce39ull,
+        0x61042f300c11ac78ull, 0x35ed56a250c15d75ull,
+        0xc8d6dc14b5b04e62ull, 0x9c3fa586e960bf6full,
+        0xa0796652d05c76c9ull, 0xf4901fc08c8c87c4ull,
+        0x09ab957669fd94d3ull, 0x5d42ece4352d65deull,
+    },
+    {
+        0x0000000000000000ull, 0x3f0be14a916a6dcbull,
+        0x7e17c29522d4db96ull, 0x411c23dfb3beb65dull,
+        0xfc2f852a45a9b72cull, 0xc3246460d4c3dae7ull,
+        0x823847bf677d6cbaull, 0xbd33a6f5f6170171ull,
+        0x6a87a57f245d70ddull, 0x558c4435b5371d16ull,
+        0x149067ea0689ab4bull, 0x2b9b86a097e3c680ull,
+        0x96a8205561f4c7f1ull, 0xa9a3c11ff09eaa3aull,
+        0xe8bfe2c043201c67ull, 0xd7b4038ad24a71acull,
+        0xd50f4afe48bae1baull, 0xea04abb4d9d08c71ull,
+        0xab18886b6a6e3a2cull, 0x94136921fb0457e7ull,
+        0x2920cfd40d135696ull, 0x162b2e9e9c793b5dull,
+        0x57370d412fc78d00ull, 0x683cec0bbeade0cbull,
+        0xbf88ef816ce79167ull, 0x80830ecbfd8dfcacull,
+        0xc19f2d144e334af1ull, 0xfe94cc5edf59273aull,
+        0x43a76aab294e264bull, 0x7cac8be1b8244b80ull,
+        0x3db0a83e0b9afdddull, 0x02bb49749af09016ull,
+        0x38c63ad73e7bddf1ull, 0x07cddb9daf11b03aull,
+        0x46d1f8421caf0667ull, 0x79da19088dc56bacull,
+        0xc4e9bffd7bd26addull, 0xfbe25eb7eab80716ull,
+        0xbafe7d685906b14bull, 0x85f59c22c86cdc80ull,
+        0x52419fa81a26ad2cull, 0x6d4a7ee28b4cc0e7ull,
+        0x2c565d3d38f276baull, 0x135dbc77a9981b71ull,
+        0xae6e1a825f8f1a00ull, 0x9165fbc8cee577cbull,
+        0xd079d8177d5bc196ull, 0xef72395dec31ac5dull,
+        0xedc9702976c13c4bull, 0xd2c29163e7ab5180ull,
+        0x93deb2bc5415e7ddull, 0xacd553f6c57f8a16ull,
+        0x11e6f50333688b67ull, 0x2eed1449a202e6acull,
+        0x6ff1379611bc50f1ull, 0x50fad6dc80d63d3aull,
+        0x874ed556529c4c96ull, 0xb845341cc3f6215dull,
+        0xf95917c370489700ull, 0xc652f689e122facbull,
+        0x7b61507c1735fbbaull, 0x446ab136865f9671ull,
+        0x057692e935e1202cull, 0x3a7d73a3a48b4de7ull,
+        0x718c75ae7cf7bbe2ull, 0x4e8794e4ed9dd629ull,
+        0x0f9bb73b5e236074ull, 0x30905671cf490dbfull,
+        0x8da3f084395e0cceull, 0xb2a811cea8346105ull,
+        0xf3b432111b8ad758ull, 0xccbfd35b8ae0ba93ull,
+        0x1b0bd0d158aacb3full, 0x2400319bc9c0a6f4ull,
+        0x651c12447a7e10a9ull, 0x5a17f30eeb147d62ull,
+        0xe72455fb1d037c13ull, 0xd82fb4b18c6911d8ull,
+        0x9933976e3fd7a785ull, 0xa6387624aebdca4eull,
+        0xa4833f50344d5a58ull, 0x9b88de1aa5273793ull,
+        0xda94fdc5169981ceull, 0xe59f1c8f87f3ec05ull,
+        0x58acba7a71e4ed74ull, 0x67a75b30e08e80bfull,
+        0x26bb78ef533036e2ull, 0x19b099a5c25a5b29ull,
+        0xce049a2f10102a85ull, 0xf10f7b65817a474eull,
+        0xb01358ba32c4f113ull, 0x8f18b9f0a3ae9cd8ull,
+        0x322b1f0555b99da9ull, 0x0d20fe4fc4d3f062ull,
+        0x4c3cdd90776d463full, 0x73373cdae6072bf4ull,
+        0x494a4f79428c6613ull, 0x7641ae33d3e60bd8ull,
+        0x375d8dec6058bd85ull, 0x08566ca6f132d04eull,
+        0xb565ca530725d13full, 0x8a6e2b19964fbcf4ull,
+        0xcb7208c625f10aa9ull, 0xf479e98cb49b6762ull,
+        0x23cdea0666d116ceull, 0x1cc60b4cf7bb7b05ull,
+        0x5dda28934405cd58ull, 0x62d1c9d9d56fa093ull,
+        0xdfe26f2c2378a1e2ull, 0xe0e98e66b212cc29ull,
+        0xa1f5adb901ac7a74ull, 0x9efe4cf390c617bfull,
+        0x9c4505870a3687a9ull, 0xa34ee4cd9b5cea62ull,
+        0xe252c71228e25c3full, 0xdd592658b98831f4ull,
+        0x606a80ad4f9f3085ull, 0x5f6161e7def55d4eull,
+        0x1e7d42386d4beb13ull, 0x2176a372fc2186d8ull,
+        0xf6c2a0f82e6bf774ull, 0xc9c941b2bf019abfull,
+        0x88d5626d0cbf2ce2ull, 0xb7de83279dd54129ull,
+        0x0aed25d26bc24058ull, 0x35e6c498faa82d93ull,
+        0x74fae74749169bceull, 0x4bf1060dd87cf605ull,
+        0xe318eb5cf9ef77c4ull, 0xdc130a1668851a0full,
+        0x9d0f29c9db3bac52ull, 0xa204c8834a51c199ull,
+        0x1f376e76bc46c0e8ull, 0x203c8f3c2d2cad23ull,
+        0x6120ace39e921b7eull, 0x5e2b4da90ff876b5ull,
+        0x899f4e23ddb20719ull, 0xb694af694cd86ad2ull,
+        0xf7888cb6ff66dc8full, 0xc8836dfc6e0cb144ull,
+        0x75b0cb09981bb035ull, 0x4abb2a430971ddfeull,
+        0x0ba7099cbacf6ba3ull, 0x34ace8d62ba50668ull,
+        0x3617a1a2b155967eull, 0x091c40e8203ffbb5ull,
+        0x4800633793814de8ull, 0x770b827d02eb2023ull,
+        0xca382488f4fc2152ull, 0xf533c5c265964c99ull,
+        0xb42fe61dd628fac4ull, 0x8b2407574742970full,
+        0x5c9004dd9508e6a3ull, 0x639be59704628b68ull,
+        0x2287c648b7dc3d35ull, 0x1d8c270226b650feull,
+        0xa0bf81f7d0a1518full, 0x9fb460bd41cb3c44ull,
+        0xdea84362f2758a19ull, 0xe1a3a228631fe7d2ull,
+        0xdbded18bc794aa35ull, 0xe4d530c156fec7feull,
+        0xa5c9131ee54071a3ull, 0x9ac2f254742a1c68ull,
+        0x27f154a1823d1d19ull, 0x18fab5eb135770d2ull,
+        0x59e69634a0e9c68full, 0x66ed777e3183ab44ull,
+        0xb15974f4e3c9dae8ull, 0x8e5295be72a3b723ull,
+        0xcf4eb661c11d017eull, 0xf045572b50776cb5ull,
+        0x4d76f1dea6606dc4ull, 0x727d1094370a000full,
+        0x3361334b84b4b652ull, 0x0c6ad20115dedb99ull,
+        0x0ed19b758f2e4b8full, 0x31da7a3f1e442644ull,
+        0x70c659e0adfa9019ull, 0x4fcdb8aa3c90fdd2ull,
+        0xf2fe1e5fca87fca3ull, 0xcdf5ff155bed9168ull,
+        0x8ce9dccae8532735ull, 0xb3e23d8079394afeull,
+        0x64563e0aab733b52ull, 0x5b5ddf403a195699ull,
+        0x1a41fc9f89a7e0c4ull, 0x254a1dd518cd8d0full,
+        0x9879bb20eeda8c7eull, 0xa7725a6a7fb0e1b5ull,
+        0xe66e79b5cc0e57e8ull, 0xd96598ff5d643a23ull,
+        0x92949ef28518cc26ull, 0xad9f7fb81472a1edull,
+        0xec835c67a7cc17b0ull, 0xd388bd2d36a67a7bull,
+        0x6ebb1bd8c0b17b0aull, 0x51b0fa9251db16c1ull,
+        0x10acd94de265a09cull, 0x2fa73807730fcd57ull,
+        0xf8133b8da145bcfbull, 0xc718dac7302fd130ull,
+        0x8604f9188391676dull, 0xb90f185212fb0aa6ull,
+        0x043cbea7e4ec0bd7ull, 0x3b375fed7586661cull,
+        0x7a2b7c32c638d041ull, 0x45209d785752bd8aull,
+        0x479bd40ccda22d9cull, 0x789035465cc84057ull,
+        0x398c1699ef76f60aull, 0x0687f7d37e1c9bc1ull,
+        0xbbb45126880b9ab0ull, 0x84bfb06c1961f77bull,
+        0xc5a393b3aadf4126ull, 0xfaa872f93bb52cedull,
+        0x2d1c7173e9ff5d41ull, 0x121790397895308aull,
+        0x530bb3e6cb2b86d7ull, 0x6c0052ac5a41eb1cull,
+        0xd133f459ac56ea6dull, 0xee3815133d3c87a6ull,
+        0xaf2436cc8e8231fbull, 0x902fd7861fe85c30ull,
+        0xaa52a425bb6311d7ull, 0x9559456f2a097c1cull,
+        0xd44566b099b7ca41ull, 0xeb4e87fa08dda78aull,
+        0x567d210ffecaa6fbull, 0x6976c0456fa0cb30ull,
+        0x286ae39adc1e7d6dull, 0x176102d04d7410a6ull,
+        0xc0d5015a9f3e610aull, 0xffdee0100e540cc1ull,
+        0xbec2c3cfbdeaba9cull, 0x81c922852c80d757ull,
+        0x3cfa8470da97d626ull, 0x03f1653a4bfdbbedull,
+        0x42ed46e5f8430db0ull, 0x7de6a7af6929607bull,
+        0x7f5deedbf3d9f06dull, 0x40560f9162b39da6ull,
+        0x014a2c4ed10d2bfbull, 0x3e41cd0440674630ull,
+        0x83726bf1b6704741ull, 0xbc798abb271a2a8aull,
+        0xfd65a96494a49cd7ull, 0xc26e482e05cef11cull,
+        0x15da4ba4d78480b0ull, 0x2ad1aaee46eeed7bull,
+        0x6bcd8931f5505b26ull, 0x54c6687b643a36edull,
+        0xe9f5ce8e922d379cull, 0xd6fe2fc403475a57ull,
+        0x97e20c1bb0f9ec0aull, 0xa8e9ed51219381c1ull,
+    },
+    {
+        0x0000000000000000ull, 0x1dee8a5e222ca1dcull,
+        0x3bdd14bc445943b8ull, 0x26339ee26675e264ull,
+        0x77ba297888b28770ull, 0x6a54a326aa9e26acull,
+        0x4c673dc4ccebc4c8ull, 0x5189b79aeec76514ull,
+        0xef7452f111650ee0ull, 0xf29ad8af3349af3cull,
+        0xd4a9464d553c4d58ull, 0xc947cc137710ec84ull,
+        0x98ce7b8999d78990ull, 0x8520f1d7bbfb284cull,
+        0xa3136f35dd8eca28ull, 0xbefde56bffa26bf4ull,
+        0x4c300ac98dc40345ull, 0x51de8097afe8a299ull,
+        0x77ed1e75c99d40fdull, 0x6a03942bebb1e121ull,
+        0x3b8a23b105768435ull, 0x2664a9ef275a25e9ull,
+        0x0057370d412fc78dull, 0x1db9bd5363036651ull,
+        0xa34458389ca10da5ull, 0xbeaad266be8dac79ull,
+        0x98994c84d8f84e1dull, 0x8577c6dafad4efc1ull,
+        0xd4fe714014138ad5ull, 0xc910fb1e363f2b09ull,
+        0xef2365fc504ac96dull, 0xf2cdefa2726668b1ull,
+        0x986015931b88068aull, 0x858e9fcd39a4a756ull,
+        0xa3bd012f5fd14532ull, 0xbe538b717dfde4eeull,
+        0xefda3ceb933a81faull, 0xf234b6b5b1162026ull,
+        0xd4072857d763c242ull, 0xc9e9a209f54f639eull,
+        0x771447620aed086aull, 0x6afacd3c28c1a9b6ull,
+        0x4cc953de4eb44bd2ull, 0x5127d9806c98ea0eull,
+        0x00ae6e1a825f8f1aull, 0x1d40e444a0732ec6ull,
+        0x3b737aa6c606cca2ull, 0x269df0f8e42a6d7eull,
+        0xd4501f5a964c05cfull, 0xc9be9504b460a413ull,
+        0xef8d0be6d2154677ull, 0xf26381b8f039e7abull,
+        0xa3ea36221efe82bfull, 0xbe04bc7c3cd22363ull,
+        0x9837229e5aa7c107ull, 0x85d9a8c0788b60dbull,
+        0x3b244dab87290b2full, 0x26cac7f5a505aaf3ull,
+        0x00f95917c3704897ull, 0x1d17d349e15ce94bull,
+        0x4c9e64d30f9b8c5full, 0x5170ee8d2db72d83ull,
+        0x7743706f4bc2cfe7ull, 0x6aadfa3169ee6e3bull,
+        0xa218840d981e1391ull, 0xbff60e53ba32b24dull,
+        0x99c590b1dc475029ull, 0x842b1aeffe6bf1f5ull,
+        0xd5a2ad7510ac94e1ull, 0xc84c272b3280353dull,
+        0xee7fb9c954f5d759ull, 0xf391339776d97685ull,
+        0x4d6cd6fc897b1d71ull, 0x50825ca2ab57bcadull,
+        0x76b1c240cd225ec9ull, 0x6b5f481eef0eff15ull,
+        0x3ad6ff8401c99a01ull, 0x273875da23e53bddull,
+        0x010beb384590d9b9ull, 0x1ce5616667bc7865ull,
+        0xee288ec415da10d4ull, 0xf3c6049a37f6b108ull,
+        0xd5f59a785183536cull, 0xc81b102673aff2b0ull,
+        0x9992a7bc9d6897a4ull, 0x847c2de2bf443678ull,
+        0xa24fb300d931d41cull, 0xbfa1395efb1d75c0ull,
+        0x015cdc3504bf1e34ull, 0x1cb2566b2693bfe8ull,
+        0x3a81c88940e65d8cull, 0x276f42d762cafc50ull,
+        0x76e6f54d8c0d9944ull, 0x6b087f13ae213898ull,
+        0x4d3be1f1c854dafcull, 0x50d56bafea787b20ull,
+        0x3a78919e8396151bull, 0x27961bc0a1bab4c7ull,
+        0x01a58522c7cf56a3ull, 0x1c4b0f7ce5e3f77full,
+        0x4dc2b8e60b24926bull, 0x502c32b8290833b7ull,
+        0x761fac5a4f7dd1d3ull, 0x6bf126046d51700full,
+        0xd50cc36f92f31bfbull, 0xc8e24931b0dfba27ull,
+        0xeed1d7d3d6aa5843ull, 0xf33f5d8df486f99full,
+        0xa2b6ea171a419c8bull, 0xbf586049386d3d57ull,
+        0x996bfeab5e18df33ull, 0x848574f57c347eefull,
+        0x76489b570e52165eull, 0x6ba611092c7eb782ull,
+        0x4d958feb4a0b55e6ull, 0x507b05b56827f43aull,
+        0x01f2b22f86e0912eull, 0x1c1c3871a4cc30f2ull,
+        0x3a2fa693c2b9d296ull, 0x27c12ccde095734aull,
+        0x993cc9a61f3718beull, 0x84d243f83d1bb962ull,
+        0xa2e1dd1a5b6e5b06ull, 0xbf0f57447942fadaull,
+        0xee86e0de97859fceull, 0xf3686a80b5a93e12ull,
+        0xd55bf462d3dcdc76ull, 0xc8b57e3cf1f07daaull,
+        0xd6e9a7309f3239a7ull, 0xcb072d6ebd1e987bull,
+        0xed34b38cdb6b7a1full, 0xf0da39d2f947dbc3ull,
+        0xa1538e481780bed7ull, 0xbcbd041635ac1f0bull,
+        0x9a8e9af453d9fd6full, 0x876010aa71f55cb3ull,
+        0x399df5c18e573747ull, 0x24737f9fac7b969bull,
+        0x0240e17dca0e74ffull, 0x1fae6b23e822d523ull,
+        0x4e27dcb906e5b037ull, 0x53c956e724c911ebull,
+        0x75fac80542bcf38full, 0x6814425b60905253ull,
+        0x9ad9adf912f63ae2ull, 0x873727a730da9b3eull,
+        0xa104b94556af795aull, 0xbcea331b7483d886ull,
+        0xed6384819a44bd92ull, 0xf08d0edfb8681c4eull,
+        0xd6be903dde1dfe2aull, 0xcb501a63fc315ff6ull,
+        0x75adff0803933402ull, 0x6843755621bf95deull,
+        0x4e70ebb447ca77baull, 0x539e61ea65e6d666ull,
+        0x0217d6708b21b372ull, 0x1ff95c2ea90d12aeull,
+        0x39cac2cccf78f0caull, 0x24244892ed545116ull,
+        0x4e89b2a384ba3f2dull, 0x536738fda6969ef1ull,
+        0x7554a61fc0e37c95ull, 0x68ba2c41e2cfdd49ull,
+        0x39339bdb0c08b85dull, 0x24dd11852e241981ull,
+        0x02ee8f674851fbe5ull, 0x1f0005396a7d5a39ull,
+        0xa1fde05295df31cdull, 0xbc136a0cb7f39011ull,
+        0x9a20f4eed1867275ull, 0x87ce7eb0f3aad3a9ull,
+        0xd647c92a1d6db6bdull, 0xcba943743f411761ull,
+        0xed9add965934f505ull, 0xf07457c87b1854d9ull,
+        0x02b9b86a097e3c68ull, 0x1f5732342b529db4ull,
+        0x3964acd64d277fd0ull, 0x248a26886f0bde0cull,
+        0x7503911281ccbb18ull, 0x68ed1b4ca3e01ac4ull,
+        0x4ede85aec595f8a0ull, 0x53300ff0e7b9597cull,
+        0xedcdea9b181b3288ull, 0xf02360c53a379354ull,
+        0xd610fe275c427130ull, 0xcbfe74797e6ed0ecull,
+        0x9a77c3e390a9b5f8ull, 0x879949bdb2851424ull,
+        0xa1aad75fd4f0f640ull, 0xbc445d01f6dc579cull,
+        0x74f1233d072c2a36ull, 0x691fa96325008beaull,
+        0x4f2c37814375698eull, 0x52c2bddf6159c852ull,
+        0x034b0a458f9ead46ull, 0x1ea5801badb20c9aull,
+        0x38961ef9cbc7eefeull, 0x257894a7e9eb4f22ull,
+        0x9b8571cc164924d6ull, 0x866bfb923465850aull,
+        0xa05865705210676eull, 0xbdb6ef2e703cc6b2ull,
+        0xec3f58b49efba3a6ull, 0xf1d1d2eabcd7027aull,
+        0xd7e24c08daa2e01eull, 0xca0cc656f88e41c2ull,
+        0x38c129f48ae82973ull, 0x252fa3aaa8c488afull,
+        0x031c3d48ceb16acbull, 0x1ef2b716ec9dcb17ull,
+        0x4f7b008c025aae03ull, 0x52958ad220760fdfull,
+        0x74a614304603edbbull, 0x69489e6e642f4c67ull,
+        0xd7b57b059b8d2793ull, 0xca5bf15bb9a1864full,
+        0xec686fb9dfd4642bull, 0xf186e5e7fdf8c5f7ull,
+        0xa00f527d133fa0e3ull, 0xbde1d8233113013full,
+        0x9bd246c15766e35bull, 0x863ccc9f754a4287ull,
+        0xec9136ae1ca42cbcull, 0xf17fbcf03e888d60ull,
+        0xd74c221258fd6f04ull, 0xcaa2a84c7ad1ced8ull,
+        0x9b2b1fd69416abccull, 0x86c59588b63a0a10ull,
+        0xa0f60b6ad04fe874ull, 0xbd188134f26349a8ull,
+        0x03e5645f0dc1225cull, 0x1e0bee012fed8380ull,
+        0x383870e3499861e4ull, 0x25d6fabd6bb4c038ull,
+        0x745f4d278573a52cull, 0x69b1c779a75f04f0ull,
+        0x4f82599bc12ae694ull, 0x526cd3c5e3064748ull,
+        0xa0a13c6791602ff9ull, 0xbd4fb639b34c8e25ull,
+        0x9b7c28dbd5396c41ull, 0x8692a285f715cd9dull,
+        0xd71b151f19d2a889ull, 0xcaf59f413bfe0955ull,
+        0xecc601a35d8beb31ull, 0xf1288bfd7fa74aedull,
+        0x4fd56e9680052119ull, 0x523be4c8a22980c5ull,
+        0x74087a2ac45c62a1ull, 0x69e6f074e670c37dull,
+        0x386f47ee08b7a669ull, 0x2581cdb02a9b07b5ull,
+        0x03b253524ceee5d1ull, 0x1e5cd90c6ec2440dull,
+    },
+#if JUNO_CRC_SLICE == 8
+    {
+        0x0000000000000000ull, 0x5c2d776033c4205eull,
+        0xb85aeec0678840bcull, 0xe47799a0544c60e2ull,
+        0xe26d72ab601e9ffdull, 0xbe4005cb53dabfa3ull,
+        0x5a379c6b0796df41ull, 0x061aeb0b3452ff1full,
+        0x56024a7d6f33217full, 0x0a2f3d1d5cf70121ull,
+        0xee58a4bd08bb61c3ull, 0xb275d3dd3b7f419dull,
+        0xb46f38d60f2dbe82ull, 0xe8424fb63ce99edcull,
+        0x0c35d61668a5fe3eull, 0x5018a1765b61de60ull,
+        0xac0494fade6642feull, 0xf029e39aeda262a0ull,
+        0x145e7a3ab9ee0242ull, 0x48730d5a8a2a221cull,
+        0x4e69e651be78dd03ull, 0x124491318dbcfd5dull,
+        0xf6330891d9f09dbfull, 0xaa1e7ff1ea34bde1ull,
+        0xfa06de87b1556381ull, 0xa62ba9e7829143dfull,
+        0x425c3047d6dd233dull, 0x1e714727e5190363ull,
+        0x186bac2cd14bfc7cull, 0x4446db4ce28fdc22ull,
+        0xa03142ecb6c3bcc0ull, 0xfc1c358c85079c9eull,
+        0xcad186de13c29b79ull, 0x96fcf1be2006bb27ull,
+        0x728b681e744adbc5ull, 0x2ea61f7e478efb9bull,
+        0x28bcf47573dc0484ull, 0x74918315401824daull,
+        0x90e61ab514544438ull, 0xcccb6dd527906466ull,
+        0x9cd3cca37cf1ba06ull, 0xc0febbc34f359a58ull,
+        0x248922631b79fabaull, 0x78a4550328bddae4ull,
+        0x7ebebe081cef25fbull, 0x2293c9682f2b05a5ull,
+        0xc6e450c87b676547ull, 0x9ac927a848a34519ull,
+        0x66d51224cda4d987ull, 0x3af86544fe60f9d9ull,
+        0xde8ffce4aa2c993bull, 0x82a28b8499e8b965ull,
+        0x84b8608fadba467aull, 0xd89517ef9e7e6624ull,
+        0x3ce28e4fca3206c6ull, 0x60cff92ff9f62698ull,
+        0x30d75859a297f8f8ull, 0x6cfa2f399153d8a6ull,
+        0x888db699c51fb844ull, 0xd4a0c1f9f6db981aull,
+        0xd2ba2af2c2896705ull, 0x8e975d92f14d475bull,
+        0x6ae0c432a50127b9ull, 0x36cdb35296c507e7ull,
+        0x077ba297888b2877ull, 0x5b56d5f7bb4f0829ull,
+        0xbf214c57ef0368cbull, 0xe30c3b37dcc74895ull,
+        0xe516d03ce895b78aull, 0xb93ba75cdb5197d4ull,
+        0x5d4c3efc8f1df736ull, 0x0161499cbcd9d768ull,
+        0x5179e8eae7b80908ull, 0x0d549f8ad47c2956ull,
+        0xe923062a803049b4ull, 0xb50e714ab3f469eaull,
+        0xb3149a4187a696f5ull, 0xef39ed21b462b6abull,
+        0x0b4e7481e02ed649ull, 0x576303e1d3eaf617ull,
+        0xab7f366d56ed6a89ull, 0xf752410d65294ad7ull,
+        0x1325d8ad31652a35ull, 0x4f08afcd02a10a6bull,
+        0x491244c636f3f574ull, 0x153f33a60537d52aull,
+        0xf148aa06517bb5c8ull, 0xad65dd6662bf9596ull,
+        0xfd7d7c1039de4bf6ull, 0xa1500b700a1a6ba8ull,
+        0x452792d05e560b4aull, 0x190ae5b06d922b14ull,
+        0x1f100ebb59c0d40bull, 0x433d79db6a04f455ull,
+        0xa74ae07b3e4894b7ull, 0xfb67971b0d8cb4e9ull,
+        0xcdaa24499b49b30eull, 0x91875329a88d9350ull,
+        0x75f0ca89fcc1f3b2ull, 0x29ddbde9cf05d3ecull,
+        0x2fc756e2fb572cf3ull, 0x73ea2182c8930cadull,
+        0x979db8229cdf6c4full, 0xcbb0cf42af1b4c11ull,
+        0x9ba86e34f47a9271ull, 0xc7851954c7beb22full,
+        0x23f280f493f2d2cdull, 0x7fdff794a036f293ull,
+        0x79c51c9f94640d8cull, 0x25e86bffa7a02dd2ull,
+        0xc19ff25ff3ec4d30ull, 0x9db2853fc0286d6eull,
+        0x61aeb0b3452ff1f0ull, 0x3d83c7d376ebd1aeull,
+        0xd9f45e7322a7b14cull, 0x85d9291311639112ull,
+        0x83c3c21825316e0dull, 0xdfeeb57816f54e53ull,
+        0x3b992cd842b92eb1ull, 0x67b45bb8717d0eefull,
+        0x37acface2a1cd08full, 0x6b818dae19d8f0d1ull,
+        0x8ff6140e4d949033ull, 0xd3db636e7e50b06dull,
+        0xd5c188654a024f72ull, 0x89ecff0579c66f2cull,
+        0x6d9b66a52d8a0fceull, 0x31b611c51e4e2f90ull,
+        0x0ef7452f111650eeull, 0x52da324f22d270b0ull,
+        0xb6adabef769e1052ull, 0xea80dc8f455a300cull,
+        0xec9a37847108cf13ull, 0xb0b740e442ccef4dull,
+        0x54c0d94416808fafull, 0x08edae242544aff1ull,
+        0x58f50f527e257191ull, 0x04d878324de151cfull,
+        0xe0afe19219ad312dull, 0xbc8296f22a691173ull,
+        0xba987df91e3bee6cull, 0xe6b50a992dffce32ull,
+        0x02c2933979b3aed0ull, 0x5eefe4594a778e8eull,
+        0xa2f3d1d5cf701210ull, 0xfedea6b5fcb4324eull,
+        0x1aa93f15a8f852acull, 0x468448759b3c72f2ull,
+        0x409ea37eaf6e8dedull, 0x1cb3d41e9caaadb3ull,
+        0xf8c44dbec8e6cd51ull, 0xa4e93adefb22ed0full,
+        0xf4f19ba8a043336full, 0xa8dcecc893871331ull,
+        0x4cab7568c7cb73d3ull, 0x10860208f40f538dull,
+        0x169ce903c05dac92ull, 0x4ab19e63f3998cccull,
+        0xaec607c3a7d5ec2eull, 0xf2eb70a39411cc70ull,
+        0xc426c3f102d4cb97ull, 0x980bb4913110ebc9ull,
+        0x7c7c2d31655c8b2bull, 0x20515a515698ab75ull,
+        0x264bb15a62ca546aull, 0x7a66c63a510e7434ull,
+        0x9e115f9a054214d6ull, 0xc23c28fa36863488ull,
+        0x9224898c6de7eae8ull, 0xce09feec5e23cab6ull,
+        0x2a7e674c0a6faa54ull, 0x7653102c39ab8a0aull,
+        0x7049fb270df97515ull, 0x2c648c473e3d554bull,
+        0xc81315e76a7135a9ull, 0x943e628759b515f7ull,
+        0x6822570bdcb28969ull, 0x340f206bef76a937ull,
+        0xd078b9cbbb3ac9d5ull, 0x8c55ceab88fee98bull,
+        0x8a4f25a0bcac1694ull, 0xd66252c08f6836caull,
+        0x3215cb60db245628ull, 0x6e38bc00e8e07676ull,
+        0x3e201d76b381a816ull, 0x620d6a1680458848ull,
+        0x867af3b6d409e8aaull, 0xda5784d6e7cdc8f4ull,
+        0xdc4d6fddd39f37ebull, 0x806018bde05b17b5ull,
+        0x6417811db4177757ull, 0x383af67d87d35709ull,
+        0x098ce7b8999d7899ull, 0x55a190d8aa5958c7ull,
+        0xb1d60978fe153825ull, 0xedfb7e18cdd1187bull,
+        0xebe19513f983e764ull, 0xb7cce273ca47c73aull,
+        0x53bb7bd39e0ba7d8ull, 0x0f960cb3adcf8786ull,
+        0x5f8eadc5f6ae59e6ull, 0x03a3daa5c56a79b8ull,
+        0xe7d443059126195aull, 0xbbf93465a2e23904ull,
+        0xbde3df6e96b0c61bull, 0xe1cea80ea574e645ull,
+        0x05b931aef13886a7ull, 0x599446cec2fca6f9ull,
+        0xa588734247fb3a67ull, 0xf9a50422743f1a39ull,
+        0x1dd29d8220737adbull, 0x41ffeae213b75a85ull,
+        0x47e501e927e5a59aull, 0x1bc87689142185c4ull,
+        0xffbfef29406de526ull, 0xa392984973a9c578ull,
+        0xf38a393f28c81b18ull, 0xafa74e5f1b0c3b46ull,
+        0x4bd0d7ff4f405ba4ull, 0x17fda09f7c847bfaull,
+        0x11e74b9448d684e5ull, 0x4dca3cf47b12a4bbull,
+        0xa9bda5542f5ec459ull, 0xf590d2341c9ae407ull,
+        0xc35d61668a5fe3e0ull, 0x9f701606b99bc3beull,
+        0x7b078fa6edd7a35cull, 0x272af8c6de138302ull,
+        0x213013cdea417c1dull, 0x7d1d64add9855c43ull,
+        0x996afd0d8dc93ca1ull, 0xc5478a6dbe0d1cffull,
+        0x955f2b1be56cc29full, 0xc9725c7bd6a8e2c1ull,
+        0x2d05c5db82e48223ull, 0x7128b2bbb120a27dull,
+        0x773259b085725d62ull, 0x2b1f2ed0b6b67d3cull,
+        0xcf68b770e2fa1ddeull, 0x9345c010d13e3d80ull,
+        0x6f59f59c5439a11eull, 0x337482fc67fd8140ull,
+        0xd7031b5c33b1e1a2ull, 0x8b2e6c3c0075c1fcull,
+        0x8d34873734273ee3ull, 0xd119f05707e31ebdull,
+        0x356e69f753af7e5full, 0x69431e97606b5e01ull,
+        0x395bbfe13b0a8061ull, 0x6576c88108cea03full,
+        0x810151215c82c0ddull, 0xdd2c26416f46e083ull,
+        0xdb36cd4a5b141f9cull, 0x871bba2a68d03fc2ull,
+        0x636c238a3c9c5f20ull, 0x3f4154ea0f587f7eull,
+    },
+    {
+        0x0000000000000000ull, 0x6184d55f721267c6ull,
+        0xc309aabee424cf8cull, 0xa28d7fe19636a84aull,
+        0x14cbfa566747819dull, 0x754f2f091555e65bull,
+        0xd7c250e883634e11ull, 0xb64685b7f17129d7ull,
+        0x2997f4acce8f033aull, 0x481321f3bc9d64fcull,
+        0xea9e5e122aabccb6ull, 0x8b1a8b4d58b9ab70ull,
+        0x3d5c0efaa9c882a7ull, 0x5cd8dba5dbdae561ull,
+        0xfe55a4444dec4d2bull, 0x9fd1711b3ffe2aedull,
+        0x532fe9599d1e0674ull, 0x32ab3c06ef0c61b2ull,
+        0x902643e7793ac9f8ull, 0xf1a296b80b28ae3eull,
+        0x47e4130ffa5987e9ull, 0x2660c650884be02full,
+        0x84edb9b11e7d4865ull, 0xe5696cee6c6f2fa3ull,
+        0x7ab81df55391054eull, 0x1b3cc8aa21836288ull,
+        0xb9b1b74bb7b5cac2ull, 0xd8356214c5a7ad04ull,
+        0x6e73e7a334d684d3ull, 0x0ff732fc46c4e315ull,
+        0xad7a4d1dd0f24b5full, 0xccfe9842a2e02c99ull,
+        0xa65fd2b33a3c0ce8ull, 0xc7db07ec482e6b2eull,
+        0x6556780dde18c364ull, 0x04d2ad52ac0aa4a2ull,
+        0xb29428e55d7b8d75ull, 0xd310fdba2f69eab3ull,
+        0x719d825bb95f42f9ull, 0x10195704cb4d253full,
+        0x8fc8261ff4b30fd2ull, 0xee4cf34086a16814ull,
+        0x4cc18ca11097c05eull, 0x2d4559fe6285a798ull,
+        0x9b03dc4993f48e4full, 0xfa870916e1e6e989ull,
+        0x580a76f777d041c3ull, 0x398ea3a805c22605ull,
+        0xf5703beaa7220a9cull, 0x94f4eeb5d5306d5aull,
+        0x367991544306c510ull, 0x57fd440b3114a2d6ull,
+        0xe1bbc1bcc0658b01ull, 0x803f14e3b277ecc7ull,
+        0x22b26b022441448dull, 0x4336be5d5653234bull,
+        0xdce7cf4669ad09a6ull, 0xbd631a191bbf6e60ull,
+        0x1fee65f88d89c62aull, 0x7e6ab0a7ff9ba1ecull,
+        0xc82c35100eea883bull, 0xa9a8e04f7cf8effdull,
+        0x0b259faeeace47b7ull, 0x6aa14af198dc2071ull,
+        0xde670a4ddb760755ull, 0xbfe3df12a9646093ull,
+        0x1d6ea0f33f52c8d9ull, 0x7cea75ac4d40af1full,
+        0xcaacf01bbc3186c8ull, 0xab282544ce23e10eull,
+        0x09a55aa558154944ull, 0x68218ffa2a072e82ull,
+        0xf7f0fee115f9046full, 0x96742bbe67eb63a9ull,
+        0x34f9545ff1ddcbe3ull, 0x557d810083cfac25ull,
+        0xe33b04b772be85f2ull, 0x82bfd1e800ace234ull,
+        0x2032ae09969a4a7eull, 0x41b67b56e4882db8ull,
+        0x8d48e31446680121ull, 0xeccc364b347a66e7ull,
+        0x4e4149aaa24cceadull, 0x2fc59cf5d05ea96bull,
+        0x99831942212f80bcull, 0xf807cc1d533de77aull,
+        0x5a8ab3fcc50b4f30ull, 0x3b0e66a3b71928f6ull,
+        0xa4df17b888e7021bull, 0xc55bc2e7faf565ddull,
+        0x67d6bd066cc3cd97ull, 0x065268591ed1aa51ull,
+        0xb014edeeefa08386ull, 0xd19038b19db2e440ull,
+        0x731d47500b844c0aull, 0x1299920f79962bccull,
+        0x7838d8fee14a0bbdull, 0x19bc0da193586c7bull,
+        0xbb317240056ec431ull, 0xdab5a71f777ca3f7ull,
+        0x6cf322a8860d8a20ull, 0x0d77f7f7f41fede6ull,
+        0xaffa8816622945acull, 0xce7e5d49103b226aull,
+        0x51af2c522fc50887ull, 0x302bf90d5dd76f41ull,
+        0x92a686eccbe1c70bull, 0xf32253b3b9f3a0cdull,
+        0x4564d6044882891aull, 0x24e0035b3a90eedcull,
+        0x866d7cbaaca64696ull, 0xe7e9a9e5deb42150ull,
+        0x2b1731a77c540dc9ull, 0x4a93e4f80e466a0full,
+        0xe81e9b199870c245ull, 0x899a4e46ea62a583ull,
+        0x3fdccbf11b138c54ull, 0x5e581eae6901eb92ull,
+        0xfcd5614fff3743d8ull, 0x9d51b4108d25241eull,
+        0x0280c50bb2db0ef3ull, 0x63041054c0c96935ull,
+        0xc1896fb556ffc17full, 0xa00dbaea24eda6b9ull,
+        0x164b3f5dd59c8f6eull, 0x77cfea02a78ee8a8ull,
+        0xd54295e331b840e2ull, 0xb4c640bc43aa2724ull,
+        0x2e16bbb019e2102full, 0x4f926eef6bf077e9ull,
+        0xed1f110efdc6dfa3ull, 0x8c9bc4518fd4b865ull,
+        0x3add41e67ea591b2ull, 0x5b5994b90cb7f674ull,
+        0xf9d4eb589a815e3eull, 0x98503e07e89339f8ull,
+        0x07814f1cd76d1315ull, 0x66059a43a57f74d3ull,
+        0xc488e5a23349dc99ull, 0xa50c30fd415bbb5full,
+        0x134ab54ab02a9288ull, 0x72ce6015c238f54eull,
+        0xd0431ff4540e5d04ull, 0xb1c7caab261c3ac2ull,
+        0x7d3952e984fc165bull, 0x1cbd87b6f6ee719dull,
+        0xbe30f85760d8d9d7ull, 0xdfb42d0812cabe11ull,
+        0x69f2a8bfe3bb97c6ull, 0x08767de091a9f000ull,
+        0xaafb0201079f584aull, 0xcb7fd75e758d3f8cull,
+        0x54aea6454a731561ull, 0x352a731a386172a7ull,
+        0x97a70cfbae57daedull, 0xf623d9a4dc45bd2bull,
+        0x40655c132d3494fcull, 0x21e1894c5f26f33aull,
+        0x836cf6adc9105b70ull, 0xe2e823f2bb023cb6ull,
+        0x8849690323de1cc7ull, 0xe9cdbc5c51cc7b01ull,
+        0x4b40c3bdc7fad34bull, 0x2ac416e2b5e8b48dull,
+        0x9c82935544999d5aull, 0xfd06460a368bfa9cull,
+        0x5f8b39eba0bd52d6ull, 0x3e0fecb4d2af3510ull,
+        0xa1de9dafed511ffdull, 0xc05a48f09f43783bull,
+        0x62d737110975d071ull, 0x0353e24e7b67b7b7ull,
+        0xb51567f98a169e60ull, 0xd491b2a6f804f9a6ull,
+        0x761ccd476e3251ecull, 0x179818181c20362aull,
+        0xdb66805abec01ab3ull, 0xbae25505ccd27d75ull,
+        0x186f2ae45ae4d53full, 0x79ebffbb28f6b2f9ull,
+        0xcfad7a0cd9879b2eull, 0xae29af53ab95fce8ull,
+        0x0ca4d0b23da354a2ull, 0x6d2005ed4fb13364ull,
+        0xf2f174f6704f1989ull, 0x9375a1a9025d7e4full,
+        0x31f8de48946bd605ull, 0x507c0b17e679b1c3ull,
+        0xe63a8ea017089814ull, 0x87be5bff651affd2ull,
+        0x2533241ef32c5798ull, 0x44b7f141813e305eull,
+        0xf071b1fdc294177aull, 0x91f564a2b08670bcull,
+        0x33781b4326b0d8f6ull, 0x52fcce1c54a2bf30ull,
+        0xe4ba4baba5d396e7ull, 0x853e9ef4d7c1f121ull,
+        0x27b3e11541f7596bull, 0x4637344a33e53eadull,
+        0xd9e645510c1b1440ull, 0xb862900e7e097386ull,
+        0x1aefefefe83fdbccull, 0x7b6b3ab09a2dbc0aull,
+        0xcd2dbf076b5c95ddull, 0xaca96a58194ef21bull,
+        0x0e2415b98f785a51ull, 0x6fa0c0e6fd6a3d97ull,
+        0xa35e58a45f8a110eull, 0xc2da8dfb2d9876c8ull,
+        0x6057f21abbaede82ull, 0x01d32745c9bcb944ull,
+        0xb795a2f238cd9093ull, 0xd61177ad4adff755ull,
+        0x749c084cdce95f1full, 0x1518dd13aefb38d9ull,
+        0x8ac9ac0891051234ull, 0xeb4d7957e31775f2ull,
+        0x49c006b67521ddb8ull, 0x2844d3e90733ba7eull,
+        0x9e02565ef64293a9ull, 0xff8683018450f46full,
+        0x5d0bfce012665c25ull, 0x3c8f29bf60743be3ull,
+        0x562e634ef8a81b92ull, 0x37aab6118aba7c54ull,
+        0x9527c9f01c8cd41eull, 0xf4a31caf6e9eb3d8ull,
+        0x42e599189fef9a0full, 0x23614c47edfdfdc9ull,
+        0x81ec33a67bcb5583ull, 0xe068e6f909d93245ull,
+        0x7fb997e2362718a8ull, 0x1e3d42bd44357f6eull,
+        0xbcb03d5cd203d724ull, 0xdd34e803a011b0e2ull,
+        0x6b726db451609935ull, 0x0af6b8eb2372fef3ull,
+        0xa87bc70ab54456b9ull, 0xc9ff1255c756317full,
+        0x05018a1765b61de6ull, 0x64855f4817a47a20ull,
+        0xc60820a98192d26aull, 0xa78cf5f6f380b5acull,
+        0x11ca704102f19c7bull, 0x704ea51e70e3fbbdull,
+        0xd2c3daffe6d553f7ull, 0xb3470fa094c73431ull,
+        0x2c967ebbab391edcull, 0x4d12abe4d92b791aull,
+        0xef9fd4054f1dd150ull, 0x8e1b015a3d0fb696ull,
+        0x385d84edcc7e9f41ull, 0x59d951b2be6cf887ull,
+        0xfb542e53285a50cdull, 0x9ad0fb0c5a48370bull,
+    },
+    {
+        0x0000000000000000ull, 0x22ef0d5934f964ecull,
+        0x45de1ab269f2c9d8ull, 0x673117eb5d0bad34ull,
+        0x8bbc3564d3e593b0ull, 0xa953383de71cf75cull,
+        0xce622fd6ba175a68ull, 0xec8d228f8eee3e84ull,
+        0x85a0c5e208c539e5ull, 0xa74fc8bb3c3c5d09ull,
+        0xc07edf506137f03dull, 0xe291d20955ce94d1ull,
+        0x0e1cf086db20aa55ull, 0x2cf3fddfefd9ceb9ull,
+        0x4bc2ea34b2d2638dull, 0x692de76d862b0761ull,
+        0x999924efbe846d4full, 0xbb7629b68a7d09a3ull,
+        0xdc473e5dd776a497ull, 0xfea83304e38fc07bull,
+        0x1225118b6d61feffull, 0x30ca1cd259989a13ull,
+        0x57fb0b3904933727ull, 0x75140660306a53cbull,
+        0x1c39e10db64154aaull, 0x3ed6ec5482b83046ull,
+        0x59e7fbbfdfb39d72ull, 0x7b08f6e6eb4af99eull,
+        0x9785d46965a4c71aull, 0xb56ad930515da3f6ull,
+        0xd25bcedb0c560ec2ull, 0xf0b4c38238af6a2eull,
+        0xa1eae6f4d206c41bull, 0x8305ebade6ffa0f7ull,
+        0xe434fc46bbf40dc3ull, 0xc6dbf11f8f0d692full,
+        0x2a56d39001e357abull, 0x08b9dec9351a3347ull,
+        0x6f88c92268119e73ull, 0x4d67c47b5ce8fa9full,
+        0x244a2316dac3fdfeull, 0x06a52e4fee3a9912ull,
+        0x619439a4b3313426ull, 0x437b34fd87c850caull,
+        0xaff6167209266e4eull, 0x8d191b2b3ddf0aa2ull,
+        0xea280cc060d4a796ull, 0xc8c70199542dc37aull,
+        0x3873c21b6c82a954ull, 0x1a9ccf42587bcdb8ull,
+        0x7dadd8a90570608cull, 0x5f42d5f031890460ull,
+        0xb3cff77fbf673ae4ull, 0x9120fa268b9e5e08ull,
+        0xf611edcdd695f33cull, 0xd4fee094e26c97d0ull,
+        0xbdd307f9644790b1ull, 0x9f3c0aa050bef45dull,
+        0xf80d1d4b0db55969ull, 0xdae21012394c3d85ull,
+        0x366f329db7a20301ull, 0x14803fc4835b67edull,
+        0x73b1282fde50cad9ull, 0x515e2576eaa9ae35ull,
+        0xd10d62c20b0396b3ull, 0xf3e26f9b3ffaf25full,
+        0x94d3787062f15f6bull, 0xb63c752956083b87ull,
+        0x5ab157a6d8e60503ull, 0x785e5affec1f61efull,
+        0x1f6f4d14b114ccdbull, 0x3d80404d85eda837ull,
+        0x54ada72003c6af56ull, 0x7642aa79373fcbbaull,
+        0x1173bd926a34668eull, 0x339cb0cb5ecd0262ull,
+        0xdf119244d0233ce6ull, 0xfdfe9f1de4da580aull,
+        0x9acf88f6b9d1f53eull, 0xb82085af8d2891d2ull,
+        0x4894462db587fbfcull, 0x6a7b4b74817e9f10ull,
+        0x0d4a5c9fdc753224ull, 0x2fa551c6e88c56c8ull,
+        0xc32873496662684cull, 0xe1c77e10529b0ca0ull,
+        0x86f669fb0f90a194ull, 0xa41964a23b69c578ull,
+        0xcd3483cfbd42c219ull, 0xefdb8e9689bba6f5ull,
+        0x88ea997dd4b00bc1ull, 0xaa059424e0496f2dull,
+        0x4688b6ab6ea751a9ull, 0x6467bbf25a5e3545ull,
+        0x0356ac1907559871ull, 0x21b9a14033acfc9dull,
+        0x70e78436d90552a8ull, 0x5208896fedfc3644ull,
+        0x35399e84b0f79b70ull, 0x17d693dd840eff9cull,
+        0xfb5bb1520ae0c118ull, 0xd9b4bc0b3e19a5f4ull,
+        0xbe85abe0631208c0ull, 0x9c6aa6b957eb6c2cull,
+        0xf54741d4d1c06b4dull, 0xd7a84c8de5390fa1ull,
+        0xb0995b66b832a295ull, 0x9276563f8ccbc679ull,
+        0x7efb74b00225f8fdull, 0x5c1479e936dc9c11ull,
+        0x3b256e026bd73125ull, 0x19ca635b5f2e55c9ull,
+        0xe97ea0d967813fe7ull, 0xcb91ad8053785b0bull,
+        0xaca0ba6b0e73f63full, 0x8e4fb7323a8a92d3ull,
+        0x62c295bdb464ac57ull, 0x402d98e4809dc8bbull,
+        0x271c8f0fdd96658full, 0x05f38256e96f0163ull,
+        0x6cde653b6f440602ull, 0x4e3168625bbd62eeull,
+        0x29007f8906b6cfdaull, 0x0bef72d0324fab36ull,
+        0xe762505fbca195b2ull, 0xc58d5d068858f15eull,
+        0xa2bc4aedd5535c6aull, 0x805347b4e1aa3886ull,
+        0x30c26aafb90933e3ull, 0x122d67f68df0570full,
+        0x751c701dd0fbfa3bull, 0x57f37d44e4029ed7ull,
+        0xbb7e5fcb6aeca053ull, 0x999152925e15c4bfull,
+        0xfea04579031e698bull, 0xdc4f482037e70d67ull,
+        0xb562af4db1cc0a06ull, 0x978da21485356eeaull,
+        0xf0bcb5ffd83ec3deull, 0xd253b8a6ecc7a732ull,
+        0x3ede9a29622999b6ull, 0x1c31977056d0fd5aull,
+        0x7b00809b0bdb506eull, 0x59ef8dc23f223482ull,
+        0xa95b4e40078d5eacull, 0x8bb4431933743a40ull,
+        0xec8554f26e7f9774ull, 0xce6a59ab5a86f398ull,
+        0x22e77b24d468cd1cull, 0x0008767de091a9f0ull,
+        0x67396196bd9a04c4ull, 0x45d66ccf89636028ull,
+        0x2cfb8ba20f486749ull, 0x0e1486fb3bb103a5ull,
+        0x6925911066baae91ull, 0x4bca9c495243ca7dull,
+        0xa747bec6dcadf4f9ull, 0x85a8b39fe8549015ull,
+        0xe299a474b55f3d21ull, 0xc076a92d81a659cdull,
+        0x91288c5b6b0ff7f8ull, 0xb3c781025ff69314ull,
+        0xd4f696e902fd3e20ull, 0xf6199bb036045accull,
+        0x1a94b93fb8ea6448ull, 0x387bb4668c1300a4ull,
+        0x5f4aa38dd118ad90ull, 0x7da5aed4e5e1c97cull,
+        0x148849b963cace1dull, 0x366744e05733aaf1ull,
+        0x5156530b0a3807c5ull, 0x73b95e523ec16329ull,
+        0x9f347cddb02f5dadull, 0xbddb718484d63941ull,
+        0xdaea666fd9dd9475ull, 0xf8056b36ed24f099ull,
+        0x08b1a8b4d58b9ab7ull, 0x2a5ea5ede172fe5bull,
+        0x4d6fb206bc79536full, 0x6f80bf5f88803783ull,
+        0x830d9dd0066e0907ull, 0xa1e2908932976debull,
+        0xc6d387626f9cc0dfull, 0xe43c8a3b5b65a433ull,
+        0x8d116d56dd4ea352ull, 0xaffe600fe9b7c7beull,
+        0xc8cf77e4b4bc6a8aull, 0xea207abd80450e66ull,
+        0x06ad58320eab30e2ull, 0x2442556b3a52540eull,
+        0x437342806759f93aull, 0x619c4fd953a09dd6ull,
+        0xe1cf086db20aa550ull, 0xc320053486f3c1bcull,
+        0xa41112dfdbf86c88ull, 0x86fe1f86ef010864ull,
+        0x6a733d0961ef36e0ull, 0x489c30505516520cull,
+        0x2fad27bb081dff38ull, 0x0d422ae23ce49bd4ull,
+        0x646fcd8fbacf9cb5ull, 0x4680c0d68e36f859ull,
+        0x21b1d73dd33d556dull, 0x035eda64e7c43181ull,
+        0xefd3f8eb692a0f05ull, 0xcd3cf5b25dd36be9ull,
+        0xaa0de25900d8c6ddull, 0x88e2ef003421a231ull,
+        0x78562c820c8ec81full, 0x5ab921db3877acf3ull,
+        0x3d883630657c01c7ull, 0x1f673b695185652bull,
+        0xf3ea19e6df6b5bafull, 0xd10514bfeb923f43ull,
+        0xb6340354b6999277ull, 0x94db0e0d8260f69bull,
+        0xfdf6e960044bf1faull, 0xdf19e43930b29516ull,
+        0xb828f3d26db93822ull, 0x9ac7fe8b59405cceull,
+        0x764adc04d7ae624aull, 0x54a5d15de35706a6ull,
+        0x3394c6b6be5cab92ull, 0x117bcbef8aa5cf7eull,
+        0x4025ee99600c614bull, 0x62cae3c054f505a7ull,
+        0x05fbf42b09fea893ull, 0x2714f9723d07cc7full,
+        0xcb99dbfdb3e9f2fbull, 0xe976d6a487109617ull,
+        0x8e47c14fda1b3b23ull, 0xaca8cc16eee25fcfull,
+        0xc5852b7b68c958aeull, 0xe76a26225c303c42ull,
+        0x805b31c9013b9176ull, 0xa2b43c9035c2f59aull,
+        0x4e391e1fbb2ccb1eull, 0x6cd613468fd5aff2ull,
+        0x0be704add2de02c6ull, 0x290809f4e627662aull,
+        0xd9bcca76de880c04ull, 0xfb53c72fea7168e8ull,
+        0x9c62d0c4b77ac5dcull, 0xbe8ddd9d8383a130ull,
+        0x5200ff120d6d9fb4ull, 0x70eff24b3994fb58ull,
+        0x17dee5a0649f566cull, 0x3531e8f950663280ull,
+        0x5c1c0f94d64d35e1ull, 0x7ef302cde2b4510dull,
+        0x19c21526bfbffc39ull, 0x3b2d187f8b4698d5ull,
+        0xd7a03af005a8a651ull, 0xf54f37a93151c2bdull,
+        0x927e20426c5a6f89ull, 0xb0912d1b58a30b65ull,
+    },
+    {
+        0x0000000000000000ull, 0xdabe95afc7875f40ull,
+        0x27a584742000a005ull, 0xfd1b11dbe787ff45ull,
+        0x4f4b08e84001400aull, 0x95f59d4787861f4aull,
+        0x68ee8c9c6001e00full, 0xb2501933a786bf4full,
+        0x9e9611d080028014ull, 0x4428847f4785df54ull,
+        0xb93395a4a0022011ull, 0x638d000b67857f51ull,
+        0xd1dd1938c003c01eull, 0x0b638c9707849f5eull,
+        0xf6789d4ce003601bull, 0x2cc608e327843f5bull,
+        0xaff48c8aaf0b1eadull, 0x754a1925688c41edull,
+        0x885108fe8f0bbea8ull, 0x52ef9d51488ce1e8ull,
+        0xe0bf8462ef0a5ea7ull, 0x3a0111cd288d01e7ull,
+        0xc71a0016cf0afea2ull, 0x1da495b9088da1e2ull,
+        0x31629d5a2f099eb9ull, 0xebdc08f5e88ec1f9ull,
+        0x16c7192e0f093ebcull, 0xcc798c81c88e61fcull,
+        0x7e2995b26f08deb3ull, 0xa497001da88f81f3ull,
+        0x598c11c64f087eb6ull, 0x83328469888f21f6ull,
+        0xcd31b63ef11823dfull, 0x178f2391369f7c9full,
+        0xea94324ad11883daull, 0x302aa7e5169fdc9aull,
+        0x827abed6b11963d5ull, 0x58c42b79769e3c95ull,
+        0xa5df3aa29119c3d0ull, 0x7f61af0d569e9c90ull,
+        0x53a7a7ee711aa3cbull, 0x89193241b69dfc8bull,
+        0x7402239a511a03ceull, 0xaebcb635969d5c8eull,
+        0x1cecaf06311be3c1ull, 0xc6523aa9f69cbc81ull,
+        0x3b492b72111b43c4ull, 0xe1f7beddd69c1c84ull,
+        0x62c53ab45e133d72ull, 0xb87baf1b99946232ull,
+        0x4560bec07e139d77ull, 0x9fde2b6fb994c237ull,
+        0x2d8e325c1e127d78ull, 0xf730a7f3d9952238ull,
+        0x0a2bb6283e12dd7dull, 0xd0952387f995823dull,
+        0xfc532b64de11bd66ull, 0x26edbecb1996e226ull,
+        0xdbf6af10fe111d63ull, 0x01483abf39964223ull,
+        0xb318238c9e10fd6cull, 0x69a6b6235997a22cull,
+        0x94bda7f8be105d69ull, 0x4e03325779970229ull,
+        0x08bbc3564d3e593bull, 0xd20556f98ab9067bull,
+        0x2f1e47226d3ef93eull, 0xf5a0d28daab9a67eull,
+        0x47f0cbbe0d3f1931ull, 0x9d4e5e11cab84671ull,
+        0x60554fca2d3fb934ull, 0xbaebda65eab8e674ull,
+        0x962dd286cd3cd92full, 0x4c9347290abb866full,
+        0xb18856f2ed3c792aull, 0x6b36c35d2abb266aull,
+        0xd966da6e8d3d9925ull, 0x03d84fc14abac665ull,
+        0xfec35e1aad3d3920ull, 0x247dcbb56aba6660ull,
+        0xa74f4fdce2354796ull, 0x7df1da7325b218d6ull,
+        0x80eacba8c235e793ull, 0x5a545e0705b2b8d3ull,
+        0xe8044734a234079cull, 0x32bad29b65b358dcull,
+        0xcfa1c3408234a799ull, 0x151f56ef45b3f8d9ull,
+        0x39d95e0c6237c782ull, 0xe367cba3a5b098c2ull,
+        0x1e7cda7842376787ull, 0xc4c24fd785b038c7ull,
+        0x769256e422368788ull, 0xac2cc34be5b1d8c8ull,
+        0x5137d2900236278dull, 0x8b89473fc5b178cdull,
+        0xc58a7568bc267ae4ull, 0x1f34e0c77ba125a4ull,
+        0xe22ff11c9c26dae1ull, 0x389164b35ba185a1ull,
+        0x8ac17d80fc273aeeull, 0x507fe82f3ba065aeull,
+        0xad64f9f4dc279aebull, 0x77da6c5b1ba0c5abull,
+        0x5b1c64b83c24faf0ull, 0x81a2f117fba3a5b0ull,
+        0x7cb9e0cc1c245af5ull, 0xa6077563dba305b5ull,
+        0x14576c507c25bafaull, 0xcee9f9ffbba2e5baull,
+        0x33f2e8245c251affull, 0xe94c7d8b9ba245bfull,
+        0x6a7ef9e2132d6449ull, 0xb0c06c4dd4aa3b09ull,
+        0x4ddb7d96332dc44cull, 0x9765e839f4aa9b0cull,
+        0x2535f10a532c2443ull, 0xff8b64a594ab7b03ull,
+        0x0290757e732c8446ull, 0xd82ee0d1b4abdb06ull,
+        0xf4e8e832932fe45dull, 0x2e567d9d54a8bb1dull,
+        0xd34d6c46b32f4458ull, 0x09f3f9e974a81b18ull,
+        0xbba3e0dad32ea457ull, 0x611d757514a9fb17ull,
+        0x9c0664aef32e0452ull, 0x46b8f10134a95b12ull,
+        0x117786ac9a7cb276ull, 0xcbc913035dfbed36ull,
+        0x36d202d8ba7c1273ull, 0xec6c97777dfb4d33ull,
+        0x5e3c8e44da7df27cull, 0x84821beb1dfaad3cull,
+        0x79990a30fa7d5279ull, 0xa3279f9f3dfa0d39ull,
+        0x8fe1977c1a7e3262ull, 0x555f02d3ddf96d22ull,
+        0xa84413083a7e9267ull, 0x72fa86a7fdf9cd27ull,
+        0xc0aa9f945a7f7268ull, 0x1a140a3b9df82d28ull,
+        0xe70f1be07a7fd26dull, 0x3db18e4fbdf88d2dull,
+        0xbe830a263577acdbull, 0x643d9f89f2f0f39bull,
+        0x99268e5215770cdeull, 0x43981bfdd2f0539eull,
+        0xf1c802ce7576ecd1ull, 0x2b769761b2f1b391ull,
+        0xd66d86ba55764cd4ull, 0x0cd3131592f11394ull,
+        0x20151bf6b5752ccfull, 0xfaab8e5972f2738full,
+        0x07b09f8295758ccaull, 0xdd0e0a2d52f2d38aull,
+        0x6f5e131ef5746cc5ull, 0xb5e086b132f33385ull,
+        0x48fb976ad574ccc0ull, 0x924502c512f39380ull,
+        0xdc4630926b6491a9ull, 0x06f8a53dace3cee9ull,
+        0xfbe3b4e64b6431acull, 0x215d21498ce36eecull,
+        0x930d387a2b65d1a3ull, 0x49b3add5ece28ee3ull,
+        0xb4a8bc0e0b6571a6ull, 0x6e1629a1cce22ee6ull,
+        0x42d02142eb6611bdull, 0x986eb4ed2ce14efdull,
+        0x6575a536cb66b1b8ull, 0xbfcb30990ce1eef8ull,
+        0x0d9b29aaab6751b7ull, 0xd725bc056ce00ef7ull,
+        0x2a3eadde8b67f1b2ull, 0xf08038714ce0aef2ull,
+        0x73b2bc18c46f8f04ull, 0xa90c29b703e8d044ull,
+        0x5417386ce46f2f01ull, 0x8ea9adc323e87041ull,
+        0x3cf9b4f0846ecf0eull, 0xe647215f43e9904eull,
+        0x1b5c3084a46e6f0bull, 0xc1e2a52b63e9304bull,
+        0xed24adc8446d0f10ull, 0x379a386783ea5050ull,
+        0xca8129bc646daf15ull, 0x103fbc13a3eaf055ull,
+        0xa26fa520046c4f1aull, 0x78d1308fc3eb105aull,
+        0x85ca2154246cef1full, 0x5f74b4fbe3ebb05full,
+        0x19cc45fad742eb4dull, 0xc372d05510c5b40dull,
+        0x3e69c18ef7424b48ull, 0xe4d7542130c51408ull,
+        0x56874d129743ab47ull, 0x8c39d8bd50c4f407ull,
+        0x7122c966b7430b42ull, 0xab9c5cc970c45402ull,
+        0x875a542a57406b59ull, 0x5de4c18590c73419ull,
+        0xa0ffd05e7740cb5cull, 0x7a4145f1b0c7941cull,
+        0xc8115cc217412b53ull, 0x12afc96dd0c67413ull,
+        0xefb4d8b637418b56ull, 0x350a4d19f0c6d416ull,
+        0xb638c9707849f5e0ull, 0x6c865cdfbfceaaa0ull,
+        0x919d4d04584955e5ull, 0x4b23d8ab9fce0aa5ull,
+        0xf973c1983848b5eaull, 0x23cd5437ffcfeaaaull,
+        0xded645ec184815efull, 0x0468d043dfcf4aafull,
+        0x28aed8a0f84b75f4ull, 0xf2104d0f3fcc2ab4ull,
+        0x0f0b5cd4d84bd5f1ull, 0xd5b5c97b1fcc8ab1ull,
+        0x67e5d048b84a35feull, 0xbd5b45e77fcd6abeull,
+        0x4040543c984a95fbull, 0x9afec1935fcdcabbull,
+        0xd4fdf3c4265ac892ull, 0x0e43666be1dd97d2ull,
+        0xf35877b0065a6897ull, 0x29e6e21fc1dd37d7ull,
+        0x9bb6fb2c665b8898ull, 0x41086e83a1dcd7d8ull,
+        0xbc137f58465b289dull, 0x66adeaf781dc77ddull,
+        0x4a6be214a6584886ull, 0x90d577bb61df17c6ull,
+        0x6dce66608658e883ull, 0xb770f3cf41dfb7c3ull,
+        0x0520eafce659088cull, 0xdf9e7f5321de57ccull,
+        0x22856e88c659a889ull, 0xf83bfb2701def7c9ull,
+        0x7b097f4e8951d63full, 0xa1b7eae14ed6897full,
+        0x5cacfb3aa951763aull, 0x86126e956ed6297aull,
+        0x344277a6c9509635ull, 0xeefce2090ed7c975ull,
+        0x13e7f3d2e9503630ull, 0xc959667d2ed76970ull,
+        0xe59f6e9e0953562bull, 0x3f21fb31ced4096bull,
+        0xc23aeaea2953f62eull, 0x18847f45eed4a96eull,
+        0xaad4667649521621ull, 0x706af3d98ed54961ull,
+        0x8d71e2026952b624ull, 0x57cf77adaed5e964ull,
+    },
+#endif
+};
@@ -0,0 +1,59 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * Hardware CRC-32 kernels shared by the CRC update functions.
+ *
+ * JUNO_CRC_HW is 1 when accelerated kernels can be compiled: hosted x86-64
+ * builds (PCLMULQDQ folding for ZIP and CCITT32, the SSE4.2 crc32 instruction
+ * for Castagnoli) and hosted aarch64 Linux builds (CRC32 instructions for ZIP
+ * and Castagnoli). Defining JUNO_CRC_PORTABLE, or building
+ * freestanding, keeps only the table-driven code.
+ *
+ * The kernels are selected by Juno_CrcHwInit. A NULL kernel pointer means the
+ * table-driven path is used. The pointers are plain globals read without
+ * synchronization, so Juno_CrcHwInit must finish before concurrent CRC use.
+ * Kernels take the CRC register (no final XOR) and
+ * a length that is a multiple of JUNO_CRC_HW_BLOCK and at least
+ * JUNO_CRC_HW_MIN; the caller finishes the remaining bytes with the tables.
+ */
+#ifndef JUNO_CRC_HW_H
+#define JUNO_CRC_HW_H
+#include <stddef.h>
+#include <stdint.h>
+
+#if !defined(JUNO_CRC_PORTABLE) && __STDC_HOSTED__ && (defined(__x86_64__) || (defined(__aarch64__) && defined(__linux__)))
+#define JUNO_CRC_HW 1
+#else
+#define JUNO_CRC_HW 0
+#endif
+
+/// Smallest input handed to a hardware kernel
+#define JUNO_CRC_HW_MIN     (64u)
+/// Hardware kernels consume whole blocks of this size
+#define JUNO_CRC_HW_BLOCK   (16u)
+
+#if JUNO_CRC_HW
+typedef uint32_t (*JUNO_CRC_HW_KERNEL_T)(uint32_t iCrc, const uint8_t *pcData, size_t zDataSize);
+/// Accelerated ZIP kernel, NULL when not selected
+extern JUNO_CRC_HW_KERNEL_T gpfcnJunoCrcZipHw;
+/// Accelerated CCITT32 kernel, NULL when not selected
+extern JUNO_CRC_HW_KERNEL_T gpfcnJunoCrcCcitt32Hw;
+/// Accelerated Castagnoli kernel, NULL when not selected
+extern JUNO_CRC_HW_KERNEL_T gpfcnJunoCrcCastagnoliHw;
+#endif
+#endif // JUNO_CRC_HW_H
@@ -0,0 +1,131 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * Per-variant dispatch shared by the parallel and streaming CRC drivers.
+ *
+ * Values are carried in 64 bits; 16- and 32-bit variants use the low bits.
+ * Callers validate the kind with KindValid before dispatching.
+ */
+#ifndef JUNO_CRC_KIND_H
+#define JUNO_CRC_KIND_H
+#include "juno/crc/crc.h"
+#include "juno/crc/crc_parallel.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// True when tKind names a supported CRC variant
+static inline bool KindValid(JUNO_CRC_KIND_T tKind)
+{
+    return (unsigned)tKind <= (unsigned)JUNO_CRC_KIND_CRC64;
+}
+
+/// Seed of the variant (its JUNO_*_CRC_INIT at the variant's width)
+static inline uint64_t KindInit(JUNO_CRC_KIND_T tKind)
+{
+    switch(tKind)
+    {
+        case JUNO_CRC_KIND_ARC:
+            return (uint16_t)JUNO_ARC_CRC_INIT;
+        case JUNO_CRC_KIND_BINHEX:
+            return (uint16_t)JUNO_BINHEX_CRC_INIT;
+        case JUNO_CRC_KIND_CCITT:
+            return (uint16_t)JUNO_CCITT_CRC_INIT;
+        case JUNO_CRC_KIND_CCITT32:
+            return (uint32_t)JUNO_CCITT32_CRC_INIT;
+        case JUNO_CRC_KIND_KERMIT:
+            return (uint16_t)JUNO_KERMIT_CRC_INIT;
+        case JUNO_CRC_KIND_ZIP:
+            return (uint32_t)JUNO_ZIP_CRC_INIT;
+        case JUNO_CRC_KIND_CASTAGNOLI:
+            return (uint32_t)JUNO_CASTAGNOLI_CRC_INIT;
+        case JUNO_CRC_KIND_CRC64:
+            return (uint64_t)JUNO_CRC64_CRC_INIT;
+        default:
+            return 0;
+    }
+}
+
+/// Final XOR the variant's update function applies before returning
+static inline uint64_t KindXorOut(JUNO_CRC_KIND_T tKind)
+{
+    switch(tKind)
+    {
+        case JUNO_CRC_KIND_ZIP:
+        case JUNO_CRC_KIND_CASTAGNOLI:
+            return UINT32_MAX;
+        case JUNO_CRC_KIND_CRC64:
+            return UINT64_MAX;
+        default:
+            return 0;
+    }
+}
+
+/// Call the variant's update function
+static inline uint64_t KindUpdate(JUNO_CRC_KIND_T tKind, uint64_t iCrc, const void *pcData, size_t zDataSize)
+{
+    switch(tKind)
+    {
+        case JUNO_CRC_KIND_ARC:
+            return Juno_CrcArcUpdate((uint16_t)iCrc, pcData, zDataSize);
+        case JUNO_CRC_KIND_BINHEX:
+            return Juno_CrcBinhexUpdate((uint16_t)iCrc, pcData, zDataSize);
+        case JUNO_CRC_KIND_CCITT:
+            return Juno_CrcCcittUpdate((uint16_t)iCrc, pcData, zDataSize);
+        case JUNO_CRC_KIND_CCITT32:
+            return Juno_CrcCcitt32Update((uint32_t)iCrc, pcData, zDataSize);
+        case JUNO_CRC_KIND_KERMIT:
+            return Juno_CrcKermitUpdate((uint16_t)iCrc, pcData, zDataSize);
+        case JUNO_CRC_KIND_ZIP:
+            return Juno_CrcZipUpdate((uint32_t)iCrc, pcData, zDataSize);
+        case JUNO_CRC_KIND_CASTAGNOLI:
+            return Juno_CrcCastagnoliUpdate((uint32_t)iCrc, pcData, zDataSize);
+        case JUNO_CRC_KIND_CRC64:
+            return Juno_CrcCrc64Update(iCrc, pcData, zDataSize);
+        default:
+            return 0;
+    }
+}
+
+/// Append the CRC of a following chunk to a running CRC
+static inline uint64_t KindCombine(JUNO_CRC_KIND_T tKind, uint64_t iCrcA, uint64_t iCrcB, size_t zLengthB)
+{
+    switch(tKind)
+    {
+        case JUNO_CRC_KIND_ARC:
+            return Juno_CrcArcCombine((uint16_t)iCrcA, (uint16_t)iCrcB, zLengthB);
+        case JUNO_CRC_KIND_BINHEX:
+            return Juno_CrcBinhexCombine((uint16_t)iCrcA, (uint16_t)iCrcB, zLengthB);
+        case JUNO_CRC_KIND_CCITT:
+            return Juno_CrcCcittCombine((uint16_t)iCrcA, (uint16_t)iCrcB, zLengthB);
+        case JUNO_CRC_KIND_CCITT32:
+            return Juno_CrcCcitt32Combine((uint32_t)iCrcA, (uint32_t)iCrcB, zLengthB);
+        case JUNO_CRC_KIND_KERMIT:
+            return Juno_CrcKermitCombine((uint16_t)iCrcA, (uint16_t)iCrcB, zLengthB);
+        case JUNO_CRC_KIND_ZIP:
+            return Juno_CrcZipCombine((uint32_t)iCrcA, (uint32_t)iCrcB, zLengthB);
+        case JUNO_CRC_KIND_CASTAGNOLI:
+            return Juno_CrcCastagnoliCombine((uint32_t)iCrcA, (uint32_t)iCrcB, zLengthB);
+        case JUNO_CRC_KIND_CRC64:
+            return Juno_CrcCrc64Combine(iCrcA, iCrcB, zLengthB);
+        default:
+            return 0;
+    }
+}
+
+#endif // JUNO_CRC_KIND_H
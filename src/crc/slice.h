@@ -0,0 +1,46 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * Slicing-by-N configuration shared by the CRC kernels.
+ *
+ * JUNO_CRC_SLICE is the number of input bytes consumed per table step and is
+ * set with the JUNO_CRC_SLICE CMake cache variable. 1 uses only the 256-entry
+ * tables in src/crc/<name>.h; 4 and 8 add the tables in src/crc/<name>_slice.h
+ * (N x 256 entries per CRC) and break the serial byte-to-byte dependency.
+ */
+#ifndef JUNO_CRC_SLICE_H
+#define JUNO_CRC_SLICE_H
+#ifndef JUNO_CRC_SLICE
+#define JUNO_CRC_SLICE 1
+#endif
+#if JUNO_CRC_SLICE != 1 && JUNO_CRC_SLICE != 4 && JUNO_CRC_SLICE != 8
+#error "JUNO_CRC_SLICE must be 1, 4 or 8"
+#endif
+
+#if JUNO_CRC_SLICE == 8
+/// Lookups for the data bytes of a step that do not overlap a 16-bit CRC
+#define JUNO_CRC_SLICE_DATA16(tab, cp) \
+    (tab[5][cp[2]] ^ tab[4][cp[3]] ^ tab[3][cp[4]] ^ tab[2][cp[5]] ^ tab[1][cp[6]] ^ tab[0][cp[7]])
+/// Lookups for the data bytes of a step that do not overlap a 32-bit CRC
+#define JUNO_CRC_SLICE_DATA32(tab, cp) \
+    (tab[3][cp[4]] ^ tab[2][cp[5]] ^ tab[1][cp[6]] ^ tab[0][cp[7]])
+#elif JUNO_CRC_SLICE == 4
+#define JUNO_CRC_SLICE_DATA16(tab, cp) (tab[1][cp[2]] ^ tab[0][cp[3]])
+#define JUNO_CRC_SLICE_DATA32(tab, cp) (0u)
+#endif
+#endif // JUNO_CRC_SLICE_H
@@ -17,6 +17,10 @@
 #include "juno/crc/crc.h"
 #include <stdint.h>
 #include "crc/arc.h"
+#include "crc/slice.h"
+#if JUNO_CRC_SLICE > 1
+#include "crc/arc_slice.h"
+#endif
 
 // @{"req": ["REQ-CRC-001", "REQ-CRC-002", "REQ-CRC-003", "REQ-CRC-004"]}
 uint16_t Juno_CrcArcUpdate(uint16_t iCrc, const void *pcData, size_t zDataSize)
@@ -29,6 +33,15 @@ uint16_t Juno_CrcArcUpdate(uint16_t iCrc, const void *pcData, size_t zDataSize)
     register const uint8_t *cp = pcData;
     register size_t cnt = zDataSize;
 
+#if JUNO_CRC_SLICE > 1
+    // Consume JUNO_CRC_SLICE bytes per step; the low CRC byte meets the first data byte
+    for(; cnt >= JUNO_CRC_SLICE; cnt -= JUNO_CRC_SLICE, cp += JUNO_CRC_SLICE) {
+        crc = arc_crctab_slice[JUNO_CRC_SLICE - 1][(crc ^ cp[0]) & 0xff] ^
+            arc_crctab_slice[JUNO_CRC_SLICE - 2][((crc >> 8) ^ cp[1]) & 0xff] ^
+            JUNO_CRC_SLICE_DATA16(arc_crctab_slice, cp);
+    }
+#endif
+
     while(cnt--) {
 	crc=((crc>>8)&M1_16)^arc_crctab[(crc&0xff)^*cp++];
     }
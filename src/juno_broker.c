@@ -20,16 +20,21 @@
 #include "juno/memory/pointer_api.h"
 #include "juno/sb/broker_api.h"
 #include "juno/status.h"
+#include "juno/types.h"
+#include <stddef.h>
 
 /// Publish the SB message with message id
 static JUNO_STATUS_T Publish(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_MID_T tMid, JUNO_POINTER_T tMsg);
 /// Register a subscriber to a sb message
 static JUNO_STATUS_T RegisterSubscriber(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_PIPE_T *ptPipe);
+/// Publish an array of SB messages in order
+static JUNO_RESULT_SIZE_T PublishBatch(JUNO_SB_BROKER_ROOT_T *ptBroker, const JUNO_SB_PUBLISH_ENTRY_T *ptEntries, size_t zEntries);
 
 static const JUNO_SB_BROKER_API_T gtBrokerApi =
 {
     Publish,
-    RegisterSubscriber
+    RegisterSubscriber,
+    PublishBatch
 };
 
 // @{"req": ["REQ-SB-003"]}
@@ -72,6 +77,74 @@ static JUNO_STATUS_T Publish(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_MID_T tMid
     return tStatus;
 }
 
+/// Find the registry span [*piStart, *piEnd) that holds every pipe subscribed to tMid
+static void FindMidSpan(const JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_MID_T tMid, size_t *piStart, size_t *piEnd)
+{
+    size_t iStart = 0;
+    size_t iEnd = 0;
+    for(size_t i = 0; i < ptBroker->zRegistryLength; i++)
+    {
+        if(ptBroker->ptPipeRegistry[i]->iMsgId == tMid)
+        {
+            if(iEnd == 0)
+            {
+                iStart = i;
+            }
+            iEnd = i + 1;
+        }
+    }
+    *piStart = iStart;
+    *piEnd = iEnd;
+}
+
+// @{"req": ["REQ-SB-017", "REQ-SB-018"]}
+static JUNO_RESULT_SIZE_T PublishBatch(JUNO_SB_BROKER_ROOT_T *ptBroker, const JUNO_SB_PUBLISH_ENTRY_T *ptEntries, size_t zEntries)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    tResult.tStatus = JunoSb_BrokerVerify(ptBroker);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(zEntries && !ptEntries)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptBroker, "Batch entries are null");
+        return tResult;
+    }
+    // Verify every pipe once for the whole batch
+    for(size_t i = 0; i < ptBroker->zRegistryLength; i++)
+    {
+        tResult.tStatus = JunoDs_QueueVerify(&ptBroker->ptPipeRegistry[i]->tRoot);
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    }
+    size_t iSpanStart = 0;
+    size_t iSpanEnd = 0;
+    for(; tResult.tOk < zEntries; tResult.tOk++)
+    {
+        const JUNO_SB_PUBLISH_ENTRY_T *ptEntry = &ptEntries[tResult.tOk];
+        // Narrow the registry to the MID's span once per run of two or more entries
+        if(tResult.tOk == 0 || ptEntries[tResult.tOk - 1].tMid != ptEntry->tMid)
+        {
+            iSpanStart = 0;
+            iSpanEnd = ptBroker->zRegistryLength;
+            if(tResult.tOk + 1 < zEntries && ptEntries[tResult.tOk + 1].tMid == ptEntry->tMid)
+            {
+                FindMidSpan(ptBroker, ptEntry->tMid, &iSpanStart, &iSpanEnd);
+            }
+        }
+        for(size_t i = iSpanStart; i < iSpanEnd; i++)
+        {
+            JUNO_SB_PIPE_T *ptCurrentItem = ptBroker->ptPipeRegistry[i];
+            if(ptCurrentItem->iMsgId == ptEntry->tMid)
+            {
+                JUNO_DS_QUEUE_ROOT_T *ptRecvQueue = &ptCurrentItem->tRoot;
+                tResult.tStatus = ptRecvQueue->ptApi->Enqueue(ptRecvQueue, ptEntry->tMsg);
+                // tOk holds the index of the failed entry
+                JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            }
+        }
+    }
+    return tResult;
+}
+
 // @{"req": ["REQ-SB-008", "REQ-SB-009"]}
 static JUNO_STATUS_T RegisterSubscriber(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_PIPE_T *ptPipe)
 {
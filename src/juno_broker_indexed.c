@@ -0,0 +1,237 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/sb/broker_indexed.h"
+#include "juno/ds/queue_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/sb/broker_api.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/// Publish the SB message to the pipes indexed under the message id
+static JUNO_STATUS_T Publish(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_MID_T tMid, JUNO_POINTER_T tMsg);
+/// Register a subscriber and update the topic index
+static JUNO_STATUS_T RegisterSubscriber(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_PIPE_T *ptPipe);
+/// Publish an array of SB messages in order
+static JUNO_RESULT_SIZE_T PublishBatch(JUNO_SB_BROKER_ROOT_T *ptBroker, const JUNO_SB_PUBLISH_ENTRY_T *ptEntries, size_t zEntries);
+
+static const JUNO_SB_BROKER_API_T gtBrokerIndexedApi =
+{
+    Publish,
+    RegisterSubscriber,
+    PublishBatch
+};
+
+static inline JUNO_STATUS_T Verify(const JUNO_SB_BROKER_ROOT_T *ptBroker)
+{
+    JUNO_STATUS_T tStatus = JunoSb_BrokerVerify(ptBroker);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    const JUNO_SB_BROKER_INDEXED_T *ptIndexed = (const JUNO_SB_BROKER_INDEXED_T *)(ptBroker);
+    JUNO_ASSERT_EXISTS_MODULE(
+        ptIndexed->ptTopicTable &&
+        ptIndexed->zTopicCapacity,
+        ptIndexed,
+        "Module does not have all dependencies"
+    );
+    if(ptIndexed->JUNO_MODULE_SUPER.ptApi != &gtBrokerIndexedApi)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptIndexed, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Find the first topic whose MID is not less than tMid
+static inline size_t TopicLowerBound(const JUNO_SB_BROKER_INDEXED_T *ptBroker, JUNO_SB_MID_T tMid)
+{
+    size_t iLow = 0;
+    size_t iHigh = ptBroker->zTopicLength;
+    while(iLow < iHigh)
+    {
+        size_t iMid = iLow + (iHigh - iLow) / 2;
+        if(ptBroker->ptTopicTable[iMid].iMsgId < tMid)
+        {
+            iLow = iMid + 1;
+        }
+        else
+        {
+            iHigh = iMid;
+        }
+    }
+    return iLow;
+}
+
+/// Find the topic entry for tMid, NULL if nothing subscribes to it
+static inline const JUNO_SB_TOPIC_T *FindTopic(const JUNO_SB_BROKER_INDEXED_T *ptBroker, JUNO_SB_MID_T tMid)
+{
+    size_t iTopic = TopicLowerBound(ptBroker, tMid);
+    if(iTopic >= ptBroker->zTopicLength || ptBroker->ptTopicTable[iTopic].iMsgId != tMid)
+    {
+        return NULL;
+    }
+    return &ptBroker->ptTopicTable[iTopic];
+}
+
+/// Enqueue the message into every pipe of the topic
+static inline JUNO_STATUS_T EnqueueTopic(JUNO_SB_BROKER_ROOT_T *ptBroker, const JUNO_SB_TOPIC_T *ptTopic, JUNO_POINTER_T tMsg)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_SB_PIPE_T **ptPipes = &ptBroker->ptPipeRegistry[ptTopic->iStart];
+    for(size_t i = 0; i < ptTopic->zCount; i++)
+    {
+        // Pipes were verified at registration, Enqueue verifies the queue
+        JUNO_DS_QUEUE_ROOT_T *ptRecvQueue = &ptPipes[i]->tRoot;
+        tStatus = ptRecvQueue->ptApi->Enqueue(ptRecvQueue, tMsg);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    return tStatus;
+}
+
+// @{"req": ["REQ-SB-014"]}
+JUNO_STATUS_T JunoSb_BrokerIndexedInit(
+    JUNO_SB_BROKER_INDEXED_T *ptBroker,
+    JUNO_SB_PIPE_T **ptPipeRegistry,
+    size_t zRegistryCapacity,
+    JUNO_SB_TOPIC_T *ptTopicTable,
+    size_t zTopicCapacity,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvFailureUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptBroker);
+    JUNO_SB_BROKER_ROOT_T *ptRoot = &ptBroker->JUNO_MODULE_SUPER;
+    ptRoot->ptApi = &gtBrokerIndexedApi;
+    ptRoot->ptPipeRegistry = ptPipeRegistry;
+    ptRoot->zRegistryCapacity = zRegistryCapacity;
+    ptRoot->zRegistryLength = 0;
+    ptRoot->_pfcnFailureHandler = pfcnFailureHdlr;
+    ptRoot->_pvFailureUserData = pvFailureUserData;
+    ptBroker->ptTopicTable = ptTopicTable;
+    ptBroker->zTopicCapacity = zTopicCapacity;
+    ptBroker->zTopicLength = 0;
+    JUNO_STATUS_T tStatus = Verify(ptRoot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return tStatus;
+}
+
+// @{"req": ["REQ-SB-016"]}
+static JUNO_STATUS_T Publish(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_MID_T tMid, JUNO_POINTER_T tMsg)
+{
+    JUNO_STATUS_T tStatus = Verify(ptBroker);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    const JUNO_SB_TOPIC_T *ptTopic = FindTopic((JUNO_SB_BROKER_INDEXED_T *)(ptBroker), tMid);
+    if(!ptTopic)
+    {
+        // No subscribers for this MID
+        return tStatus;
+    }
+    return EnqueueTopic(ptBroker, ptTopic, tMsg);
+}
+
+// @{"req": ["REQ-SB-017", "REQ-SB-018"]}
+static JUNO_RESULT_SIZE_T PublishBatch(JUNO_SB_BROKER_ROOT_T *ptBroker, const JUNO_SB_PUBLISH_ENTRY_T *ptEntries, size_t zEntries)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    tResult.tStatus = Verify(ptBroker);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(zEntries && !ptEntries)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptBroker, "Batch entries are null");
+        return tResult;
+    }
+    const JUNO_SB_BROKER_INDEXED_T *ptIndexed = (const JUNO_SB_BROKER_INDEXED_T *)(ptBroker);
+    const JUNO_SB_TOPIC_T *ptTopic = NULL;
+    for(; tResult.tOk < zEntries; tResult.tOk++)
+    {
+        const JUNO_SB_PUBLISH_ENTRY_T *ptEntry = &ptEntries[tResult.tOk];
+        // Reuse the previous lookup for runs of the same MID
+        if(!ptTopic || ptTopic->iMsgId != ptEntry->tMid)
+        {
+            ptTopic = FindTopic(ptIndexed, ptEntry->tMid);
+            if(!ptTopic)
+            {
+                // No subscribers for this MID
+                continue;
+            }
+        }
+        tResult.tStatus = EnqueueTopic(ptBroker, ptTopic, ptEntry->tMsg);
+        // tOk holds the index of the failed entry
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    }
+    return tResult;
+}
+
+// @{"req": ["REQ-SB-015"]}
+static JUNO_STATUS_T RegisterSubscriber(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_PIPE_T *ptPipe)
+{
+    JUNO_STATUS_T tStatus = Verify(ptBroker);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoSb_PipeVerify(ptPipe);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_SB_BROKER_INDEXED_T *ptIndexed = (JUNO_SB_BROKER_INDEXED_T *)(ptBroker);
+    // Check if the broker registry is full
+    if(ptBroker->zRegistryLength >= ptBroker->zRegistryCapacity)
+    {
+        tStatus = JUNO_STATUS_ERR;
+        JUNO_FAIL_ROOT(tStatus, ptBroker, "Failed to register subscriber. Registry Full");
+        return tStatus;
+    }
+    size_t iTopic = TopicLowerBound(ptIndexed, ptPipe->iMsgId);
+    bool bNewTopic = iTopic >= ptIndexed->zTopicLength || ptIndexed->ptTopicTable[iTopic].iMsgId != ptPipe->iMsgId;
+    if(bNewTopic && ptIndexed->zTopicLength >= ptIndexed->zTopicCapacity)
+    {
+        tStatus = JUNO_STATUS_TABLE_FULL_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptBroker, "Failed to register subscriber. Topic table full");
+        return tStatus;
+    }
+    size_t iInsert = 0;
+    if(bNewTopic)
+    {
+        // The new group starts where the next topic's group starts
+        iInsert = iTopic < ptIndexed->zTopicLength ? ptIndexed->ptTopicTable[iTopic].iStart : ptBroker->zRegistryLength;
+        for(size_t i = ptIndexed->zTopicLength; i > iTopic; i--)
+        {
+            ptIndexed->ptTopicTable[i] = ptIndexed->ptTopicTable[i - 1];
+        }
+        ptIndexed->ptTopicTable[iTopic].iMsgId = ptPipe->iMsgId;
+        ptIndexed->ptTopicTable[iTopic].iStart = iInsert;
+        ptIndexed->ptTopicTable[iTopic].zCount = 0;
+        ptIndexed->zTopicLength += 1;
+    }
+    else
+    {
+        // Append to the end of the existing group to keep registration order
+        iInsert = ptIndexed->ptTopicTable[iTopic].iStart + ptIndexed->ptTopicTable[iTopic].zCount;
+    }
+    // Shift the following groups up by one slot
+    for(size_t i = ptBroker->zRegistryLength; i > iInsert; i--)
+    {
+        ptBroker->ptPipeRegistry[i] = ptBroker->ptPipeRegistry[i - 1];
+    }
+    ptBroker->ptPipeRegistry[iInsert] = ptPipe;
+    ptBroker->zRegistryLength += 1;
+    ptIndexed->ptTopicTable[iTopic].zCount += 1;
+    for(size_t i = iTopic + 1; i < ptIndexed->zTopicLength; i++)
+    {
+        ptIndexed->ptTopicTable[i].iStart += 1;
+    }
+    return tStatus;
+}
@@ -18,23 +18,34 @@
 #include "juno/ds/array_api.h"
 #include "juno/ds/queue_api.h"
 #include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
 #include "juno/status.h"
+#include <stdbool.h>
+#include <stddef.h>
 
-/// Enqueue an item on the queue
-// @{"req": ["REQ-QUEUE-003", "REQ-QUEUE-004"]}
-JUNO_STATUS_T JunoDs_QueuePush(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem)
+static JUNO_STATUS_T QueuePushPow2(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T QueuePopPow2(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn);
+
+/// Wrap an index into the ring, masking when the capacity is a power of two
+static inline size_t QueueWrap(size_t iIndex, size_t zCapacity, bool bPow2)
 {
-    JUNO_ASSERT_EXISTS(ptQueue);
-    JUNO_STATUS_T tStatus = JunoDs_QueueVerify(ptQueue);
-    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
-    tStatus = JunoMemory_PointerVerify(tItem);
+    return bPow2 ? (iIndex & (zCapacity - 1)) : (iIndex % zCapacity);
+}
+
+static inline JUNO_STATUS_T QueuePush(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem, bool bPow2)
+{
+    JUNO_STATUS_T tStatus = JunoMemory_PointerVerify(tItem);
     JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
     JUNO_DS_ARRAY_ROOT_T *ptBuffer = ptQueue->ptQueueArray;
     if(ptQueue->zLength < ptBuffer->zCapacity)
     {
-        size_t iIndex = (ptQueue->iStartIndex + ptQueue->zLength) % ptBuffer->zCapacity;
-        tStatus = ptBuffer->ptApi->SetAt(ptBuffer, tItem, iIndex);
-        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        size_t iIndex = QueueWrap(ptQueue->iStartIndex + ptQueue->zLength, ptBuffer->zCapacity, bPow2);
+        tStatus = JunoDs_ArrayStore(ptBuffer, tItem, iIndex);
+        if(tStatus != JUNO_STATUS_SUCCESS)
+        {
+            JUNO_FAIL_ROOT(tStatus, ptQueue, "Failed to store enqueued data");
+            return tStatus;
+        }
         ptQueue->zLength += 1;
     }
     else
@@ -46,13 +57,9 @@ JUNO_STATUS_T JunoDs_QueuePush(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tIt
     return tStatus;
 }
 
-/// Dequeue an item from the queue
-// @{"req": ["REQ-QUEUE-005", "REQ-QUEUE-006"]}
-JUNO_STATUS_T JunoDs_QueuePop(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn)
+static inline JUNO_STATUS_T QueuePop(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn, bool bPow2)
 {
-    JUNO_STATUS_T tStatus = JunoDs_QueueVerify(ptQueue);
-    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
-    tStatus = JunoMemory_PointerVerify(tReturn);
+    JUNO_STATUS_T tStatus = JunoMemory_PointerVerify(tReturn);
     JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
     JUNO_DS_ARRAY_ROOT_T *ptBuffer = ptQueue->ptQueueArray;
     if(ptQueue->zLength > 0)
@@ -61,11 +68,15 @@ JUNO_STATUS_T JunoDs_QueuePop(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tRet
         size_t iDequeueIndex = ptQueue->iStartIndex;
         JUNO_RESULT_POINTER_T tPtrResult = ptApi->GetAt(ptBuffer, iDequeueIndex);
         JUNO_ASSERT_SUCCESS(tPtrResult.tStatus, return tPtrResult.tStatus);
-        tStatus = tPtrResult.tOk.ptApi->Copy(tReturn, JUNO_OK(tPtrResult));
-        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = JunoMemory_PointerCopyWith(tPtrResult.tOk.ptApi, tReturn, JUNO_OK(tPtrResult));
+        if(tStatus != JUNO_STATUS_SUCCESS)
+        {
+            JUNO_FAIL_ROOT(tStatus, ptQueue, "Failed to copy dequeued data");
+            return tStatus;
+        }
         tStatus = ptApi->RemoveAt(ptBuffer, iDequeueIndex);
         JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
-        ptQueue->iStartIndex = (ptQueue->iStartIndex + 1) % ptBuffer->zCapacity;
+        ptQueue->iStartIndex = QueueWrap(ptQueue->iStartIndex + 1, ptBuffer->zCapacity, bPow2);
         ptQueue->zLength -= 1;
         return tStatus;
     }
@@ -74,6 +85,43 @@ JUNO_STATUS_T JunoDs_QueuePop(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tRet
     return tStatus;
 }
 
+/// Enqueue an item on the queue
+// @{"req": ["REQ-QUEUE-003", "REQ-QUEUE-004"]}
+JUNO_STATUS_T JunoDs_QueuePush(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem)
+{
+    JUNO_ASSERT_EXISTS(ptQueue);
+    JUNO_STATUS_T tStatus = JunoDs_QueueVerify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return QueuePush(ptQueue, tItem, false);
+}
+
+/// Dequeue an item from the queue
+// @{"req": ["REQ-QUEUE-005", "REQ-QUEUE-006"]}
+JUNO_STATUS_T JunoDs_QueuePop(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn)
+{
+    JUNO_STATUS_T tStatus = JunoDs_QueueVerify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return QueuePop(ptQueue, tReturn, false);
+}
+
+/// Enqueue an item on a power-of-two queue
+// @{"req": ["REQ-QUEUE-003", "REQ-QUEUE-015"]}
+static JUNO_STATUS_T QueuePushPow2(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = JunoDs_QueueVerify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return QueuePush(ptQueue, tItem, true);
+}
+
+/// Dequeue an item from a power-of-two queue
+// @{"req": ["REQ-QUEUE-005", "REQ-QUEUE-015"]}
+static JUNO_STATUS_T QueuePopPow2(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn)
+{
+    JUNO_STATUS_T tStatus = JunoDs_QueueVerify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return QueuePop(ptQueue, tReturn, true);
+}
+
 /// Peek at the next item in the queue
 // @{"req": ["REQ-QUEUE-007", "REQ-QUEUE-008"]}
 JUNO_RESULT_POINTER_T JunoDs_QueuePeek(JUNO_DS_QUEUE_ROOT_T *ptQueue)
@@ -102,6 +150,16 @@ static const JUNO_DS_QUEUE_API_T gtQueueApi =
     JunoDs_QueuePeek,
 };
 
+static const JUNO_DS_QUEUE_API_T gtQueuePow2Api =
+{
+    /// Enqueue an item on the queue
+    QueuePushPow2,
+    /// Dequeue an item from the queue
+    QueuePopPow2,
+    /// Peek at the next item in the queue
+    JunoDs_QueuePeek,
+};
+
 /// Initialize a buffer queue with a capacity
 // @{"req": ["REQ-QUEUE-001", "REQ-QUEUE-002"]}
 JUNO_STATUS_T JunoDs_QueueInit(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_DS_ARRAY_ROOT_T *ptQueueArray, JUNO_FAILURE_HANDLER_T pfcnFailureHdlr, JUNO_USER_DATA_T *pvFailureUserData)
@@ -115,3 +173,20 @@ JUNO_STATUS_T JunoDs_QueueInit(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_DS_ARRAY_ROOT
     ptQueue->_pvFailureUserData = pvFailureUserData;
     return JunoDs_QueueVerify(ptQueue);
 }
+
+/// Initialize a buffer queue whose capacity is a power of two
+// @{"req": ["REQ-QUEUE-015"]}
+JUNO_STATUS_T JunoDs_QueueInitPow2(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_DS_ARRAY_ROOT_T *ptQueueArray, JUNO_FAILURE_HANDLER_T pfcnFailureHdlr, JUNO_USER_DATA_T *pvFailureUserData)
+{
+    JUNO_STATUS_T tStatus = JunoDs_QueueInit(ptQueue, ptQueueArray, pfcnFailureHdlr, pvFailureUserData);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    size_t zCapacity = ptQueueArray->zCapacity;
+    if(zCapacity & (zCapacity - 1))
+    {
+        tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptQueue, "Queue capacity must be a power of two");
+        return tStatus;
+    }
+    ptQueue->ptApi = &gtQueuePow2Api;
+    return tStatus;
+}
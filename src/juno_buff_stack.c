@@ -18,6 +18,7 @@
 #include "juno/ds/array_api.h"
 #include "juno/ds/stack_api.h"
 #include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
 #include "juno/memory/memory_api.h"
 #include "juno/status.h"
 
@@ -34,7 +35,7 @@ JUNO_STATUS_T JunoDs_StackPush(JUNO_DS_STACK_ROOT_T *ptStack, JUNO_POINTER_T tIt
     JUNO_DS_ARRAY_ROOT_T *ptBuffer = ptStack->ptStackArray;
     if(ptStack->zLength < ptBuffer->zCapacity)
     {
-        tStatus = ptBuffer->ptApi->SetAt(ptBuffer, tItem, ptStack->zLength);
+        tStatus = JunoDs_ArrayStore(ptBuffer, tItem, ptStack->zLength);
         JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
         ptStack->zLength += 1;
     }
@@ -63,7 +64,7 @@ JUNO_STATUS_T JunoDs_StackPop(JUNO_DS_STACK_ROOT_T *ptStack, JUNO_POINTER_T tRet
         ptStack->zLength -= 1;
         JUNO_RESULT_POINTER_T tResult = ptBuffer->ptApi->GetAt(ptBuffer, ptStack->zLength);
         JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult.tStatus);
-        tStatus = tReturn.ptApi->Copy(tReturn, tResult.tOk);
+        tStatus = JunoMemory_PointerCopy(tReturn, tResult.tOk);
         return tStatus;
     }
     tStatus = JUNO_STATUS_OOB_ERROR;
@@ -0,0 +1,63 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+#include "juno/crc/crc.h"
+#include "crc/castagnoli.h"
+#include "crc/hw.h"
+#include "crc/slice.h"
+#if JUNO_CRC_SLICE > 1
+#include "crc/castagnoli_slice.h"
+#endif
+
+// @{"req": ["REQ-CRC-001", "REQ-CRC-002", "REQ-CRC-003", "REQ-CRC-015"]}
+uint32_t Juno_CrcCastagnoliUpdate(uint32_t iCrc, const void *pcData, size_t zDataSize)
+{
+    if(!(pcData && zDataSize))
+    {
+        return 0;
+    }
+    register uint32_t crc = iCrc;
+    register const uint8_t *cp = pcData;
+    register size_t cnt = zDataSize;
+
+#if JUNO_CRC_HW
+    if(cnt >= JUNO_CRC_HW_MIN && gpfcnJunoCrcCastagnoliHw)
+    {
+        // The kernel takes whole blocks; the tables finish the tail
+        size_t zBulk = cnt - cnt % JUNO_CRC_HW_BLOCK;
+        crc = gpfcnJunoCrcCastagnoliHw(crc, cp, zBulk);
+        cp += zBulk;
+        cnt -= zBulk;
+    }
+#endif
+
+#if JUNO_CRC_SLICE > 1
+    // Consume JUNO_CRC_SLICE bytes per step; the low CRC byte meets the first data byte
+    for(; cnt >= JUNO_CRC_SLICE; cnt -= JUNO_CRC_SLICE, cp += JUNO_CRC_SLICE) {
+        crc = castagnoli_crctab_slice[JUNO_CRC_SLICE - 1][(crc ^ cp[0]) & 0xff] ^
+            castagnoli_crctab_slice[JUNO_CRC_SLICE - 2][((crc >> 8) ^ cp[1]) & 0xff] ^
+            castagnoli_crctab_slice[JUNO_CRC_SLICE - 3][((crc >> 16) ^ cp[2]) & 0xff] ^
+            castagnoli_crctab_slice[JUNO_CRC_SLICE - 4][((crc >> 24) ^ cp[3]) & 0xff] ^
+            JUNO_CRC_SLICE_DATA32(castagnoli_crctab_slice, cp);
+    }
+#endif
+
+    while(cnt--) {
+	crc=((crc>>8)&M1_32)^castagnoli_crctab[(crc&0xff)^*cp++];
+    }
+
+    return(crc ^ 0xFFFFFFFF);
+}
@@ -17,6 +17,10 @@
 #include "juno/crc/crc.h"
 #include <stdint.h>
 #include "crc/ccitt.h"
+#include "crc/slice.h"
+#if JUNO_CRC_SLICE > 1
+#include "crc/ccitt_slice.h"
+#endif
 
 // @{"req": ["REQ-CRC-001", "REQ-CRC-002", "REQ-CRC-003", "REQ-CRC-006"]}
 uint16_t Juno_CrcCcittUpdate(uint16_t iCrc, const void *pcData, size_t zDataSize)
@@ -29,6 +33,15 @@ uint16_t Juno_CrcCcittUpdate(uint16_t iCrc, const void *pcData, size_t zDataSize
     register const uint8_t *cp = pcData;
     register size_t cnt = zDataSize;
 
+#if JUNO_CRC_SLICE > 1
+    // Consume JUNO_CRC_SLICE bytes per step; the high CRC byte meets the first data byte
+    for(; cnt >= JUNO_CRC_SLICE; cnt -= JUNO_CRC_SLICE, cp += JUNO_CRC_SLICE) {
+        crc = ccitt_crctab_slice[JUNO_CRC_SLICE - 1][((crc >> 8) ^ cp[0]) & 0xff] ^
+            ccitt_crctab_slice[JUNO_CRC_SLICE - 2][(crc ^ cp[1]) & 0xff] ^
+            JUNO_CRC_SLICE_DATA16(ccitt_crctab_slice, cp);
+    }
+#endif
+
     while(cnt--) {
 	crc=((crc<<8)&M2_16)^ccitt_crctab[((crc>>8)&0xff)^*cp++];
     }
@@ -0,0 +1,58 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+#include "juno/crc/crc.h"
+#include "crc/crc64.h"
+#include "crc/slice.h"
+#if JUNO_CRC_SLICE > 1
+#include "crc/crc64_slice.h"
+#endif
+
+// @{"req": ["REQ-CRC-001", "REQ-CRC-002", "REQ-CRC-003", "REQ-CRC-016"]}
+uint64_t Juno_CrcCrc64Update(uint64_t iCrc, const void *pcData, size_t zDataSize)
+{
+    if(!(pcData && zDataSize))
+    {
+        return 0;
+    }
+    register uint64_t crc = iCrc;
+    register const uint8_t *cp = pcData;
+    register size_t cnt = zDataSize;
+
+#if JUNO_CRC_SLICE > 1
+    // Consume JUNO_CRC_SLICE bytes per step; every data byte meets a CRC byte
+    for(; cnt >= JUNO_CRC_SLICE; cnt -= JUNO_CRC_SLICE, cp += JUNO_CRC_SLICE) {
+        crc = crc64_crctab_slice[JUNO_CRC_SLICE - 1][(crc ^ cp[0]) & 0xff] ^
+            crc64_crctab_slice[JUNO_CRC_SLICE - 2][((crc >> 8) ^ cp[1]) & 0xff] ^
+            crc64_crctab_slice[JUNO_CRC_SLICE - 3][((crc >> 16) ^ cp[2]) & 0xff] ^
+            crc64_crctab_slice[JUNO_CRC_SLICE - 4][((crc >> 24) ^ cp[3]) & 0xff] ^
+#if JUNO_CRC_SLICE == 8
+            crc64_crctab_slice[3][((crc >> 32) ^ cp[4]) & 0xff] ^
+            crc64_crctab_slice[2][((crc >> 40) ^ cp[5]) & 0xff] ^
+            crc64_crctab_slice[1][((crc >> 48) ^ cp[6]) & 0xff] ^
+            crc64_crctab_slice[0][((crc >> 56) ^ cp[7]) & 0xff];
+#else
+            (crc >> 32);
+#endif
+    }
+#endif
+
+    while(cnt--) {
+	crc=(crc>>8)^crc64_crctab[(crc&0xff)^*cp++];
+    }
+
+    return(crc ^ 0xFFFFFFFFFFFFFFFFull);
+}
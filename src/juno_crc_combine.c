@@ -0,0 +1,147 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/crc/crc.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Polynomial arithmetic description of a CRC variant
+typedef struct JUNO_CRC_POLY_TAG
+{
+    /// Generator polynomial without the x^width term, in register bit order
+    uint64_t iPoly;
+    /// Highest register bit (1 << (width - 1))
+    uint64_t iTop;
+    /// Register is LSB-first (bit width-1-i holds x^i) instead of MSB-first
+    bool bReflected;
+    /// Seed XOR final XOR of the variant, removed from the leading CRC
+    uint64_t iAdjust;
+} JUNO_CRC_POLY_T;
+
+static const JUNO_CRC_POLY_T gtArcPoly = {0xA001u, 0x8000u, true, 0x0000u};
+static const JUNO_CRC_POLY_T gtBinhexPoly = {0x1021u, 0x8000u, false, 0x0000u};
+static const JUNO_CRC_POLY_T gtCcittPoly = {0x1021u, 0x8000u, false, 0xFFFFu};
+static const JUNO_CRC_POLY_T gtCcitt32Poly = {0x04C11DB7u, 0x80000000u, false, 0xFFFFFFFFu};
+static const JUNO_CRC_POLY_T gtKermitPoly = {0x8408u, 0x8000u, true, 0x0000u};
+static const JUNO_CRC_POLY_T gtZipPoly = {0xEDB88320u, 0x80000000u, true, 0x00000000u};
+static const JUNO_CRC_POLY_T gtCastagnoliPoly = {0x82F63B78u, 0x80000000u, true, 0x00000000u};
+static const JUNO_CRC_POLY_T gtCrc64Poly = {0xC96C5795D7870F42ull, 0x8000000000000000ull, true, 0x0000000000000000ull};
+
+/// Multiply a register polynomial by x modulo the generator
+static inline uint64_t MulX(const JUNO_CRC_POLY_T *ptPoly, uint64_t iValue)
+{
+    if(ptPoly->bReflected)
+    {
+        return (iValue & 1u) ? ((iValue >> 1) ^ ptPoly->iPoly) : (iValue >> 1);
+    }
+    uint64_t iMask = ptPoly->iTop | (ptPoly->iTop - 1u);
+    return (iValue & ptPoly->iTop) ? (((iValue << 1) & iMask) ^ ptPoly->iPoly) : ((iValue << 1) & iMask);
+}
+
+/// Multiply two register polynomials modulo the generator
+static uint64_t MulMod(const JUNO_CRC_POLY_T *ptPoly, uint64_t iLeft, uint64_t iRight)
+{
+    uint64_t iMask = ptPoly->iTop | (ptPoly->iTop - 1u);
+    uint64_t iProduct = 0;
+    // Walk the coefficients of iRight from x^0 upwards, keeping iLeft * x^i
+    for(uint64_t iBit = ptPoly->bReflected ? ptPoly->iTop : 1u; iBit;
+        iBit = ptPoly->bReflected ? (iBit >> 1) : ((iBit << 1) & iMask))
+    {
+        if(iRight & iBit)
+        {
+            iProduct ^= iLeft;
+        }
+        iLeft = MulX(ptPoly, iLeft);
+    }
+    return iProduct;
+}
+
+/// Compute x^(8 * zBytes) modulo the generator by square and multiply
+static uint64_t XPowBytes(const JUNO_CRC_POLY_T *ptPoly, size_t zBytes)
+{
+    uint64_t iResult = ptPoly->bReflected ? ptPoly->iTop : 1u;
+    uint64_t iSquare = ptPoly->bReflected ? (ptPoly->iTop >> 8) : (1u << 8);
+    for(; zBytes; zBytes >>= 1)
+    {
+        if(zBytes & 1u)
+        {
+            iResult = MulMod(ptPoly, iResult, iSquare);
+        }
+        iSquare = MulMod(ptPoly, iSquare, iSquare);
+    }
+    return iResult;
+}
+
+/// Shift the leading CRC over zLengthB zero bytes and add the trailing CRC
+static inline uint64_t Combine(const JUNO_CRC_POLY_T *ptPoly, uint64_t iCrcA, uint64_t iCrcB, size_t zLengthB)
+{
+    if(!zLengthB)
+    {
+        return iCrcA;
+    }
+    // CRC(A || B) = (CRC(A) ^ seed ^ xorout) * x^(8 len B) + CRC(B) mod P
+    return MulMod(ptPoly, iCrcA ^ ptPoly->iAdjust, XPowBytes(ptPoly, zLengthB)) ^ iCrcB;
+}
+
+// @{"req": ["REQ-CRC-013"]}
+uint16_t Juno_CrcArcCombine(uint16_t iCrcA, uint16_t iCrcB, size_t zLengthB)
+{
+    return (uint16_t)Combine(&gtArcPoly, iCrcA, iCrcB, zLengthB);
+}
+
+// @{"req": ["REQ-CRC-013"]}
+uint16_t Juno_CrcBinhexCombine(uint16_t iCrcA, uint16_t iCrcB, size_t zLengthB)
+{
+    return (uint16_t)Combine(&gtBinhexPoly, iCrcA, iCrcB, zLengthB);
+}
+
+// @{"req": ["REQ-CRC-013"]}
+uint16_t Juno_CrcCcittCombine(uint16_t iCrcA, uint16_t iCrcB, size_t zLengthB)
+{
+    return (uint16_t)Combine(&gtCcittPoly, iCrcA, iCrcB, zLengthB);
+}
+
+// @{"req": ["REQ-CRC-013"]}
+uint32_t Juno_CrcCcitt32Combine(uint32_t iCrcA, uint32_t iCrcB, size_t zLengthB)
+{
+    return (uint32_t)Combine(&gtCcitt32Poly, iCrcA, iCrcB, zLengthB);
+}
+
+// @{"req": ["REQ-CRC-013"]}
+uint16_t Juno_CrcKermitCombine(uint16_t iCrcA, uint16_t iCrcB, size_t zLengthB)
+{
+    return (uint16_t)Combine(&gtKermitPoly, iCrcA, iCrcB, zLengthB);
+}
+
+// @{"req": ["REQ-CRC-013"]}
+uint32_t Juno_CrcZipCombine(uint32_t iCrcA, uint32_t iCrcB, size_t zLengthB)
+{
+    return (uint32_t)Combine(&gtZipPoly, iCrcA, iCrcB, zLengthB);
+}
+
+// @{"req": ["REQ-CRC-013", "REQ-CRC-015"]}
+uint32_t Juno_CrcCastagnoliCombine(uint32_t iCrcA, uint32_t iCrcB, size_t zLengthB)
+{
+    return (uint32_t)Combine(&gtCastagnoliPoly, iCrcA, iCrcB, zLengthB);
+}
+
+// @{"req": ["REQ-CRC-013", "REQ-CRC-016"]}
+uint64_t Juno_CrcCrc64Combine(uint64_t iCrcA, uint64_t iCrcB, size_t zLengthB)
+{
+    return Combine(&gtCrc64Poly, iCrcA, iCrcB, zLengthB);
+}
@@ -0,0 +1,253 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+#include "juno/crc/crc.h"
+#include "crc/hw.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if JUNO_CRC_HW
+JUNO_CRC_HW_KERNEL_T gpfcnJunoCrcZipHw = NULL;
+JUNO_CRC_HW_KERNEL_T gpfcnJunoCrcCcitt32Hw = NULL;
+JUNO_CRC_HW_KERNEL_T gpfcnJunoCrcCastagnoliHw = NULL;
+#endif
+
+#if JUNO_CRC_HW && defined(__x86_64__)
+#include <cpuid.h>
+#include <immintrin.h>
+
+#define JUNO_CRC_HW_X86_TARGET __attribute__((target("pclmul,ssse3")))
+
+/// Carry-less product of two 64-bit values, returning the low 64 bits
+JUNO_CRC_HW_X86_TARGET static inline uint64_t ClmulLo(uint64_t iLeft, uint64_t iRight)
+{
+    __m128i tProduct = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)iLeft), _mm_cvtsi64_si128((long long)iRight), 0x00);
+    return (uint64_t)_mm_cvtsi128_si64(tProduct);
+}
+
+/// Fold four 128-bit lanes forward by 512 bits (or one lane by 128 bits)
+JUNO_CRC_HW_X86_TARGET static inline __m128i Fold(__m128i tLane, __m128i tConstants, __m128i tNext)
+{
+    __m128i tLow = _mm_clmulepi64_si128(tLane, tConstants, 0x00);
+    __m128i tHigh = _mm_clmulepi64_si128(tLane, tConstants, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(tLow, tHigh), tNext);
+}
+
+/// Reflected CRC-32 (ZIP, polynomial 0xEDB88320) by PCLMULQDQ folding
+JUNO_CRC_HW_X86_TARGET static uint32_t CrcZipPclmul(uint32_t iCrc, const uint8_t *pcData, size_t zDataSize)
+{
+    // Reflected fold constants: x^(D+32) and x^(D-32) mod P, bit-reflected
+    const __m128i tFold4 = _mm_set_epi64x(0x01c6e41596ll, 0x0154442bd4ll);
+    const __m128i tFold1 = _mm_set_epi64x(0x00ccaa009ell, 0x01751997d0ll);
+    const __m128i tFold64 = _mm_set_epi64x(0, 0x0163cd6124ll);
+    const __m128i tBarrett = _mm_set_epi64x(0x01f7011641ll, 0x01db710641ll);
+    const __m128i tMask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i tX1 = _mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x00));
+    __m128i tX2 = _mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x10));
+    __m128i tX3 = _mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x20));
+    __m128i tX4 = _mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x30));
+    tX1 = _mm_xor_si128(tX1, _mm_cvtsi32_si128((int)iCrc));
+    pcData += 64;
+    zDataSize -= 64;
+    for(; zDataSize >= 64; zDataSize -= 64, pcData += 64)
+    {
+        tX1 = Fold(tX1, tFold4, _mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x00)));
+        tX2 = Fold(tX2, tFold4, _mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x10)));
+        tX3 = Fold(tX3, tFold4, _mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x20)));
+        tX4 = Fold(tX4, tFold4, _mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x30)));
+    }
+    // Fold the four lanes into one, then any remaining 16 byte blocks
+    tX1 = Fold(tX1, tFold1, tX2);
+    tX1 = Fold(tX1, tFold1, tX3);
+    tX1 = Fold(tX1, tFold1, tX4);
+    for(; zDataSize >= 16; zDataSize -= 16, pcData += 16)
+    {
+        tX1 = Fold(tX1, tFold1, _mm_loadu_si128((const __m128i *)(const void *)pcData));
+    }
+    // 128 to 64 bits
+    __m128i tPartial = _mm_clmulepi64_si128(tX1, tFold1, 0x10);
+    tX1 = _mm_xor_si128(_mm_srli_si128(tX1, 8), tPartial);
+    // 64 to 32 bits
+    tPartial = _mm_srli_si128(tX1, 4);
+    tX1 = _mm_clmulepi64_si128(_mm_and_si128(tX1, tMask32), tFold64, 0x00);
+    tX1 = _mm_xor_si128(tX1, tPartial);
+    // Barrett reduction to the 32-bit remainder
+    tPartial = _mm_clmulepi64_si128(_mm_and_si128(tX1, tMask32), tBarrett, 0x10);
+    tPartial = _mm_clmulepi64_si128(_mm_and_si128(tPartial, tMask32), tBarrett, 0x00);
+    tX1 = _mm_xor_si128(tX1, tPartial);
+    return (uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(tX1, 4));
+}
+
+/// MSB-first CRC-32 (CCITT32, polynomial 0x04C11DB7) by PCLMULQDQ folding
+JUNO_CRC_HW_X86_TARGET static uint32_t CrcCcitt32Pclmul(uint32_t iCrc, const uint8_t *pcData, size_t zDataSize)
+{
+    // Fold constants: lane 1 is x^(D+64) mod P, lane 0 is x^D mod P
+    const __m128i tFold4 = _mm_set_epi64x(0x8833794cll, 0xe6228b11ll);
+    const __m128i tFold1 = _mm_set_epi64x(0xc5b9cd4cll, 0xe8a45605ll);
+    const uint64_t iX96 = 0xf200aa66u;
+    const uint64_t iX64 = 0x490d678du;
+    const uint64_t iMu = 0x104d101dfull;
+    const uint64_t iPoly = 0x104c11db7ull;
+    // Byte reversal puts the first byte of each block in the top bits
+    const __m128i tSwap = _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    __m128i tX1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x00)), tSwap);
+    __m128i tX2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x10)), tSwap);
+    __m128i tX3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x20)), tSwap);
+    __m128i tX4 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x30)), tSwap);
+    tX1 = _mm_xor_si128(tX1, _mm_slli_si128(_mm_cvtsi32_si128((int)iCrc), 12));
+    pcData += 64;
+    zDataSize -= 64;
+    for(; zDataSize >= 64; zDataSize -= 64, pcData += 64)
+    {
+        tX1 = Fold(tX1, tFold4, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x00)), tSwap));
+        tX2 = Fold(tX2, tFold4, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x10)), tSwap));
+        tX3 = Fold(tX3, tFold4, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x20)), tSwap));
+        tX4 = Fold(tX4, tFold4, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)(pcData + 0x30)), tSwap));
+    }
+    tX1 = Fold(tX1, tFold1, tX2);
+    tX1 = Fold(tX1, tFold1, tX3);
+    tX1 = Fold(tX1, tFold1, tX4);
+    for(; zDataSize >= 16; zDataSize -= 16, pcData += 16)
+    {
+        tX1 = Fold(tX1, tFold1, _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(const void *)pcData), tSwap));
+    }
+    // CRC = (H * x^64 + L) * x^32 mod P, with H and L the 64-bit halves
+    uint64_t iLow = (uint64_t)_mm_cvtsi128_si64(tX1);
+    uint64_t iHigh = (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(tX1, tX1));
+    __m128i tProduct = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)iHigh), _mm_cvtsi64_si128((long long)iX96), 0x00);
+    uint64_t iTop = (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(tProduct, tProduct)) ^ (iLow >> 32);
+    uint64_t iRem = (uint64_t)_mm_cvtsi128_si64(tProduct) ^ (iLow << 32);
+    iRem ^= ClmulLo(iTop, iX64);
+    // Barrett reduction of the 64-bit remainder
+    uint64_t iQuotient = ClmulLo(iRem >> 32, iMu) >> 32;
+    return (uint32_t)(iRem ^ ClmulLo(iQuotient, iPoly));
+}
+
+/// Reflected CRC-32C (Castagnoli) with the SSE4.2 crc32 instruction
+__attribute__((target("sse4.2"))) static uint32_t CrcCastagnoliSse42(uint32_t iCrc, const uint8_t *pcData, size_t zDataSize)
+{
+    uint64_t iCrc64 = iCrc;
+    for(; zDataSize >= 8; zDataSize -= 8, pcData += 8)
+    {
+        uint64_t iWord = (uint64_t)_mm_cvtsi128_si64(_mm_loadl_epi64((const __m128i *)(const void *)pcData));
+        iCrc64 = _mm_crc32_u64(iCrc64, iWord);
+    }
+    iCrc = (uint32_t)iCrc64;
+    for(; zDataSize; zDataSize--)
+    {
+        iCrc = _mm_crc32_u8(iCrc, *pcData++);
+    }
+    return iCrc;
+}
+
+/// Select the x86-64 kernels the CPU supports
+static inline void SelectKernels(void)
+{
+    unsigned int iEax = 0;
+    unsigned int iEbx = 0;
+    unsigned int iEcx = 0;
+    unsigned int iEdx = 0;
+    if(!__get_cpuid(1, &iEax, &iEbx, &iEcx, &iEdx))
+    {
+        return;
+    }
+    if((iEcx & bit_PCLMUL) && (iEcx & bit_SSSE3))
+    {
+        gpfcnJunoCrcZipHw = CrcZipPclmul;
+        gpfcnJunoCrcCcitt32Hw = CrcCcitt32Pclmul;
+    }
+    if(iEcx & bit_SSE4_2)
+    {
+        gpfcnJunoCrcCastagnoliHw = CrcCastagnoliSse42;
+    }
+}
+#elif JUNO_CRC_HW && defined(__aarch64__)
+#include <arm_acle.h>
+#include <sys/auxv.h>
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+
+/// Load 8 little-endian bytes
+static inline uint64_t LoadLe64(const uint8_t *pcData)
+{
+    return (uint64_t)pcData[0] |
+        ((uint64_t)pcData[1] << 8) |
+        ((uint64_t)pcData[2] << 16) |
+        ((uint64_t)pcData[3] << 24) |
+        ((uint64_t)pcData[4] << 32) |
+        ((uint64_t)pcData[5] << 40) |
+        ((uint64_t)pcData[6] << 48) |
+        ((uint64_t)pcData[7] << 56);
+}
+
+/// Reflected CRC-32 (ZIP) with the ARMv8 CRC32 instructions
+__attribute__((target("+crc"))) static uint32_t CrcZipArmv8(uint32_t iCrc, const uint8_t *pcData, size_t zDataSize)
+{
+    for(; zDataSize >= 8; zDataSize -= 8, pcData += 8)
+    {
+        iCrc = __crc32d(iCrc, LoadLe64(pcData));
+    }
+    for(; zDataSize; zDataSize--)
+    {
+        iCrc = __crc32b(iCrc, *pcData++);
+    }
+    return iCrc;
+}
+
+/// Reflected CRC-32C (Castagnoli) with the ARMv8 CRC32C instructions
+__attribute__((target("+crc"))) static uint32_t CrcCastagnoliArmv8(uint32_t iCrc, const uint8_t *pcData, size_t zDataSize)
+{
+    for(; zDataSize >= 8; zDataSize -= 8, pcData += 8)
+    {
+        iCrc = __crc32cd(iCrc, LoadLe64(pcData));
+    }
+    for(; zDataSize; zDataSize--)
+    {
+        iCrc = __crc32cb(iCrc, *pcData++);
+    }
+    return iCrc;
+}
+
+/// Select the aarch64 kernels when the CPU reports the CRC32 extension
+static inline void SelectKernels(void)
+{
+    if(getauxval(AT_HWCAP) & HWCAP_CRC32)
+    {
+        gpfcnJunoCrcZipHw = CrcZipArmv8;
+        gpfcnJunoCrcCastagnoliHw = CrcCastagnoliArmv8;
+    }
+}
+#endif
+
+// @{"req": ["REQ-CRC-012", "REQ-CRC-015"]}
+bool Juno_CrcHwInit(bool bEnable)
+{
+#if JUNO_CRC_HW
+    gpfcnJunoCrcZipHw = NULL;
+    gpfcnJunoCrcCcitt32Hw = NULL;
+    gpfcnJunoCrcCastagnoliHw = NULL;
+    if(bEnable)
+    {
+        SelectKernels();
+    }
+    return gpfcnJunoCrcZipHw || gpfcnJunoCrcCcitt32Hw || gpfcnJunoCrcCastagnoliHw;
+#else
+    (void)bEnable;
+    return false;
+#endif
+}
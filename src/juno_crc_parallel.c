@@ -0,0 +1,106 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "crc/kind.h"
+#include "juno/crc/crc_parallel.h"
+#include "juno/crc/crc.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/// Chunks other than the last are a multiple of this many bytes
+#define JUNO_CRC_PARALLEL_ALIGN (64u)
+
+// @{"req": ["REQ-CRC-014"]}
+void Juno_CrcJobRun(JUNO_CRC_JOB_T *ptJob)
+{
+    if(!ptJob)
+    {
+        return;
+    }
+    ptJob->iCrc = KindUpdate(ptJob->tKind, ptJob->iCrc, ptJob->pcData, ptJob->zDataSize);
+}
+
+// @{"req": ["REQ-CRC-014"]}
+JUNO_RESULT_UINT64_T Juno_CrcParallel(
+    JUNO_CRC_KIND_T tKind,
+    uint64_t iCrc,
+    const void *pcData,
+    size_t zDataSize,
+    JUNO_CRC_JOB_T *ptJobs,
+    size_t zJobs,
+    JUNO_CRC_EXECUTOR_T pfcnExecutor,
+    JUNO_USER_DATA_T *pvUserData
+)
+{
+    JUNO_RESULT_UINT64_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    if(!KindValid(tKind))
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR;
+        return tResult;
+    }
+    if(!(pcData && zDataSize))
+    {
+        // Same as the update functions: no data, no update
+        return tResult;
+    }
+    if(!(ptJobs && pfcnExecutor))
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    if(!zJobs)
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        return tResult;
+    }
+    size_t zChunk = zDataSize / zJobs;
+    if(zChunk >= JUNO_CRC_PARALLEL_ALIGN)
+    {
+        zChunk -= zChunk % JUNO_CRC_PARALLEL_ALIGN;
+    }
+    else
+    {
+        // Fewer, aligned chunks instead of empty or tiny ones
+        zChunk = JUNO_CRC_PARALLEL_ALIGN;
+    }
+    const uint8_t *pcChunk = pcData;
+    size_t zRemaining = zDataSize;
+    size_t zUsed = 0;
+    for(; zUsed < zJobs && zRemaining; zUsed++)
+    {
+        size_t zSize = (zUsed + 1 == zJobs || zRemaining < zChunk) ? zRemaining : zChunk;
+        ptJobs[zUsed].tKind = tKind;
+        ptJobs[zUsed].iCrc = zUsed ? KindInit(tKind) : iCrc;
+        ptJobs[zUsed].pcData = pcChunk;
+        ptJobs[zUsed].zDataSize = zSize;
+        pcChunk += zSize;
+        zRemaining -= zSize;
+    }
+    tResult.tStatus = pfcnExecutor(ptJobs, zUsed, pvUserData);
+    if(tResult.tStatus != JUNO_STATUS_SUCCESS)
+    {
+        return tResult;
+    }
+    tResult.tOk = ptJobs[0].iCrc;
+    for(size_t i = 1; i < zUsed; i++)
+    {
+        tResult.tOk = KindCombine(tKind, tResult.tOk, ptJobs[i].iCrc, ptJobs[i].zDataSize);
+    }
+    return tResult;
+}
@@ -0,0 +1,87 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "crc/kind.h"
+#include "juno/crc/crc_stream.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+// @{"req": ["REQ-CRC-018"]}
+JUNO_STATUS_T Juno_CrcStreamInit(JUNO_CRC_STREAM_T *ptStream, JUNO_CRC_KIND_T tKind)
+{
+    if(!ptStream)
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    if(!KindValid(tKind))
+    {
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    ptStream->tKind = tKind;
+    ptStream->iCrc = KindInit(tKind);
+    ptStream->iLength = 0;
+    return JUNO_STATUS_SUCCESS;
+}
+
+// @{"req": ["REQ-CRC-018"]}
+JUNO_STATUS_T Juno_CrcStreamUpdate(JUNO_CRC_STREAM_T *ptStream, const void *pcData, size_t zDataSize)
+{
+    if(!ptStream)
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    if(!KindValid(ptStream->tKind))
+    {
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    if(!zDataSize)
+    {
+        // The update functions return 0 for empty input, which is not a register
+        return JUNO_STATUS_SUCCESS;
+    }
+    if(!pcData)
+    {
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    uint64_t iCrc = KindUpdate(ptStream->tKind, ptStream->iCrc, pcData, zDataSize);
+    ptStream->iCrc = iCrc ^ KindXorOut(ptStream->tKind);
+    ptStream->iLength += zDataSize;
+    return JUNO_STATUS_SUCCESS;
+}
+
+// @{"req": ["REQ-CRC-018"]}
+JUNO_RESULT_UINT64_T Juno_CrcStreamFinal(const JUNO_CRC_STREAM_T *ptStream)
+{
+    JUNO_RESULT_UINT64_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    if(!ptStream)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    if(!KindValid(ptStream->tKind))
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR;
+        return tResult;
+    }
+    if(ptStream->iLength)
+    {
+        tResult.tOk = ptStream->iCrc ^ KindXorOut(ptStream->tKind);
+    }
+    return tResult;
+}
@@ -37,50 +37,45 @@ JUNO_STATUS_T JunoDs_Heap_Init(JUNO_DS_HEAP_ROOT_T *ptHeap, const JUNO_DS_HEAP_P
     ptHeap->ptHeapPointerApi = ptHeapPointerApi;
     ptHeap->ptHeapArray = ptHeapArray;
     ptHeap->zLength = 0;
+    ptHeap->zArity = JUNO_DS_HEAP_ARITY_DEFAULT;
     ptHeap->_pfcnFailureHandler = pfcnFailureHdlr;
     ptHeap->_pvFailureUserData = pvUserData;
     return JunoDs_Heap_Verify(ptHeap);
 }
 
-/**
- * @brief Compute the left child index of iIndex.
- *
- * @return A result wrapping an optional index:
- *  - tStatus = SUCCESS and bIsSome = true when the left child is within current length.
- *  - tStatus = SUCCESS and bIsSome = false when the left child would be beyond zLength.
- *  - tStatus = ERR when the computed index would exceed zCapacity.
- */
-static inline JUNO_DS_HEAP_INDEX_RESULT_T JunoDs_Heap_ChildGetLeft(JUNO_DS_HEAP_ROOT_T *ptHeap, size_t iIndex)
+// @{"req": ["REQ-HEAP-015"]}
+JUNO_STATUS_T JunoDs_Heap_SetArity(JUNO_DS_HEAP_ROOT_T *ptHeap, size_t zArity)
 {
-    JUNO_DS_HEAP_INDEX_RESULT_T tResult = {0};
-    tResult.tStatus = JunoDs_Heap_Verify(ptHeap);
-    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
-    // Calculate the left index
-    iIndex = 2 * iIndex + 1;
-    // Check if the index is out of bounds or if the length exceeds capacity
-    if(iIndex > ptHeap->ptHeapArray->zCapacity || ptHeap->zLength > ptHeap->ptHeapArray->zCapacity)
+    JUNO_STATUS_T tStatus = JunoDs_Heap_Verify(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(!JunoDs_Heap_ArityValid(zArity))
     {
-        tResult.tStatus = JUNO_STATUS_OOB_ERROR;
-        return tResult;
+        tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptHeap, "Heap arity must be 2, 4 or 8");
+        return tStatus;
     }
-    tResult.tStatus = JUNO_STATUS_SUCCESS;
-    tResult.tOk= iIndex;
-    return tResult;
+    ptHeap->zArity = zArity;
+    return tStatus;
 }
 
 /**
- * @brief Compute the right child index of iIndex.
- * @copydetails JunoDs_Heap_ChildGetLeft
+ * @brief Compute the first child index of iIndex.
+ *
+ * The children of iIndex are the zArity consecutive indices starting there.
+ *
+ * @return A result wrapping the index:
+ *  - tStatus = SUCCESS; callers compare the index with zLength.
+ *  - tStatus = OOB when zLength exceeds zCapacity.
  */
-static inline JUNO_DS_HEAP_INDEX_RESULT_T JunoDs_Heap_ChildGetRight(JUNO_DS_HEAP_ROOT_T *ptHeap, size_t iIndex)
+static inline JUNO_DS_HEAP_INDEX_RESULT_T JunoDs_Heap_ChildGetFirst(JUNO_DS_HEAP_ROOT_T *ptHeap, size_t iIndex)
 {
-    JUNO_DS_HEAP_INDEX_RESULT_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    JUNO_DS_HEAP_INDEX_RESULT_T tResult = {0};
     tResult.tStatus = JunoDs_Heap_Verify(ptHeap);
     JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
-    // Calculate the right child
-    iIndex = 2 * iIndex + 2;
-    // Check if this index is beyond the capacity or if the length is beyond the capacity
-    if(iIndex > ptHeap->ptHeapArray->zCapacity || ptHeap->zLength > ptHeap->ptHeapArray->zCapacity)
+    // Calculate the first child index
+    iIndex = (iIndex << JunoDs_Heap_ArityShift(ptHeap)) + 1;
+    // Check if the length exceeds capacity; callers compare the index with zLength
+    if(ptHeap->zLength > ptHeap->ptHeapArray->zCapacity)
     {
         tResult.tStatus = JUNO_STATUS_OOB_ERROR;
         return tResult;
@@ -92,7 +87,7 @@ static inline JUNO_DS_HEAP_INDEX_RESULT_T JunoDs_Heap_ChildGetRight(JUNO_DS_HEAP
 
 /**
  * @brief Compute the parent index of iIndex.
- * @copydetails JunoDs_Heap_ChildGetLeft
+ * @copydetails JunoDs_Heap_ChildGetFirst
  */
 static inline JUNO_DS_HEAP_INDEX_RESULT_T JunoDs_Heap_ChildGetParent(JUNO_DS_HEAP_ROOT_T *ptHeap, size_t iIndex)
 {
@@ -100,7 +95,7 @@ static inline JUNO_DS_HEAP_INDEX_RESULT_T JunoDs_Heap_ChildGetParent(JUNO_DS_HEA
     tResult.tStatus = JunoDs_Heap_Verify(ptHeap);
     JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
     // calculate the parent
-    iIndex = (iIndex - 1)/2;
+    iIndex = (iIndex - 1) >> JunoDs_Heap_ArityShift(ptHeap);
     // Check if the index is OOB
     if(iIndex > ptHeap->ptHeapArray->zCapacity || ptHeap->zLength > ptHeap->ptHeapArray->zCapacity)
     {
@@ -181,49 +176,27 @@ JUNO_STATUS_T JunoDs_Heap_SiftDown(JUNO_DS_HEAP_ROOT_T *ptHeap, size_t iStart)
     for(size_t i = 0; i < ptHeap->zLength; ++i)
     {
         iCurrentIndex = iRoot;
-        JUNO_DS_HEAP_COMPARE_RESULT_T tCompareResult = {0};
-        JUNO_DS_HEAP_INDEX_RESULT_T tIndexResult = JunoDs_Heap_ChildGetLeft(ptHeap, iCurrentIndex);
+        JUNO_DS_HEAP_INDEX_RESULT_T tIndexResult = JunoDs_Heap_ChildGetFirst(ptHeap, iCurrentIndex);
         JUNO_ASSERT_SUCCESS(tIndexResult.tStatus, return tIndexResult.tStatus);
-        size_t iLeft = 0;
-        bool bLeftSome = JUNO_OK(tIndexResult) < ptHeap->zLength;
-        if(bLeftSome)
+        size_t iFirst = tIndexResult.tOk;
+        size_t iEnd = iFirst + ptHeap->zArity;
+        if(iEnd > ptHeap->zLength)
         {
-            iLeft = tIndexResult.tOk;
+            iEnd = ptHeap->zLength;
         }
-        tIndexResult = JunoDs_Heap_ChildGetRight(ptHeap, iCurrentIndex);
-        JUNO_ASSERT_SUCCESS(tIndexResult.tStatus, return tIndexResult.tStatus);
-        size_t iRight = 0;
-        bool bRightSome = tIndexResult.tOk < ptHeap->zLength;
         JUNO_RESULT_POINTER_T tResultCurrent = ptArrayApi->GetAt(ptArray, iCurrentIndex);
         JUNO_ASSERT_OK(tResultCurrent, return tResultCurrent.tStatus);
-        if(bRightSome)
-        {
-            iRight = tIndexResult.tOk;
-        }
-        if(bLeftSome)
-        {
-            tResultCurrent = ptArrayApi->GetAt(ptArray, iCurrentIndex);
-            JUNO_ASSERT_OK(tResultCurrent, return tResultCurrent.tStatus);
-            JUNO_RESULT_POINTER_T tResultLeft = ptArrayApi->GetAt(ptArray, iLeft);
-            JUNO_ASSERT_OK(tResultLeft, return tResultLeft.tStatus);
-            tCompareResult = ptHeap->ptHeapPointerApi->Compare(ptHeap, JUNO_OK(tResultCurrent), JUNO_OK(tResultLeft));
-            JUNO_ASSERT_SUCCESS(tCompareResult.tStatus, return tCompareResult.tStatus);
-            if(!tCompareResult.tOk)
-            {
-                iCurrentIndex = iLeft;
-            }
-        }
-        if(bRightSome)
+        // Track the child that belongs highest, starting from the root itself
+        for(size_t iChild = iFirst; iChild < iEnd; ++iChild)
         {
-            tResultCurrent = ptArrayApi->GetAt(ptArray, iCurrentIndex);
-            JUNO_ASSERT_OK(tResultCurrent, return tResultCurrent.tStatus);
-            JUNO_RESULT_POINTER_T tResultRight = ptArrayApi->GetAt(ptArray, iRight);
-            JUNO_ASSERT_OK(tResultRight, return tResultRight.tStatus);
-            tCompareResult = ptHeap->ptHeapPointerApi->Compare(ptHeap, JUNO_OK(tResultCurrent), JUNO_OK(tResultRight));
+            JUNO_RESULT_POINTER_T tResultChild = ptArrayApi->GetAt(ptArray, iChild);
+            JUNO_ASSERT_OK(tResultChild, return tResultChild.tStatus);
+            JUNO_DS_HEAP_COMPARE_RESULT_T tCompareResult = ptHeap->ptHeapPointerApi->Compare(ptHeap, JUNO_OK(tResultCurrent), JUNO_OK(tResultChild));
             JUNO_ASSERT_SUCCESS(tCompareResult.tStatus, return tCompareResult.tStatus);
             if(!tCompareResult.tOk)
             {
-                iCurrentIndex = iRight;
+                iCurrentIndex = iChild;
+                tResultCurrent = tResultChild;
             }
         }
         if(iCurrentIndex != iRoot)
@@ -267,7 +240,7 @@ JUNO_STATUS_T JunoDs_Heap_Insert(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tVa
     }
     tStatus = JunoMemory_PointerVerify(tValue);
     JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
-    tStatus = ptHeap->ptHeapArray->ptApi->SetAt(ptHeap->ptHeapArray, tValue, ptHeap->zLength);
+    tStatus = JunoDs_ArrayStore(ptHeap->ptHeapArray, tValue, ptHeap->zLength);
     ptHeap->zLength += 1;
     tStatus = JunoDs_Heap_Update(ptHeap);
     return tStatus;
@@ -345,7 +318,7 @@ JUNO_STATUS_T JunoDs_Heap_Pop(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tRetur
     JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
     tStatus = JunoMemory_PointerVerify(tReturn);
     JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
-    tStatus = tReturn.ptApi->Copy(tReturn, JUNO_OK(tEnd));
+    tStatus = JunoMemory_PointerCopy(tReturn, JUNO_OK(tEnd));
     JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
     tStatus = ptArrayApi->RemoveAt(ptArray, ptHeap->zLength - 1);
     JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
@@ -0,0 +1,337 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/ds/heap_fast.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/heap_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/status.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Insert by moving the hole up from the end
+static JUNO_STATUS_T Insert(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tValue);
+/// Heapify with hole-based sift down
+static JUNO_STATUS_T Heapify(JUNO_DS_HEAP_ROOT_T *ptHeap);
+/// Pop the root and move the hole down from the root
+static JUNO_STATUS_T Pop(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tReturn);
+
+static const JUNO_DS_HEAP_API_T gtHeapFastApi =
+{
+    Insert,
+    Heapify,
+    Pop
+};
+
+/// Read a key of type TYPE_T at zOffset bytes into the element
+#define JUNO_DS_HEAP_FAST_KEY(TYPE_T, tPointer, zOffset) \
+    (*(const TYPE_T *)((const uint8_t *)(tPointer).pvAddr + (zOffset)))
+
+/// Compare two keys of type TYPE_T in heap order
+#define JUNO_DS_HEAP_FAST_KEY_HOLDS(TYPE_T, ptHeap, tParent, tChild) \
+    ((ptHeap)->bMinHeap ? \
+        JUNO_DS_HEAP_FAST_KEY(TYPE_T, tParent, (ptHeap)->zKeyOffset) <= JUNO_DS_HEAP_FAST_KEY(TYPE_T, tChild, (ptHeap)->zKeyOffset) : \
+        JUNO_DS_HEAP_FAST_KEY(TYPE_T, tParent, (ptHeap)->zKeyOffset) >= JUNO_DS_HEAP_FAST_KEY(TYPE_T, tChild, (ptHeap)->zKeyOffset))
+
+static inline JUNO_STATUS_T Verify(JUNO_DS_HEAP_ROOT_T *ptHeap)
+{
+    JUNO_STATUS_T tStatus = JunoDs_Heap_Verify(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    const JUNO_DS_HEAP_FAST_T *ptFast = (const JUNO_DS_HEAP_FAST_T *)(ptHeap);
+    JUNO_ASSERT_EXISTS_MODULE(
+        ptFast->tElement.ptApi &&
+        ptFast->tElement.pvAddr &&
+        ptFast->tScratch.pvAddr,
+        ptFast,
+        "Module does not have all dependencies"
+    );
+    if(ptHeap->ptApi != &gtHeapFastApi)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptFast, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    if(ptHeap->zLength > ptHeap->ptHeapArray->zCapacity)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_OOB_ERROR, ptFast, "Heap length exceeds capacity");
+        return JUNO_STATUS_OOB_ERROR;
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// True when tPointer describes an element of the heap's type
+static inline bool IsElement(const JUNO_DS_HEAP_FAST_T *ptHeap, JUNO_POINTER_T tPointer)
+{
+    return tPointer.ptApi == ptHeap->tElement.ptApi &&
+        tPointer.zSize == ptHeap->tElement.zSize &&
+        tPointer.zAlignment == ptHeap->tElement.zAlignment;
+}
+
+/// Descriptor of slot iIndex
+static inline JUNO_POINTER_T Slot(const JUNO_DS_HEAP_FAST_T *ptHeap, size_t iIndex)
+{
+    JUNO_POINTER_T tSlot = ptHeap->tElement;
+    tSlot.pvAddr = (uint8_t *)ptHeap->tElement.pvAddr + iIndex * ptHeap->tElement.zSize;
+    return tSlot;
+}
+
+/// True when the heap property holds for (tParent, tChild)
+static inline JUNO_DS_HEAP_COMPARE_RESULT_T Holds(JUNO_DS_HEAP_FAST_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild)
+{
+    JUNO_DS_HEAP_COMPARE_RESULT_T tResult = {JUNO_STATUS_SUCCESS, false};
+    switch(ptHeap->tKey)
+    {
+        case JUNO_DS_HEAP_KEY_U32:
+            tResult.tOk = JUNO_DS_HEAP_FAST_KEY_HOLDS(uint32_t, ptHeap, tParent, tChild);
+            return tResult;
+        case JUNO_DS_HEAP_KEY_U64:
+            tResult.tOk = JUNO_DS_HEAP_FAST_KEY_HOLDS(uint64_t, ptHeap, tParent, tChild);
+            return tResult;
+        case JUNO_DS_HEAP_KEY_I32:
+            tResult.tOk = JUNO_DS_HEAP_FAST_KEY_HOLDS(int32_t, ptHeap, tParent, tChild);
+            return tResult;
+        case JUNO_DS_HEAP_KEY_I64:
+            tResult.tOk = JUNO_DS_HEAP_FAST_KEY_HOLDS(int64_t, ptHeap, tParent, tChild);
+            return tResult;
+        case JUNO_DS_HEAP_KEY_NONE:
+        default:
+            return ptHeap->JUNO_MODULE_SUPER.ptHeapPointerApi->Compare(&ptHeap->JUNO_MODULE_SUPER, tParent, tChild);
+    }
+}
+
+/// Move the hole at iHole up until tValue can be written there
+static inline JUNO_STATUS_T SiftUp(JUNO_DS_HEAP_FAST_T *ptHeap, size_t iHole, JUNO_POINTER_T tValue)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    size_t zShift = JunoDs_Heap_ArityShift(&ptHeap->JUNO_MODULE_SUPER);
+    while(iHole > 0)
+    {
+        size_t iParent = (iHole - 1) >> zShift;
+        JUNO_POINTER_T tParent = Slot(ptHeap, iParent);
+        JUNO_DS_HEAP_COMPARE_RESULT_T tCompare = Holds(ptHeap, tParent, tValue);
+        JUNO_ASSERT_SUCCESS(tCompare.tStatus, return tCompare.tStatus);
+        if(tCompare.tOk)
+        {
+            break;
+        }
+        tStatus = JunoMemory_PointerCopy(Slot(ptHeap, iHole), tParent);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        iHole = iParent;
+    }
+    return JunoMemory_PointerCopy(Slot(ptHeap, iHole), tValue);
+}
+
+/// Move the hole at iHole down through the first zLength slots until tValue can be written there
+static inline JUNO_STATUS_T SiftDown(JUNO_DS_HEAP_FAST_T *ptHeap, size_t iHole, JUNO_POINTER_T tValue, size_t zLength)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    size_t zArity = ptHeap->JUNO_MODULE_SUPER.zArity;
+    size_t zShift = JunoDs_Heap_ArityShift(&ptHeap->JUNO_MODULE_SUPER);
+    for(size_t iChild = (iHole << zShift) + 1; iChild < zLength; iChild = (iHole << zShift) + 1)
+    {
+        // Siblings are adjacent; follow the one that belongs highest
+        JUNO_POINTER_T tChild = Slot(ptHeap, iChild);
+        size_t iEnd = zLength - iChild < zArity ? zLength : iChild + zArity;
+        for(size_t iSibling = iChild + 1; iSibling < iEnd; iSibling++)
+        {
+            JUNO_POINTER_T tSibling = Slot(ptHeap, iSibling);
+            JUNO_DS_HEAP_COMPARE_RESULT_T tCompare = Holds(ptHeap, tChild, tSibling);
+            JUNO_ASSERT_SUCCESS(tCompare.tStatus, return tCompare.tStatus);
+            if(!tCompare.tOk)
+            {
+                iChild = iSibling;
+                tChild = tSibling;
+            }
+        }
+        JUNO_DS_HEAP_COMPARE_RESULT_T tCompare = Holds(ptHeap, tValue, tChild);
+        JUNO_ASSERT_SUCCESS(tCompare.tStatus, return tCompare.tStatus);
+        if(tCompare.tOk)
+        {
+            break;
+        }
+        tStatus = JunoMemory_PointerCopy(Slot(ptHeap, iHole), tChild);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        iHole = iChild;
+    }
+    return JunoMemory_PointerCopy(Slot(ptHeap, iHole), tValue);
+}
+
+// @{"req": ["REQ-HEAP-009"]}
+JUNO_STATUS_T JunoDs_HeapFastInit(
+    JUNO_DS_HEAP_FAST_T *ptHeap,
+    const JUNO_DS_HEAP_POINTER_API_T *ptHeapPointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptHeapArray,
+    JUNO_POINTER_T tScratch,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptHeap);
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &ptHeap->JUNO_MODULE_SUPER;
+    ptRoot->ptApi = &gtHeapFastApi;
+    ptRoot->ptHeapPointerApi = ptHeapPointerApi;
+    ptRoot->ptHeapArray = ptHeapArray;
+    ptRoot->zLength = 0;
+    ptRoot->zArity = JUNO_DS_HEAP_ARITY_DEFAULT;
+    ptRoot->_pfcnFailureHandler = pfcnFailureHdlr;
+    ptRoot->_pvFailureUserData = pvUserData;
+    ptHeap->tElement = (JUNO_POINTER_T){0};
+    ptHeap->tScratch = tScratch;
+    ptHeap->tKey = JUNO_DS_HEAP_KEY_NONE;
+    ptHeap->zKeyOffset = 0;
+    ptHeap->bMinHeap = false;
+    JUNO_STATUS_T tStatus = JunoDs_Heap_Verify(ptRoot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_RESULT_POINTER_T tSlot = ptHeapArray->ptApi->GetAt(ptHeapArray, 0);
+    JUNO_ASSERT_OK(tSlot, return tSlot.tStatus);
+    tStatus = JunoMemory_PointerVerify(tSlot.tOk);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptHeap->tElement = tSlot.tOk;
+    // Every slot must sit where Slot() computes it
+    for(size_t i = 1; i < ptHeapArray->zCapacity; i++)
+    {
+        tSlot = ptHeapArray->ptApi->GetAt(ptHeapArray, i);
+        JUNO_ASSERT_OK(tSlot, return tSlot.tStatus);
+        if(!IsElement(ptHeap, tSlot.tOk) || tSlot.tOk.pvAddr != Slot(ptHeap, i).pvAddr)
+        {
+            JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptHeap, "Heap array is not contiguous");
+            return JUNO_STATUS_INVALID_TYPE_ERROR;
+        }
+    }
+    tStatus = JunoMemory_PointerVerify(tScratch);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(!IsElement(ptHeap, tScratch))
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptHeap, "Scratch is not a heap element");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    return Verify(ptRoot);
+}
+
+// @{"req": ["REQ-HEAP-010"]}
+JUNO_STATUS_T JunoDs_HeapFastSetKey(JUNO_DS_HEAP_FAST_T *ptHeap, JUNO_DS_HEAP_KEY_T tKey, size_t zKeyOffset, bool bMinHeap)
+{
+    JUNO_ASSERT_EXISTS(ptHeap);
+    JUNO_STATUS_T tStatus = Verify(&ptHeap->JUNO_MODULE_SUPER);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    size_t zKeySize = 0;
+    switch(tKey)
+    {
+        case JUNO_DS_HEAP_KEY_NONE:
+            break;
+        case JUNO_DS_HEAP_KEY_U32:
+        case JUNO_DS_HEAP_KEY_I32:
+            zKeySize = sizeof(uint32_t);
+            break;
+        case JUNO_DS_HEAP_KEY_U64:
+        case JUNO_DS_HEAP_KEY_I64:
+            zKeySize = sizeof(uint64_t);
+            break;
+        default:
+            JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptHeap, "Unknown heap key type");
+            return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    size_t zElementSize = ptHeap->tElement.zSize;
+    // The key must lie inside the element and be aligned in every slot
+    if(zKeySize && (
+        zKeyOffset > zElementSize ||
+        zElementSize - zKeyOffset < zKeySize ||
+        ((uintptr_t)ptHeap->tElement.pvAddr + zKeyOffset) % zKeySize ||
+        ((uintptr_t)ptHeap->tScratch.pvAddr + zKeyOffset) % zKeySize ||
+        zElementSize % zKeySize))
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_SIZE_ERROR, ptHeap, "Heap key does not fit the element");
+        return JUNO_STATUS_INVALID_SIZE_ERROR;
+    }
+    ptHeap->tKey = tKey;
+    ptHeap->zKeyOffset = zKeyOffset;
+    ptHeap->bMinHeap = bMinHeap;
+    return tStatus;
+}
+
+// @{"req": ["REQ-HEAP-003", "REQ-HEAP-009"]}
+static JUNO_STATUS_T Insert(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tValue)
+{
+    JUNO_STATUS_T tStatus = Verify(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_HEAP_FAST_T *ptFast = (JUNO_DS_HEAP_FAST_T *)(ptHeap);
+    if(ptHeap->zLength >= ptHeap->ptHeapArray->zCapacity)
+    {
+        return JUNO_STATUS_ERR;
+    }
+    tStatus = JunoMemory_PointerVerify(tValue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(!IsElement(ptFast, tValue))
+    {
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    tStatus = SiftUp(ptFast, ptHeap->zLength, tValue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptHeap->zLength += 1;
+    return tStatus;
+}
+
+// @{"req": ["REQ-HEAP-006", "REQ-HEAP-009"]}
+static JUNO_STATUS_T Heapify(JUNO_DS_HEAP_ROOT_T *ptHeap)
+{
+    JUNO_STATUS_T tStatus = Verify(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_HEAP_FAST_T *ptFast = (JUNO_DS_HEAP_FAST_T *)(ptHeap);
+    if(ptHeap->zLength == 0)
+    {
+        return JUNO_STATUS_ERR;
+    }
+    // Sift every parent, last parent first
+    for(size_t i = ptHeap->zLength / 2; i > 0; i--)
+    {
+        tStatus = JunoMemory_PointerCopy(ptFast->tScratch, Slot(ptFast, i - 1));
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        tStatus = SiftDown(ptFast, i - 1, ptFast->tScratch, ptHeap->zLength);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    return tStatus;
+}
+
+// @{"req": ["REQ-HEAP-004", "REQ-HEAP-005", "REQ-HEAP-009"]}
+static JUNO_STATUS_T Pop(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tReturn)
+{
+    JUNO_STATUS_T tStatus = Verify(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_HEAP_FAST_T *ptFast = (JUNO_DS_HEAP_FAST_T *)(ptHeap);
+    if(ptHeap->zLength == 0)
+    {
+        return JUNO_STATUS_ERR;
+    }
+    tStatus = JunoMemory_PointerVerify(tReturn);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoMemory_PointerCopy(tReturn, Slot(ptFast, 0));
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    size_t iLast = ptHeap->zLength - 1;
+    if(iLast > 0)
+    {
+        // The last element fills the hole left by the root; its own slot is
+        // outside the shortened heap and is not overwritten on the way down
+        tStatus = SiftDown(ptFast, 0, Slot(ptFast, iLast), iLast);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    tStatus = ptHeap->ptHeapArray->ptApi->RemoveAt(ptHeap->ptHeapArray, iLast);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptHeap->zLength = iLast;
+    return tStatus;
+}
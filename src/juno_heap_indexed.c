@@ -0,0 +1,434 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/ds/heap_indexed.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/heap_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/module.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// Queue a copy of tValue under the first free handle
+static JUNO_STATUS_T Insert(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tValue);
+/// Restore the order of the queued handles
+static JUNO_STATUS_T Heapify(JUNO_DS_HEAP_ROOT_T *ptHeap);
+/// Copy out the root element and free its handle
+static JUNO_STATUS_T Pop(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tReturn);
+
+static const JUNO_DS_HEAP_API_T gtHeapIndexedApi =
+{
+    Insert,
+    Heapify,
+    Pop
+};
+
+static inline JUNO_STATUS_T Verify(JUNO_DS_HEAP_ROOT_T *ptHeap)
+{
+    JUNO_STATUS_T tStatus = JunoDs_Heap_Verify(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    const JUNO_DS_HEAP_INDEXED_T *ptIndexed = (const JUNO_DS_HEAP_INDEXED_T *)(ptHeap);
+    JUNO_ASSERT_EXISTS_MODULE(
+        ptIndexed->tElement.ptApi &&
+        ptIndexed->tElement.pvAddr &&
+        ptIndexed->pzHeap &&
+        ptIndexed->pzPositions,
+        ptIndexed,
+        "Module does not have all dependencies"
+    );
+    if(ptHeap->ptApi != &gtHeapIndexedApi)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptIndexed, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    if(ptHeap->zLength > ptHeap->ptHeapArray->zCapacity)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_OOB_ERROR, ptIndexed, "Heap length exceeds capacity");
+        return JUNO_STATUS_OOB_ERROR;
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Verify the indexed heap behind a public entry point
+static inline JUNO_STATUS_T VerifyIndexed(JUNO_DS_HEAP_INDEXED_T *ptHeap)
+{
+    JUNO_ASSERT_EXISTS(ptHeap);
+    return Verify(&ptHeap->JUNO_MODULE_SUPER);
+}
+
+/// True when tPointer describes an element of the heap's type
+static inline bool IsElement(const JUNO_DS_HEAP_INDEXED_T *ptHeap, JUNO_POINTER_T tPointer)
+{
+    return tPointer.ptApi == ptHeap->tElement.ptApi &&
+        tPointer.zSize == ptHeap->tElement.zSize &&
+        tPointer.zAlignment == ptHeap->tElement.zAlignment;
+}
+
+/// Descriptor of the element of zHandle
+static inline JUNO_POINTER_T Element(const JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle)
+{
+    JUNO_POINTER_T tElement = ptHeap->tElement;
+    tElement.pvAddr = (uint8_t *)ptHeap->tElement.pvAddr + zHandle * ptHeap->tElement.zSize;
+    return tElement;
+}
+
+/// Put zHandle at iSlot of the handle array
+static inline void Place(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t iSlot, size_t zHandle)
+{
+    ptHeap->pzHeap[iSlot] = zHandle;
+    ptHeap->pzPositions[zHandle] = iSlot;
+}
+
+/// Fail unless zHandle addresses an element and is (or is not) queued
+static inline JUNO_STATUS_T CheckHandle(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle, bool bQueued)
+{
+    if(zHandle >= ptHeap->JUNO_MODULE_SUPER.ptHeapArray->zCapacity)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_OOB_ERROR, ptHeap, "Heap handle out of bounds");
+        return JUNO_STATUS_OOB_ERROR;
+    }
+    bool bIsQueued = ptHeap->pzPositions[zHandle] < ptHeap->JUNO_MODULE_SUPER.zLength;
+    if(bQueued && !bIsQueued)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_DNE_ERROR, ptHeap, "Heap handle is not queued");
+        return JUNO_STATUS_DNE_ERROR;
+    }
+    if(!bQueued && bIsQueued)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_REF_IN_USE_ERROR, ptHeap, "Heap handle is already queued");
+        return JUNO_STATUS_REF_IN_USE_ERROR;
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Fail unless tValue is an element of the heap's type
+static inline JUNO_STATUS_T CheckValue(JUNO_DS_HEAP_INDEXED_T *ptHeap, JUNO_POINTER_T tValue)
+{
+    JUNO_STATUS_T tStatus = JunoMemory_PointerVerify(tValue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(!IsElement(ptHeap, tValue))
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptHeap, "Value is not a heap element");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    return tStatus;
+}
+
+/// Move the handle at iSlot up until the heap property holds, returning its final slot
+static inline JUNO_DS_HEAP_INDEX_RESULT_T SiftUp(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t iSlot)
+{
+    JUNO_DS_HEAP_INDEX_RESULT_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &ptHeap->JUNO_MODULE_SUPER;
+    size_t zHandle = ptHeap->pzHeap[iSlot];
+    JUNO_POINTER_T tValue = Element(ptHeap, zHandle);
+    size_t zShift = JunoDs_Heap_ArityShift(ptRoot);
+    while(iSlot > 0)
+    {
+        size_t iParent = (iSlot - 1) >> zShift;
+        size_t zParent = ptHeap->pzHeap[iParent];
+        JUNO_DS_HEAP_COMPARE_RESULT_T tCompare = ptRoot->ptHeapPointerApi->Compare(ptRoot, Element(ptHeap, zParent), tValue);
+        tResult.tStatus = tCompare.tStatus;
+        if(tResult.tStatus != JUNO_STATUS_SUCCESS || tCompare.tOk)
+        {
+            break;
+        }
+        Place(ptHeap, iSlot, zParent);
+        iSlot = iParent;
+    }
+    // Handles only move once the comparison succeeded, so the arrays stay a permutation
+    Place(ptHeap, iSlot, zHandle);
+    tResult.tOk = iSlot;
+    return tResult;
+}
+
+/// Move the handle at iSlot down until the heap property holds
+static inline JUNO_STATUS_T SiftDown(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t iSlot)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &ptHeap->JUNO_MODULE_SUPER;
+    size_t zLength = ptRoot->zLength;
+    size_t zHandle = ptHeap->pzHeap[iSlot];
+    JUNO_POINTER_T tValue = Element(ptHeap, zHandle);
+    size_t zArity = ptRoot->zArity;
+    size_t zShift = JunoDs_Heap_ArityShift(ptRoot);
+    for(size_t iChild = (iSlot << zShift) + 1; iChild < zLength; iChild = (iSlot << zShift) + 1)
+    {
+        // Follow the sibling that belongs highest
+        size_t zChild = ptHeap->pzHeap[iChild];
+        size_t iEnd = zLength - iChild < zArity ? zLength : iChild + zArity;
+        for(size_t iSibling = iChild + 1; iSibling < iEnd; iSibling++)
+        {
+            size_t zSibling = ptHeap->pzHeap[iSibling];
+            JUNO_DS_HEAP_COMPARE_RESULT_T tCompare = ptRoot->ptHeapPointerApi->Compare(ptRoot, Element(ptHeap, zChild), Element(ptHeap, zSibling));
+            tStatus = tCompare.tStatus;
+            JUNO_ASSERT_SUCCESS(tStatus, break);
+            if(!tCompare.tOk)
+            {
+                iChild = iSibling;
+                zChild = zSibling;
+            }
+        }
+        JUNO_ASSERT_SUCCESS(tStatus, break);
+        JUNO_DS_HEAP_COMPARE_RESULT_T tCompare = ptRoot->ptHeapPointerApi->Compare(ptRoot, tValue, Element(ptHeap, zChild));
+        tStatus = tCompare.tStatus;
+        if(tStatus != JUNO_STATUS_SUCCESS || tCompare.tOk)
+        {
+            break;
+        }
+        Place(ptHeap, iSlot, zChild);
+        iSlot = iChild;
+    }
+    Place(ptHeap, iSlot, zHandle);
+    return tStatus;
+}
+
+/// Restore the heap property around iSlot after its element changed
+static inline JUNO_STATUS_T Restore(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t iSlot)
+{
+    JUNO_DS_HEAP_INDEX_RESULT_T tResult = SiftUp(ptHeap, iSlot);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult.tStatus);
+    if(tResult.tOk != iSlot)
+    {
+        return tResult.tStatus;
+    }
+    return SiftDown(ptHeap, iSlot);
+}
+
+/// Copy tValue into the free handle zHandle and queue it
+static inline JUNO_STATUS_T Enqueue(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle, JUNO_POINTER_T tValue)
+{
+    JUNO_STATUS_T tStatus = JunoMemory_PointerCopy(Element(ptHeap, zHandle), tValue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    // Trade places with the first free handle so the queued handles stay in front
+    size_t iEnd = ptHeap->JUNO_MODULE_SUPER.zLength;
+    Place(ptHeap, ptHeap->pzPositions[zHandle], ptHeap->pzHeap[iEnd]);
+    Place(ptHeap, iEnd, zHandle);
+    ptHeap->JUNO_MODULE_SUPER.zLength = iEnd + 1;
+    return SiftUp(ptHeap, iEnd).tStatus;
+}
+
+/// Free the queued handle zHandle
+static inline JUNO_STATUS_T Dequeue(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle)
+{
+    size_t iSlot = ptHeap->pzPositions[zHandle];
+    size_t iLast = ptHeap->JUNO_MODULE_SUPER.zLength - 1;
+    // The last queued handle fills the slot; zHandle becomes the first free one
+    Place(ptHeap, iSlot, ptHeap->pzHeap[iLast]);
+    Place(ptHeap, iLast, zHandle);
+    ptHeap->JUNO_MODULE_SUPER.zLength = iLast;
+    if(iSlot == iLast)
+    {
+        return JUNO_STATUS_SUCCESS;
+    }
+    return Restore(ptHeap, iSlot);
+}
+
+// @{"req": ["REQ-HEAP-011"]}
+JUNO_STATUS_T JunoDs_HeapIndexedInit(
+    JUNO_DS_HEAP_INDEXED_T *ptHeap,
+    const JUNO_DS_HEAP_POINTER_API_T *ptHeapPointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptHeapArray,
+    size_t *pzHeap,
+    size_t *pzPositions,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptHeap);
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &ptHeap->JUNO_MODULE_SUPER;
+    ptRoot->ptApi = &gtHeapIndexedApi;
+    ptRoot->ptHeapPointerApi = ptHeapPointerApi;
+    ptRoot->ptHeapArray = ptHeapArray;
+    ptRoot->zLength = 0;
+    ptRoot->zArity = JUNO_DS_HEAP_ARITY_DEFAULT;
+    ptRoot->_pfcnFailureHandler = pfcnFailureHdlr;
+    ptRoot->_pvFailureUserData = pvUserData;
+    ptHeap->tElement = (JUNO_POINTER_T){0};
+    ptHeap->pzHeap = pzHeap;
+    ptHeap->pzPositions = pzPositions;
+    JUNO_STATUS_T tStatus = JunoDs_Heap_Verify(ptRoot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_ASSERT_EXISTS_MODULE(pzHeap && pzPositions, ptHeap, "Module does not have all dependencies");
+    JUNO_RESULT_POINTER_T tSlot = ptHeapArray->ptApi->GetAt(ptHeapArray, 0);
+    JUNO_ASSERT_OK(tSlot, return tSlot.tStatus);
+    tStatus = JunoMemory_PointerVerify(tSlot.tOk);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptHeap->tElement = tSlot.tOk;
+    Place(ptHeap, 0, 0);
+    // Every slot must sit where Element() computes it; every handle starts free
+    for(size_t i = 1; i < ptHeapArray->zCapacity; i++)
+    {
+        tSlot = ptHeapArray->ptApi->GetAt(ptHeapArray, i);
+        JUNO_ASSERT_OK(tSlot, return tSlot.tStatus);
+        if(!IsElement(ptHeap, tSlot.tOk) || tSlot.tOk.pvAddr != Element(ptHeap, i).pvAddr)
+        {
+            JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptHeap, "Heap array is not contiguous");
+            return JUNO_STATUS_INVALID_TYPE_ERROR;
+        }
+        Place(ptHeap, i, i);
+    }
+    return Verify(ptRoot);
+}
+
+// @{"req": ["REQ-HEAP-012"]}
+JUNO_DS_HEAP_INDEX_RESULT_T JunoDs_HeapIndexedInsert(JUNO_DS_HEAP_INDEXED_T *ptHeap, JUNO_POINTER_T tValue)
+{
+    JUNO_DS_HEAP_INDEX_RESULT_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    tResult.tStatus = VerifyIndexed(ptHeap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(ptHeap->JUNO_MODULE_SUPER.zLength >= ptHeap->JUNO_MODULE_SUPER.ptHeapArray->zCapacity)
+    {
+        tResult.tStatus = JUNO_STATUS_ERR;
+        return tResult;
+    }
+    tResult.tStatus = CheckValue(ptHeap, tValue);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk = ptHeap->pzHeap[ptHeap->JUNO_MODULE_SUPER.zLength];
+    tResult.tStatus = Enqueue(ptHeap, tResult.tOk, tValue);
+    return tResult;
+}
+
+// @{"req": ["REQ-HEAP-012"]}
+JUNO_STATUS_T JunoDs_HeapIndexedInsertHandle(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle, JUNO_POINTER_T tValue)
+{
+    JUNO_STATUS_T tStatus = VerifyIndexed(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = CheckHandle(ptHeap, zHandle, false);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = CheckValue(ptHeap, tValue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return Enqueue(ptHeap, zHandle, tValue);
+}
+
+// @{"req": ["REQ-HEAP-013"]}
+JUNO_STATUS_T JunoDs_HeapIndexedUpdate(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle, JUNO_POINTER_T tValue)
+{
+    JUNO_STATUS_T tStatus = VerifyIndexed(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = CheckHandle(ptHeap, zHandle, true);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = CheckValue(ptHeap, tValue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoMemory_PointerCopy(Element(ptHeap, zHandle), tValue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return Restore(ptHeap, ptHeap->pzPositions[zHandle]);
+}
+
+// @{"req": ["REQ-HEAP-013"]}
+JUNO_STATUS_T JunoDs_HeapIndexedRemove(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle)
+{
+    JUNO_STATUS_T tStatus = VerifyIndexed(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = CheckHandle(ptHeap, zHandle, true);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return Dequeue(ptHeap, zHandle);
+}
+
+// @{"req": ["REQ-HEAP-014"]}
+JUNO_DS_HEAP_ENTRY_RESULT_T JunoDs_HeapIndexedPeek(JUNO_DS_HEAP_INDEXED_T *ptHeap)
+{
+    JUNO_DS_HEAP_ENTRY_RESULT_T tResult = {0};
+    tResult.tStatus = VerifyIndexed(ptHeap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(ptHeap->JUNO_MODULE_SUPER.zLength == 0)
+    {
+        tResult.tStatus = JUNO_STATUS_ERR;
+        return tResult;
+    }
+    tResult.tOk.zHandle = ptHeap->pzHeap[0];
+    tResult.tOk.tElement = Element(ptHeap, tResult.tOk.zHandle);
+    return tResult;
+}
+
+// @{"req": ["REQ-HEAP-014"]}
+JUNO_RESULT_POINTER_T JunoDs_HeapIndexedGet(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle)
+{
+    JUNO_RESULT_POINTER_T tResult = {0};
+    tResult.tStatus = VerifyIndexed(ptHeap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(zHandle >= ptHeap->JUNO_MODULE_SUPER.ptHeapArray->zCapacity)
+    {
+        tResult.tStatus = JUNO_STATUS_OOB_ERROR;
+        JUNO_FAIL_MODULE(tResult.tStatus, ptHeap, "Heap handle out of bounds");
+        return tResult;
+    }
+    tResult.tOk = Element(ptHeap, zHandle);
+    return tResult;
+}
+
+// @{"req": ["REQ-HEAP-014"]}
+JUNO_RESULT_BOOL_T JunoDs_HeapIndexedContains(JUNO_DS_HEAP_INDEXED_T *ptHeap, size_t zHandle)
+{
+    JUNO_RESULT_BOOL_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tStatus = VerifyIndexed(ptHeap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(zHandle >= ptHeap->JUNO_MODULE_SUPER.ptHeapArray->zCapacity)
+    {
+        tResult.tStatus = JUNO_STATUS_OOB_ERROR;
+        JUNO_FAIL_MODULE(tResult.tStatus, ptHeap, "Heap handle out of bounds");
+        return tResult;
+    }
+    tResult.tOk = ptHeap->pzPositions[zHandle] < ptHeap->JUNO_MODULE_SUPER.zLength;
+    return tResult;
+}
+
+// @{"req": ["REQ-HEAP-003", "REQ-HEAP-012"]}
+static JUNO_STATUS_T Insert(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tValue)
+{
+    return JunoDs_HeapIndexedInsert((JUNO_DS_HEAP_INDEXED_T *)(ptHeap), tValue).tStatus;
+}
+
+// @{"req": ["REQ-HEAP-006", "REQ-HEAP-011"]}
+static JUNO_STATUS_T Heapify(JUNO_DS_HEAP_ROOT_T *ptHeap)
+{
+    JUNO_STATUS_T tStatus = Verify(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_HEAP_INDEXED_T *ptIndexed = (JUNO_DS_HEAP_INDEXED_T *)(ptHeap);
+    if(ptHeap->zLength == 0)
+    {
+        return JUNO_STATUS_ERR;
+    }
+    // Sift every parent, last parent first
+    for(size_t i = ptHeap->zLength / 2; i > 0; i--)
+    {
+        tStatus = SiftDown(ptIndexed, i - 1);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    }
+    return tStatus;
+}
+
+// @{"req": ["REQ-HEAP-004", "REQ-HEAP-005", "REQ-HEAP-013"]}
+static JUNO_STATUS_T Pop(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tReturn)
+{
+    JUNO_STATUS_T tStatus = Verify(ptHeap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_HEAP_INDEXED_T *ptIndexed = (JUNO_DS_HEAP_INDEXED_T *)(ptHeap);
+    if(ptHeap->zLength == 0)
+    {
+        return JUNO_STATUS_ERR;
+    }
+    tStatus = JunoMemory_PointerVerify(tReturn);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    size_t zRoot = ptIndexed->pzHeap[0];
+    tStatus = JunoMemory_PointerCopy(tReturn, Element(ptIndexed, zRoot));
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return Dequeue(ptIndexed, zRoot);
+}
@@ -41,16 +41,23 @@ JUNO_STATUS_T JunoDs_MapInit(JUNO_MAP_ROOT_T *ptMapRoot, const JUNO_MAP_HASHABLE
     ptMapRoot->ptHashMap = ptArray;
     ptMapRoot->_pfcnFailureHandler = pfcnFailureHandler;
     ptMapRoot->_pvFailureUserData = pvUserData;
+    ptMapRoot->zEqualsCalls = 0;
     JUNO_STATUS_T tStatus = JunoDs_MapVerify(ptMapRoot);
     return tStatus;
 }
 
-static JUNO_RESULT_POINTER_T JunoDs_MapGetWithKey(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+/// Wrap a probe index into the table, masking when the capacity is a power of two
+static inline size_t MapWrap(size_t iIndex, size_t zCapacity, bool bPow2)
+{
+    return bPow2 ? (iIndex & (zCapacity - 1)) : (iIndex % zCapacity);
+}
+
+/// Find the slot holding the key or the first empty slot; the map must be verified
+static inline JUNO_RESULT_POINTER_T JunoDs_MapGetWithKey(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem, bool bPow2)
 {
     JUNO_RESULT_POINTER_T tResult = {0};
-    tResult.tStatus = JunoDs_MapVerify(ptJunoMap);
-    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
     tResult.tStatus = JunoMemory_PointerVerify(tItem);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
     const JUNO_MAP_HASHABLE_POINTER_API_T *ptPointerApi = ptJunoMap->ptHashablePointerApi;
     JUNO_RESULT_SIZE_T tHashResult = ptPointerApi->Hash(tItem);
     tResult.tStatus = tHashResult.tStatus;
@@ -66,7 +73,7 @@ static JUNO_RESULT_POINTER_T JunoDs_MapGetWithKey(JUNO_MAP_ROOT_T *ptJunoMap, JU
     // Iterate over the table
     for (size_t i = 0; i < zCapacity; i++)
     {
-        size_t zIndex = (iHash + i) % zCapacity;
+        size_t zIndex = MapWrap(iHash + i, zCapacity, bPow2);
         // Get a pointer to the current key
         JUNO_RESULT_POINTER_T tPtrResult = ptArrayApi->GetAt(ptHashMap, zIndex);
         tResult.tStatus = tPtrResult.tStatus;
@@ -89,7 +96,7 @@ static JUNO_RESULT_POINTER_T JunoDs_MapGetWithKey(JUNO_MAP_ROOT_T *ptJunoMap, JU
             tResult.tStatus = JUNO_STATUS_SUCCESS;
             break;
         }
-        tBoolResult = ptJunoMap->ptValuePointerApi->Equals(tItem, tPtrResult.tOk);
+        tBoolResult = JunoDs_MapEquals(ptJunoMap, tItem, tPtrResult.tOk);
         tResult.tStatus = tBoolResult.tStatus;
         JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
         bool bIsEqual = tBoolResult.tOk;
@@ -106,8 +113,7 @@ static JUNO_RESULT_POINTER_T JunoDs_MapGetWithKey(JUNO_MAP_ROOT_T *ptJunoMap, JU
     return tResult;
 }
 
-// @{"req": ["REQ-MAP-006", "REQ-MAP-007"]}
-JUNO_RESULT_POINTER_T JunoDs_MapGet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+static inline JUNO_RESULT_POINTER_T MapGet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem, bool bPow2)
 {
     JUNO_RESULT_POINTER_T tResult = {0};
     tResult.tStatus = JunoDs_MapVerify(ptJunoMap);
@@ -115,7 +121,7 @@ JUNO_RESULT_POINTER_T JunoDs_MapGet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T t
     tResult.tStatus = JunoMemory_PointerVerify(tItem);
     JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
     // Get the index for the key
-    tResult = JunoDs_MapGetWithKey(ptJunoMap, tItem);
+    tResult = JunoDs_MapGetWithKey(ptJunoMap, tItem, bPow2);
     JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
     // Check if the value at the index is empty
     JUNO_RESULT_BOOL_T tBoolResult = ptJunoMap->ptHashablePointerApi->IsValueNull(tResult.tOk);
@@ -132,15 +138,13 @@ JUNO_RESULT_POINTER_T JunoDs_MapGet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T t
     return tResult;
 }
 
-// @{"req": ["REQ-MAP-004", "REQ-MAP-005"]}
-JUNO_STATUS_T JunoDs_MapSet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+/// Write one entry; the map must be verified
+static inline JUNO_STATUS_T MapSetEntry(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem, bool bPow2)
 {
-    JUNO_STATUS_T tStatus = JunoDs_MapVerify(ptJunoMap);
-    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
-    tStatus = JunoMemory_PointerVerify(tItem);
+    JUNO_STATUS_T tStatus = JunoMemory_PointerVerify(tItem);
     JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
     // Get the index for the key
-    JUNO_RESULT_POINTER_T tItemResult = JunoDs_MapGetWithKey(ptJunoMap, tItem);
+    JUNO_RESULT_POINTER_T tItemResult = JunoDs_MapGetWithKey(ptJunoMap, tItem, bPow2);
     tStatus = tItemResult.tStatus;
     JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
     if(tItem.ptApi != tItemResult.tOk.ptApi)
@@ -149,17 +153,28 @@ JUNO_STATUS_T JunoDs_MapSet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
         JUNO_FAIL_ROOT(tStatus, ptJunoMap, "Invalid map type");
         return tStatus;
     }
-    tStatus = tItem.ptApi->Copy(tItemResult.tOk, tItem);
+    tStatus = JunoMemory_PointerCopyWith(tItem.ptApi, tItemResult.tOk, tItem);
+    if(tStatus != JUNO_STATUS_SUCCESS)
+    {
+        JUNO_FAIL_ROOT(tStatus, ptJunoMap, "Failed to copy map entry");
+    }
     return tStatus;
 }
 
-// @{"req": ["REQ-MAP-008"]}
-JUNO_STATUS_T JunoDs_MapRemove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+static inline JUNO_STATUS_T MapSet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem, bool bPow2)
+{
+    JUNO_STATUS_T tStatus = JunoDs_MapVerify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return MapSetEntry(ptJunoMap, tItem, bPow2);
+}
+
+static inline JUNO_STATUS_T MapRemove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem, bool bPow2)
 {
     JUNO_RESULT_POINTER_T tResult = {0};
     tResult.tStatus = JunoDs_MapVerify(ptJunoMap);
     JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult.tStatus);
     tResult.tStatus = JunoMemory_PointerVerify(tItem);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult.tStatus);
     const JUNO_MAP_HASHABLE_POINTER_API_T *ptPointerApi = ptJunoMap->ptHashablePointerApi;
     JUNO_RESULT_SIZE_T tHashResult = ptPointerApi->Hash(tItem);
     tResult.tStatus = tHashResult.tStatus;
@@ -175,7 +190,7 @@ JUNO_STATUS_T JunoDs_MapRemove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
     // Iterate over the table
     for (size_t i = 0; i < zCapacity; i++)
     {
-        size_t zIndex = (iHash + i) % zCapacity;
+        size_t zIndex = MapWrap(iHash + i, zCapacity, bPow2);
         JUNO_RESULT_POINTER_T tPtrResult = ptArrayApi->GetAt(ptHashMap, zIndex);
         tResult.tStatus = tPtrResult.tStatus;
         JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult.tStatus);
@@ -195,7 +210,7 @@ JUNO_STATUS_T JunoDs_MapRemove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
         {
             break;
         }
-        tBoolResult = ptJunoMap->ptValuePointerApi->Equals(tItem, tPtrResult.tOk);
+        tBoolResult = JunoDs_MapEquals(ptJunoMap, tItem, tPtrResult.tOk);
         tResult.tStatus = tBoolResult.tStatus;
         JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult.tStatus);
         bool bIsEqual = tBoolResult.tOk;
@@ -210,3 +225,201 @@ JUNO_STATUS_T JunoDs_MapRemove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
     // Return the status
     return tResult.tStatus;
 }
+
+// @{"req": ["REQ-MAP-006", "REQ-MAP-007"]}
+JUNO_RESULT_POINTER_T JunoDs_MapGet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    return MapGet(ptJunoMap, tItem, false);
+}
+
+// @{"req": ["REQ-MAP-004", "REQ-MAP-005"]}
+JUNO_STATUS_T JunoDs_MapSet(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    return MapSet(ptJunoMap, tItem, false);
+}
+
+// @{"req": ["REQ-MAP-008"]}
+JUNO_STATUS_T JunoDs_MapRemove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    return MapRemove(ptJunoMap, tItem, false);
+}
+
+// The power-of-two capacity is checked once by JunoDs_MapInitPow2
+// @{"req": ["REQ-MAP-006", "REQ-MAP-011"]}
+static JUNO_RESULT_POINTER_T MapGetPow2(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    return MapGet(ptJunoMap, tItem, true);
+}
+
+// @{"req": ["REQ-MAP-004", "REQ-MAP-011"]}
+static JUNO_STATUS_T MapSetPow2(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    return MapSet(ptJunoMap, tItem, true);
+}
+
+// @{"req": ["REQ-MAP-008", "REQ-MAP-011"]}
+static JUNO_STATUS_T MapRemovePow2(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    return MapRemove(ptJunoMap, tItem, true);
+}
+
+static const JUNO_MAP_API_T gtMapPow2Api =
+{
+    MapGetPow2,
+    MapSetPow2,
+    MapRemovePow2,
+};
+
+// @{"req": ["REQ-MAP-011"]}
+JUNO_STATUS_T JunoDs_MapInitPow2(JUNO_MAP_ROOT_T *ptMapRoot, const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi, const JUNO_VALUE_POINTER_API_T *ptValuePointerApi, JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_FAILURE_HANDLER_T pfcnFailureHandler, JUNO_USER_DATA_T *pvUserData)
+{
+    JUNO_STATUS_T tStatus = JunoDs_MapInit(ptMapRoot, ptHashablePointerApi, ptValuePointerApi, ptArray, pfcnFailureHandler, pvUserData);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    size_t zCapacity = ptArray->zCapacity;
+    if(zCapacity & (zCapacity - 1))
+    {
+        tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptMapRoot, "Map capacity must be a power of two");
+        return tStatus;
+    }
+    ptMapRoot->ptApi = &gtMapPow2Api;
+    return tStatus;
+}
+
+// @{"req": ["REQ-MAP-024"]}
+JUNO_RESULT_POINTER_T JunoDs_MapNext(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_MAP_CURSOR_T *ptCursor)
+{
+    JUNO_RESULT_POINTER_T tResult = {0};
+    tResult.tStatus = JunoDs_MapVerify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(!ptCursor)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptJunoMap, "Cursor is null");
+        return tResult;
+    }
+    JUNO_DS_ARRAY_ROOT_T *ptHashMap = ptJunoMap->ptHashMap;
+    for(; ptCursor->iSlot < ptHashMap->zCapacity; ptCursor->iSlot++)
+    {
+        tResult = ptHashMap->ptApi->GetAt(ptHashMap, ptCursor->iSlot);
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+        JUNO_RESULT_BOOL_T tBoolResult = ptJunoMap->ptHashablePointerApi->IsValueNull(tResult.tOk);
+        tResult.tStatus = tBoolResult.tStatus;
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+        if(!tBoolResult.tOk)
+        {
+            ptCursor->iSlot++;
+            return tResult;
+        }
+    }
+    // Every slot has been visited
+    tResult.tStatus = JUNO_STATUS_OOB_ERROR;
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-025"]}
+JUNO_RESULT_SIZE_T JunoDs_MapSetMany(JUNO_MAP_ROOT_T *ptJunoMap, const JUNO_POINTER_T *ptItems, size_t zItems)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    tResult.tStatus = JunoDs_MapVerify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(zItems && !ptItems)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptJunoMap, "Batch entries are null");
+        return tResult;
+    }
+    bool bPow2 = ptJunoMap->ptApi == &gtMapPow2Api;
+    bool bLinear = bPow2 || ptJunoMap->ptApi == &gtMapApi;
+    for(; tResult.tOk < zItems; tResult.tOk++)
+    {
+        // The linear map was verified above, other maps verify in Set
+        tResult.tStatus = bLinear ?
+            MapSetEntry(ptJunoMap, ptItems[tResult.tOk], bPow2) :
+            ptJunoMap->ptApi->Set(ptJunoMap, ptItems[tResult.tOk]);
+        // tOk holds the index of the failed entry
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    }
+    return tResult;
+}
+
+/// Distance of a slot's entry from hash % capacity; also exact for power-of-two maps
+// @{"req": ["REQ-MAP-026"]}
+static JUNO_MAP_PROBE_OPTION_RESULT_T MapProbeDistance(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot)
+{
+    JUNO_MAP_PROBE_OPTION_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {false, 0}};
+    JUNO_DS_ARRAY_ROOT_T *ptHashMap = ptJunoMap->ptHashMap;
+    JUNO_RESULT_POINTER_T tPtrResult = ptHashMap->ptApi->GetAt(ptHashMap, iSlot);
+    tResult.tStatus = tPtrResult.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_RESULT_BOOL_T tBoolResult = ptJunoMap->ptHashablePointerApi->IsValueNull(tPtrResult.tOk);
+    tResult.tStatus = tBoolResult.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(tBoolResult.tOk)
+    {
+        return tResult;
+    }
+    JUNO_RESULT_SIZE_T tHashResult = ptJunoMap->ptHashablePointerApi->Hash(tPtrResult.tOk);
+    tResult.tStatus = tHashResult.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    size_t zCapacity = ptHashMap->zCapacity;
+    tResult.tOk.bIsSome = true;
+    tResult.tOk.tSome = JunoDs_MapWrapDistance(iSlot, tHashResult.tOk % zCapacity, zCapacity);
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapStats(JUNO_MAP_ROOT_T *ptJunoMap)
+{
+    JUNO_MAP_STATS_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    tResult.tStatus = JunoDs_MapVerify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(ptJunoMap->ptApi != &gtMapApi && ptJunoMap->ptApi != &gtMapPow2Api)
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptJunoMap, "Map is not a linear-probing map");
+        return tResult;
+    }
+    return JunoDs_MapStatsScan(ptJunoMap, MapProbeDistance);
+}
+
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapStatsScan(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_MAP_PROBE_DISTANCE_T pfcnProbeDistance)
+{
+    JUNO_MAP_STATS_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    tResult.tStatus = JunoDs_MapVerify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(!pfcnProbeDistance)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptJunoMap, "No probe distance function");
+        return tResult;
+    }
+    JUNO_MAP_STATS_T *ptStats = &tResult.tOk;
+    size_t zCapacity = ptJunoMap->ptHashMap->zCapacity;
+    ptStats->zCapacity = zCapacity;
+    ptStats->zEqualsCalls = ptJunoMap->zEqualsCalls;
+    for(size_t i = 0; i < zCapacity; i++)
+    {
+        JUNO_MAP_PROBE_OPTION_RESULT_T tProbeResult = pfcnProbeDistance(ptJunoMap, i);
+        tResult.tStatus = tProbeResult.tStatus;
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+        if(!tProbeResult.tOk.bIsSome)
+        {
+            continue;
+        }
+        size_t zProbe = tProbeResult.tOk.tSome;
+        ptStats->zOccupied += 1;
+        ptStats->zTotalProbe += zProbe;
+        ptStats->zMaxProbe = zProbe > ptStats->zMaxProbe ? zProbe : ptStats->zMaxProbe;
+    }
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-026"]}
+JUNO_STATUS_T JunoDs_MapStatsReset(JUNO_MAP_ROOT_T *ptJunoMap)
+{
+    JUNO_ASSERT_EXISTS(ptJunoMap);
+    ptJunoMap->zEqualsCalls = 0;
+    return JUNO_STATUS_SUCCESS;
+}
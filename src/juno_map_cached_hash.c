@@ -0,0 +1,269 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/ds/map_cached_hash.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+/// Tag bit marking an occupied slot
+#define CACHED_HASH_OCCUPIED (~(~(size_t)0 >> 1))
+
+static JUNO_RESULT_POINTER_T CachedHash_Get(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T CachedHash_Set(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T CachedHash_Remove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+
+static const JUNO_MAP_API_T gtMapCachedHashApi =
+{
+    CachedHash_Get,
+    CachedHash_Set,
+    CachedHash_Remove,
+};
+
+/// Result of probing for a key
+typedef struct CACHED_HASH_PROBE_TAG
+{
+    /// The slot holding the key, or the first empty slot of the chain.
+    size_t iSlot;
+    /// The key's hash tag.
+    size_t zTag;
+    /// True when iSlot holds the key.
+    bool bFound;
+} CACHED_HASH_PROBE_T;
+
+JUNO_MODULE_RESULT(CACHED_HASH_PROBE_RESULT_T, CACHED_HASH_PROBE_T);
+
+static inline JUNO_STATUS_T Verify(JUNO_MAP_ROOT_T *ptJunoMap)
+{
+    JUNO_STATUS_T tStatus = JunoDs_MapVerify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_CACHED_HASH_T *ptMap = (JUNO_MAP_CACHED_HASH_T *)(ptJunoMap);
+    JUNO_ASSERT_EXISTS_MODULE(ptMap->pzHashes, ptMap, "Module does not have all dependencies");
+    if(ptJunoMap->ptApi != &gtMapCachedHashApi)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptMap, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    return tStatus;
+}
+
+static inline size_t NextSlot(size_t iSlot, size_t zCapacity)
+{
+    iSlot += 1;
+    return iSlot == zCapacity ? 0 : iSlot;
+}
+
+/// Home slot of an occupied tag
+static inline size_t HomeSlot(size_t zTag, size_t zCapacity)
+{
+    return (zTag & ~CACHED_HASH_OCCUPIED) % zCapacity;
+}
+
+/// Get a slot and check that it holds the key's pointer type
+static inline JUNO_RESULT_POINTER_T GetSlot(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot, const JUNO_POINTER_T tItem)
+{
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    JUNO_RESULT_POINTER_T tResult = ptArray->ptApi->GetAt(ptArray, iSlot);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(tResult.tOk.ptApi != tItem.ptApi)
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptJunoMap, "Invalid pointer type");
+    }
+    return tResult;
+}
+
+/// Probe for tItem, comparing keys only on a full tag match
+static inline CACHED_HASH_PROBE_RESULT_T Probe(JUNO_MAP_CACHED_HASH_T *ptMap, JUNO_POINTER_T tItem)
+{
+    CACHED_HASH_PROBE_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0, 0, false}};
+    JUNO_MAP_ROOT_T *ptJunoMap = &ptMap->tRoot;
+    tResult.tStatus = JunoMemory_PointerVerify(tItem);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_RESULT_SIZE_T tHashResult = ptJunoMap->ptHashablePointerApi->Hash(tItem);
+    tResult.tStatus = tHashResult.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    size_t zCapacity = ptJunoMap->ptHashMap->zCapacity;
+    CACHED_HASH_PROBE_T *ptProbe = &tResult.tOk;
+    ptProbe->zTag = tHashResult.tOk | CACHED_HASH_OCCUPIED;
+    ptProbe->iSlot = HomeSlot(ptProbe->zTag, zCapacity);
+    for(size_t i = 0; i < zCapacity; i++)
+    {
+        size_t zTag = ptMap->pzHashes[ptProbe->iSlot];
+        if(zTag == 0)
+        {
+            // End of the chain, the key is absent
+            return tResult;
+        }
+        if(zTag == ptProbe->zTag)
+        {
+            JUNO_RESULT_POINTER_T tSlot = GetSlot(ptJunoMap, ptProbe->iSlot, tItem);
+            tResult.tStatus = tSlot.tStatus;
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            JUNO_RESULT_BOOL_T tEquals = JunoDs_MapEquals(ptJunoMap, tItem, tSlot.tOk);
+            tResult.tStatus = tEquals.tStatus;
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            if(tEquals.tOk)
+            {
+                ptProbe->bFound = true;
+                return tResult;
+            }
+        }
+        ptProbe->iSlot = NextSlot(ptProbe->iSlot, zCapacity);
+    }
+    tResult.tStatus = JUNO_STATUS_TABLE_FULL_ERROR;
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-015"]}
+JUNO_STATUS_T JunoDs_MapCachedHashInit(
+    JUNO_MAP_CACHED_HASH_T *ptMap,
+    const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi,
+    const JUNO_VALUE_POINTER_API_T *ptValuePointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    size_t *pzHashes,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptMap);
+    JUNO_MAP_ROOT_T *ptRoot = &ptMap->tRoot;
+    ptRoot->ptApi = &gtMapCachedHashApi;
+    ptRoot->ptHashablePointerApi = ptHashablePointerApi;
+    ptRoot->ptValuePointerApi = ptValuePointerApi;
+    ptRoot->ptHashMap = ptArray;
+    ptRoot->_pfcnFailureHandler = pfcnFailureHandler;
+    ptRoot->_pvFailureUserData = pvUserData;
+    ptRoot->zEqualsCalls = 0;
+    ptMap->pzHashes = pzHashes;
+    JUNO_STATUS_T tStatus = Verify(ptRoot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(size_t i = 0; i < ptArray->zCapacity; i++)
+    {
+        pzHashes[i] = 0;
+    }
+    return tStatus;
+}
+
+// @{"req": ["REQ-MAP-016"]}
+static JUNO_RESULT_POINTER_T CachedHash_Get(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    tResult.tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    CACHED_HASH_PROBE_RESULT_T tProbe = Probe((JUNO_MAP_CACHED_HASH_T *)(ptJunoMap), tItem);
+    tResult.tStatus = tProbe.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(!tProbe.tOk.bFound)
+    {
+        tResult.tStatus = JUNO_STATUS_DNE_ERROR;
+        return tResult;
+    }
+    return GetSlot(ptJunoMap, tProbe.tOk.iSlot, tItem);
+}
+
+// @{"req": ["REQ-MAP-016"]}
+static JUNO_STATUS_T CachedHash_Set(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_CACHED_HASH_T *ptMap = (JUNO_MAP_CACHED_HASH_T *)(ptJunoMap);
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    CACHED_HASH_PROBE_RESULT_T tProbe = Probe(ptMap, tItem);
+    if(tProbe.tStatus == JUNO_STATUS_TABLE_FULL_ERROR)
+    {
+        JUNO_FAIL_ROOT(tProbe.tStatus, ptJunoMap, "Map is full");
+    }
+    JUNO_ASSERT_SUCCESS(tProbe.tStatus, return tProbe.tStatus);
+    tStatus = JunoDs_ArrayStore(ptArray, tItem, tProbe.tOk.iSlot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptMap->pzHashes[tProbe.tOk.iSlot] = tProbe.tOk.zTag;
+    return tStatus;
+}
+
+// @{"req": ["REQ-MAP-017"]}
+static JUNO_STATUS_T CachedHash_Remove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_CACHED_HASH_T *ptMap = (JUNO_MAP_CACHED_HASH_T *)(ptJunoMap);
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    size_t zCapacity = ptArray->zCapacity;
+    CACHED_HASH_PROBE_RESULT_T tProbe = Probe(ptMap, tItem);
+    if(tProbe.tStatus == JUNO_STATUS_TABLE_FULL_ERROR || (tProbe.tStatus == JUNO_STATUS_SUCCESS && !tProbe.tOk.bFound))
+    {
+        // Key not present
+        return JUNO_STATUS_SUCCESS;
+    }
+    JUNO_ASSERT_SUCCESS(tProbe.tStatus, return tProbe.tStatus);
+    // Backward shift: move every later chain entry whose home is not in
+    // (iHole, iNext] into the hole, using the cached hashes for the homes
+    size_t iHole = tProbe.tOk.iSlot;
+    ptMap->pzHashes[iHole] = 0;
+    for(size_t iNext = NextSlot(iHole, zCapacity); ptMap->pzHashes[iNext] != 0; iNext = NextSlot(iNext, zCapacity))
+    {
+        size_t iHome = HomeSlot(ptMap->pzHashes[iNext], zCapacity);
+        bool bReachable = iHole <= iNext ?
+            (iHole < iHome && iHome <= iNext) :
+            (iHole < iHome || iHome <= iNext);
+        if(bReachable)
+        {
+            // The entry cannot move before its home slot
+            continue;
+        }
+        JUNO_RESULT_POINTER_T tNext = ptArray->ptApi->GetAt(ptArray, iNext);
+        JUNO_ASSERT_SUCCESS(tNext.tStatus, return tNext.tStatus);
+        tStatus = JunoDs_ArrayStore(ptArray, tNext.tOk, iHole);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        ptMap->pzHashes[iHole] = ptMap->pzHashes[iNext];
+        ptMap->pzHashes[iNext] = 0;
+        iHole = iNext;
+    }
+    return ptArray->ptApi->RemoveAt(ptArray, iHole);
+}
+
+/// Distance of a slot's entry from the home slot of its stored tag
+static JUNO_MAP_PROBE_OPTION_RESULT_T CachedHash_ProbeDistance(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot)
+{
+    JUNO_MAP_PROBE_OPTION_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {false, 0}};
+    size_t zTag = ((JUNO_MAP_CACHED_HASH_T *)(ptJunoMap))->pzHashes[iSlot];
+    if(zTag != 0)
+    {
+        size_t zCapacity = ptJunoMap->ptHashMap->zCapacity;
+        tResult.tOk.bIsSome = true;
+        tResult.tOk.tSome = JunoDs_MapWrapDistance(iSlot, HomeSlot(zTag, zCapacity), zCapacity);
+    }
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapCachedHashStats(JUNO_MAP_CACHED_HASH_T *ptMap)
+{
+    JUNO_MAP_STATS_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    if(!ptMap)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    tResult.tStatus = Verify(&ptMap->tRoot);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    return JunoDs_MapStatsScan(&ptMap->tRoot, CachedHash_ProbeDistance);
+}
@@ -0,0 +1,232 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/ds/map_perfect.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+static JUNO_RESULT_POINTER_T Perfect_Get(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T Perfect_Set(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T Perfect_Remove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+
+static const JUNO_MAP_API_T gtMapPerfectApi =
+{
+    Perfect_Get,
+    Perfect_Set,
+    Perfect_Remove,
+};
+
+/// Result of looking up a key's slot
+typedef struct PERFECT_SLOT_TAG
+{
+    /// The key's slot when bMember is set.
+    size_t iSlot;
+    /// True when the key hash belongs to the generated set.
+    bool bMember;
+} PERFECT_SLOT_T;
+
+JUNO_MODULE_RESULT(PERFECT_SLOT_RESULT_T, PERFECT_SLOT_T);
+
+static inline JUNO_STATUS_T Verify(JUNO_MAP_ROOT_T *ptJunoMap)
+{
+    JUNO_STATUS_T tStatus = JunoDs_MapVerify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_PERFECT_T *ptMap = (JUNO_MAP_PERFECT_T *)(ptJunoMap);
+    JUNO_ASSERT_EXISTS_MODULE(
+        ptMap->ptTable &&
+        ptMap->ptTable->piDisplacements &&
+        ptMap->ptTable->pzKeys,
+        ptMap,
+        "Module does not have all dependencies"
+    );
+    if(ptJunoMap->ptApi != &gtMapPerfectApi)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptMap, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    return tStatus;
+}
+
+/// Hash the key and find its one candidate slot
+static inline PERFECT_SLOT_RESULT_T FindSlot(JUNO_MAP_PERFECT_T *ptMap, JUNO_POINTER_T tItem)
+{
+    PERFECT_SLOT_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0, false}};
+    tResult.tStatus = JunoMemory_PointerVerify(tItem);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_RESULT_SIZE_T tHashResult = ptMap->tRoot.ptHashablePointerApi->Hash(tItem);
+    tResult.tStatus = tHashResult.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk.iSlot = JunoDs_MapPerfectSlot(ptMap->ptTable, tHashResult.tOk);
+    tResult.tOk.bMember = ptMap->ptTable->pzKeys[tResult.tOk.iSlot] == tHashResult.tOk;
+    return tResult;
+}
+
+/// Get a slot and check that it holds the key's pointer type
+static inline JUNO_RESULT_POINTER_T GetSlot(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot, const JUNO_POINTER_T tItem)
+{
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    JUNO_RESULT_POINTER_T tResult = ptArray->ptApi->GetAt(ptArray, iSlot);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(tResult.tOk.ptApi != tItem.ptApi)
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptJunoMap, "Invalid pointer type");
+    }
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-022"]}
+JUNO_STATUS_T JunoDs_MapPerfectInit(
+    JUNO_MAP_PERFECT_T *ptMap,
+    const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi,
+    const JUNO_VALUE_POINTER_API_T *ptValuePointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    const JUNO_MAP_PERFECT_TABLE_T *ptTable,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptMap);
+    JUNO_MAP_ROOT_T *ptRoot = &ptMap->tRoot;
+    ptRoot->ptApi = &gtMapPerfectApi;
+    ptRoot->ptHashablePointerApi = ptHashablePointerApi;
+    ptRoot->ptValuePointerApi = ptValuePointerApi;
+    ptRoot->ptHashMap = ptArray;
+    ptRoot->_pfcnFailureHandler = pfcnFailureHandler;
+    ptRoot->_pvFailureUserData = pvUserData;
+    ptRoot->zEqualsCalls = 0;
+    ptMap->ptTable = ptTable;
+    JUNO_STATUS_T tStatus = Verify(ptRoot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(!ptTable->zBuckets || !ptTable->zKeys || ptArray->zCapacity < ptTable->zKeys)
+    {
+        tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        JUNO_FAIL_MODULE(tStatus, ptMap, "Array is smaller than the perfect-hash table");
+        return tStatus;
+    }
+    return tStatus;
+}
+
+/// Get the entry stored for a key in its slot, JUNO_STATUS_DNE_ERROR if it is absent
+static inline JUNO_RESULT_POINTER_T GetEntry(JUNO_MAP_ROOT_T *ptJunoMap, PERFECT_SLOT_T tSlot, JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    if(!tSlot.bMember)
+    {
+        tResult.tStatus = JUNO_STATUS_DNE_ERROR;
+        return tResult;
+    }
+    tResult = GetSlot(ptJunoMap, tSlot.iSlot, tItem);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_RESULT_BOOL_T tBool = ptJunoMap->ptHashablePointerApi->IsValueNull(tResult.tOk);
+    tResult.tStatus = tBool.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(!tBool.tOk)
+    {
+        tBool = JunoDs_MapEquals(ptJunoMap, tItem, tResult.tOk);
+        tResult.tStatus = tBool.tStatus;
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+        if(tBool.tOk)
+        {
+            return tResult;
+        }
+    }
+    // The slot is empty or holds a different key with the same hash
+    tResult.tStatus = JUNO_STATUS_DNE_ERROR;
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-023"]}
+static JUNO_RESULT_POINTER_T Perfect_Get(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    tResult.tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    PERFECT_SLOT_RESULT_T tSlot = FindSlot((JUNO_MAP_PERFECT_T *)(ptJunoMap), tItem);
+    tResult.tStatus = tSlot.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    return GetEntry(ptJunoMap, tSlot.tOk, tItem);
+}
+
+// @{"req": ["REQ-MAP-023"]}
+static JUNO_STATUS_T Perfect_Set(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    PERFECT_SLOT_RESULT_T tSlot = FindSlot((JUNO_MAP_PERFECT_T *)(ptJunoMap), tItem);
+    JUNO_ASSERT_SUCCESS(tSlot.tStatus, return tSlot.tStatus);
+    if(!tSlot.tOk.bMember)
+    {
+        tStatus = JUNO_STATUS_DNE_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptJunoMap, "Key is not in the perfect-hash key set");
+        return tStatus;
+    }
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    return JunoDs_ArrayStore(ptArray, tItem, tSlot.tOk.iSlot);
+}
+
+// @{"req": ["REQ-MAP-023"]}
+static JUNO_STATUS_T Perfect_Remove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    PERFECT_SLOT_RESULT_T tSlot = FindSlot((JUNO_MAP_PERFECT_T *)(ptJunoMap), tItem);
+    JUNO_ASSERT_SUCCESS(tSlot.tStatus, return tSlot.tStatus);
+    JUNO_RESULT_POINTER_T tEntry = GetEntry(ptJunoMap, tSlot.tOk, tItem);
+    if(tEntry.tStatus == JUNO_STATUS_DNE_ERROR)
+    {
+        // Key not present
+        return tStatus;
+    }
+    JUNO_ASSERT_SUCCESS(tEntry.tStatus, return tEntry.tStatus);
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    return ptArray->ptApi->RemoveAt(ptArray, tSlot.tOk.iSlot);
+}
+
+/// Every key has exactly one slot, so an occupied slot is always at distance 0
+static JUNO_MAP_PROBE_OPTION_RESULT_T Perfect_ProbeDistance(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot)
+{
+    JUNO_MAP_PROBE_OPTION_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {false, 0}};
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    JUNO_RESULT_POINTER_T tSlot = ptArray->ptApi->GetAt(ptArray, iSlot);
+    tResult.tStatus = tSlot.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_RESULT_BOOL_T tBool = ptJunoMap->ptHashablePointerApi->IsValueNull(tSlot.tOk);
+    tResult.tStatus = tBool.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk.bIsSome = !tBool.tOk;
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapPerfectStats(JUNO_MAP_PERFECT_T *ptMap)
+{
+    JUNO_MAP_STATS_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    if(!ptMap)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    tResult.tStatus = Verify(&ptMap->tRoot);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    return JunoDs_MapStatsScan(&ptMap->tRoot, Perfect_ProbeDistance);
+}
@@ -0,0 +1,294 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/ds/map_robin_hood.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+static JUNO_RESULT_POINTER_T RobinHood_Get(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T RobinHood_Set(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T RobinHood_Remove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+
+static const JUNO_MAP_API_T gtMapRobinHoodApi =
+{
+    RobinHood_Get,
+    RobinHood_Set,
+    RobinHood_Remove,
+};
+
+/// Result of probing for a key
+typedef struct ROBIN_HOOD_PROBE_TAG
+{
+    /// The slot holding the key, or where the key would be inserted.
+    size_t iSlot;
+    /// The key's probe distance + 1 at iSlot.
+    size_t zDistance;
+    /// True when iSlot holds the key.
+    bool bFound;
+} ROBIN_HOOD_PROBE_T;
+
+JUNO_MODULE_RESULT(ROBIN_HOOD_PROBE_RESULT_T, ROBIN_HOOD_PROBE_T);
+
+static inline JUNO_STATUS_T Verify(JUNO_MAP_ROOT_T *ptJunoMap)
+{
+    JUNO_STATUS_T tStatus = JunoDs_MapVerify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_ROBIN_HOOD_T *ptMap = (JUNO_MAP_ROBIN_HOOD_T *)(ptJunoMap);
+    JUNO_ASSERT_EXISTS_MODULE(ptMap->pzDistances, ptMap, "Module does not have all dependencies");
+    if(ptJunoMap->ptApi != &gtMapRobinHoodApi)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptMap, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    return tStatus;
+}
+
+static inline size_t NextSlot(size_t iSlot, size_t zCapacity)
+{
+    iSlot += 1;
+    return iSlot == zCapacity ? 0 : iSlot;
+}
+
+static inline size_t PrevSlot(size_t iSlot, size_t zCapacity)
+{
+    return iSlot == 0 ? zCapacity - 1 : iSlot - 1;
+}
+
+/// Get a slot and check that it holds the key's pointer type
+static inline JUNO_RESULT_POINTER_T GetSlot(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot, const JUNO_POINTER_T tItem)
+{
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    JUNO_RESULT_POINTER_T tResult = ptArray->ptApi->GetAt(ptArray, iSlot);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(tResult.tOk.ptApi != tItem.ptApi)
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptJunoMap, "Invalid pointer type");
+    }
+    return tResult;
+}
+
+/// Probe for tItem, stopping at the key or at the first resident closer to its home
+static inline ROBIN_HOOD_PROBE_RESULT_T Probe(JUNO_MAP_ROBIN_HOOD_T *ptMap, JUNO_POINTER_T tItem)
+{
+    ROBIN_HOOD_PROBE_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0, 1, false}};
+    JUNO_MAP_ROOT_T *ptJunoMap = &ptMap->tRoot;
+    tResult.tStatus = JunoMemory_PointerVerify(tItem);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_RESULT_SIZE_T tHashResult = ptJunoMap->ptHashablePointerApi->Hash(tItem);
+    tResult.tStatus = tHashResult.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    size_t zCapacity = ptJunoMap->ptHashMap->zCapacity;
+    ROBIN_HOOD_PROBE_T *ptProbe = &tResult.tOk;
+    ptProbe->iSlot = tHashResult.tOk % zCapacity;
+    for(; ptProbe->zDistance <= zCapacity; ptProbe->zDistance++)
+    {
+        size_t zResident = ptMap->pzDistances[ptProbe->iSlot];
+        if(zResident < ptProbe->zDistance)
+        {
+            // Empty, or a resident richer than the key: the key is absent
+            return tResult;
+        }
+        if(zResident == ptProbe->zDistance)
+        {
+            // Same home slot, compare the keys
+            JUNO_RESULT_POINTER_T tSlot = GetSlot(ptJunoMap, ptProbe->iSlot, tItem);
+            tResult.tStatus = tSlot.tStatus;
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            JUNO_RESULT_BOOL_T tEquals = JunoDs_MapEquals(ptJunoMap, tItem, tSlot.tOk);
+            tResult.tStatus = tEquals.tStatus;
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            if(tEquals.tOk)
+            {
+                ptProbe->bFound = true;
+                return tResult;
+            }
+        }
+        ptProbe->iSlot = NextSlot(ptProbe->iSlot, zCapacity);
+    }
+    // Every slot holds a poorer resident; only possible on a full table
+    tResult.tStatus = JUNO_STATUS_TABLE_FULL_ERROR;
+    return tResult;
+}
+
+/// Copy the entry at iSrc into iDest
+static inline JUNO_STATUS_T MoveSlot(JUNO_MAP_ROOT_T *ptJunoMap, size_t iDest, size_t iSrc)
+{
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    JUNO_RESULT_POINTER_T tSrc = ptArray->ptApi->GetAt(ptArray, iSrc);
+    JUNO_ASSERT_SUCCESS(tSrc.tStatus, return tSrc.tStatus);
+    return JunoDs_ArrayStore(ptArray, tSrc.tOk, iDest);
+}
+
+// @{"req": ["REQ-MAP-012"]}
+JUNO_STATUS_T JunoDs_MapRobinHoodInit(
+    JUNO_MAP_ROBIN_HOOD_T *ptMap,
+    const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi,
+    const JUNO_VALUE_POINTER_API_T *ptValuePointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    size_t *pzDistances,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptMap);
+    JUNO_MAP_ROOT_T *ptRoot = &ptMap->tRoot;
+    ptRoot->ptApi = &gtMapRobinHoodApi;
+    ptRoot->ptHashablePointerApi = ptHashablePointerApi;
+    ptRoot->ptValuePointerApi = ptValuePointerApi;
+    ptRoot->ptHashMap = ptArray;
+    ptRoot->_pfcnFailureHandler = pfcnFailureHandler;
+    ptRoot->_pvFailureUserData = pvUserData;
+    ptRoot->zEqualsCalls = 0;
+    ptMap->pzDistances = pzDistances;
+    ptMap->zLength = 0;
+    JUNO_STATUS_T tStatus = Verify(ptRoot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(size_t i = 0; i < ptArray->zCapacity; i++)
+    {
+        pzDistances[i] = 0;
+    }
+    return tStatus;
+}
+
+// @{"req": ["REQ-MAP-013"]}
+static JUNO_RESULT_POINTER_T RobinHood_Get(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    tResult.tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    ROBIN_HOOD_PROBE_RESULT_T tProbe = Probe((JUNO_MAP_ROBIN_HOOD_T *)(ptJunoMap), tItem);
+    tResult.tStatus = tProbe.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(!tProbe.tOk.bFound)
+    {
+        tResult.tStatus = JUNO_STATUS_DNE_ERROR;
+        return tResult;
+    }
+    return GetSlot(ptJunoMap, tProbe.tOk.iSlot, tItem);
+}
+
+// @{"req": ["REQ-MAP-013"]}
+static JUNO_STATUS_T RobinHood_Set(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_ROBIN_HOOD_T *ptMap = (JUNO_MAP_ROBIN_HOOD_T *)(ptJunoMap);
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    size_t zCapacity = ptArray->zCapacity;
+    ROBIN_HOOD_PROBE_RESULT_T tProbe = Probe(ptMap, tItem);
+    JUNO_ASSERT_SUCCESS(tProbe.tStatus, return tProbe.tStatus);
+    size_t iSlot = tProbe.tOk.iSlot;
+    if(tProbe.tOk.bFound)
+    {
+        // Overwrite the existing entry
+        return JunoDs_ArrayStore(ptArray, tItem, iSlot);
+    }
+    if(ptMap->zLength >= zCapacity)
+    {
+        tStatus = JUNO_STATUS_TABLE_FULL_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptJunoMap, "Map is full");
+        return tStatus;
+    }
+    // Shift the rest of the cluster forward by one slot, starting at its end.
+    // This is equivalent to the Robin Hood swap chain and keeps residents
+    // ordered by home slot.
+    size_t iEmpty = iSlot;
+    while(ptMap->pzDistances[iEmpty] != 0)
+    {
+        iEmpty = NextSlot(iEmpty, zCapacity);
+    }
+    while(iEmpty != iSlot)
+    {
+        size_t iPrev = PrevSlot(iEmpty, zCapacity);
+        tStatus = MoveSlot(ptJunoMap, iEmpty, iPrev);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        ptMap->pzDistances[iEmpty] = ptMap->pzDistances[iPrev] + 1;
+        iEmpty = iPrev;
+    }
+    tStatus = JunoDs_ArrayStore(ptArray, tItem, iSlot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptMap->pzDistances[iSlot] = tProbe.tOk.zDistance;
+    ptMap->zLength += 1;
+    return tStatus;
+}
+
+// @{"req": ["REQ-MAP-014"]}
+static JUNO_STATUS_T RobinHood_Remove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_ROBIN_HOOD_T *ptMap = (JUNO_MAP_ROBIN_HOOD_T *)(ptJunoMap);
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    size_t zCapacity = ptArray->zCapacity;
+    ROBIN_HOOD_PROBE_RESULT_T tProbe = Probe(ptMap, tItem);
+    if(tProbe.tStatus == JUNO_STATUS_TABLE_FULL_ERROR || (tProbe.tStatus == JUNO_STATUS_SUCCESS && !tProbe.tOk.bFound))
+    {
+        // Key not present
+        return JUNO_STATUS_SUCCESS;
+    }
+    JUNO_ASSERT_SUCCESS(tProbe.tStatus, return tProbe.tStatus);
+    // Backward shift: pull displaced followers one slot closer to home
+    size_t iSlot = tProbe.tOk.iSlot;
+    size_t iNext = NextSlot(iSlot, zCapacity);
+    while(ptMap->pzDistances[iNext] > 1)
+    {
+        tStatus = MoveSlot(ptJunoMap, iSlot, iNext);
+        JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+        ptMap->pzDistances[iSlot] = ptMap->pzDistances[iNext] - 1;
+        iSlot = iNext;
+        iNext = NextSlot(iNext, zCapacity);
+    }
+    tStatus = ptArray->ptApi->RemoveAt(ptArray, iSlot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptMap->pzDistances[iSlot] = 0;
+    ptMap->zLength -= 1;
+    return tStatus;
+}
+
+/// Probe distance of a slot, read from the stored distances
+static JUNO_MAP_PROBE_OPTION_RESULT_T RobinHood_ProbeDistance(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot)
+{
+    JUNO_MAP_PROBE_OPTION_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {false, 0}};
+    // The stored distance is the probe distance + 1, 0 when the slot is empty
+    size_t zDistance = ((JUNO_MAP_ROBIN_HOOD_T *)(ptJunoMap))->pzDistances[iSlot];
+    if(zDistance != 0)
+    {
+        tResult.tOk.bIsSome = true;
+        tResult.tOk.tSome = zDistance - 1;
+    }
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapRobinHoodStats(JUNO_MAP_ROBIN_HOOD_T *ptMap)
+{
+    JUNO_MAP_STATS_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    if(!ptMap)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    tResult.tStatus = Verify(&ptMap->tRoot);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    return JunoDs_MapStatsScan(&ptMap->tRoot, RobinHood_ProbeDistance);
+}
@@ -0,0 +1,357 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/ds/map_swiss.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/map_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Pick the group matcher. Vector intrinsics are only used on hosted builds.
+#if !defined(JUNO_MAP_SWISS_SCALAR) && __STDC_HOSTED__ && defined(__SSE2__)
+#include <emmintrin.h>
+#define SWISS_SSE2
+#elif !defined(JUNO_MAP_SWISS_SCALAR) && __STDC_HOSTED__ && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SWISS_NEON
+#endif
+
+/// Bit mask of matching slots in a group
+typedef uint64_t SWISS_MASK_T;
+
+#ifdef SWISS_NEON
+/// NEON masks hold 4 bits per slot
+#define SWISS_MASK_SHIFT (2u)
+#define SWISS_MASK_LANE ((SWISS_MASK_T)0xF)
+#else
+/// SSE2 and scalar masks hold 1 bit per slot
+#define SWISS_MASK_SHIFT (0u)
+#define SWISS_MASK_LANE ((SWISS_MASK_T)0x1)
+#endif
+
+/// Low bits of the hash stored in the control byte
+#define SWISS_H2_MASK (0x7Fu)
+
+static JUNO_RESULT_POINTER_T Swiss_Get(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T Swiss_Set(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T Swiss_Remove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem);
+
+static const JUNO_MAP_API_T gtMapSwissApi =
+{
+    Swiss_Get,
+    Swiss_Set,
+    Swiss_Remove,
+};
+
+/// Result of probing for a key
+typedef struct SWISS_PROBE_TAG
+{
+    /// The slot holding the key when bFound is set.
+    size_t iSlot;
+    /// The first empty or deleted slot of the probe sequence when bHasFree is set.
+    size_t iFree;
+    /// The key's control byte.
+    uint8_t iCtrl;
+    /// True when iSlot holds the key.
+    bool bFound;
+    /// True when iFree is valid.
+    bool bHasFree;
+} SWISS_PROBE_T;
+
+JUNO_MODULE_RESULT(SWISS_PROBE_RESULT_T, SWISS_PROBE_T);
+
+/// Mask of the slots in the group whose control byte equals iCtrl
+static inline SWISS_MASK_T GroupMatch(const uint8_t *piGroup, uint8_t iCtrl)
+{
+#if defined(SWISS_SSE2)
+    __m128i tCtrl = _mm_loadu_si128((const __m128i *)(const void *)piGroup);
+    return (SWISS_MASK_T)(uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(tCtrl, _mm_set1_epi8((char)iCtrl)));
+#elif defined(SWISS_NEON)
+    uint8x16_t tMatch = vceqq_u8(vld1q_u8(piGroup), vdupq_n_u8(iCtrl));
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(tMatch), 4)), 0);
+#else
+    SWISS_MASK_T iMask = 0;
+    for(size_t i = 0; i < JUNO_MAP_SWISS_GROUP_SIZE; i++)
+    {
+        iMask |= (SWISS_MASK_T)(piGroup[i] == iCtrl) << i;
+    }
+    return iMask;
+#endif
+}
+
+/// Mask of the empty or deleted slots in the group (control byte high bit set)
+static inline SWISS_MASK_T GroupMatchFree(const uint8_t *piGroup)
+{
+#if defined(SWISS_SSE2)
+    return (SWISS_MASK_T)(uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(const void *)piGroup));
+#elif defined(SWISS_NEON)
+    uint8x16_t tFree = vcltq_s8(vreinterpretq_s8_u8(vld1q_u8(piGroup)), vdupq_n_s8(0));
+    return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(tFree), 4)), 0);
+#else
+    SWISS_MASK_T iMask = 0;
+    for(size_t i = 0; i < JUNO_MAP_SWISS_GROUP_SIZE; i++)
+    {
+        iMask |= (SWISS_MASK_T)(piGroup[i] >> 7) << i;
+    }
+    return iMask;
+#endif
+}
+
+/// Slot offset of the lowest match in a non-zero mask
+static inline size_t MaskLowest(SWISS_MASK_T iMask)
+{
+#if defined(__GNUC__)
+    return (size_t)__builtin_ctzll(iMask) >> SWISS_MASK_SHIFT;
+#else
+    size_t iBit = 0;
+    while(!(iMask & 1u))
+    {
+        iMask >>= 1;
+        iBit++;
+    }
+    return iBit >> SWISS_MASK_SHIFT;
+#endif
+}
+
+/// Clear the lowest match of a mask
+static inline SWISS_MASK_T MaskClear(SWISS_MASK_T iMask, size_t iOffset)
+{
+    return iMask & ~(SWISS_MASK_LANE << (iOffset << SWISS_MASK_SHIFT));
+}
+
+static inline JUNO_STATUS_T Verify(JUNO_MAP_ROOT_T *ptJunoMap)
+{
+    JUNO_STATUS_T tStatus = JunoDs_MapVerify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_SWISS_T *ptMap = (JUNO_MAP_SWISS_T *)(ptJunoMap);
+    JUNO_ASSERT_EXISTS_MODULE(ptMap->piCtrl, ptMap, "Module does not have all dependencies");
+    if(ptJunoMap->ptApi != &gtMapSwissApi)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptMap, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    return tStatus;
+}
+
+/// Get a slot and check that it holds the key's pointer type
+static inline JUNO_RESULT_POINTER_T GetSlot(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot, const JUNO_POINTER_T tItem)
+{
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    JUNO_RESULT_POINTER_T tResult = ptArray->ptApi->GetAt(ptArray, iSlot);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(tResult.tOk.ptApi != tItem.ptApi)
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptJunoMap, "Invalid pointer type");
+    }
+    return tResult;
+}
+
+/// Probe the groups for tItem until a group with an empty slot is reached
+static inline SWISS_PROBE_RESULT_T Probe(JUNO_MAP_SWISS_T *ptMap, JUNO_POINTER_T tItem)
+{
+    SWISS_PROBE_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0, 0, 0, false, false}};
+    JUNO_MAP_ROOT_T *ptJunoMap = &ptMap->tRoot;
+    tResult.tStatus = JunoMemory_PointerVerify(tItem);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_RESULT_SIZE_T tHashResult = ptJunoMap->ptHashablePointerApi->Hash(tItem);
+    tResult.tStatus = tHashResult.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    SWISS_PROBE_T *ptProbe = &tResult.tOk;
+    size_t zGroups = ptJunoMap->ptHashMap->zCapacity / JUNO_MAP_SWISS_GROUP_SIZE;
+    size_t iGroup = (tHashResult.tOk >> 7) % zGroups;
+    ptProbe->iCtrl = (uint8_t)(tHashResult.tOk & SWISS_H2_MASK);
+    for(size_t i = 0; i < zGroups; i++)
+    {
+        size_t iBase = iGroup * JUNO_MAP_SWISS_GROUP_SIZE;
+        const uint8_t *piGroup = &ptMap->piCtrl[iBase];
+        for(SWISS_MASK_T iMask = GroupMatch(piGroup, ptProbe->iCtrl); iMask;)
+        {
+            size_t iOffset = MaskLowest(iMask);
+            iMask = MaskClear(iMask, iOffset);
+            JUNO_RESULT_POINTER_T tSlot = GetSlot(ptJunoMap, iBase + iOffset, tItem);
+            tResult.tStatus = tSlot.tStatus;
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            JUNO_RESULT_BOOL_T tEquals = JunoDs_MapEquals(ptJunoMap, tItem, tSlot.tOk);
+            tResult.tStatus = tEquals.tStatus;
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            if(tEquals.tOk)
+            {
+                ptProbe->iSlot = iBase + iOffset;
+                ptProbe->bFound = true;
+                return tResult;
+            }
+        }
+        SWISS_MASK_T iFree = GroupMatchFree(piGroup);
+        if(iFree && !ptProbe->bHasFree)
+        {
+            ptProbe->iFree = iBase + MaskLowest(iFree);
+            ptProbe->bHasFree = true;
+        }
+        if(GroupMatch(piGroup, JUNO_MAP_SWISS_CTRL_EMPTY))
+        {
+            // Keys are never placed past a group with an empty slot
+            return tResult;
+        }
+        iGroup = iGroup + 1 == zGroups ? 0 : iGroup + 1;
+    }
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-018"]}
+JUNO_STATUS_T JunoDs_MapSwissInit(
+    JUNO_MAP_SWISS_T *ptMap,
+    const JUNO_MAP_HASHABLE_POINTER_API_T *ptHashablePointerApi,
+    const JUNO_VALUE_POINTER_API_T *ptValuePointerApi,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    uint8_t *piCtrl,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptMap);
+    JUNO_MAP_ROOT_T *ptRoot = &ptMap->tRoot;
+    ptRoot->ptApi = &gtMapSwissApi;
+    ptRoot->ptHashablePointerApi = ptHashablePointerApi;
+    ptRoot->ptValuePointerApi = ptValuePointerApi;
+    ptRoot->ptHashMap = ptArray;
+    ptRoot->_pfcnFailureHandler = pfcnFailureHandler;
+    ptRoot->_pvFailureUserData = pvUserData;
+    ptRoot->zEqualsCalls = 0;
+    ptMap->piCtrl = piCtrl;
+    JUNO_STATUS_T tStatus = Verify(ptRoot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(ptArray->zCapacity % JUNO_MAP_SWISS_GROUP_SIZE != 0)
+    {
+        tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        JUNO_FAIL_MODULE(tStatus, ptMap, "Capacity is not a multiple of the group size");
+        return tStatus;
+    }
+    for(size_t i = 0; i < ptArray->zCapacity; i++)
+    {
+        piCtrl[i] = JUNO_MAP_SWISS_CTRL_EMPTY;
+    }
+    return tStatus;
+}
+
+// @{"req": ["REQ-MAP-019"]}
+static JUNO_RESULT_POINTER_T Swiss_Get(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    tResult.tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    SWISS_PROBE_RESULT_T tProbe = Probe((JUNO_MAP_SWISS_T *)(ptJunoMap), tItem);
+    tResult.tStatus = tProbe.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    if(!tProbe.tOk.bFound)
+    {
+        tResult.tStatus = JUNO_STATUS_DNE_ERROR;
+        return tResult;
+    }
+    return GetSlot(ptJunoMap, tProbe.tOk.iSlot, tItem);
+}
+
+// @{"req": ["REQ-MAP-019"]}
+static JUNO_STATUS_T Swiss_Set(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_SWISS_T *ptMap = (JUNO_MAP_SWISS_T *)(ptJunoMap);
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    SWISS_PROBE_RESULT_T tProbe = Probe(ptMap, tItem);
+    JUNO_ASSERT_SUCCESS(tProbe.tStatus, return tProbe.tStatus);
+    if(tProbe.tOk.bFound)
+    {
+        // Overwrite the existing entry
+        return JunoDs_ArrayStore(ptArray, tItem, tProbe.tOk.iSlot);
+    }
+    if(!tProbe.tOk.bHasFree)
+    {
+        tStatus = JUNO_STATUS_TABLE_FULL_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptJunoMap, "Map is full");
+        return tStatus;
+    }
+    tStatus = JunoDs_ArrayStore(ptArray, tItem, tProbe.tOk.iFree);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptMap->piCtrl[tProbe.tOk.iFree] = tProbe.tOk.iCtrl;
+    return tStatus;
+}
+
+// @{"req": ["REQ-MAP-020"]}
+static JUNO_STATUS_T Swiss_Remove(JUNO_MAP_ROOT_T *ptJunoMap, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptJunoMap);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MAP_SWISS_T *ptMap = (JUNO_MAP_SWISS_T *)(ptJunoMap);
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    SWISS_PROBE_RESULT_T tProbe = Probe(ptMap, tItem);
+    JUNO_ASSERT_SUCCESS(tProbe.tStatus, return tProbe.tStatus);
+    if(!tProbe.tOk.bFound)
+    {
+        // Key not present
+        return tStatus;
+    }
+    size_t iSlot = tProbe.tOk.iSlot;
+    tStatus = ptArray->ptApi->RemoveAt(ptArray, iSlot);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    // A group that still has an empty slot never let a probe pass it, so the
+    // slot can become empty again. Otherwise later groups may hold keys that
+    // probed through this one.
+    const uint8_t *piGroup = &ptMap->piCtrl[iSlot - iSlot % JUNO_MAP_SWISS_GROUP_SIZE];
+    ptMap->piCtrl[iSlot] = GroupMatch(piGroup, JUNO_MAP_SWISS_CTRL_EMPTY) ? JUNO_MAP_SWISS_CTRL_EMPTY : JUNO_MAP_SWISS_CTRL_DELETED;
+    return tStatus;
+}
+
+/// Distance in groups from the key's home group; keys are hashed again since the control byte holds only H2
+static JUNO_MAP_PROBE_OPTION_RESULT_T Swiss_ProbeDistance(JUNO_MAP_ROOT_T *ptJunoMap, size_t iSlot)
+{
+    JUNO_MAP_PROBE_OPTION_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {false, 0}};
+    if(((JUNO_MAP_SWISS_T *)(ptJunoMap))->piCtrl[iSlot] & ~SWISS_H2_MASK)
+    {
+        // Empty or deleted
+        return tResult;
+    }
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptJunoMap->ptHashMap;
+    JUNO_RESULT_POINTER_T tSlot = ptArray->ptApi->GetAt(ptArray, iSlot);
+    tResult.tStatus = tSlot.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_RESULT_SIZE_T tHashResult = ptJunoMap->ptHashablePointerApi->Hash(tSlot.tOk);
+    tResult.tStatus = tHashResult.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    size_t zGroups = ptArray->zCapacity / JUNO_MAP_SWISS_GROUP_SIZE;
+    tResult.tOk.bIsSome = true;
+    tResult.tOk.tSome = JunoDs_MapWrapDistance(iSlot / JUNO_MAP_SWISS_GROUP_SIZE, (tHashResult.tOk >> 7) % zGroups, zGroups);
+    return tResult;
+}
+
+// @{"req": ["REQ-MAP-026"]}
+JUNO_MAP_STATS_RESULT_T JunoDs_MapSwissStats(JUNO_MAP_SWISS_T *ptMap)
+{
+    JUNO_MAP_STATS_RESULT_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    if(!ptMap)
+    {
+        tResult.tStatus = JUNO_STATUS_NULLPTR_ERROR;
+        return tResult;
+    }
+    tResult.tStatus = Verify(&ptMap->tRoot);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    return JunoDs_MapStatsScan(&ptMap->tRoot, Swiss_ProbeDistance);
+}
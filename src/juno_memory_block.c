@@ -126,7 +126,7 @@ static JUNO_RESULT_POINTER_T Juno_MemoryBlkGet(JUNO_MEMORY_ALLOC_ROOT_T *ptJunoM
     ptMemBlk->ptMetadata[ptMemBlk->zFreed].ptFreeMem = NULL;
     tResult.tStatus = JunoMemory_PointerVerify(tResult.tOk);
     JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
-    tResult.tStatus = tResult.tOk.ptApi->Reset(tResult.tOk);
+    tResult.tStatus = JunoMemory_PointerReset(tResult.tOk);
     if (tResult.tStatus != JUNO_STATUS_SUCCESS) {
         // Clean up: mark the block as unused and clear the pointer
         ptMemBlk->zFreed += 1;
@@ -208,7 +208,7 @@ static JUNO_STATUS_T Juno_MemoryBlkPut(JUNO_MEMORY_ALLOC_ROOT_T *ptJunoMemory, J
             return tStatus;           
         }
     }
-    tStatus = tMemory.ptApi->Reset(tMemory);
+    tStatus = JunoMemory_PointerReset(tMemory);
     JUNO_ASSERT_SUCCESS(tStatus,
         *ptMemory = tMemory;
         return tStatus;
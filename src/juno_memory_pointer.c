@@ -0,0 +1,63 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/memory/pointer_api.h"
+#include "juno/macros.h"
+#include "juno/status.h"
+
+void JunoMemory_PointerCopyBytes(void *pvDest, const void *pvSrc, size_t zSize)
+{
+    uint8_t *piDest = (uint8_t *) pvDest;
+    const uint8_t *piSrc = (const uint8_t *) pvSrc;
+    for(size_t i = 0; i < zSize; i++)
+    {
+        piDest[i] = piSrc[i];
+    }
+}
+
+void JunoMemory_PointerResetBytes(void *pvAddr, size_t zSize)
+{
+    uint8_t *piAddr = (uint8_t *) pvAddr;
+    for(size_t i = 0; i < zSize; i++)
+    {
+        piAddr[i] = 0;
+    }
+}
+
+// @{"req": ["REQ-POINTER-006"]}
+JUNO_STATUS_T JunoMemory_PointerCopyTrivial(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = JunoMemory_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoMemory_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(tDest.zSize != tSrc.zSize || tDest.zAlignment != tSrc.zAlignment)
+    {
+        return JUNO_STATUS_INVALID_SIZE_ERROR;
+    }
+    JunoMemory_PointerCopyBytes(tDest.pvAddr, tSrc.pvAddr, tDest.zSize);
+    return tStatus;
+}
+
+// @{"req": ["REQ-POINTER-006"]}
+JUNO_STATUS_T JunoMemory_PointerResetTrivial(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = JunoMemory_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JunoMemory_PointerResetBytes(tPointer.pvAddr, tPointer.zSize);
+    return tStatus;
+}
@@ -0,0 +1,300 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/ds/queue_mpmc.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/mp/atomic.h"
+#include "juno/status.h"
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+static JUNO_STATUS_T MpmcRing_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T MpmcRing_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T MpmcRing_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+static const JUNO_DS_QUEUE_API_T gtQueueMpmcApi =
+{
+    JunoDs_QueueMpmcPush,
+    JunoDs_QueueMpmcPop,
+    JunoDs_QueueMpmcPeek
+};
+
+/// The ring forwards element access to the caller's array
+static const JUNO_DS_ARRAY_API_T gtMpmcRingApi =
+{
+    MpmcRing_SetAt,
+    MpmcRing_GetAt,
+    MpmcRing_RemoveAt
+};
+
+static inline JUNO_STATUS_T Verify(const JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    JUNO_STATUS_T tStatus = JunoDs_QueueVerify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(ptQueue->ptApi != &gtQueueMpmcApi || ptQueue->ptQueueArray->ptApi != &gtMpmcRingApi)
+    {
+        JUNO_FAIL_ROOT(JUNO_STATUS_INVALID_TYPE_ERROR, ptQueue, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    const JUNO_DS_MPMC_RING_T *ptRing = (const JUNO_DS_MPMC_RING_T *)(ptQueue->ptQueueArray);
+    JUNO_ASSERT_EXISTS(ptRing->ptSequences);
+    return JunoDs_ArrayVerify(ptRing->ptArray);
+}
+
+/// Sequence value for a position; the low bit flags a slot whose enqueue failed
+static inline size_t Sequence(size_t iPos)
+{
+    return iPos << 1;
+}
+
+/// Set in a published sequence when SetAt failed and the slot holds no item
+#define MPMC_SEQUENCE_POISONED ((size_t)1)
+
+/// Record a lost CAS race, returning true when the retry budget is spent
+static inline bool RetriesExhausted(const JUNO_DS_MPMC_RING_T *ptRing, size_t *pzRetries)
+{
+    *pzRetries += 1;
+    return ptRing->zRetryLimit && *pzRetries > ptRing->zRetryLimit;
+}
+
+// @{"req": ["REQ-QUEUE-013", "REQ-QUEUE-014"]}
+JUNO_STATUS_T JunoDs_QueueMpmcPush(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoMemory_PointerVerify(tItem);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_MPMC_RING_T *ptRing = (JUNO_DS_MPMC_RING_T *)(ptQueue->ptQueueArray);
+    size_t zMask = ptRing->tRoot.zCapacity - 1;
+    size_t zRetries = 0;
+    size_t iPos = atomic_load_explicit(&ptRing->zEnqueuePos, memory_order_relaxed);
+    for(;;)
+    {
+        size_t iSeq = atomic_load_explicit(&ptRing->ptSequences[iPos & zMask], memory_order_acquire);
+        intptr_t iDiff = (intptr_t)(iSeq - Sequence(iPos));
+        if(iDiff == 0)
+        {
+            // The slot is free for this position, try to claim it
+            if(atomic_compare_exchange_weak_explicit(&ptRing->zEnqueuePos, &iPos, iPos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(iDiff < 0)
+        {
+            tStatus = JUNO_STATUS_OOB_ERROR;
+            JUNO_FAIL_ROOT(tStatus, ptQueue, "Failed to enqueue data");
+            return tStatus;
+        }
+        else
+        {
+            // Another producer claimed this position
+            iPos = atomic_load_explicit(&ptRing->zEnqueuePos, memory_order_relaxed);
+        }
+        if(RetriesExhausted(ptRing, &zRetries))
+        {
+            tStatus = JUNO_STATUS_TIMEOUT_ERROR;
+            JUNO_FAIL_ROOT(tStatus, ptQueue, "Enqueue retry limit reached");
+            return tStatus;
+        }
+    }
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptRing->ptArray;
+    tStatus = JunoDs_ArrayStore(ptArray, tItem, iPos & zMask);
+    // The claimed slot is always handed to the consumers so the queue cannot
+    // stall. A failed store is flagged so the consumer reports it instead of
+    // reading the slot's stale contents.
+    size_t iSeq = Sequence(iPos + 1);
+    if(tStatus != JUNO_STATUS_SUCCESS)
+    {
+        iSeq |= MPMC_SEQUENCE_POISONED;
+        JUNO_FAIL_ROOT(tStatus, ptQueue, "Failed to store enqueued data");
+    }
+    atomic_store_explicit(&ptRing->ptSequences[iPos & zMask], iSeq, memory_order_release);
+    return tStatus;
+}
+
+// @{"req": ["REQ-QUEUE-013", "REQ-QUEUE-014"]}
+JUNO_STATUS_T JunoDs_QueueMpmcPop(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn)
+{
+    JUNO_STATUS_T tStatus = Verify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoMemory_PointerVerify(tReturn);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_MPMC_RING_T *ptRing = (JUNO_DS_MPMC_RING_T *)(ptQueue->ptQueueArray);
+    size_t zCapacity = ptRing->tRoot.zCapacity;
+    size_t zMask = zCapacity - 1;
+    size_t zRetries = 0;
+    size_t iPos = atomic_load_explicit(&ptRing->zDequeuePos, memory_order_relaxed);
+    bool bPoisoned = false;
+    for(;;)
+    {
+        size_t iSeq = atomic_load_explicit(&ptRing->ptSequences[iPos & zMask], memory_order_acquire);
+        intptr_t iDiff = (intptr_t)(iSeq - Sequence(iPos + 1));
+        bPoisoned = iDiff == (intptr_t)MPMC_SEQUENCE_POISONED;
+        if(iDiff == 0 || bPoisoned)
+        {
+            // The slot holds the item for this position, try to claim it
+            if(atomic_compare_exchange_weak_explicit(&ptRing->zDequeuePos, &iPos, iPos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(iDiff < 0)
+        {
+            tStatus = JUNO_STATUS_OOB_ERROR;
+            JUNO_FAIL_ROOT(tStatus, ptQueue, "Queue is empty");
+            return tStatus;
+        }
+        else
+        {
+            // Another consumer claimed this position
+            iPos = atomic_load_explicit(&ptRing->zDequeuePos, memory_order_relaxed);
+        }
+        if(RetriesExhausted(ptRing, &zRetries))
+        {
+            tStatus = JUNO_STATUS_TIMEOUT_ERROR;
+            JUNO_FAIL_ROOT(tStatus, ptQueue, "Dequeue retry limit reached");
+            return tStatus;
+        }
+    }
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptRing->ptArray;
+    size_t iSlot = iPos & zMask;
+    if(bPoisoned)
+    {
+        // The producer failed to store an item, the slot holds stale contents
+        tStatus = JUNO_STATUS_INVALID_DATA_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptQueue, "Dequeued a slot whose enqueue failed");
+    }
+    else
+    {
+        JUNO_RESULT_POINTER_T tPtrResult = ptArray->ptApi->GetAt(ptArray, iSlot);
+        tStatus = tPtrResult.tStatus;
+        if(tStatus == JUNO_STATUS_SUCCESS)
+        {
+            tStatus = JunoMemory_PointerCopyWith(tPtrResult.tOk.ptApi, tReturn, JUNO_OK(tPtrResult));
+        }
+        if(tStatus != JUNO_STATUS_SUCCESS)
+        {
+            JUNO_FAIL_ROOT(tStatus, ptQueue, "Failed to copy dequeued data");
+        }
+    }
+    JUNO_STATUS_T tRemoveStatus = ptArray->ptApi->RemoveAt(ptArray, iSlot);
+    // Hand the slot to the producers of the next lap
+    atomic_store_explicit(&ptRing->ptSequences[iSlot], Sequence(iPos + zCapacity), memory_order_release);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return tRemoveStatus;
+}
+
+// @{"req": ["REQ-QUEUE-014"]}
+JUNO_RESULT_POINTER_T JunoDs_QueueMpmcPeek(JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    JUNO_RESULT_POINTER_T tResult = JUNO_ERR_RESULT(JUNO_STATUS_ERR, {0});
+    tResult.tStatus = Verify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_DS_MPMC_RING_T *ptRing = (JUNO_DS_MPMC_RING_T *)(ptQueue->ptQueueArray);
+    size_t zMask = ptRing->tRoot.zCapacity - 1;
+    size_t iPos = atomic_load_explicit(&ptRing->zDequeuePos, memory_order_relaxed);
+    size_t iSeq = atomic_load_explicit(&ptRing->ptSequences[iPos & zMask], memory_order_acquire);
+    if(iSeq == (Sequence(iPos + 1) | MPMC_SEQUENCE_POISONED))
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_DATA_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptQueue, "Front slot's enqueue failed");
+        return tResult;
+    }
+    if(iSeq != Sequence(iPos + 1))
+    {
+        tResult.tStatus = JUNO_STATUS_OOB_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptQueue, "Queue is empty");
+        return tResult;
+    }
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptRing->ptArray;
+    return ptArray->ptApi->GetAt(ptArray, iPos & zMask);
+}
+
+static JUNO_STATUS_T MpmcRing_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_ARRAY_ROOT_T *ptInner = ((JUNO_DS_MPMC_RING_T *)ptArray)->ptArray;
+    return ptInner->ptApi->SetAt(ptInner, tItem, iIndex);
+}
+
+static JUNO_RESULT_POINTER_T MpmcRing_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = JUNO_ERR_RESULT(JUNO_STATUS_ERR, {0});
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_DS_ARRAY_ROOT_T *ptInner = ((JUNO_DS_MPMC_RING_T *)ptArray)->ptArray;
+    return ptInner->ptApi->GetAt(ptInner, iIndex);
+}
+
+static JUNO_STATUS_T MpmcRing_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_ARRAY_ROOT_T *ptInner = ((JUNO_DS_MPMC_RING_T *)ptArray)->ptArray;
+    return ptInner->ptApi->RemoveAt(ptInner, iIndex);
+}
+
+// @{"req": ["REQ-QUEUE-012"]}
+JUNO_STATUS_T JunoDs_QueueMpmcInit(
+    JUNO_DS_QUEUE_ROOT_T *ptQueue,
+    JUNO_DS_MPMC_RING_T *ptRing,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    JUNO_MP_ATOMIC_SIZE_T *ptSequences,
+    size_t zRetryLimit,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvFailureUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptQueue && ptRing && ptSequences);
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerify(ptArray);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptQueue->_pfcnFailureHandler = pfcnFailureHdlr;
+    ptQueue->_pvFailureUserData = pvFailureUserData;
+    size_t zCapacity = ptArray->zCapacity;
+    // A single slot cannot tell a free slot from a full one
+    if(zCapacity < 2 || (zCapacity & (zCapacity - 1)))
+    {
+        tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptQueue, "MPMC capacity must be a power of two of at least 2");
+        return tStatus;
+    }
+    ptRing->tRoot.ptApi = &gtMpmcRingApi;
+    ptRing->tRoot.zCapacity = zCapacity;
+    ptRing->tRoot._pfcnFailureHandler = pfcnFailureHdlr;
+    ptRing->tRoot._pvFailureUserData = pvFailureUserData;
+    ptRing->ptArray = ptArray;
+    ptRing->ptSequences = ptSequences;
+    ptRing->zRetryLimit = zRetryLimit;
+    for(size_t i = 0; i < zCapacity; i++)
+    {
+        atomic_init(&ptSequences[i], Sequence(i));
+    }
+    atomic_init(&ptRing->zEnqueuePos, 0);
+    atomic_init(&ptRing->zDequeuePos, 0);
+    ptQueue->ptApi = &gtQueueMpmcApi;
+    ptQueue->ptQueueArray = &ptRing->tRoot;
+    ptQueue->iStartIndex = 0;
+    ptQueue->zLength = 0;
+    return Verify(ptQueue);
+}
@@ -0,0 +1,253 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/ds/queue_spsc.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/mp/atomic.h"
+#include "juno/status.h"
+#include <stdatomic.h>
+#include <stddef.h>
+
+static JUNO_STATUS_T SpscRing_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T SpscRing_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T SpscRing_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+static const JUNO_DS_QUEUE_API_T gtQueueSpscApi =
+{
+    JunoDs_QueueSpscPush,
+    JunoDs_QueueSpscPop,
+    JunoDs_QueueSpscPeek
+};
+
+/// The ring forwards element access to the caller's array
+static const JUNO_DS_ARRAY_API_T gtSpscRingApi =
+{
+    SpscRing_SetAt,
+    SpscRing_GetAt,
+    SpscRing_RemoveAt
+};
+
+static inline JUNO_STATUS_T Verify(const JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    JUNO_STATUS_T tStatus = JunoDs_QueueVerify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(ptQueue->ptApi != &gtQueueSpscApi || ptQueue->ptQueueArray->ptApi != &gtSpscRingApi)
+    {
+        JUNO_FAIL_ROOT(JUNO_STATUS_INVALID_TYPE_ERROR, ptQueue, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    const JUNO_DS_SPSC_RING_T *ptRing = (const JUNO_DS_SPSC_RING_T *)(ptQueue->ptQueueArray);
+    return JunoDs_ArrayVerify(ptRing->ptArray);
+}
+
+/// Positions run over [0, 2 * capacity) so full and empty are distinguishable
+static inline size_t NextPosition(size_t iPos, size_t zCapacity)
+{
+    iPos += 1;
+    return iPos == 2 * zCapacity ? 0 : iPos;
+}
+
+static inline size_t PositionSlot(size_t iPos, size_t zCapacity)
+{
+    return iPos < zCapacity ? iPos : iPos - zCapacity;
+}
+
+static inline size_t PositionDistance(size_t iTail, size_t iHead, size_t zCapacity)
+{
+    return iTail >= iHead ? iTail - iHead : iTail + 2 * zCapacity - iHead;
+}
+
+// @{"req": ["REQ-QUEUE-010", "REQ-QUEUE-011"]}
+JUNO_STATUS_T JunoDs_QueueSpscPush(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = Verify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoMemory_PointerVerify(tItem);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_SPSC_RING_T *ptRing = (JUNO_DS_SPSC_RING_T *)(ptQueue->ptQueueArray);
+    size_t zCapacity = ptRing->tRoot.zCapacity;
+    size_t iTail = atomic_load_explicit(&ptRing->zTail, memory_order_relaxed);
+    if(PositionDistance(iTail, ptRing->zHeadCache, zCapacity) >= zCapacity)
+    {
+        // Looks full, refresh the view of the consumer
+        ptRing->zHeadCache = atomic_load_explicit(&ptRing->zHead, memory_order_acquire);
+        if(PositionDistance(iTail, ptRing->zHeadCache, zCapacity) >= zCapacity)
+        {
+            tStatus = JUNO_STATUS_OOB_ERROR;
+            JUNO_FAIL_ROOT(tStatus, ptQueue, "Failed to enqueue data");
+            return tStatus;
+        }
+    }
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptRing->ptArray;
+    tStatus = JunoDs_ArrayStore(ptArray, tItem, PositionSlot(iTail, zCapacity));
+    if(tStatus != JUNO_STATUS_SUCCESS)
+    {
+        JUNO_FAIL_ROOT(tStatus, ptQueue, "Failed to store enqueued data");
+        return tStatus;
+    }
+    // Publish the slot to the consumer
+    atomic_store_explicit(&ptRing->zTail, NextPosition(iTail, zCapacity), memory_order_release);
+    return tStatus;
+}
+
+/// Check for an item at the consumer position, refreshing the view of the producer if needed
+static inline JUNO_STATUS_T ConsumerReady(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_DS_SPSC_RING_T *ptRing, size_t iHead)
+{
+    if(iHead == ptRing->zTailCache)
+    {
+        ptRing->zTailCache = atomic_load_explicit(&ptRing->zTail, memory_order_acquire);
+        if(iHead == ptRing->zTailCache)
+        {
+            JUNO_FAIL_ROOT(JUNO_STATUS_OOB_ERROR, ptQueue, "Queue is empty");
+            return JUNO_STATUS_OOB_ERROR;
+        }
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Reset the consumer slot and hand it back to the producer
+static inline JUNO_STATUS_T ConsumerRelease(JUNO_DS_SPSC_RING_T *ptRing, size_t iHead)
+{
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptRing->ptArray;
+    size_t zCapacity = ptRing->tRoot.zCapacity;
+    JUNO_STATUS_T tStatus = ptArray->ptApi->RemoveAt(ptArray, PositionSlot(iHead, zCapacity));
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    atomic_store_explicit(&ptRing->zHead, NextPosition(iHead, zCapacity), memory_order_release);
+    return tStatus;
+}
+
+// @{"req": ["REQ-QUEUE-010", "REQ-QUEUE-011"]}
+JUNO_STATUS_T JunoDs_QueueSpscPop(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn)
+{
+    JUNO_STATUS_T tStatus = Verify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoMemory_PointerVerify(tReturn);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_SPSC_RING_T *ptRing = (JUNO_DS_SPSC_RING_T *)(ptQueue->ptQueueArray);
+    size_t iHead = atomic_load_explicit(&ptRing->zHead, memory_order_relaxed);
+    tStatus = ConsumerReady(ptQueue, ptRing, iHead);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptRing->ptArray;
+    size_t zCapacity = ptRing->tRoot.zCapacity;
+    size_t iSlot = PositionSlot(iHead, zCapacity);
+    JUNO_RESULT_POINTER_T tPtrResult = ptArray->ptApi->GetAt(ptArray, iSlot);
+    JUNO_ASSERT_SUCCESS(tPtrResult.tStatus, return tPtrResult.tStatus);
+    tStatus = JunoMemory_PointerCopyWith(tPtrResult.tOk.ptApi, tReturn, JUNO_OK(tPtrResult));
+    if(tStatus != JUNO_STATUS_SUCCESS)
+    {
+        JUNO_FAIL_ROOT(tStatus, ptQueue, "Failed to copy dequeued data");
+        return tStatus;
+    }
+    return ConsumerRelease(ptRing, iHead);
+}
+
+// @{"req": ["REQ-QUEUE-010", "REQ-QUEUE-011"]}
+JUNO_STATUS_T JunoDs_QueueSpscDrop(JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    JUNO_STATUS_T tStatus = Verify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_SPSC_RING_T *ptRing = (JUNO_DS_SPSC_RING_T *)(ptQueue->ptQueueArray);
+    size_t iHead = atomic_load_explicit(&ptRing->zHead, memory_order_relaxed);
+    tStatus = ConsumerReady(ptQueue, ptRing, iHead);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return ConsumerRelease(ptRing, iHead);
+}
+
+// @{"req": ["REQ-QUEUE-010"]}
+JUNO_RESULT_SIZE_T JunoDs_QueueSpscAvailable(JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    tResult.tStatus = Verify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_DS_SPSC_RING_T *ptRing = (JUNO_DS_SPSC_RING_T *)(ptQueue->ptQueueArray);
+    size_t iHead = atomic_load_explicit(&ptRing->zHead, memory_order_relaxed);
+    ptRing->zTailCache = atomic_load_explicit(&ptRing->zTail, memory_order_acquire);
+    tResult.tOk = PositionDistance(ptRing->zTailCache, iHead, ptRing->tRoot.zCapacity);
+    return tResult;
+}
+
+// @{"req": ["REQ-QUEUE-010", "REQ-QUEUE-011"]}
+JUNO_RESULT_POINTER_T JunoDs_QueueSpscPeek(JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    JUNO_RESULT_POINTER_T tResult = JUNO_ERR_RESULT(JUNO_STATUS_ERR, {0});
+    tResult.tStatus = Verify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_DS_SPSC_RING_T *ptRing = (JUNO_DS_SPSC_RING_T *)(ptQueue->ptQueueArray);
+    size_t iHead = atomic_load_explicit(&ptRing->zHead, memory_order_relaxed);
+    tResult.tStatus = ConsumerReady(ptQueue, ptRing, iHead);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_DS_ARRAY_ROOT_T *ptArray = ptRing->ptArray;
+    return ptArray->ptApi->GetAt(ptArray, PositionSlot(iHead, ptRing->tRoot.zCapacity));
+}
+
+static JUNO_STATUS_T SpscRing_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_ARRAY_ROOT_T *ptInner = ((JUNO_DS_SPSC_RING_T *)ptArray)->ptArray;
+    return ptInner->ptApi->SetAt(ptInner, tItem, iIndex);
+}
+
+static JUNO_RESULT_POINTER_T SpscRing_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = JUNO_ERR_RESULT(JUNO_STATUS_ERR, {0});
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_DS_ARRAY_ROOT_T *ptInner = ((JUNO_DS_SPSC_RING_T *)ptArray)->ptArray;
+    return ptInner->ptApi->GetAt(ptInner, iIndex);
+}
+
+static JUNO_STATUS_T SpscRing_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_DS_ARRAY_ROOT_T *ptInner = ((JUNO_DS_SPSC_RING_T *)ptArray)->ptArray;
+    return ptInner->ptApi->RemoveAt(ptInner, iIndex);
+}
+
+// @{"req": ["REQ-QUEUE-009"]}
+JUNO_STATUS_T JunoDs_QueueSpscInit(
+    JUNO_DS_QUEUE_ROOT_T *ptQueue,
+    JUNO_DS_SPSC_RING_T *ptRing,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvFailureUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptQueue && ptRing);
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerify(ptArray);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptRing->tRoot.ptApi = &gtSpscRingApi;
+    ptRing->tRoot.zCapacity = ptArray->zCapacity;
+    ptRing->tRoot._pfcnFailureHandler = pfcnFailureHdlr;
+    ptRing->tRoot._pvFailureUserData = pvFailureUserData;
+    ptRing->ptArray = ptArray;
+    atomic_init(&ptRing->zTail, 0);
+    atomic_init(&ptRing->zHead, 0);
+    ptRing->zHeadCache = 0;
+    ptRing->zTailCache = 0;
+    ptQueue->ptApi = &gtQueueSpscApi;
+    ptQueue->ptQueueArray = &ptRing->tRoot;
+    ptQueue->iStartIndex = 0;
+    ptQueue->zLength = 0;
+    ptQueue->_pfcnFailureHandler = pfcnFailureHdlr;
+    ptQueue->_pvFailureUserData = pvFailureUserData;
+    return Verify(ptQueue);
+}
@@ -0,0 +1,266 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/sb/bridge.h"
+#include "juno/app/app_api.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/ds/queue_spsc.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/sb/broker_api.h"
+#include "juno/status.h"
+#include <stddef.h>
+
+static JUNO_STATUS_T Route_Enqueue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem);
+static JUNO_STATUS_T Route_Dequeue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn);
+static JUNO_RESULT_POINTER_T Route_Peek(JUNO_DS_QUEUE_ROOT_T *ptQueue);
+static JUNO_STATUS_T MidArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T MidArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T MidArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T Bridge_OnStart(JUNO_APP_ROOT_T *ptJunoApp);
+static JUNO_STATUS_T Bridge_OnProcess(JUNO_APP_ROOT_T *ptJunoApp);
+static JUNO_STATUS_T Bridge_OnExit(JUNO_APP_ROOT_T *ptJunoApp);
+
+static const JUNO_DS_QUEUE_API_T gtBridgeRouteApi =
+{
+    Route_Enqueue,
+    Route_Dequeue,
+    Route_Peek
+};
+
+/// MIDs are plain integers
+static const JUNO_POINTER_API_T gtBridgeMidPointerApi =
+{
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_DS_ARRAY_API_T gtBridgeMidArrayApi =
+{
+    MidArray_SetAt,
+    MidArray_GetAt,
+    MidArray_RemoveAt
+};
+
+static const JUNO_APP_API_T gtBridgeAppApi =
+{
+    Bridge_OnStart,
+    Bridge_OnProcess,
+    Bridge_OnExit
+};
+
+#define BridgeMid_PointerInit(addr) JunoMemory_PointerInit(&gtBridgeMidPointerApi, JUNO_SB_MID_T, addr)
+
+static inline JUNO_STATUS_T Verify(const JUNO_SB_BRIDGE_T *ptBridge)
+{
+    JUNO_ASSERT_EXISTS(ptBridge);
+    JUNO_ASSERT_EXISTS_MODULE(
+        ptBridge->ptDestBroker &&
+        ptBridge->tMids.ptMids,
+        ptBridge,
+        "Module does not have all dependencies"
+    );
+    if(ptBridge->tRoot.ptApi != &gtBridgeAppApi || ptBridge->tMids.tRoot.ptApi != &gtBridgeMidArrayApi)
+    {
+        JUNO_FAIL_MODULE(JUNO_STATUS_INVALID_TYPE_ERROR, ptBridge, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    JUNO_STATUS_T tStatus = JunoSb_BrokerVerify(ptBridge->ptDestBroker);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoDs_QueueVerify(&ptBridge->tMsgQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoDs_QueueVerify(&ptBridge->tMidQueue);
+}
+
+static inline JUNO_STATUS_T VerifyRoute(const JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    JUNO_STATUS_T tStatus = JunoDs_QueueVerify(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(ptQueue->ptApi != &gtBridgeRouteApi)
+    {
+        JUNO_FAIL_ROOT(JUNO_STATUS_INVALID_TYPE_ERROR, ptQueue, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    const JUNO_SB_BRIDGE_ROUTE_T *ptRoute = (const JUNO_SB_BRIDGE_ROUTE_T *)(ptQueue);
+    return Verify(ptRoute->ptBridge);
+}
+
+// @{"req": ["REQ-SB-023"]}
+JUNO_STATUS_T JunoSb_BridgeInit(
+    JUNO_SB_BRIDGE_T *ptBridge,
+    JUNO_SB_BROKER_ROOT_T *ptDestBroker,
+    JUNO_DS_ARRAY_ROOT_T *ptArray,
+    JUNO_SB_MID_T *ptSlotMids,
+    size_t zBatchLimit,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHdlr,
+    JUNO_USER_DATA_T *pvFailureUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptBridge);
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerify(ptArray);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptBridge->tRoot.ptApi = &gtBridgeAppApi;
+    ptBridge->tRoot._pfcnFailureHandler = pfcnFailureHdlr;
+    ptBridge->tRoot._pvFailureUserData = pvFailureUserData;
+    ptBridge->ptDestBroker = ptDestBroker;
+    ptBridge->zBatchLimit = zBatchLimit;
+    tStatus = JunoDs_QueueSpscInit(&ptBridge->tMsgQueue, &ptBridge->tMsgRing, ptArray, pfcnFailureHdlr, pvFailureUserData);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = JunoDs_ArrayInit(&ptBridge->tMids.tRoot, &gtBridgeMidArrayApi, ptArray->zCapacity, pfcnFailureHdlr, pvFailureUserData);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptBridge->tMids.ptMids = ptSlotMids;
+    tStatus = JunoDs_QueueSpscInit(&ptBridge->tMidQueue, &ptBridge->tMidRing, &ptBridge->tMids.tRoot, pfcnFailureHdlr, pvFailureUserData);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return Verify(ptBridge);
+}
+
+// @{"req": ["REQ-SB-024"]}
+JUNO_STATUS_T JunoSb_BridgeRouteInit(JUNO_SB_BRIDGE_ROUTE_T *ptRoute, JUNO_SB_BRIDGE_T *ptBridge, JUNO_SB_MID_T iMid)
+{
+    JUNO_ASSERT_EXISTS(ptRoute);
+    JUNO_STATUS_T tStatus = Verify(ptBridge);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    // The route shares the bridge storage so the broker sees a valid pipe
+    JUNO_DS_QUEUE_ROOT_T *ptQueue = &ptRoute->tRoot.tRoot;
+    ptQueue->ptApi = &gtBridgeRouteApi;
+    ptQueue->ptQueueArray = ptBridge->tMsgRing.ptArray;
+    ptQueue->iStartIndex = 0;
+    ptQueue->zLength = 0;
+    ptQueue->_pfcnFailureHandler = ptBridge->tRoot._pfcnFailureHandler;
+    ptQueue->_pvFailureUserData = ptBridge->tRoot._pvFailureUserData;
+    ptRoute->tRoot.iMsgId = iMid;
+    ptRoute->ptBridge = ptBridge;
+    return VerifyRoute(ptQueue);
+}
+
+/// Source thread: enqueue the message, then its MID
+// @{"req": ["REQ-SB-024", "REQ-SB-026"]}
+static JUNO_STATUS_T Route_Enqueue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tItem)
+{
+    JUNO_STATUS_T tStatus = VerifyRoute(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_SB_BRIDGE_ROUTE_T *ptRoute = (JUNO_SB_BRIDGE_ROUTE_T *)(ptQueue);
+    JUNO_SB_BRIDGE_T *ptBridge = ptRoute->ptBridge;
+    tStatus = JunoDs_QueueSpscPush(&ptBridge->tMsgQueue, tItem);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    // The MID queue never holds more entries than the message queue, so this cannot be full
+    JUNO_SB_MID_T iMid = ptRoute->tRoot.iMsgId;
+    return JunoDs_QueueSpscPush(&ptBridge->tMidQueue, BridgeMid_PointerInit(&iMid));
+}
+
+/// Routes only forward, the bridge is the consumer
+static JUNO_STATUS_T Route_Dequeue(JUNO_DS_QUEUE_ROOT_T *ptQueue, JUNO_POINTER_T tReturn)
+{
+    (void) tReturn;
+    JUNO_STATUS_T tStatus = VerifyRoute(ptQueue);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_FAIL_ROOT(JUNO_STATUS_INVALID_TYPE_ERROR, ptQueue, "Bridge routes cannot be dequeued");
+    return JUNO_STATUS_INVALID_TYPE_ERROR;
+}
+
+/// Routes only forward, the bridge is the consumer
+static JUNO_RESULT_POINTER_T Route_Peek(JUNO_DS_QUEUE_ROOT_T *ptQueue)
+{
+    JUNO_RESULT_POINTER_T tResult = JUNO_ERR_RESULT(JUNO_STATUS_ERR, {0});
+    tResult.tStatus = VerifyRoute(ptQueue);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR;
+    JUNO_FAIL_ROOT(tResult.tStatus, ptQueue, "Bridge routes cannot be peeked");
+    return tResult;
+}
+
+static JUNO_STATUS_T MidArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_SB_BRIDGE_MID_ARRAY_T *ptMids = (JUNO_SB_BRIDGE_MID_ARRAY_T *)(ptArray);
+    return JunoMemory_PointerCopy(BridgeMid_PointerInit(&ptMids->ptMids[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T MidArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = JUNO_ERR_RESULT(JUNO_STATUS_ERR, {0});
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_SB_BRIDGE_MID_ARRAY_T *ptMids = (JUNO_SB_BRIDGE_MID_ARRAY_T *)(ptArray);
+    tResult.tOk = BridgeMid_PointerInit(&ptMids->ptMids[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T MidArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ((JUNO_SB_BRIDGE_MID_ARRAY_T *)ptArray)->ptMids[iIndex] = 0;
+    return tStatus;
+}
+
+// @{"req": ["REQ-SB-025", "REQ-SB-026"]}
+JUNO_RESULT_SIZE_T JunoSb_BridgeDrain(JUNO_SB_BRIDGE_T *ptBridge, size_t zMax)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    tResult.tStatus = Verify(ptBridge);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_SB_BROKER_ROOT_T *ptDest = ptBridge->ptDestBroker;
+    // A visible MID means its message is visible too, so count the MIDs
+    JUNO_RESULT_SIZE_T tAvailable = JunoDs_QueueSpscAvailable(&ptBridge->tMidQueue);
+    JUNO_ASSERT_SUCCESS(tAvailable.tStatus, tResult.tStatus = tAvailable.tStatus; return tResult);
+    if(zMax == 0 || zMax > tAvailable.tOk)
+    {
+        zMax = tAvailable.tOk;
+    }
+    while(tResult.tOk < zMax)
+    {
+        // Take the MID first so the MID queue never holds more entries than the message queue
+        JUNO_SB_MID_T iMid = 0;
+        tResult.tStatus = JunoDs_QueueSpscPop(&ptBridge->tMidQueue, BridgeMid_PointerInit(&iMid));
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, break);
+        // Publish straight from the slot
+        JUNO_RESULT_POINTER_T tPtrResult = JunoDs_QueueSpscPeek(&ptBridge->tMsgQueue);
+        JUNO_ASSERT_SUCCESS(tPtrResult.tStatus, tResult.tStatus = tPtrResult.tStatus; break);
+        JUNO_STATUS_T tPubStatus = ptDest->ptApi->Publish(ptDest, iMid, JUNO_OK(tPtrResult));
+        // The slot is released even when the publish fails so the ring keeps moving
+        tResult.tStatus = JunoDs_QueueSpscDrop(&ptBridge->tMsgQueue);
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, break);
+        tResult.tOk += 1;
+        if(tPubStatus != JUNO_STATUS_SUCCESS)
+        {
+            tResult.tStatus = tPubStatus;
+            break;
+        }
+    }
+    return tResult;
+}
+
+static JUNO_STATUS_T Bridge_OnStart(JUNO_APP_ROOT_T *ptJunoApp)
+{
+    return Verify((JUNO_SB_BRIDGE_T *)(ptJunoApp));
+}
+
+// @{"req": ["REQ-SB-025"]}
+static JUNO_STATUS_T Bridge_OnProcess(JUNO_APP_ROOT_T *ptJunoApp)
+{
+    JUNO_SB_BRIDGE_T *ptBridge = (JUNO_SB_BRIDGE_T *)(ptJunoApp);
+    JUNO_ASSERT_EXISTS(ptBridge);
+    return JunoSb_BridgeDrain(ptBridge, ptBridge->zBatchLimit).tStatus;
+}
+
+static JUNO_STATUS_T Bridge_OnExit(JUNO_APP_ROOT_T *ptJunoApp)
+{
+    return Verify((JUNO_SB_BRIDGE_T *)(ptJunoApp));
+}
@@ -0,0 +1,258 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/sb/msg_ref.h"
+#include "juno/ds/array_api.h"
+#include "juno/macros.h"
+#include "juno/memory/memory_api.h"
+#include "juno/memory/memory_block.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/sb/broker_api.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include <stddef.h>
+#include <stdint.h>
+
+static JUNO_STATUS_T MsgRef_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T MsgRef_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T MsgRefArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T MsgRefArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T MsgRefArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+static const JUNO_POINTER_API_T gtMsgRefPointerApi =
+{
+    MsgRef_Copy,
+    MsgRef_Reset
+};
+
+static const JUNO_DS_ARRAY_API_T gtMsgRefArrayApi =
+{
+    MsgRefArray_SetAt,
+    MsgRefArray_GetAt,
+    MsgRefArray_RemoveAt
+};
+
+#define MsgRef_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, JUNO_SB_MSG_REF_T, gtMsgRefPointerApi)
+
+static inline JUNO_STATUS_T Verify(const JUNO_SB_MSG_POOL_T *ptPool)
+{
+    JUNO_ASSERT_EXISTS(ptPool);
+    if(!(
+        ptPool->ptApi &&
+        ptPool->ptAlloc &&
+        ptPool->pzRefCounts &&
+        ptPool->ptAlloc->pvMemory &&
+        ptPool->ptAlloc->zTypeSize &&
+        ptPool->ptAlloc->zLength
+    ))
+    {
+        JUNO_FAIL_ROOT(JUNO_STATUS_NULLPTR_ERROR, ptPool, "Module does not have all dependencies");
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    if(ptPool->ptApi != &gtMsgRefPointerApi)
+    {
+        JUNO_FAIL_ROOT(JUNO_STATUS_INVALID_TYPE_ERROR, ptPool, "Module has invalid API");
+        return JUNO_STATUS_INVALID_TYPE_ERROR;
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Get the reference count slot of the block a handle points to
+static JUNO_RESULT_SIZE_T RefIndex(const JUNO_SB_MSG_REF_T *ptRef)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    tResult.tStatus = Verify(ptRef->ptPool);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    const JUNO_MEMORY_ALLOC_BLOCK_T *ptAlloc = ptRef->ptPool->ptAlloc;
+    uintptr_t iStart = (uintptr_t)ptAlloc->pvMemory;
+    uintptr_t iAddr = (uintptr_t)ptRef->tMsg.pvAddr;
+    size_t zOffset = (size_t)(iAddr - iStart);
+    size_t iBlock = zOffset / ptAlloc->zTypeSize;
+    // The address must be the start of a block within the pool
+    if(iAddr < iStart || iBlock >= ptAlloc->zLength || iBlock * ptAlloc->zTypeSize != zOffset)
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_REF_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptRef->ptPool, "Handle does not reference a pool block");
+        return tResult;
+    }
+    tResult.tOk = iBlock;
+    if(ptRef->ptPool->pzRefCounts[tResult.tOk] == 0)
+    {
+        tResult.tStatus = JUNO_STATUS_INVALID_REF_ERROR;
+        JUNO_FAIL_ROOT(tResult.tStatus, ptRef->ptPool, "Handle references a released block");
+        return tResult;
+    }
+    return tResult;
+}
+
+// @{"req": ["REQ-SB-019"]}
+JUNO_STATUS_T JunoSb_MsgPoolInit(
+    JUNO_SB_MSG_POOL_T *ptPool,
+    JUNO_MEMORY_ALLOC_BLOCK_T *ptAlloc,
+    size_t *pzRefCounts,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvFailureUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptPool);
+    ptPool->ptApi = &gtMsgRefPointerApi;
+    ptPool->ptAlloc = ptAlloc;
+    ptPool->pzRefCounts = pzRefCounts;
+    ptPool->_pfcnFailureHandler = pfcnFailureHandler;
+    ptPool->_pvFailureUserData = pvFailureUserData;
+    JUNO_STATUS_T tStatus = Verify(ptPool);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(size_t i = 0; i < ptAlloc->zLength; i++)
+    {
+        pzRefCounts[i] = 0;
+    }
+    return tStatus;
+}
+
+// @{"req": ["REQ-SB-021"]}
+JUNO_STATUS_T JunoSb_MsgRefRelease(JUNO_SB_MSG_REF_T *ptRef)
+{
+    JUNO_ASSERT_EXISTS(ptRef);
+    if(!ptRef->ptPool)
+    {
+        // Empty handle, nothing to release
+        return JUNO_STATUS_SUCCESS;
+    }
+    JUNO_RESULT_SIZE_T tIndex = RefIndex(ptRef);
+    JUNO_ASSERT_SUCCESS(tIndex.tStatus, return tIndex.tStatus);
+    JUNO_SB_MSG_POOL_T *ptPool = ptRef->ptPool;
+    JUNO_POINTER_T tMsg = ptRef->tMsg;
+    *ptRef = (JUNO_SB_MSG_REF_T){0};
+    ptPool->pzRefCounts[tIndex.tOk] -= 1;
+    if(ptPool->pzRefCounts[tIndex.tOk] > 0)
+    {
+        return JUNO_STATUS_SUCCESS;
+    }
+    // Last reference, return the block to the allocator
+    JUNO_MEMORY_ALLOC_ROOT_T *ptAlloc = &ptPool->ptAlloc->tRoot;
+    return ptAlloc->ptApi->Put(ptAlloc, &tMsg);
+}
+
+// @{"req": ["REQ-SB-020"]}
+JUNO_STATUS_T JunoSb_PublishRef(JUNO_SB_BROKER_ROOT_T *ptBroker, JUNO_SB_MSG_POOL_T *ptPool, JUNO_SB_MID_T tMid, JUNO_POINTER_T tMsg)
+{
+    JUNO_STATUS_T tStatus = Verify(ptPool);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_ASSERT_EXISTS(ptBroker && ptBroker->ptApi);
+    tStatus = JunoMemory_PointerVerify(tMsg);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_MEMORY_ALLOC_ROOT_T *ptAlloc = &ptPool->ptAlloc->tRoot;
+    JUNO_RESULT_POINTER_T tBlock = ptAlloc->ptApi->Get(ptAlloc, tMsg.zSize);
+    JUNO_ASSERT_OK(tBlock, return tBlock.tStatus);
+    // Describe the block with the size of the message being copied
+    tStatus = ptAlloc->ptApi->Update(ptAlloc, &tBlock.tOk, tMsg.zSize);
+    JUNO_ASSERT_SUCCESS(tStatus, ptAlloc->ptApi->Put(ptAlloc, &tBlock.tOk); return tStatus);
+    // The only payload copy of the publish
+    tStatus = JunoMemory_PointerCopyWith(tMsg.ptApi, tBlock.tOk, tMsg);
+    JUNO_ASSERT_SUCCESS(tStatus, ptAlloc->ptApi->Put(ptAlloc, &tBlock.tOk); return tStatus);
+    JUNO_SB_MSG_REF_T tRef = {ptPool, tBlock.tOk};
+    // The publisher holds the first reference while the broker fans out
+    size_t iBlock = (size_t)((uint8_t *)tBlock.tOk.pvAddr - ptPool->ptAlloc->pvMemory) / ptPool->ptAlloc->zTypeSize;
+    ptPool->pzRefCounts[iBlock] = 1;
+    tStatus = ptBroker->ptApi->Publish(ptBroker, tMid, JunoSb_MsgRefPointerInit(ptPool, &tRef));
+    JUNO_STATUS_T tReleaseStatus = JunoSb_MsgRefRelease(&tRef);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return tReleaseStatus;
+}
+
+// @{"req": ["REQ-SB-019"]}
+static JUNO_STATUS_T MsgRef_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = MsgRef_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = MsgRef_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_SB_MSG_REF_T *ptDest = (JUNO_SB_MSG_REF_T *)tDest.pvAddr;
+    const JUNO_SB_MSG_REF_T *ptSrc = (const JUNO_SB_MSG_REF_T *)tSrc.pvAddr;
+    if(ptDest == ptSrc)
+    {
+        return JUNO_STATUS_SUCCESS;
+    }
+    if(!ptSrc->ptPool)
+    {
+        // Copying an empty handle releases the destination
+        return JunoSb_MsgRefRelease(ptDest);
+    }
+    JUNO_RESULT_SIZE_T tIndex = RefIndex(ptSrc);
+    JUNO_ASSERT_SUCCESS(tIndex.tStatus, return tIndex.tStatus);
+    // Acquire before releasing so self-referencing handles stay live
+    ptSrc->ptPool->pzRefCounts[tIndex.tOk] += 1;
+    tStatus = JunoSb_MsgRefRelease(ptDest);
+    JUNO_ASSERT_SUCCESS(tStatus, ptSrc->ptPool->pzRefCounts[tIndex.tOk] -= 1; return tStatus);
+    *ptDest = *ptSrc;
+    return JUNO_STATUS_SUCCESS;
+}
+
+// @{"req": ["REQ-SB-021"]}
+static JUNO_STATUS_T MsgRef_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = MsgRef_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoSb_MsgRefRelease((JUNO_SB_MSG_REF_T *)tPointer.pvAddr);
+}
+
+// @{"req": ["REQ-SB-022"]}
+JUNO_STATUS_T JunoSb_MsgRefArrayInit(
+    JUNO_SB_MSG_REF_ARRAY_T *ptArray,
+    JUNO_SB_MSG_REF_T *ptRefs,
+    size_t zCapacity,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvFailureUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptArray && ptRefs);
+    ptArray->ptRefs = ptRefs;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&ptArray->tRoot, &gtMsgRefArrayApi, zCapacity, pfcnFailureHandler, pvFailureUserData);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    for(size_t i = 0; i < zCapacity; i++)
+    {
+        ptRefs[i] = (JUNO_SB_MSG_REF_T){0};
+    }
+    return tStatus;
+}
+
+static JUNO_STATUS_T MsgRefArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_SB_MSG_REF_ARRAY_T *ptRefArray = (JUNO_SB_MSG_REF_ARRAY_T *)ptArray;
+    JUNO_POINTER_T tSlot = JunoMemory_PointerInit(&gtMsgRefPointerApi, JUNO_SB_MSG_REF_T, &ptRefArray->ptRefs[iIndex]);
+    return MsgRef_Copy(tSlot, tItem);
+}
+
+static JUNO_RESULT_POINTER_T MsgRefArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_SUCCESS, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_SB_MSG_REF_ARRAY_T *ptRefArray = (JUNO_SB_MSG_REF_ARRAY_T *)ptArray;
+    tResult.tOk = JunoMemory_PointerInit(&gtMsgRefPointerApi, JUNO_SB_MSG_REF_T, &ptRefArray->ptRefs[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T MsgRefArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    JUNO_SB_MSG_REF_ARRAY_T *ptRefArray = (JUNO_SB_MSG_REF_ARRAY_T *)ptArray;
+    return JunoSb_MsgRefRelease(&ptRefArray->ptRefs[iIndex]);
+}
@@ -0,0 +1,365 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include "juno/time/timer_wheel.h"
+#include "juno/macros.h"
+#include "juno/status.h"
+#include "juno/time/time_api.h"
+#include "juno/types.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+static const JUNO_TIME_SUBSECONDS_T giSUBSECS_MAX = (~(JUNO_TIME_SUBSECONDS_T)0);
+
+/// Convert a timestamp to a count of subseconds. Exact for every timestamp
+static inline uint64_t ToSubSeconds(JUNO_TIMESTAMP_T tTime)
+{
+    return (uint64_t)tTime.iSeconds * giSUBSECS_MAX + tTime.iSubSeconds;
+}
+
+/// Convert a count of subseconds to a timestamp
+static inline JUNO_TIMESTAMP_T FromSubSeconds(uint64_t iSubSeconds)
+{
+    JUNO_TIMESTAMP_T tTime = {0};
+    tTime.iSeconds = (JUNO_TIME_SECONDS_T)(iSubSeconds / giSUBSECS_MAX);
+    tTime.iSubSeconds = (JUNO_TIME_SUBSECONDS_T)(iSubSeconds % giSUBSECS_MAX);
+    return tTime;
+}
+
+static inline JUNO_STATUS_T Verify(const JUNO_TIME_WHEEL_T *ptWheel)
+{
+    JUNO_ASSERT_EXISTS(ptWheel);
+    if(!(ptWheel->ptTime &&
+         ptWheel->ptTime->ptApi &&
+         ptWheel->ptTime->ptApi->Now &&
+         ptWheel->ptTime->ptApi->AddTime &&
+         ptWheel->ptTime->ptApi->SubtractTime &&
+         ptWheel->ptSlots))
+    {
+        JUNO_FAIL_ROOT(JUNO_STATUS_NULLPTR_ERROR, ptWheel, "Module does not have all dependencies");
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    if(ptWheel->zLevelBits < 1 || ptWheel->zLevelBits > JUNO_TIME_WHEEL_LEVEL_BITS_MAX ||
+       ptWheel->zLevels < 1 || ptWheel->zLevels > 63 / ptWheel->zLevelBits ||
+       ToSubSeconds(ptWheel->tTick) == 0)
+    {
+        JUNO_FAIL_ROOT(JUNO_STATUS_INVALID_SIZE_ERROR, ptWheel, "Invalid wheel geometry or tick");
+        return JUNO_STATUS_INVALID_SIZE_ERROR;
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+static inline JUNO_STATUS_T VerifyTimer(const JUNO_TIME_WHEEL_T *ptWheel, const JUNO_TIME_TIMER_T *ptTimer)
+{
+    JUNO_STATUS_T tStatus = Verify(ptWheel);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(!(ptTimer && ptTimer->pfcnCallback))
+    {
+        JUNO_FAIL_ROOT(JUNO_STATUS_NULLPTR_ERROR, ptWheel, "Timer is null or has no callback");
+        return JUNO_STATUS_NULLPTR_ERROR;
+    }
+    return tStatus;
+}
+
+/// Link a timer at the head of a list
+static inline void Link(JUNO_TIME_TIMER_T **pptHead, JUNO_TIME_TIMER_T *ptTimer)
+{
+    ptTimer->ptNext = *pptHead;
+    if(ptTimer->ptNext)
+    {
+        ptTimer->ptNext->pptPrev = &ptTimer->ptNext;
+    }
+    ptTimer->pptPrev = pptHead;
+    *pptHead = ptTimer;
+}
+
+/// Unlink a timer from its list and mark it inactive
+static inline void Unlink(JUNO_TIME_TIMER_T *ptTimer)
+{
+    *ptTimer->pptPrev = ptTimer->ptNext;
+    if(ptTimer->ptNext)
+    {
+        ptTimer->ptNext->pptPrev = ptTimer->pptPrev;
+    }
+    ptTimer->ptNext = NULL;
+    ptTimer->pptPrev = NULL;
+}
+
+/// Move a slot list into a local head so it can be drained while timers are re-linked
+static inline void Detach(JUNO_TIME_TIMER_T **pptSlot, JUNO_TIME_TIMER_T **pptHead)
+{
+    *pptHead = *pptSlot;
+    *pptSlot = NULL;
+    if(*pptHead)
+    {
+        (*pptHead)->pptPrev = pptHead;
+    }
+}
+
+/// Link a timer into the slot of the lowest level whose span covers its expiry
+static void Place(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIME_TIMER_T *ptTimer)
+{
+    const size_t zBits = ptWheel->zLevelBits;
+    const JUNO_TIME_TICK_T iMask = ((JUNO_TIME_TICK_T)1 << zBits) - 1;
+    const JUNO_TIME_TICK_T iRange = ((JUNO_TIME_TICK_T)1 << (zBits * ptWheel->zLevels)) - 1;
+    JUNO_TIME_TICK_T iTick = ptTimer->iExpiryTick;
+    JUNO_TIME_TICK_T iDelta = iTick > ptWheel->iNowTick ? iTick - ptWheel->iNowTick : 0;
+    if(iDelta > iRange)
+    {
+        // Park beyond-range timers in the top level, they are re-placed when cascaded
+        iDelta = iRange;
+        iTick = ptWheel->iNowTick + iDelta;
+    }
+    else if(iDelta == 0)
+    {
+        // Only cascades re-place due timers, into the slot about to be processed
+        iTick = ptWheel->iNowTick;
+    }
+    size_t zLevel = 0;
+    while((iDelta >> (zBits * (zLevel + 1))) != 0)
+    {
+        zLevel++;
+    }
+    size_t zSlot = (zLevel << zBits) + (size_t)((iTick >> (zBits * zLevel)) & iMask);
+    Link(&ptWheel->ptSlots[zSlot], ptTimer);
+}
+
+/// Compute the first tick whose boundary is at or after tExpiry
+static JUNO_STATUS_T ExpiryTick(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIMESTAMP_T tExpiry, JUNO_TIME_TICK_T *piTick)
+{
+    *piTick = ptWheel->iNowTick + 1;
+    if(!JunoTime_TimestampGreaterThan(tExpiry, ptWheel->tNextTick))
+    {
+        return JUNO_STATUS_SUCCESS;
+    }
+    JUNO_STATUS_T tStatus = ptWheel->ptTime->ptApi->SubtractTime(ptWheel->ptTime, &tExpiry, ptWheel->tNextTick);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    uint64_t iRemaining = ToSubSeconds(tExpiry);
+    uint64_t iTick = ToSubSeconds(ptWheel->tTick);
+    *piTick += iRemaining / iTick + (iRemaining % iTick != 0);
+    return tStatus;
+}
+
+// @{"req": ["REQ-TIME-020"]}
+JUNO_STATUS_T JunoTime_WheelInit(
+    JUNO_TIME_WHEEL_T *ptWheel,
+    const JUNO_TIME_ROOT_T *ptTime,
+    JUNO_TIME_TIMER_T **ptSlots,
+    size_t zSlots,
+    size_t zLevelBits,
+    size_t zLevels,
+    JUNO_TIMESTAMP_T tTick,
+    JUNO_FAILURE_HANDLER_T pfcnFailureHandler,
+    JUNO_USER_DATA_T *pvFailureUserData
+)
+{
+    JUNO_ASSERT_EXISTS(ptWheel);
+    ptWheel->ptApi = NULL;
+    ptWheel->ptTime = ptTime;
+    ptWheel->ptSlots = ptSlots;
+    ptWheel->zLevelBits = zLevelBits;
+    ptWheel->zLevels = zLevels;
+    ptWheel->tTick = tTick;
+    ptWheel->iNowTick = 0;
+    ptWheel->zActive = 0;
+    ptWheel->_pfcnFailureHandler = pfcnFailureHandler;
+    ptWheel->_pvFailureUserData = pvFailureUserData;
+    JUNO_STATUS_T tStatus = Verify(ptWheel);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(zSlots != JUNO_TIME_WHEEL_SLOTS(zLevelBits, zLevels))
+    {
+        tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptWheel, "Slot storage does not match the wheel geometry");
+        return tStatus;
+    }
+    for(size_t i = 0; i < zSlots; i++)
+    {
+        ptSlots[i] = NULL;
+    }
+    JUNO_TIMESTAMP_RESULT_T tNow = ptTime->ptApi->Now(ptTime);
+    JUNO_ASSERT_OK(tNow, return tNow.tStatus);
+    ptWheel->tNextTick = tNow.tOk;
+    tStatus = ptTime->ptApi->AddTime(ptTime, &ptWheel->tNextTick, tTick);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return tStatus;
+}
+
+// @{"req": ["REQ-TIME-021"]}
+JUNO_STATUS_T JunoTime_TimerInit(JUNO_TIME_TIMER_T *ptTimer, JUNO_TIME_TIMER_CALLBACK_T pfcnCallback, JUNO_USER_DATA_T *pvUserData)
+{
+    JUNO_ASSERT_EXISTS(ptTimer && pfcnCallback);
+    ptTimer->ptNext = NULL;
+    ptTimer->pptPrev = NULL;
+    ptTimer->iExpiryTick = 0;
+    ptTimer->tExpiry = (JUNO_TIMESTAMP_T){0};
+    ptTimer->pfcnCallback = pfcnCallback;
+    ptTimer->pvUserData = pvUserData;
+    return JUNO_STATUS_SUCCESS;
+}
+
+// @{"req": ["REQ-TIME-022"]}
+JUNO_STATUS_T JunoTime_TimerStartAt(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIME_TIMER_T *ptTimer, JUNO_TIMESTAMP_T tExpiry)
+{
+    JUNO_STATUS_T tStatus = VerifyTimer(ptWheel, ptTimer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(ptTimer->pptPrev)
+    {
+        tStatus = JUNO_STATUS_REF_IN_USE_ERROR;
+        JUNO_FAIL_ROOT(tStatus, ptWheel, "Timer is already active");
+        return tStatus;
+    }
+    tStatus = ExpiryTick(ptWheel, tExpiry, &ptTimer->iExpiryTick);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    ptTimer->tExpiry = tExpiry;
+    Place(ptWheel, ptTimer);
+    ptWheel->zActive += 1;
+    return tStatus;
+}
+
+// @{"req": ["REQ-TIME-022"]}
+JUNO_STATUS_T JunoTime_TimerStart(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIME_TIMER_T *ptTimer, JUNO_TIMESTAMP_T tDelay)
+{
+    JUNO_STATUS_T tStatus = VerifyTimer(ptWheel, ptTimer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    const JUNO_TIME_ROOT_T *ptTime = ptWheel->ptTime;
+    JUNO_TIMESTAMP_RESULT_T tExpiry = ptTime->ptApi->Now(ptTime);
+    JUNO_ASSERT_OK(tExpiry, return tExpiry.tStatus);
+    tStatus = ptTime->ptApi->AddTime(ptTime, &tExpiry.tOk, tDelay);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoTime_TimerStartAt(ptWheel, ptTimer, tExpiry.tOk);
+}
+
+// @{"req": ["REQ-TIME-023"]}
+JUNO_STATUS_T JunoTime_TimerStop(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIME_TIMER_T *ptTimer)
+{
+    JUNO_STATUS_T tStatus = VerifyTimer(ptWheel, ptTimer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    if(ptTimer->pptPrev)
+    {
+        Unlink(ptTimer);
+        ptWheel->zActive -= 1;
+    }
+    return tStatus;
+}
+
+// @{"req": ["REQ-TIME-023"]}
+JUNO_STATUS_T JunoTime_TimerRestart(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIME_TIMER_T *ptTimer, JUNO_TIMESTAMP_T tDelay)
+{
+    JUNO_STATUS_T tStatus = JunoTime_TimerStop(ptWheel, ptTimer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoTime_TimerStart(ptWheel, ptTimer, tDelay);
+}
+
+/// Re-place the timers of the upper level slots that the current tick enters
+static void Cascade(JUNO_TIME_WHEEL_T *ptWheel)
+{
+    const size_t zBits = ptWheel->zLevelBits;
+    const JUNO_TIME_TICK_T iMask = ((JUNO_TIME_TICK_T)1 << zBits) - 1;
+    for(size_t zLevel = 1; zLevel < ptWheel->zLevels; zLevel++)
+    {
+        // A level turns one slot each time every level below it wraps
+        if(((ptWheel->iNowTick >> (zBits * (zLevel - 1))) & iMask) != 0)
+        {
+            break;
+        }
+        size_t zSlot = (zLevel << zBits) + (size_t)((ptWheel->iNowTick >> (zBits * zLevel)) & iMask);
+        JUNO_TIME_TIMER_T *ptHead = NULL;
+        Detach(&ptWheel->ptSlots[zSlot], &ptHead);
+        while(ptHead)
+        {
+            JUNO_TIME_TIMER_T *ptTimer = ptHead;
+            Unlink(ptTimer);
+            Place(ptWheel, ptTimer);
+        }
+    }
+}
+
+// @{"req": ["REQ-TIME-024"]}
+JUNO_RESULT_SIZE_T JunoTime_WheelAdvance(JUNO_TIME_WHEEL_T *ptWheel, JUNO_TIMESTAMP_T tNow)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    tResult.tStatus = Verify(ptWheel);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    const JUNO_TIME_ROOT_T *ptTime = ptWheel->ptTime;
+    const JUNO_TIME_TICK_T iMask = ((JUNO_TIME_TICK_T)1 << ptWheel->zLevelBits) - 1;
+    JUNO_STATUS_T tCallbackStatus = JUNO_STATUS_SUCCESS;
+    while(!JunoTime_TimestampLessThan(tNow, ptWheel->tNextTick))
+    {
+        if(ptWheel->zActive == 0)
+        {
+            // Nothing to fire, jump over every elapsed tick at once
+            JUNO_TIMESTAMP_T tElapsed = tNow;
+            tResult.tStatus = ptTime->ptApi->SubtractTime(ptTime, &tElapsed, ptWheel->tNextTick);
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            uint64_t iTick = ToSubSeconds(ptWheel->tTick);
+            uint64_t iTicks = ToSubSeconds(tElapsed) / iTick;
+            ptWheel->iNowTick += iTicks + 1;
+            tResult.tStatus = ptTime->ptApi->AddTime(ptTime, &ptWheel->tNextTick, FromSubSeconds(iTicks * iTick));
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            tResult.tStatus = ptTime->ptApi->AddTime(ptTime, &ptWheel->tNextTick, ptWheel->tTick);
+            JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+            break;
+        }
+        ptWheel->iNowTick += 1;
+        tResult.tStatus = ptTime->ptApi->AddTime(ptTime, &ptWheel->tNextTick, ptWheel->tTick);
+        JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+        if((ptWheel->iNowTick & iMask) == 0)
+        {
+            Cascade(ptWheel);
+        }
+        JUNO_TIME_TIMER_T *ptHead = NULL;
+        Detach(&ptWheel->ptSlots[ptWheel->iNowTick & iMask], &ptHead);
+        while(ptHead)
+        {
+            JUNO_TIME_TIMER_T *ptTimer = ptHead;
+            Unlink(ptTimer);
+            if(ptTimer->iExpiryTick > ptWheel->iNowTick)
+            {
+                Place(ptWheel, ptTimer);
+                continue;
+            }
+            ptWheel->zActive -= 1;
+            tResult.tOk += 1;
+            // Callbacks may stop or restart any timer, including those still in ptHead
+            JUNO_STATUS_T tStatus = ptTimer->pfcnCallback(ptTimer, ptTimer->pvUserData);
+            if(tStatus != JUNO_STATUS_SUCCESS && tCallbackStatus == JUNO_STATUS_SUCCESS)
+            {
+                tCallbackStatus = tStatus;
+            }
+        }
+        if(tCallbackStatus != JUNO_STATUS_SUCCESS)
+        {
+            tResult.tStatus = tCallbackStatus;
+            JUNO_FAIL_ROOT(tResult.tStatus, ptWheel, "Timer callback failed");
+            return tResult;
+        }
+    }
+    return tResult;
+}
+
+// @{"req": ["REQ-TIME-024"]}
+JUNO_RESULT_SIZE_T JunoTime_WheelPoll(JUNO_TIME_WHEEL_T *ptWheel)
+{
+    JUNO_RESULT_SIZE_T tResult = {JUNO_STATUS_SUCCESS, 0};
+    tResult.tStatus = Verify(ptWheel);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    JUNO_TIMESTAMP_RESULT_T tNow = ptWheel->ptTime->ptApi->Now(ptWheel->ptTime);
+    tResult.tStatus = tNow.tStatus;
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    return JunoTime_WheelAdvance(ptWheel, tNow.tOk);
+}
@@ -16,6 +16,11 @@
 */
 #include "juno/crc/crc.h"
 #include "crc/zip.h"
+#include "crc/hw.h"
+#include "crc/slice.h"
+#if JUNO_CRC_SLICE > 1
+#include "crc/zip_slice.h"
+#endif
 
 // @{"req": ["REQ-CRC-001", "REQ-CRC-002", "REQ-CRC-003", "REQ-CRC-009", "REQ-CRC-010"]}
 uint32_t Juno_CrcZipUpdate(uint32_t iCrc, const void *pcData, size_t zDataSize)
@@ -28,6 +33,28 @@ uint32_t Juno_CrcZipUpdate(uint32_t iCrc, const void *pcData, size_t zDataSize)
     register const uint8_t *cp = pcData;
     register size_t cnt = zDataSize;
 
+#if JUNO_CRC_HW
+    if(cnt >= JUNO_CRC_HW_MIN && gpfcnJunoCrcZipHw)
+    {
+        // The kernel takes whole blocks; the tables finish the tail
+        size_t zBulk = cnt - cnt % JUNO_CRC_HW_BLOCK;
+        crc = gpfcnJunoCrcZipHw(crc, cp, zBulk);
+        cp += zBulk;
+        cnt -= zBulk;
+    }
+#endif
+
+#if JUNO_CRC_SLICE > 1
+    // Consume JUNO_CRC_SLICE bytes per step; the low CRC byte meets the first data byte
+    for(; cnt >= JUNO_CRC_SLICE; cnt -= JUNO_CRC_SLICE, cp += JUNO_CRC_SLICE) {
+        crc = zip_crctab_slice[JUNO_CRC_SLICE - 1][(crc ^ cp[0]) & 0xff] ^
+            zip_crctab_slice[JUNO_CRC_SLICE - 2][((crc >> 8) ^ cp[1]) & 0xff] ^
+            zip_crctab_slice[JUNO_CRC_SLICE - 3][((crc >> 16) ^ cp[2]) & 0xff] ^
+            zip_crctab_slice[JUNO_CRC_SLICE - 4][((crc >> 24) ^ cp[3]) & 0xff] ^
+            JUNO_CRC_SLICE_DATA32(zip_crctab_slice, cp);
+    }
+#endif
+
     while(cnt--) {
 	crc=((crc>>8)&M1_32)^zip_crctab[(crc&0xff)^*cp++];
     }
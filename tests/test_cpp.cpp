@@ -19,7 +19,12 @@
 #include "juno/ds/queue_api.h"
 #include "juno/ds/stack_api.h"
 #include "juno/ds/heap_api.h"
+#include "juno/ds/heap_fast.h"
+#include "juno/ds/heap_indexed.h"
 #include "juno/crc/crc.h"
+#include "juno/crc/crc.hpp"
+#include "juno/crc/crc_stream.h"
+#include "juno/crc/crc_posix.h"
 #include "juno/io/async_io_api.h"
 #include "juno/io/i2c_io_api.h"
 #include "juno/io/spi_io_api.h"
@@ -28,6 +33,7 @@
 #include "juno/math/juno_math.h"
 #include "juno/memory/memory_api.h"
 #include "juno/time/time_api.h"
+#include "juno/time/timer_wheel.h"
 #include "juno/sb/broker_api.h"
 #include "juno/sm/sm_api.h"
 
@@ -19,6 +19,12 @@
 #include "unity_internals.h"
 #include <stdbool.h>
 #include "juno/crc/crc.h"
+#include "juno/crc/crc_parallel.h"
+#include "juno/crc/crc_posix.h"
+#include "juno/crc/crc_pthread.h"
+#include "juno/crc/crc_stream.h"
+#include "juno/io/async_io_api.h"
+#include <stdlib.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <string.h>
@@ -104,6 +110,435 @@ static void test_various_crc_behaviour(void)
     TEST_ASSERT_NOT_EQUAL(crc_k1, Juno_CrcKermitUpdate(JUNO_KERMIT_CRC_INIT, data2, len2));
 }
 
+// @{"verify": ["REQ-CRC-004", "REQ-CRC-005", "REQ-CRC-006", "REQ-CRC-007", "REQ-CRC-008", "REQ-CRC-009"]}
+static void test_crc_check_values(void)
+{
+    // Catalogue check values over the ASCII string "123456789"
+    const char acCheck[] = "123456789";
+    const size_t zLen = sizeof(acCheck) - 1;
+    TEST_ASSERT_EQUAL_UINT16(0xBB3D, Juno_CrcArcUpdate(JUNO_ARC_CRC_INIT, acCheck, zLen));
+    TEST_ASSERT_EQUAL_UINT16(0x31C3, Juno_CrcBinhexUpdate(JUNO_BINHEX_CRC_INIT, acCheck, zLen));
+    TEST_ASSERT_EQUAL_UINT16(0x29B1, Juno_CrcCcittUpdate(JUNO_CCITT_CRC_INIT, acCheck, zLen));
+    TEST_ASSERT_EQUAL_UINT32(0x0376E6E7, Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, acCheck, zLen));
+    TEST_ASSERT_EQUAL_UINT16(0x2189, Juno_CrcKermitUpdate(JUNO_KERMIT_CRC_INIT, acCheck, zLen));
+    TEST_ASSERT_EQUAL_UINT32(0xCBF43926, Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, acCheck, zLen));
+}
+
+// @{"verify": ["REQ-CRC-015", "REQ-CRC-016"]}
+static void test_crc_castagnoli_crc64_known_answers(void)
+{
+    const char acCheck[] = "123456789";
+    const size_t zLen = sizeof(acCheck) - 1;
+    TEST_ASSERT_EQUAL_UINT32(0xE3069283, Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, acCheck, zLen));
+    TEST_ASSERT_EQUAL_UINT64(0x995DC9BBDF1939FAull, Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, acCheck, zLen));
+    // RFC 3720 B.4 iSCSI vectors: 32 bytes of zeros, ones and an ascending ramp
+    uint8_t acVector[32] = {0};
+    TEST_ASSERT_EQUAL_UINT32(0x8A9136AA, Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, acVector, sizeof(acVector)));
+    for(size_t i = 0; i < sizeof(acVector); i++)
+    {
+        acVector[i] = 0xFF;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0x62A8AB43, Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, acVector, sizeof(acVector)));
+    for(size_t i = 0; i < sizeof(acVector); i++)
+    {
+        acVector[i] = (uint8_t)i;
+    }
+    TEST_ASSERT_EQUAL_UINT32(0x46DD794E, Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, acVector, sizeof(acVector)));
+    // Streaming with the final XOR undone matches one call
+    uint32_t iCastagnoli = Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, acCheck, 4) ^ 0xFFFFFFFF;
+    TEST_ASSERT_EQUAL_UINT32(0xE3069283, Juno_CrcCastagnoliUpdate(iCastagnoli, &acCheck[4], zLen - 4));
+    uint64_t iCrc64 = Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, acCheck, 4) ^ 0xFFFFFFFFFFFFFFFFull;
+    TEST_ASSERT_EQUAL_UINT64(0x995DC9BBDF1939FAull, Juno_CrcCrc64Update(iCrc64, &acCheck[4], zLen - 4));
+    TEST_ASSERT_EQUAL_UINT32(0, Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, NULL, 0));
+    TEST_ASSERT_EQUAL_UINT64(0, Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, acCheck, 0));
+}
+
+// @{"verify": ["REQ-CRC-011", "REQ-CRC-015", "REQ-CRC-016"]}
+static void test_crc_multi_byte_matches_byte_at_a_time(void)
+{
+    // Every length and alignment around the slicing step must equal the
+    // byte-at-a-time result, obtained here by feeding one byte per call
+    uint8_t acBuf[80];
+    for(size_t i = 0; i < sizeof(acBuf); i++)
+    {
+        acBuf[i] = (uint8_t)(i * 37u + 11u);
+    }
+    for(size_t iOffset = 0; iOffset < 8; iOffset++)
+    {
+        for(size_t zLen = 1; zLen <= sizeof(acBuf) - iOffset; zLen++)
+        {
+            const uint8_t *pcData = &acBuf[iOffset];
+            uint16_t iArc = JUNO_ARC_CRC_INIT;
+            uint16_t iBinhex = JUNO_BINHEX_CRC_INIT;
+            uint16_t iCcitt = JUNO_CCITT_CRC_INIT;
+            uint32_t iCcitt32 = JUNO_CCITT32_CRC_INIT;
+            uint16_t iKermit = JUNO_KERMIT_CRC_INIT;
+            uint32_t iZip = JUNO_ZIP_CRC_INIT;
+            uint32_t iCastagnoli = JUNO_CASTAGNOLI_CRC_INIT;
+            uint64_t iCrc64 = JUNO_CRC64_CRC_INIT;
+            for(size_t i = 0; i < zLen; i++)
+            {
+                iArc = Juno_CrcArcUpdate(iArc, &pcData[i], 1);
+                iBinhex = Juno_CrcBinhexUpdate(iBinhex, &pcData[i], 1);
+                iCcitt = Juno_CrcCcittUpdate(iCcitt, &pcData[i], 1);
+                iCcitt32 = Juno_CrcCcitt32Update(iCcitt32, &pcData[i], 1);
+                iKermit = Juno_CrcKermitUpdate(iKermit, &pcData[i], 1);
+                // Undo the final XOR between chunks
+                iZip = Juno_CrcZipUpdate(iZip, &pcData[i], 1) ^ 0xFFFFFFFF;
+                iCastagnoli = Juno_CrcCastagnoliUpdate(iCastagnoli, &pcData[i], 1) ^ 0xFFFFFFFF;
+                iCrc64 = Juno_CrcCrc64Update(iCrc64, &pcData[i], 1) ^ 0xFFFFFFFFFFFFFFFFull;
+            }
+            TEST_ASSERT_EQUAL_UINT16(iArc, Juno_CrcArcUpdate(JUNO_ARC_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT16(iBinhex, Juno_CrcBinhexUpdate(JUNO_BINHEX_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT16(iCcitt, Juno_CrcCcittUpdate(JUNO_CCITT_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT32(iCcitt32, Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT16(iKermit, Juno_CrcKermitUpdate(JUNO_KERMIT_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT32(iZip ^ 0xFFFFFFFF, Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT32(iCastagnoli ^ 0xFFFFFFFF, Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT64(iCrc64 ^ 0xFFFFFFFFFFFFFFFFull, Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, pcData, zLen));
+        }
+    }
+}
+
+// @{"verify": ["REQ-CRC-012", "REQ-CRC-015"]}
+static void test_crc_hw_matches_portable(void)
+{
+    // The accelerated kernels are checked against the table-driven reference
+    // for lengths around the 64 byte threshold and 16 byte blocks, at every
+    // alignment of a 16 byte load
+    static uint8_t acBuf[4096 + 16];
+    for(size_t i = 0; i < sizeof(acBuf); i++)
+    {
+        acBuf[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+    static const size_t azLengths[] = {1, 15, 63, 64, 65, 79, 80, 127, 128, 129, 255, 1000, 4096};
+    for(size_t iOffset = 0; iOffset < 16; iOffset++)
+    {
+        for(size_t i = 0; i < sizeof(azLengths) / sizeof(azLengths[0]); i++)
+        {
+            const uint8_t *pcData = &acBuf[iOffset];
+            size_t zLen = azLengths[i];
+            TEST_ASSERT_FALSE(Juno_CrcHwInit(false));
+            uint32_t iZip = Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, pcData, zLen);
+            uint32_t iCcitt32 = Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, pcData, zLen);
+            uint32_t iZipSeeded = Juno_CrcZipUpdate(0x12345678, pcData, zLen);
+            uint32_t iCcitt32Seeded = Juno_CrcCcitt32Update(0x12345678, pcData, zLen);
+            uint32_t iCastagnoli = Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, pcData, zLen);
+            uint32_t iCastagnoliSeeded = Juno_CrcCastagnoliUpdate(0x12345678, pcData, zLen);
+            Juno_CrcHwInit(true);
+            TEST_ASSERT_EQUAL_UINT32(iZip, Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT32(iCcitt32, Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT32(iZipSeeded, Juno_CrcZipUpdate(0x12345678, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT32(iCcitt32Seeded, Juno_CrcCcitt32Update(0x12345678, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT32(iCastagnoli, Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, pcData, zLen));
+            TEST_ASSERT_EQUAL_UINT32(iCastagnoliSeeded, Juno_CrcCastagnoliUpdate(0x12345678, pcData, zLen));
+        }
+    }
+    const char acCheck[] = "123456789";
+    TEST_ASSERT_EQUAL_UINT32(0xCBF43926, Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, acCheck, sizeof(acCheck) - 1));
+    Juno_CrcHwInit(false);
+}
+
+// @{"verify": ["REQ-CRC-013"]}
+static void test_crc_combine_matches_streaming(void)
+{
+    // Combining the CRCs of both halves must equal one pass over the whole
+    // buffer for every split point, including the empty tail
+    static uint8_t acBuf[300];
+    for(size_t i = 0; i < sizeof(acBuf); i++)
+    {
+        acBuf[i] = (uint8_t)((i * 2654435761u) >> 11);
+    }
+    const size_t zLen = sizeof(acBuf);
+    uint16_t iArc = Juno_CrcArcUpdate(JUNO_ARC_CRC_INIT, acBuf, zLen);
+    uint16_t iBinhex = Juno_CrcBinhexUpdate(JUNO_BINHEX_CRC_INIT, acBuf, zLen);
+    uint16_t iCcitt = Juno_CrcCcittUpdate(JUNO_CCITT_CRC_INIT, acBuf, zLen);
+    uint32_t iCcitt32 = Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, acBuf, zLen);
+    uint16_t iKermit = Juno_CrcKermitUpdate(JUNO_KERMIT_CRC_INIT, acBuf, zLen);
+    uint32_t iZip = Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, acBuf, zLen);
+    uint32_t iCastagnoli = Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, acBuf, zLen);
+    uint64_t iCrc64 = Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, acBuf, zLen);
+    for(size_t zSplit = 1; zSplit <= zLen; zSplit++)
+    {
+        const uint8_t *pcTail = &acBuf[zSplit];
+        size_t zTail = zLen - zSplit;
+        TEST_ASSERT_EQUAL_UINT16(iArc, Juno_CrcArcCombine(
+            Juno_CrcArcUpdate(JUNO_ARC_CRC_INIT, acBuf, zSplit),
+            Juno_CrcArcUpdate(JUNO_ARC_CRC_INIT, pcTail, zTail), zTail));
+        TEST_ASSERT_EQUAL_UINT16(iBinhex, Juno_CrcBinhexCombine(
+            Juno_CrcBinhexUpdate(JUNO_BINHEX_CRC_INIT, acBuf, zSplit),
+            Juno_CrcBinhexUpdate(JUNO_BINHEX_CRC_INIT, pcTail, zTail), zTail));
+        TEST_ASSERT_EQUAL_UINT16(iCcitt, Juno_CrcCcittCombine(
+            Juno_CrcCcittUpdate(JUNO_CCITT_CRC_INIT, acBuf, zSplit),
+            Juno_CrcCcittUpdate(JUNO_CCITT_CRC_INIT, pcTail, zTail), zTail));
+        TEST_ASSERT_EQUAL_UINT32(iCcitt32, Juno_CrcCcitt32Combine(
+            Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, acBuf, zSplit),
+            Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, pcTail, zTail), zTail));
+        TEST_ASSERT_EQUAL_UINT16(iKermit, Juno_CrcKermitCombine(
+            Juno_CrcKermitUpdate(JUNO_KERMIT_CRC_INIT, acBuf, zSplit),
+            Juno_CrcKermitUpdate(JUNO_KERMIT_CRC_INIT, pcTail, zTail), zTail));
+        TEST_ASSERT_EQUAL_UINT32(iZip, Juno_CrcZipCombine(
+            Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, acBuf, zSplit),
+            Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, pcTail, zTail), zTail));
+        TEST_ASSERT_EQUAL_UINT32(iCastagnoli, Juno_CrcCastagnoliCombine(
+            Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, acBuf, zSplit),
+            Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, pcTail, zTail), zTail));
+        TEST_ASSERT_EQUAL_UINT64(iCrc64, Juno_CrcCrc64Combine(
+            Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, acBuf, zSplit),
+            Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, pcTail, zTail), zTail));
+    }
+    // Lengths far beyond the buffer exercise the square-and-multiply path:
+    // CRC-32 of 1 MiB of zeros is 0xA738EA1C
+    static uint8_t acZeros[4096];
+    uint32_t iZeros = Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, acZeros, sizeof(acZeros));
+    uint32_t iMiB = iZeros;
+    for(size_t i = 1; i < 256; i++)
+    {
+        iMiB = Juno_CrcZipCombine(iMiB, iZeros, sizeof(acZeros));
+    }
+    TEST_ASSERT_EQUAL_UINT32(0xA738EA1C, iMiB);
+}
+
+/// Executor running the jobs back to front on the calling thread
+static JUNO_STATUS_T ReverseExecutor(JUNO_CRC_JOB_T *ptJobs, size_t zJobs, JUNO_USER_DATA_T *pvUserData)
+{
+    size_t *pzCalls = (size_t *)pvUserData;
+    *pzCalls = zJobs;
+    for(size_t i = zJobs; i > 0; i--)
+    {
+        Juno_CrcJobRun(&ptJobs[i - 1]);
+    }
+    return JUNO_STATUS_SUCCESS;
+}
+
+/// Executor that fails without running anything
+static JUNO_STATUS_T FailingExecutor(JUNO_CRC_JOB_T *ptJobs, size_t zJobs, JUNO_USER_DATA_T *pvUserData)
+{
+    (void)ptJobs;
+    (void)zJobs;
+    (void)pvUserData;
+    return JUNO_STATUS_ERR;
+}
+
+// @{"verify": ["REQ-CRC-014"]}
+static void test_crc_parallel_matches_serial(void)
+{
+    static uint8_t acBuf[100000];
+    for(size_t i = 0; i < sizeof(acBuf); i++)
+    {
+        acBuf[i] = (uint8_t)((i * 2246822519u) >> 9);
+    }
+    JUNO_CRC_JOB_T atJobs[8];
+    static const size_t azLengths[] = {1, 63, 64, 500, 4097, sizeof(acBuf)};
+    for(size_t i = 0; i < sizeof(azLengths) / sizeof(azLengths[0]); i++)
+    {
+        size_t zLen = azLengths[i];
+        uint64_t aiSerial[8] = {
+            Juno_CrcArcUpdate(JUNO_ARC_CRC_INIT, acBuf, zLen),
+            Juno_CrcBinhexUpdate(JUNO_BINHEX_CRC_INIT, acBuf, zLen),
+            Juno_CrcCcittUpdate(JUNO_CCITT_CRC_INIT, acBuf, zLen),
+            Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, acBuf, zLen),
+            Juno_CrcKermitUpdate(JUNO_KERMIT_CRC_INIT, acBuf, zLen),
+            Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, acBuf, zLen),
+            Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, acBuf, zLen),
+            Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, acBuf, zLen),
+        };
+        uint64_t aiInit[8] = {
+            (uint16_t)JUNO_ARC_CRC_INIT, (uint16_t)JUNO_BINHEX_CRC_INIT, (uint16_t)JUNO_CCITT_CRC_INIT,
+            (uint32_t)JUNO_CCITT32_CRC_INIT, (uint16_t)JUNO_KERMIT_CRC_INIT, (uint32_t)JUNO_ZIP_CRC_INIT,
+            (uint32_t)JUNO_CASTAGNOLI_CRC_INIT, (uint64_t)JUNO_CRC64_CRC_INIT,
+        };
+        for(size_t iKind = 0; iKind < 8; iKind++)
+        {
+            for(size_t zJobs = 1; zJobs <= 8; zJobs++)
+            {
+                size_t zCalls = 0;
+                JUNO_RESULT_UINT64_T tResult = Juno_CrcParallel((JUNO_CRC_KIND_T)iKind, aiInit[iKind], acBuf, zLen, atJobs, zJobs, ReverseExecutor, &zCalls);
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+                TEST_ASSERT_EQUAL_UINT64(aiSerial[iKind], tResult.tOk);
+                TEST_ASSERT_TRUE(zCalls >= 1 && zCalls <= zJobs);
+                tResult = Juno_CrcParallel((JUNO_CRC_KIND_T)iKind, aiInit[iKind], acBuf, zLen, atJobs, zJobs, Juno_CrcPthreadExecutor, NULL);
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+                TEST_ASSERT_EQUAL_UINT64(aiSerial[iKind], tResult.tOk);
+            }
+        }
+    }
+    // Errors and the empty buffer
+    JUNO_RESULT_UINT64_T tResult = Juno_CrcParallel(JUNO_CRC_KIND_ZIP, JUNO_ZIP_CRC_INIT, acBuf, 0, atJobs, 8, Juno_CrcPthreadExecutor, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL_UINT32(0, tResult.tOk);
+    tResult = Juno_CrcParallel(JUNO_CRC_KIND_ZIP, JUNO_ZIP_CRC_INIT, acBuf, 10, NULL, 8, Juno_CrcPthreadExecutor, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, tResult.tStatus);
+    tResult = Juno_CrcParallel(JUNO_CRC_KIND_ZIP, JUNO_ZIP_CRC_INIT, acBuf, 10, atJobs, 0, Juno_CrcPthreadExecutor, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, tResult.tStatus);
+    tResult = Juno_CrcParallel((JUNO_CRC_KIND_T)42, 0, acBuf, 10, atJobs, 8, Juno_CrcPthreadExecutor, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, tResult.tStatus);
+    tResult = Juno_CrcParallel(JUNO_CRC_KIND_ZIP, JUNO_ZIP_CRC_INIT, acBuf, 10, atJobs, 8, FailingExecutor, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, tResult.tStatus);
+}
+
+// @{"verify": ["REQ-CRC-018"]}
+static void test_crc_stream_matches_update(void)
+{
+    static uint8_t acBuf[5000];
+    for(size_t i = 0; i < sizeof(acBuf); i++)
+    {
+        acBuf[i] = (uint8_t)((i * 2654435761u) >> 13);
+    }
+    uint64_t aiSerial[8] = {
+        Juno_CrcArcUpdate(JUNO_ARC_CRC_INIT, acBuf, sizeof(acBuf)),
+        Juno_CrcBinhexUpdate(JUNO_BINHEX_CRC_INIT, acBuf, sizeof(acBuf)),
+        Juno_CrcCcittUpdate(JUNO_CCITT_CRC_INIT, acBuf, sizeof(acBuf)),
+        Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, acBuf, sizeof(acBuf)),
+        Juno_CrcKermitUpdate(JUNO_KERMIT_CRC_INIT, acBuf, sizeof(acBuf)),
+        Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, acBuf, sizeof(acBuf)),
+        Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, acBuf, sizeof(acBuf)),
+        Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, acBuf, sizeof(acBuf)),
+    };
+    static const size_t azChunks[] = {1, 3, 64, 1000, sizeof(acBuf)};
+    for(size_t iKind = 0; iKind < 8; iKind++)
+    {
+        for(size_t i = 0; i < sizeof(azChunks) / sizeof(azChunks[0]); i++)
+        {
+            JUNO_CRC_STREAM_T tStream;
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamInit(&tStream, (JUNO_CRC_KIND_T)iKind));
+            JUNO_RESULT_UINT64_T tResult = Juno_CrcStreamFinal(&tStream);
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+            TEST_ASSERT_EQUAL_UINT64(0, tResult.tOk);
+            for(size_t zOffset = 0; zOffset < sizeof(acBuf); zOffset += azChunks[i])
+            {
+                size_t zSize = sizeof(acBuf) - zOffset < azChunks[i] ? sizeof(acBuf) - zOffset : azChunks[i];
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamUpdate(&tStream, &acBuf[zOffset], zSize));
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamUpdate(&tStream, NULL, 0));
+            }
+            tResult = Juno_CrcStreamFinal(&tStream);
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+            TEST_ASSERT_EQUAL_UINT64(aiSerial[iKind], tResult.tOk);
+            TEST_ASSERT_EQUAL_UINT64(sizeof(acBuf), tStream.iLength);
+        }
+    }
+    JUNO_CRC_STREAM_T tStream;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, Juno_CrcStreamInit(NULL, JUNO_CRC_KIND_ZIP));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, Juno_CrcStreamInit(&tStream, (JUNO_CRC_KIND_T)42));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamInit(&tStream, JUNO_CRC_KIND_ZIP));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, Juno_CrcStreamUpdate(&tStream, NULL, 10));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, Juno_CrcStreamUpdate(NULL, acBuf, 10));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, Juno_CrcStreamFinal(NULL).tStatus);
+}
+
+/// Async I/O source over a memory buffer returning short, uneven reads
+typedef struct TEST_CRC_IO_TAG JUNO_MODULE_DERIVE(JUNO_ASYNC_IO_ROOT_T,
+    const uint8_t *pcData;
+    size_t zSize;
+    size_t zPos;
+    /// Read fails once this many bytes have been read
+    size_t zFailAt;
+    /// Poll still reports data after the end, like a closed source
+    bool bClosed;
+) TEST_CRC_IO_T;
+
+static JUNO_STATUS_T TestCrcIo_Read(JUNO_ASYNC_IO_ROOT_T *ptIo, char *pcBuff, size_t *pzBuffSize)
+{
+    TEST_CRC_IO_T *ptTestIo = (TEST_CRC_IO_T *)ptIo;
+    if(ptTestIo->zPos >= ptTestIo->zFailAt)
+    {
+        return JUNO_STATUS_READ_ERROR;
+    }
+    size_t zRead = 1 + ptTestIo->zPos % 3001;
+    zRead = zRead < *pzBuffSize ? zRead : *pzBuffSize;
+    zRead = zRead < ptTestIo->zSize - ptTestIo->zPos ? zRead : ptTestIo->zSize - ptTestIo->zPos;
+    memcpy(pcBuff, &ptTestIo->pcData[ptTestIo->zPos], zRead);
+    ptTestIo->zPos += zRead;
+    *pzBuffSize = zRead;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestCrcIo_Poll(JUNO_ASYNC_IO_ROOT_T *ptIo, JUNO_TIME_MICROS_T iTimeoutUs, bool *pbHasData)
+{
+    (void)iTimeoutUs;
+    TEST_CRC_IO_T *ptTestIo = (TEST_CRC_IO_T *)ptIo;
+    *pbHasData = ptTestIo->bClosed || ptTestIo->zPos < ptTestIo->zSize;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static const JUNO_ASYNC_IO_API_T gtTestCrcIoApi = {TestCrcIo_Read, NULL, NULL, NULL, NULL, NULL, TestCrcIo_Poll};
+
+// @{"verify": ["REQ-CRC-018"]}
+static void test_crc_stream_file_and_async_io(void)
+{
+    // Spans several mmap windows and ends mid-window
+    size_t zSize = 2 * JUNO_CRC_POSIX_WINDOW + 1234;
+    uint8_t *pcData = malloc(zSize);
+    TEST_ASSERT_NOT_NULL(pcData);
+    for(size_t i = 0; i < zSize; i++)
+    {
+        pcData[i] = (uint8_t)((i * 2246822519u) >> 11);
+    }
+    char acPath[] = "test_crc_stream_XXXXXX";
+    int iFd = mkstemp(acPath);
+    TEST_ASSERT_TRUE(iFd >= 0);
+    TEST_ASSERT_EQUAL(zSize, (size_t)write(iFd, pcData, zSize));
+    static const JUNO_CRC_KIND_T atKinds[] = {JUNO_CRC_KIND_ARC, JUNO_CRC_KIND_ZIP, JUNO_CRC_KIND_CRC64};
+    for(size_t i = 0; i < sizeof(atKinds) / sizeof(atKinds[0]); i++)
+    {
+        JUNO_CRC_STREAM_T tSerial;
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamInit(&tSerial, atKinds[i]));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamUpdate(&tSerial, pcData, zSize));
+        JUNO_CRC_STREAM_T tStream;
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamInit(&tStream, atKinds[i]));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamMmapFile(&tStream, acPath));
+        TEST_ASSERT_EQUAL_UINT64(Juno_CrcStreamFinal(&tSerial).tOk, Juno_CrcStreamFinal(&tStream).tOk);
+    }
+    // Empty and missing files
+    TEST_ASSERT_EQUAL(0, ftruncate(iFd, 0));
+    close(iFd);
+    JUNO_CRC_STREAM_T tStream;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamInit(&tStream, JUNO_CRC_KIND_ZIP));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamMmapFile(&tStream, acPath));
+    TEST_ASSERT_EQUAL_UINT64(0, Juno_CrcStreamFinal(&tStream).tOk);
+    unlink(acPath);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_FILE_ERROR, Juno_CrcStreamMmapFile(&tStream, acPath));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, Juno_CrcStreamMmapFile(&tStream, NULL));
+
+    // Async I/O with buffers smaller than, equal to and larger than the data
+    static char acBuffers[2 * 100000];
+    size_t zIoSize = 100000;
+    JUNO_CRC_STREAM_T tSerial;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamInit(&tSerial, JUNO_CRC_KIND_CASTAGNOLI));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamUpdate(&tSerial, pcData, zIoSize));
+    static const size_t azBuffSizes[] = {1, 7, 4096, 50000, 100000};
+    for(size_t i = 0; i < sizeof(azBuffSizes) / sizeof(azBuffSizes[0]); i++)
+    {
+        TEST_CRC_IO_T tIo = {{&gtTestCrcIoApi, NULL, NULL}, pcData, zIoSize, 0, SIZE_MAX, false};
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamInit(&tStream, JUNO_CRC_KIND_CASTAGNOLI));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamAsyncIo(&tStream, &tIo.tRoot, zIoSize, 1000, acBuffers, azBuffSizes[i]));
+        TEST_ASSERT_EQUAL_UINT64(Juno_CrcStreamFinal(&tSerial).tOk, Juno_CrcStreamFinal(&tStream).tOk);
+        TEST_ASSERT_EQUAL(zIoSize, tIo.zPos);
+    }
+    // Only the stream length is read, even when more data is available
+    TEST_CRC_IO_T tIo = {{&gtTestCrcIoApi, NULL, NULL}, pcData, zIoSize, 0, SIZE_MAX, false};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamInit(&tSerial, JUNO_CRC_KIND_CASTAGNOLI));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamUpdate(&tSerial, pcData, 5000));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamInit(&tStream, JUNO_CRC_KIND_CASTAGNOLI));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Juno_CrcStreamAsyncIo(&tStream, &tIo.tRoot, 5000, 1000, acBuffers, 4096));
+    TEST_ASSERT_EQUAL_UINT64(Juno_CrcStreamFinal(&tSerial).tOk, Juno_CrcStreamFinal(&tStream).tOk);
+    TEST_ASSERT_EQUAL(5000, tIo.zPos);
+    // A stalled source times out and a closed one fails; neither is truncated
+    tIo.zPos = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_TIMEOUT_ERROR, Juno_CrcStreamAsyncIo(&tStream, &tIo.tRoot, zIoSize + 1, 1000, acBuffers, 4096));
+    TEST_ASSERT_EQUAL(zIoSize, tIo.zPos);
+    tIo.zPos = 0;
+    tIo.bClosed = true;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_READ_ERROR, Juno_CrcStreamAsyncIo(&tStream, &tIo.tRoot, zIoSize + 1, 1000, acBuffers, 4096));
+    tIo.zPos = 0;
+    tIo.bClosed = false;
+    tIo.zFailAt = 60000;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_READ_ERROR, Juno_CrcStreamAsyncIo(&tStream, &tIo.tRoot, zIoSize, 1000, acBuffers, 4096));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, Juno_CrcStreamAsyncIo(&tStream, &tIo.tRoot, zIoSize, 1000, acBuffers, 0));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, Juno_CrcStreamAsyncIo(&tStream, NULL, zIoSize, 1000, acBuffers, 4096));
+    free(pcData);
+}
+
 int main(void)
 {
 	UNITY_BEGIN();
@@ -111,5 +546,13 @@ int main(void)
 	RUN_TEST(test_ccitt_crc);
 	RUN_TEST(test_empty_crc_all);
 	RUN_TEST(test_various_crc_behaviour);
+	RUN_TEST(test_crc_check_values);
+	RUN_TEST(test_crc_castagnoli_crc64_known_answers);
+	RUN_TEST(test_crc_multi_byte_matches_byte_at_a_time);
+	RUN_TEST(test_crc_hw_matches_portable);
+	RUN_TEST(test_crc_combine_matches_streaming);
+	RUN_TEST(test_crc_parallel_matches_serial);
+	RUN_TEST(test_crc_stream_matches_update);
+	RUN_TEST(test_crc_stream_file_and_async_io);
 	return UNITY_END();
 }
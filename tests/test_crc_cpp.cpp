@@ -0,0 +1,141 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+#include <cstddef>
+#include <cstdint>
+
+extern "C" {
+#include "unity.h"
+}
+
+#include "juno/crc/crc.h"
+#include "juno/crc/crc.hpp"
+
+using namespace juno::crc;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Catalogue check values over "123456789", evaluated by the compiler
+// @{"verify": ["REQ-CRC-017"]}
+static_assert(CRC16_ARC_T<>::Checksum("123456789", 9) == 0xBB3Du, "CRC-16/ARC");
+static_assert(CRC16_XMODEM_T<>::Checksum("123456789", 9) == 0x31C3u, "CRC-16/XMODEM");
+static_assert(CRC16_IBM_3740_T<>::Checksum("123456789", 9) == 0x29B1u, "CRC-16/IBM-3740");
+static_assert(CRC16_KERMIT_T<>::Checksum("123456789", 9) == 0x2189u, "CRC-16/KERMIT");
+static_assert(CRC16_MODBUS_T<>::Checksum("123456789", 9) == 0x4B37u, "CRC-16/MODBUS");
+static_assert(CRC32_MPEG2_T<>::Checksum("123456789", 9) == 0x0376E6E7u, "CRC-32/MPEG-2");
+static_assert(CRC32_ISO_HDLC_T<>::Checksum("123456789", 9) == 0xCBF43926u, "CRC-32/ISO-HDLC");
+static_assert(CRC32_ISCSI_T<>::Checksum("123456789", 9) == 0xE3069283u, "CRC-32/ISCSI");
+static_assert(CRC64_XZ_T<>::Checksum("123456789", 9) == 0x995DC9BBDF1939FAull, "CRC-64/XZ");
+
+// Catalogue entries with no C counterpart: widths below 8, a width below the
+// register type, reflect-in without reflect-out, and an asymmetric reflected init
+typedef CRC_T<uint8_t, 3, 0x3u, false, false, 0x0u, 0x7u> CRC3_GSM_T;
+typedef CRC_T<uint8_t, 5, 0x05u, true, true, 0x1Fu, 0x1Fu> CRC5_USB_T;
+typedef CRC_T<uint8_t, 8, 0x07u, false, false, 0x00u, 0x00u> CRC8_SMBUS_T;
+typedef CRC_T<uint16_t, 12, 0x80Fu, false, true, 0x000u, 0x000u> CRC12_UMTS_T;
+typedef CRC_T<uint16_t, 16, 0x1021u, true, true, 0xB2AAu, 0x0000u> CRC16_RIELLO_T;
+typedef CRC_T<uint32_t, 24, 0x864CFBu, false, false, 0xB704CEu, 0x000000u, 8> CRC24_OPENPGP_T;
+static_assert(CRC3_GSM_T::Checksum("123456789", 9) == 0x4u, "CRC-3/GSM");
+static_assert(CRC5_USB_T::Checksum("123456789", 9) == 0x19u, "CRC-5/USB");
+static_assert(CRC8_SMBUS_T::Checksum("123456789", 9) == 0xF4u, "CRC-8/SMBUS");
+static_assert(CRC12_UMTS_T::Checksum("123456789", 9) == 0xDAFu, "CRC-12/UMTS");
+static_assert(CRC16_RIELLO_T::Checksum("123456789", 9) == 0x63D0u, "CRC-16/RIELLO");
+static_assert(CRC24_OPENPGP_T::Checksum("123456789", 9) == 0x21CF02u, "CRC-24/OPENPGP");
+
+static uint8_t gacBuf[1024 + 8];
+
+static void FillBuffer(void)
+{
+    for(size_t i = 0; i < sizeof(gacBuf); i++)
+    {
+        gacBuf[i] = uint8_t((i * 2654435761u) >> 13);
+    }
+}
+
+/// Byte at a time and slicing-by-8 engines must agree with the constant evaluation
+template<typename BYTE_T, typename SLICE_T>
+static void CheckEngine(typename BYTE_T::VALUE_T iCheck)
+{
+    const char acCheck[] = "123456789";
+    TEST_ASSERT_EQUAL_UINT64(iCheck, BYTE_T::Compute(acCheck, 9));
+    TEST_ASSERT_EQUAL_UINT64(iCheck, SLICE_T::Compute(acCheck, 9));
+    for(size_t iOffset = 0; iOffset < 8; iOffset++)
+    {
+        for(size_t zLen = 0; zLen <= 40; zLen++)
+        {
+            TEST_ASSERT_EQUAL_UINT64(BYTE_T::Compute(&gacBuf[iOffset], zLen), SLICE_T::Compute(&gacBuf[iOffset], zLen));
+        }
+    }
+}
+
+// @{"verify": ["REQ-CRC-017"]}
+static void test_crc_cpp_matches_c_functions(void)
+{
+    FillBuffer();
+    for(size_t zLen = 1; zLen <= 1024; zLen += 37)
+    {
+        TEST_ASSERT_EQUAL_UINT16(Juno_CrcArcUpdate(JUNO_ARC_CRC_INIT, gacBuf, zLen), CRC16_ARC_T<8>::Compute(gacBuf, zLen));
+        TEST_ASSERT_EQUAL_UINT16(Juno_CrcBinhexUpdate(JUNO_BINHEX_CRC_INIT, gacBuf, zLen), CRC16_XMODEM_T<>::Compute(gacBuf, zLen));
+        TEST_ASSERT_EQUAL_UINT16(Juno_CrcCcittUpdate(JUNO_CCITT_CRC_INIT, gacBuf, zLen), CRC16_IBM_3740_T<8>::Compute(gacBuf, zLen));
+        TEST_ASSERT_EQUAL_UINT16(Juno_CrcKermitUpdate(JUNO_KERMIT_CRC_INIT, gacBuf, zLen), CRC16_KERMIT_T<>::Compute(gacBuf, zLen));
+        TEST_ASSERT_EQUAL_UINT32(Juno_CrcCcitt32Update(JUNO_CCITT32_CRC_INIT, gacBuf, zLen), CRC32_MPEG2_T<8>::Compute(gacBuf, zLen));
+        TEST_ASSERT_EQUAL_UINT32(Juno_CrcZipUpdate(JUNO_ZIP_CRC_INIT, gacBuf, zLen), CRC32_ISO_HDLC_T<8>::Compute(gacBuf, zLen));
+        TEST_ASSERT_EQUAL_UINT32(Juno_CrcCastagnoliUpdate(JUNO_CASTAGNOLI_CRC_INIT, gacBuf, zLen), CRC32_ISCSI_T<>::Compute(gacBuf, zLen));
+        TEST_ASSERT_EQUAL_UINT64(Juno_CrcCrc64Update(JUNO_CRC64_CRC_INIT, gacBuf, zLen), CRC64_XZ_T<8>::Compute(gacBuf, zLen));
+    }
+}
+
+// @{"verify": ["REQ-CRC-017"]}
+static void test_crc_cpp_slicing_matches_bytewise(void)
+{
+    FillBuffer();
+    CheckEngine<CRC16_ARC_T<1>, CRC16_ARC_T<8>>(0xBB3Du);
+    CheckEngine<CRC16_IBM_3740_T<1>, CRC16_IBM_3740_T<8>>(0x29B1u);
+    CheckEngine<CRC32_MPEG2_T<1>, CRC32_MPEG2_T<8>>(0x0376E6E7u);
+    CheckEngine<CRC32_ISO_HDLC_T<1>, CRC32_ISO_HDLC_T<8>>(0xCBF43926u);
+    CheckEngine<CRC64_XZ_T<1>, CRC64_XZ_T<8>>(0x995DC9BBDF1939FAull);
+    CheckEngine<CRC3_GSM_T, CRC_T<uint8_t, 3, 0x3u, false, false, 0x0u, 0x7u, 8>>(0x4u);
+    CheckEngine<CRC5_USB_T, CRC_T<uint8_t, 5, 0x05u, true, true, 0x1Fu, 0x1Fu, 8>>(0x19u);
+    CheckEngine<CRC12_UMTS_T, CRC_T<uint16_t, 12, 0x80Fu, false, true, 0x000u, 0x000u, 8>>(0xDAFu);
+    CheckEngine<CRC_T<uint32_t, 24, 0x864CFBu, false, false, 0xB704CEu, 0x000000u>, CRC24_OPENPGP_T>(0x21CF02u);
+}
+
+// @{"verify": ["REQ-CRC-017"]}
+static void test_crc_cpp_streaming(void)
+{
+    FillBuffer();
+    typedef CRC32_ISO_HDLC_T<8> ZIP_T;
+    for(size_t zSplit = 0; zSplit <= 100; zSplit++)
+    {
+        uint32_t iReg = ZIP_T::Init();
+        iReg = ZIP_T::Update(iReg, gacBuf, zSplit);
+        iReg = ZIP_T::Update(iReg, &gacBuf[zSplit], 100 - zSplit);
+        TEST_ASSERT_EQUAL_UINT32(ZIP_T::Compute(gacBuf, 100), ZIP_T::Final(iReg));
+    }
+    // The table is a constant: usable in constant expressions
+    static_assert(CRC_TABLE_T<ZIP_T, MAKE_INDICES_T<8 * 256>::TYPE_T>::atEntries[1] == 0x77073096u, "table");
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_crc_cpp_matches_c_functions);
+    RUN_TEST(test_crc_cpp_slicing_matches_bytewise);
+    RUN_TEST(test_crc_cpp_streaming);
+    return UNITY_END();
+}
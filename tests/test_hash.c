@@ -17,15 +17,18 @@
 
 /**
  * @file test_hash.c
- * @brief Unit tests for the LibJuno DJB2 hash function.
+ * @brief Unit tests for the LibJuno hash functions.
  */
 
 #include "juno/hash/hash_djb2.h"
+#include "juno/hash/hash_fnv1a.h"
+#include "juno/hash/hash_xxh64.h"
 #include "juno/status.h"
 #include "unity.h"
 #include "unity_internals.h"
 #include <stddef.h>
 #include <stdint.h>
+#include <string.h>
 
 void setUp(void) {}
 void tearDown(void) {}
@@ -82,6 +85,212 @@ static void test_hash_djb2_null_buffer(void)
     TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, tResult.tStatus);
 }
 
+/* ============================================================================
+ * Test Cases: FNV-1a-64 and XXH64 (REQ-HASH-004, REQ-HASH-005)
+ * ============================================================================ */
+
+static const uint8_t gacSpam[] = "Nobody inspects the spammish repetition";
+
+// @{"verify": ["REQ-HASH-004"]}
+static void test_hash_fnv1a64_known_values(void)
+{
+    JUNO_RESULT_SIZE_T tResult = JunoHash_Fnv1a64(gacSpam, 0);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL_UINT((size_t)0xCBF29CE484222325ULL, tResult.tOk);
+    tResult = JunoHash_Fnv1a64((const uint8_t *)"a", 1);
+    TEST_ASSERT_EQUAL_UINT((size_t)0xAF63DC4C8601EC8CULL, tResult.tOk);
+    tResult = JunoHash_Fnv1a64((const uint8_t *)"abc", 3);
+    TEST_ASSERT_EQUAL_UINT((size_t)0xE71FA2190541574BULL, tResult.tOk);
+    tResult = JunoHash_Fnv1a64(NULL, 1);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, tResult.tStatus);
+}
+
+// @{"verify": ["REQ-HASH-005"]}
+static void test_hash_xxh64_known_values(void)
+{
+    JUNO_RESULT_SIZE_T tResult = JunoHash_Xxh64(gacSpam, 0, 0);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL_UINT((size_t)0xEF46DB3751D8E999ULL, tResult.tOk);
+    tResult = JunoHash_Xxh64((const uint8_t *)"a", 1, 0);
+    TEST_ASSERT_EQUAL_UINT((size_t)0xD24EC4F1A98C6E5BULL, tResult.tOk);
+    tResult = JunoHash_Xxh64((const uint8_t *)"abc", 3, 0);
+    TEST_ASSERT_EQUAL_UINT((size_t)0x44BC2CF5AD770999ULL, tResult.tOk);
+    tResult = JunoHash_Xxh64((const uint8_t *)"abc", 3, 1);
+    TEST_ASSERT_EQUAL_UINT((size_t)0xBEA9CA8199328908ULL, tResult.tOk);
+    // 39 bytes: one 32 byte stripe followed by a 4, 2 and 1 byte tail
+    tResult = JunoHash_Xxh64(gacSpam, sizeof(gacSpam) - 1, 0);
+    TEST_ASSERT_EQUAL_UINT((size_t)0xFBCEA83C8A378BF1ULL, tResult.tOk);
+    // 100 bytes: three stripes, then 8 and 4 byte tails
+    uint8_t acBuf[100];
+    for (size_t i = 0; i < sizeof(acBuf); i++) {
+        acBuf[i] = (uint8_t)i;
+    }
+    tResult = JunoHash_Xxh64(acBuf, sizeof(acBuf), 0);
+    TEST_ASSERT_EQUAL_UINT((size_t)0x6AC1E58032166597ULL, tResult.tOk);
+    tResult = JunoHash_Xxh64(NULL, 1, 0);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, tResult.tStatus);
+}
+
+// @{"verify": ["REQ-HASH-005"]}
+static void test_hash_xxh64_unaligned_input(void)
+{
+    uint8_t acBuf[sizeof(gacSpam) + 8];
+    size_t zLen = sizeof(gacSpam) - 1;
+    for (size_t iOffset = 0; iOffset < 8; iOffset++) {
+        memcpy(&acBuf[iOffset], gacSpam, zLen);
+        JUNO_RESULT_SIZE_T tResult = JunoHash_Xxh64(&acBuf[iOffset], zLen, 0);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+        TEST_ASSERT_EQUAL_UINT((size_t)0xFBCEA83C8A378BF1ULL, tResult.tOk);
+    }
+}
+
+/* ============================================================================
+ * Test Cases: Streaming Hashes (REQ-HASH-007)
+ * ============================================================================ */
+
+/// Fill a buffer with 0, 1, 2, ... so every byte differs from its neighbours
+static void TestHash_FillRamp(uint8_t *pcBuff, size_t zBuffSize)
+{
+    for (size_t i = 0; i < zBuffSize; i++) {
+        pcBuff[i] = (uint8_t)i;
+    }
+}
+
+// @{"verify": ["REQ-HASH-007"]}
+static void test_hash_streaming_matches_one_shot(void)
+{
+    uint8_t acBuf[100];
+    TestHash_FillRamp(acBuf, sizeof(acBuf));
+    size_t zDjb2 = JunoHash_Djb2(acBuf, sizeof(acBuf)).tOk;
+    size_t zFnv = JunoHash_Fnv1a64(acBuf, sizeof(acBuf)).tOk;
+    size_t zXxh = JunoHash_Xxh64(acBuf, sizeof(acBuf), 7).tOk;
+    // Every split of the buffer into three chunks, including empty chunks
+    for (size_t i = 0; i <= sizeof(acBuf); i++) {
+        for (size_t j = i; j <= sizeof(acBuf); j++) {
+            JUNO_HASH_DJB2_STATE_T tDjb2;
+            JUNO_HASH_FNV1A64_STATE_T tFnv;
+            JUNO_HASH_XXH64_STATE_T tXxh;
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Djb2Init(&tDjb2));
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Fnv1a64Init(&tFnv));
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Xxh64Init(&tXxh, 7));
+            const size_t azBounds[] = {0, i, j, sizeof(acBuf)};
+            for (size_t k = 0; k < 3; k++) {
+                const uint8_t *pcChunk = &acBuf[azBounds[k]];
+                size_t zChunk = azBounds[k + 1] - azBounds[k];
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Djb2Update(&tDjb2, pcChunk, zChunk));
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Fnv1a64Update(&tFnv, pcChunk, zChunk));
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Xxh64Update(&tXxh, pcChunk, zChunk));
+            }
+            TEST_ASSERT_EQUAL_UINT(zDjb2, JunoHash_Djb2Final(&tDjb2).tOk);
+            TEST_ASSERT_EQUAL_UINT(zFnv, JunoHash_Fnv1a64Final(&tFnv).tOk);
+            TEST_ASSERT_EQUAL_UINT(zXxh, JunoHash_Xxh64Final(&tXxh).tOk);
+        }
+    }
+}
+
+// @{"verify": ["REQ-HASH-007"]}
+static void test_hash_streaming_composite_key(void)
+{
+    // MID, source ID and name hashed in place equal the hash of the packed key
+    const uint8_t acMid[] = {0x18, 0x01};
+    const uint8_t acSource[] = {0x00, 0x00, 0x00, 0x2A};
+    const uint8_t acName[] = "thermal_zone_primary_heater_loop";
+    uint8_t acPacked[sizeof(acMid) + sizeof(acSource) + sizeof(acName) - 1];
+    memcpy(acPacked, acMid, sizeof(acMid));
+    memcpy(&acPacked[sizeof(acMid)], acSource, sizeof(acSource));
+    memcpy(&acPacked[sizeof(acMid) + sizeof(acSource)], acName, sizeof(acName) - 1);
+    JUNO_HASH_XXH64_STATE_T tState;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Xxh64Init(&tState, 0));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Xxh64Update(&tState, acMid, sizeof(acMid)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Xxh64Update(&tState, acSource, sizeof(acSource)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Xxh64Update(&tState, acName, sizeof(acName) - 1));
+    JUNO_RESULT_SIZE_T tResult = JunoHash_Xxh64Final(&tState);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL_UINT(JunoHash_Xxh64(acPacked, sizeof(acPacked), 0).tOk, tResult.tOk);
+    // Final leaves the state unchanged, so hashing can continue
+    TEST_ASSERT_EQUAL_UINT(tResult.tOk, JunoHash_Xxh64Final(&tState).tOk);
+}
+
+// @{"verify": ["REQ-HASH-007"]}
+static void test_hash_streaming_null_arguments(void)
+{
+    const uint8_t acBuf[] = {'a'};
+    JUNO_HASH_DJB2_STATE_T tDjb2;
+    JUNO_HASH_FNV1A64_STATE_T tFnv;
+    JUNO_HASH_XXH64_STATE_T tXxh;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Djb2Init(NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Fnv1a64Init(NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Xxh64Init(NULL, 0));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Djb2Init(&tDjb2));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Fnv1a64Init(&tFnv));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoHash_Xxh64Init(&tXxh, 0));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Djb2Update(&tDjb2, NULL, 1));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Fnv1a64Update(&tFnv, NULL, 1));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Xxh64Update(&tXxh, NULL, 1));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Xxh64Update(NULL, acBuf, 1));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Djb2Final(NULL).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Fnv1a64Final(NULL).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoHash_Xxh64Final(NULL).tStatus);
+    // A rejected update leaves the state usable
+    TEST_ASSERT_EQUAL_UINT(JunoHash_Xxh64(acBuf, 0, 0).tOk, JunoHash_Xxh64Final(&tXxh).tOk);
+}
+
+/* ============================================================================
+ * Test Cases: Distribution Quality (REQ-HASH-004, REQ-HASH-005)
+ * ============================================================================ */
+
+#define TEST_HASH_SLOTS 1024
+#define TEST_HASH_KEYS 512
+
+typedef JUNO_RESULT_SIZE_T (*TEST_HASH_FCN_T)(const uint8_t *pcBuff, size_t zBuffSize);
+
+static JUNO_RESULT_SIZE_T TestHash_Xxh64(const uint8_t *pcBuff, size_t zBuffSize)
+{
+    return JunoHash_Xxh64(pcBuff, zBuffSize, 0);
+}
+
+/// Insert similar short keys ("sensor_0000", ...) into a linear-probing table
+/// at 50% load and report the total and maximum probe length
+static void TestHash_Probe(TEST_HASH_FCN_T pfcnHash, size_t *pzTotal, size_t *pzMax)
+{
+    static bool abOccupied[TEST_HASH_SLOTS];
+    memset(abOccupied, 0, sizeof(abOccupied));
+    *pzTotal = 0;
+    *pzMax = 0;
+    uint8_t acKey[] = "sensor_0000";
+    for (size_t i = 0; i < TEST_HASH_KEYS; i++) {
+        acKey[7] = (uint8_t)('0' + i / 1000 % 10);
+        acKey[8] = (uint8_t)('0' + i / 100 % 10);
+        acKey[9] = (uint8_t)('0' + i / 10 % 10);
+        acKey[10] = (uint8_t)('0' + i % 10);
+        JUNO_RESULT_SIZE_T tResult = pfcnHash(acKey, sizeof(acKey) - 1);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+        size_t zProbe = 0;
+        size_t iSlot = tResult.tOk % TEST_HASH_SLOTS;
+        while (abOccupied[iSlot]) {
+            zProbe++;
+            iSlot = (iSlot + 1) % TEST_HASH_SLOTS;
+        }
+        abOccupied[iSlot] = true;
+        *pzTotal += zProbe;
+        *pzMax = zProbe > *pzMax ? zProbe : *pzMax;
+    }
+}
+
+// @{"verify": ["REQ-HASH-004", "REQ-HASH-005"]}
+static void test_hash_probe_lengths(void)
+{
+    // Uniform hashing at 50% load expects a mean of 0.5 extra probes
+    TEST_HASH_FCN_T apfcnHashes[] = {JunoHash_Fnv1a64, TestHash_Xxh64};
+    for (size_t i = 0; i < sizeof(apfcnHashes) / sizeof(apfcnHashes[0]); i++) {
+        size_t zTotal = 0;
+        size_t zMax = 0;
+        TestHash_Probe(apfcnHashes[i], &zTotal, &zMax);
+        TEST_ASSERT_LESS_THAN(TEST_HASH_KEYS, zTotal);
+        TEST_ASSERT_LESS_THAN(16, zMax);
+    }
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -93,5 +302,12 @@ int main(void)
     RUN_TEST(test_hash_djb2_empty_buffer);
     RUN_TEST(test_hash_djb2_different_inputs_differ);
     RUN_TEST(test_hash_djb2_null_buffer);
+    RUN_TEST(test_hash_fnv1a64_known_values);
+    RUN_TEST(test_hash_xxh64_known_values);
+    RUN_TEST(test_hash_xxh64_unaligned_input);
+    RUN_TEST(test_hash_streaming_matches_one_shot);
+    RUN_TEST(test_hash_streaming_composite_key);
+    RUN_TEST(test_hash_streaming_null_arguments);
+    RUN_TEST(test_hash_probe_lengths);
     return UNITY_END();
 }
@@ -469,6 +469,83 @@ static void test_heap_insert_to_full_capacity(void)
     assert_max_heap_property(&gtTestHeap);
 }
 
+// @{"verify": ["REQ-HEAP-004", "REQ-HEAP-005"]}
+static void test_heap_pop_from_full_capacity(void)
+{
+    JUNO_STATUS_T tStatus = InitTestHeap(&gtTestHeap, &gtTestMaxHeapPointerApi, TEST_HEAP_CAPACITY);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+
+    /* Fill heap to capacity so sifting reaches the last leaves */
+    for (uint32_t i = 0; i < TEST_HEAP_CAPACITY; i++)
+    {
+        TEST_HEAP_DATA_T tData = CreateTestData((i * 37u) % TEST_HEAP_CAPACITY, false, (uint8_t)i);
+        JUNO_POINTER_T tPointer = TestHeapData_PointerInit(&tData);
+        tStatus = gtTestHeap.tRoot.ptApi->Insert(&gtTestHeap.tRoot, tPointer);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    }
+
+    /* Drain it in descending order */
+    for (uint32_t i = 0; i < TEST_HEAP_CAPACITY; i++)
+    {
+        TEST_HEAP_DATA_T tData = {0};
+        tStatus = gtTestHeap.tRoot.ptApi->Pop(&gtTestHeap.tRoot, TestHeapData_PointerInit(&tData));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+        TEST_ASSERT_EQUAL(TEST_HEAP_CAPACITY - 1 - i, tData.iValue);
+    }
+    TEST_ASSERT_EQUAL(0, gtTestHeap.tRoot.zLength);
+}
+
+// @{"verify": ["REQ-HEAP-015"]}
+static void test_heap_arity_insert_heapify_pop(void)
+{
+    static const size_t azArities[] = {2, 4, 8};
+    for (size_t iArity = 0; iArity < sizeof(azArities) / sizeof(azArities[0]); iArity++)
+    {
+        size_t zArity = azArities[iArity];
+        JUNO_STATUS_T tStatus = InitTestHeap(&gtTestHeap, &gtTestMaxHeapPointerApi, TEST_HEAP_CAPACITY);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+        TEST_ASSERT_EQUAL(JUNO_DS_HEAP_ARITY_DEFAULT, gtTestHeap.tRoot.zArity);
+        tStatus = JunoDs_Heap_SetArity(&gtTestHeap.tRoot, zArity);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+
+        /* Insert keeps the d-ary heap property */
+        for (uint32_t i = 0; i < TEST_HEAP_CAPACITY; i++)
+        {
+            TEST_HEAP_DATA_T tData = CreateTestData((i * 37u) % TEST_HEAP_CAPACITY, false, (uint8_t)i);
+            tStatus = gtTestHeap.tRoot.ptApi->Insert(&gtTestHeap.tRoot, TestHeapData_PointerInit(&tData));
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+        }
+        for (size_t i = 1; i < TEST_HEAP_CAPACITY; i++)
+        {
+            TEST_ASSERT_TRUE(gtTestHeapBuffer[(i - 1) / zArity].iValue >= gtTestHeapBuffer[i].iValue);
+        }
+
+        /* Heapify over scrambled storage */
+        for (uint32_t i = 0; i < TEST_HEAP_CAPACITY; i++)
+        {
+            gtTestHeapBuffer[i] = CreateTestData((i * 53u) % TEST_HEAP_CAPACITY, false, (uint8_t)i);
+        }
+        tStatus = gtTestHeap.tRoot.ptApi->Heapify(&gtTestHeap.tRoot);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+
+        /* Pop drains in descending order */
+        for (uint32_t i = 0; i < TEST_HEAP_CAPACITY; i++)
+        {
+            TEST_HEAP_DATA_T tData = {0};
+            tStatus = gtTestHeap.tRoot.ptApi->Pop(&gtTestHeap.tRoot, TestHeapData_PointerInit(&tData));
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+            TEST_ASSERT_EQUAL(TEST_HEAP_CAPACITY - 1 - i, tData.iValue);
+        }
+    }
+
+    /* Unsupported arities are rejected and leave the heap unchanged */
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_Heap_SetArity(&gtTestHeap.tRoot, 3));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_Heap_SetArity(&gtTestHeap.tRoot, 16));
+    TEST_ASSERT_EQUAL(8, gtTestHeap.tRoot.zArity);
+    gtTestHeap.tRoot.zArity = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_Heap_Verify(&gtTestHeap.tRoot));
+}
+
 // @{"verify": ["REQ-HEAP-003"]}
 static void test_heap_insert_overflow(void)
 {
@@ -1105,6 +1182,8 @@ int main(void)
     RUN_TEST(test_heap_insert_single_item_max_heap);
     RUN_TEST(test_heap_insert_multiple_items_max_heap);
     RUN_TEST(test_heap_insert_to_full_capacity);
+    RUN_TEST(test_heap_pop_from_full_capacity);
+    RUN_TEST(test_heap_arity_insert_heapify_pop);
     RUN_TEST(test_heap_insert_overflow);
     RUN_TEST(test_heap_insert_null_heap);
     RUN_TEST(test_heap_insert_invalid_pointer);
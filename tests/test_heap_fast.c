@@ -0,0 +1,358 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_heap_fast.c
+ * @brief Unit tests for the fast heap
+ *
+ * Every ordering mode is checked against a reference: popping a heap must
+ * yield its keys in sorted order, whether it was filled by Insert, by
+ * Heapify, or by a random mix of Insert and Pop.
+ */
+
+#include "juno/ds/heap_fast.h"
+#include "juno/ds/heap_api.h"
+#include "juno/ds/array_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include "unity.h"
+#include "unity_internals.h"
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TEST_CAPACITY 256
+
+typedef struct TEST_FAST_ELEM_TAG
+{
+    uint64_t iKey64;
+    int64_t iSigned64;
+    uint32_t iKey;
+    int32_t iSigned;
+} TEST_FAST_ELEM_T;
+
+/// Contiguous array, or every other slot of it when bSparse is set
+typedef struct TEST_FAST_ARRAY_TAG JUNO_MODULE_DERIVE(JUNO_DS_ARRAY_ROOT_T,
+    const JUNO_POINTER_API_T *ptElemApi;
+    TEST_FAST_ELEM_T *ptBuffer;
+    bool bSparse;
+) TEST_FAST_ARRAY_T;
+
+static JUNO_STATUS_T TestFastElem_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T TestFastElem_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T TestFastArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T TestFastArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T TestFastArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_DS_HEAP_COMPARE_RESULT_T TestFast_CompareMin(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild);
+static JUNO_DS_HEAP_COMPARE_RESULT_T TestFast_CompareFail(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild);
+static JUNO_STATUS_T TestFast_Swap(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tLeft, JUNO_POINTER_T tRight);
+
+static const JUNO_POINTER_API_T gtTestFastElemApi = {
+    TestFastElem_Copy,
+    TestFastElem_Reset
+};
+
+static const JUNO_POINTER_API_T gtTestFastElemTrivialApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_DS_ARRAY_API_T gtTestFastArrayApi = {
+    TestFastArray_SetAt,
+    TestFastArray_GetAt,
+    TestFastArray_RemoveAt
+};
+
+static const JUNO_DS_HEAP_POINTER_API_T gtTestFastMinApi = {
+    TestFast_CompareMin,
+    TestFast_Swap
+};
+
+static const JUNO_DS_HEAP_POINTER_API_T gtTestFastFailApi = {
+    TestFast_CompareFail,
+    TestFast_Swap
+};
+
+static TEST_FAST_ELEM_T gatBuffer[2 * TEST_CAPACITY];
+static TEST_FAST_ELEM_T gtScratch;
+static size_t gzSwaps;
+
+static JUNO_STATUS_T TestFastElem_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_ASSERT_POINTER_TYPE(tStatus, tDest, TEST_FAST_ELEM_T, gtTestFastElemApi);
+    JUNO_ASSERT_POINTER_TYPE(tStatus, tSrc, TEST_FAST_ELEM_T, gtTestFastElemApi);
+    *(TEST_FAST_ELEM_T *)tDest.pvAddr = *(const TEST_FAST_ELEM_T *)tSrc.pvAddr;
+    return tStatus;
+}
+
+static JUNO_STATUS_T TestFastElem_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = JUNO_STATUS_SUCCESS;
+    JUNO_ASSERT_POINTER_TYPE(tStatus, tPointer, TEST_FAST_ELEM_T, gtTestFastElemApi);
+    *(TEST_FAST_ELEM_T *)tPointer.pvAddr = (TEST_FAST_ELEM_T){0};
+    return tStatus;
+}
+
+static inline JUNO_POINTER_T TestFastArray_Slot(const TEST_FAST_ARRAY_T *ptArray, size_t iIndex)
+{
+    return (JUNO_POINTER_T){
+        ptArray->ptElemApi,
+        &ptArray->ptBuffer[ptArray->bSparse ? 2 * iIndex : iIndex],
+        sizeof(TEST_FAST_ELEM_T),
+        alignof(TEST_FAST_ELEM_T)
+    };
+}
+
+static JUNO_STATUS_T TestFastArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerCopy(TestFastArray_Slot((TEST_FAST_ARRAY_T *)ptArray, iIndex), tItem);
+}
+
+static JUNO_RESULT_POINTER_T TestFastArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk = TestFastArray_Slot((TEST_FAST_ARRAY_T *)ptArray, iIndex);
+    return tResult;
+}
+
+static JUNO_STATUS_T TestFastArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerReset(TestFastArray_Slot((TEST_FAST_ARRAY_T *)ptArray, iIndex));
+}
+
+static JUNO_DS_HEAP_COMPARE_RESULT_T TestFast_CompareMin(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild)
+{
+    (void)ptHeap;
+    JUNO_DS_HEAP_COMPARE_RESULT_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = ((const TEST_FAST_ELEM_T *)tParent.pvAddr)->iKey <= ((const TEST_FAST_ELEM_T *)tChild.pvAddr)->iKey;
+    return tResult;
+}
+
+static JUNO_DS_HEAP_COMPARE_RESULT_T TestFast_CompareFail(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild)
+{
+    (void)ptHeap;
+    (void)tParent;
+    (void)tChild;
+    JUNO_DS_HEAP_COMPARE_RESULT_T tResult = {JUNO_STATUS_ERR, false};
+    return tResult;
+}
+
+static JUNO_STATUS_T TestFast_Swap(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tLeft, JUNO_POINTER_T tRight)
+{
+    (void)ptHeap;
+    (void)tLeft;
+    (void)tRight;
+    gzSwaps += 1;
+    return JUNO_STATUS_ERR;
+}
+
+static uint32_t giSeed = 12345;
+
+static uint32_t TestFast_Rand(void)
+{
+    giSeed = giSeed * 1103515245u + 12345u;
+    return giSeed >> 8;
+}
+
+/// Element whose every key field derives from iValue, keeping all key orders consistent
+static TEST_FAST_ELEM_T TestFast_Elem(uint32_t iValue)
+{
+    TEST_FAST_ELEM_T tElem = {
+        (uint64_t)iValue << 20,
+        (int64_t)iValue - 4000000,
+        iValue,
+        (int32_t)iValue - 4000000,
+    };
+    return tElem;
+}
+
+static void TestFast_Init(JUNO_DS_HEAP_FAST_T *ptHeap, TEST_FAST_ARRAY_T *ptArray, const JUNO_POINTER_API_T *ptElemApi)
+{
+    *ptArray = (TEST_FAST_ARRAY_T){0};
+    ptArray->ptElemApi = ptElemApi;
+    ptArray->ptBuffer = gatBuffer;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_ArrayInit(&ptArray->tRoot, &gtTestFastArrayApi, TEST_CAPACITY, NULL, NULL));
+    JUNO_POINTER_T tScratch = {ptElemApi, &gtScratch, sizeof(gtScratch), alignof(TEST_FAST_ELEM_T)};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_HeapFastInit(ptHeap, &gtTestFastMinApi, &ptArray->tRoot, tScratch, NULL, NULL));
+}
+
+/// Pop everything and check that the values come out in heap order
+static void TestFast_DrainSorted(JUNO_DS_HEAP_FAST_T *ptHeap, const JUNO_POINTER_API_T *ptElemApi, bool bMinHeap, size_t zExpected)
+{
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &ptHeap->tRoot;
+    TEST_ASSERT_EQUAL(zExpected, ptRoot->zLength);
+    TEST_FAST_ELEM_T tOut = {0};
+    JUNO_POINTER_T tOutPtr = {ptElemApi, &tOut, sizeof(tOut), alignof(TEST_FAST_ELEM_T)};
+    uint32_t iPrev = bMinHeap ? 0 : UINT32_MAX;
+    for(size_t i = 0; i < zExpected; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptRoot->ptApi->Pop(ptRoot, tOutPtr));
+        TEST_ASSERT_TRUE(bMinHeap ? tOut.iKey >= iPrev : tOut.iKey <= iPrev);
+        iPrev = tOut.iKey;
+    }
+    TEST_ASSERT_EQUAL(0, ptRoot->zLength);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, ptRoot->ptApi->Pop(ptRoot, tOutPtr));
+}
+
+void setUp(void)
+{
+    gzSwaps = 0;
+}
+
+void tearDown(void)
+{
+
+}
+
+// @{"verify": ["REQ-HEAP-009", "REQ-HEAP-010", "REQ-HEAP-015"]}
+static void test_heap_fast_orders_match_reference(void)
+{
+    typedef struct
+    {
+        JUNO_DS_HEAP_KEY_T tKey;
+        size_t zOffset;
+        bool bMinHeap;
+    } TEST_FAST_MODE_T;
+    static const TEST_FAST_MODE_T atModes[] = {
+        {JUNO_DS_HEAP_KEY_NONE, 0, true},
+        {JUNO_DS_HEAP_KEY_U32, offsetof(TEST_FAST_ELEM_T, iKey), true},
+        {JUNO_DS_HEAP_KEY_U32, offsetof(TEST_FAST_ELEM_T, iKey), false},
+        {JUNO_DS_HEAP_KEY_U64, offsetof(TEST_FAST_ELEM_T, iKey64), false},
+        {JUNO_DS_HEAP_KEY_I32, offsetof(TEST_FAST_ELEM_T, iSigned), true},
+        {JUNO_DS_HEAP_KEY_I64, offsetof(TEST_FAST_ELEM_T, iSigned64), false},
+    };
+    const JUNO_POINTER_API_T *aptApis[] = {&gtTestFastElemApi, &gtTestFastElemTrivialApi};
+    static const size_t azArities[] = {2, 4, 8};
+    for(size_t iApi = 0; iApi < 2; iApi++)
+    {
+        for(size_t iMode = 0; iMode < sizeof(atModes) / sizeof(atModes[0]); iMode++)
+        {
+            JUNO_DS_HEAP_FAST_T tHeap;
+            TEST_FAST_ARRAY_T tArray;
+            TestFast_Init(&tHeap, &tArray, aptApis[iApi]);
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_HeapFastSetKey(&tHeap, atModes[iMode].tKey, atModes[iMode].zOffset, atModes[iMode].bMinHeap));
+            JUNO_DS_HEAP_ROOT_T *ptRoot = &tHeap.tRoot;
+            // Every mode runs with two of the three arities
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_Heap_SetArity(ptRoot, azArities[(iApi + iMode) % 3]));
+            // Insert with duplicates, then drain
+            for(size_t i = 0; i < TEST_CAPACITY; i++)
+            {
+                TEST_FAST_ELEM_T tElem = TestFast_Elem(TestFast_Rand() % 1000u);
+                JUNO_POINTER_T tPtr = {aptApis[iApi], &tElem, sizeof(tElem), alignof(TEST_FAST_ELEM_T)};
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptRoot->ptApi->Insert(ptRoot, tPtr));
+            }
+            TEST_FAST_ELEM_T tExtra = TestFast_Elem(1);
+            JUNO_POINTER_T tExtraPtr = {aptApis[iApi], &tExtra, sizeof(tExtra), alignof(TEST_FAST_ELEM_T)};
+            TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, ptRoot->ptApi->Insert(ptRoot, tExtraPtr));
+            TestFast_DrainSorted(&tHeap, aptApis[iApi], atModes[iMode].bMinHeap, TEST_CAPACITY);
+            // Heapify storage written through the array
+            for(size_t i = 0; i < TEST_CAPACITY - 3; i++)
+            {
+                TEST_FAST_ELEM_T tElem = TestFast_Elem(TestFast_Rand() % 5000u);
+                JUNO_POINTER_T tPtr = {aptApis[iApi], &tElem, sizeof(tElem), alignof(TEST_FAST_ELEM_T)};
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tArray.tRoot.ptApi->SetAt(&tArray.tRoot, tPtr, i));
+            }
+            ptRoot->zLength = TEST_CAPACITY - 3;
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptRoot->ptApi->Heapify(ptRoot));
+            TestFast_DrainSorted(&tHeap, aptApis[iApi], atModes[iMode].bMinHeap, TEST_CAPACITY - 3);
+            // Random mix of Insert and Pop against a reference extreme
+            uint32_t aiRef[TEST_CAPACITY];
+            size_t zRef = 0;
+            for(size_t iOp = 0; iOp < 4000; iOp++)
+            {
+                if(zRef < TEST_CAPACITY && (zRef == 0 || TestFast_Rand() % 3u))
+                {
+                    TEST_FAST_ELEM_T tElem = TestFast_Elem(TestFast_Rand() % 100000u);
+                    JUNO_POINTER_T tPtr = {aptApis[iApi], &tElem, sizeof(tElem), alignof(TEST_FAST_ELEM_T)};
+                    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptRoot->ptApi->Insert(ptRoot, tPtr));
+                    aiRef[zRef++] = tElem.iKey;
+                    continue;
+                }
+                size_t iBest = 0;
+                for(size_t i = 1; i < zRef; i++)
+                {
+                    bool bBetter = atModes[iMode].bMinHeap ? aiRef[i] < aiRef[iBest] : aiRef[i] > aiRef[iBest];
+                    iBest = bBetter ? i : iBest;
+                }
+                TEST_FAST_ELEM_T tOut = {0};
+                JUNO_POINTER_T tOutPtr = {aptApis[iApi], &tOut, sizeof(tOut), alignof(TEST_FAST_ELEM_T)};
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptRoot->ptApi->Pop(ptRoot, tOutPtr));
+                TEST_ASSERT_EQUAL_UINT32(aiRef[iBest], tOut.iKey);
+                TEST_ASSERT_TRUE(tOut.iSigned64 == (int64_t)tOut.iKey - 4000000);
+                aiRef[iBest] = aiRef[--zRef];
+            }
+            TEST_ASSERT_EQUAL(zRef, ptRoot->zLength);
+        }
+    }
+    // Sifting never swaps
+    TEST_ASSERT_EQUAL(0, gzSwaps);
+}
+
+// @{"verify": ["REQ-HEAP-009", "REQ-HEAP-010"]}
+static void test_heap_fast_errors(void)
+{
+    JUNO_DS_HEAP_FAST_T tHeap;
+    TEST_FAST_ARRAY_T tArray;
+    TestFast_Init(&tHeap, &tArray, &gtTestFastElemTrivialApi);
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &tHeap.tRoot;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, ptRoot->ptApi->Heapify(ptRoot));
+    // Keys outside the element, misaligned or unknown
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_HeapFastSetKey(&tHeap, JUNO_DS_HEAP_KEY_U64, sizeof(TEST_FAST_ELEM_T), true));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_HeapFastSetKey(&tHeap, JUNO_DS_HEAP_KEY_U64, offsetof(TEST_FAST_ELEM_T, iSigned), true));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_HeapFastSetKey(&tHeap, JUNO_DS_HEAP_KEY_U32, 2, true));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, JunoDs_HeapFastSetKey(&tHeap, (JUNO_DS_HEAP_KEY_T)42, 0, true));
+    // Elements of another type
+    uint64_t iWrong = 0;
+    JUNO_POINTER_T tWrong = {&gtTestFastElemTrivialApi, &iWrong, sizeof(iWrong), alignof(uint64_t)};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, ptRoot->ptApi->Insert(ptRoot, tWrong));
+    // Compare errors propagate
+    TEST_FAST_ELEM_T tElem = TestFast_Elem(5);
+    JUNO_POINTER_T tPtr = {&gtTestFastElemTrivialApi, &tElem, sizeof(tElem), alignof(TEST_FAST_ELEM_T)};
+    ptRoot->ptHeapPointerApi = &gtTestFastFailApi;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptRoot->ptApi->Insert(ptRoot, tPtr));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, ptRoot->ptApi->Insert(ptRoot, tPtr));
+    // A non-contiguous array and a scratch of the wrong type are rejected
+    JUNO_POINTER_T tScratch = {&gtTestFastElemTrivialApi, &gtScratch, sizeof(gtScratch), alignof(TEST_FAST_ELEM_T)};
+    tArray.bSparse = true;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, JunoDs_HeapFastInit(&tHeap, &gtTestFastMinApi, &tArray.tRoot, tScratch, NULL, NULL));
+    tArray.bSparse = false;
+    tScratch.ptApi = &gtTestFastElemApi;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, JunoDs_HeapFastInit(&tHeap, &gtTestFastMinApi, &tArray.tRoot, tScratch, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoDs_HeapFastInit(&tHeap, NULL, &tArray.tRoot, tScratch, NULL, NULL));
+    // The heap cannot be driven through a mismatched API
+    tScratch.ptApi = &gtTestFastElemTrivialApi;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_HeapFastInit(&tHeap, &gtTestFastMinApi, &tArray.tRoot, tScratch, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_Heap_Init(ptRoot, &gtTestFastMinApi, &tArray.tRoot, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, JunoDs_HeapFastSetKey(&tHeap, JUNO_DS_HEAP_KEY_U32, 0, true));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_heap_fast_orders_match_reference);
+    RUN_TEST(test_heap_fast_errors);
+    return UNITY_END();
+}
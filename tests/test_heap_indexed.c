@@ -0,0 +1,368 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_heap_indexed.c
+ * @brief Unit tests for the indexed heap
+ *
+ * A random sequence of Insert, Update, Remove and Pop is checked against a
+ * reference table of keys per handle. After every operation the root must
+ * hold the smallest queued key, and the handle and position arrays must
+ * stay a consistent permutation that satisfies the heap property.
+ */
+
+#include "juno/ds/heap_indexed.h"
+#include "juno/ds/heap_api.h"
+#include "juno/ds/array_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include "unity.h"
+#include "unity_internals.h"
+#include <stdalign.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TEST_CAPACITY 64
+
+typedef struct TEST_INDEXED_ELEM_TAG
+{
+    uint32_t iKey;
+    uint32_t iTag;
+} TEST_INDEXED_ELEM_T;
+
+/// Contiguous array, or every other slot of it when bSparse is set
+typedef struct TEST_INDEXED_ARRAY_TAG JUNO_MODULE_DERIVE(JUNO_DS_ARRAY_ROOT_T,
+    TEST_INDEXED_ELEM_T *ptBuffer;
+    bool bSparse;
+) TEST_INDEXED_ARRAY_T;
+
+static JUNO_STATUS_T TestIndexedArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T TestIndexedArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T TestIndexedArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_DS_HEAP_COMPARE_RESULT_T TestIndexed_CompareMin(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild);
+static JUNO_DS_HEAP_COMPARE_RESULT_T TestIndexed_CompareFail(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild);
+static JUNO_STATUS_T TestIndexed_Swap(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tLeft, JUNO_POINTER_T tRight);
+
+static const JUNO_POINTER_API_T gtTestIndexedElemApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+static const JUNO_DS_ARRAY_API_T gtTestIndexedArrayApi = {
+    TestIndexedArray_SetAt,
+    TestIndexedArray_GetAt,
+    TestIndexedArray_RemoveAt
+};
+
+static const JUNO_DS_HEAP_POINTER_API_T gtTestIndexedMinApi = {
+    TestIndexed_CompareMin,
+    TestIndexed_Swap
+};
+
+static const JUNO_DS_HEAP_POINTER_API_T gtTestIndexedFailApi = {
+    TestIndexed_CompareFail,
+    TestIndexed_Swap
+};
+
+static TEST_INDEXED_ELEM_T gatBuffer[2 * TEST_CAPACITY];
+static size_t gazHeap[TEST_CAPACITY];
+static size_t gazPositions[TEST_CAPACITY];
+static size_t gzSwaps;
+
+static inline JUNO_POINTER_T TestIndexedArray_Slot(const TEST_INDEXED_ARRAY_T *ptArray, size_t iIndex)
+{
+    return JunoMemory_PointerInit(&gtTestIndexedElemApi, TEST_INDEXED_ELEM_T, &ptArray->ptBuffer[ptArray->bSparse ? 2 * iIndex : iIndex]);
+}
+
+static JUNO_STATUS_T TestIndexedArray_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerCopy(TestIndexedArray_Slot((TEST_INDEXED_ARRAY_T *)ptArray, iIndex), tItem);
+}
+
+static JUNO_RESULT_POINTER_T TestIndexedArray_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    tResult.tOk = TestIndexedArray_Slot((TEST_INDEXED_ARRAY_T *)ptArray, iIndex);
+    return tResult;
+}
+
+static JUNO_STATUS_T TestIndexedArray_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    return JunoMemory_PointerReset(TestIndexedArray_Slot((TEST_INDEXED_ARRAY_T *)ptArray, iIndex));
+}
+
+static JUNO_DS_HEAP_COMPARE_RESULT_T TestIndexed_CompareMin(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild)
+{
+    (void)ptHeap;
+    JUNO_DS_HEAP_COMPARE_RESULT_T tResult = {JUNO_STATUS_SUCCESS, false};
+    tResult.tOk = ((const TEST_INDEXED_ELEM_T *)tParent.pvAddr)->iKey <= ((const TEST_INDEXED_ELEM_T *)tChild.pvAddr)->iKey;
+    return tResult;
+}
+
+static JUNO_DS_HEAP_COMPARE_RESULT_T TestIndexed_CompareFail(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tParent, JUNO_POINTER_T tChild)
+{
+    (void)ptHeap;
+    (void)tParent;
+    (void)tChild;
+    JUNO_DS_HEAP_COMPARE_RESULT_T tResult = {JUNO_STATUS_ERR, false};
+    return tResult;
+}
+
+static JUNO_STATUS_T TestIndexed_Swap(JUNO_DS_HEAP_ROOT_T *ptHeap, JUNO_POINTER_T tLeft, JUNO_POINTER_T tRight)
+{
+    (void)ptHeap;
+    (void)tLeft;
+    (void)tRight;
+    gzSwaps += 1;
+    return JUNO_STATUS_ERR;
+}
+
+static uint32_t giSeed = 4242;
+
+static uint32_t TestIndexed_Rand(void)
+{
+    giSeed = giSeed * 1103515245u + 12345u;
+    return giSeed >> 8;
+}
+
+static void TestIndexed_Init(JUNO_DS_HEAP_INDEXED_T *ptHeap, TEST_INDEXED_ARRAY_T *ptArray)
+{
+    *ptArray = (TEST_INDEXED_ARRAY_T){0};
+    ptArray->ptBuffer = gatBuffer;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_ArrayInit(&ptArray->tRoot, &gtTestIndexedArrayApi, TEST_CAPACITY, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_HeapIndexedInit(ptHeap, &gtTestIndexedMinApi, &ptArray->tRoot, gazHeap, gazPositions, NULL, NULL));
+}
+
+/// Check the handle permutation, the heap property and every handle against the reference
+static void TestIndexed_CheckInvariants(JUNO_DS_HEAP_INDEXED_T *ptHeap, const bool *pbQueued, const uint32_t *piKeys)
+{
+    size_t zLength = ptHeap->tRoot.zLength;
+    uint32_t iMin = UINT32_MAX;
+    for(size_t i = 0; i < TEST_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(i, gazPositions[gazHeap[i]]);
+        if(i > 0 && i < zLength)
+        {
+            TEST_ASSERT_TRUE(gatBuffer[gazHeap[(i - 1) / ptHeap->tRoot.zArity]].iKey <= gatBuffer[gazHeap[i]].iKey);
+        }
+        JUNO_RESULT_BOOL_T tContains = JunoDs_HeapIndexedContains(ptHeap, i);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tContains.tStatus);
+        TEST_ASSERT_EQUAL(pbQueued[i], tContains.tOk);
+        if(pbQueued[i])
+        {
+            TEST_ASSERT_EQUAL_UINT32(piKeys[i], gatBuffer[i].iKey);
+            TEST_ASSERT_EQUAL_UINT32(i, gatBuffer[i].iTag);
+            iMin = piKeys[i] < iMin ? piKeys[i] : iMin;
+        }
+    }
+    JUNO_DS_HEAP_ENTRY_RESULT_T tPeek = JunoDs_HeapIndexedPeek(ptHeap);
+    if(zLength == 0)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, tPeek.tStatus);
+        return;
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tPeek.tStatus);
+    // Peek points into the backing array
+    TEST_ASSERT_EQUAL_PTR(&gatBuffer[tPeek.tOk.zHandle], tPeek.tOk.tElement.pvAddr);
+    TEST_ASSERT_EQUAL_UINT32(iMin, ((const TEST_INDEXED_ELEM_T *)tPeek.tOk.tElement.pvAddr)->iKey);
+}
+
+void setUp(void)
+{
+    gzSwaps = 0;
+}
+
+void tearDown(void)
+{
+
+}
+
+/// Run random operations with the given arity against the reference
+static void TestIndexed_RunReference(size_t zArity)
+{
+    JUNO_DS_HEAP_INDEXED_T tHeap;
+    TEST_INDEXED_ARRAY_T tArray;
+    TestIndexed_Init(&tHeap, &tArray);
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &tHeap.tRoot;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_Heap_SetArity(ptRoot, zArity));
+    bool abQueued[TEST_CAPACITY] = {false};
+    uint32_t aiKeys[TEST_CAPACITY] = {0};
+    size_t zQueued = 0;
+    for(size_t iOp = 0; iOp < 20000; iOp++)
+    {
+        size_t zHandle = TestIndexed_Rand() % TEST_CAPACITY;
+        TEST_INDEXED_ELEM_T tElem = {TestIndexed_Rand() % 500u, (uint32_t)zHandle};
+        JUNO_POINTER_T tPtr = JunoMemory_PointerInit(&gtTestIndexedElemApi, TEST_INDEXED_ELEM_T, &tElem);
+        switch(TestIndexed_Rand() % 5u)
+        {
+            case 0:
+            {
+                // Queue under the first free handle
+                if(zQueued == TEST_CAPACITY)
+                {
+                    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, JunoDs_HeapIndexedInsert(&tHeap, tPtr).tStatus);
+                    break;
+                }
+                zHandle = gazHeap[zQueued];
+                tElem.iTag = (uint32_t)zHandle;
+                JUNO_DS_HEAP_INDEX_RESULT_T tResult = JunoDs_HeapIndexedInsert(&tHeap, tPtr);
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+                TEST_ASSERT_EQUAL(zHandle, tResult.tOk);
+                abQueued[zHandle] = true;
+                aiKeys[zHandle] = tElem.iKey;
+                zQueued++;
+                break;
+            }
+            case 1:
+                if(abQueued[zHandle])
+                {
+                    TEST_ASSERT_EQUAL(JUNO_STATUS_REF_IN_USE_ERROR, JunoDs_HeapIndexedInsertHandle(&tHeap, zHandle, tPtr));
+                    break;
+                }
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_HeapIndexedInsertHandle(&tHeap, zHandle, tPtr));
+                abQueued[zHandle] = true;
+                aiKeys[zHandle] = tElem.iKey;
+                zQueued++;
+                break;
+            case 2:
+                if(!abQueued[zHandle])
+                {
+                    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, JunoDs_HeapIndexedUpdate(&tHeap, zHandle, tPtr));
+                    break;
+                }
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_HeapIndexedUpdate(&tHeap, zHandle, tPtr));
+                aiKeys[zHandle] = tElem.iKey;
+                break;
+            case 3:
+                if(!abQueued[zHandle])
+                {
+                    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, JunoDs_HeapIndexedRemove(&tHeap, zHandle));
+                    break;
+                }
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_HeapIndexedRemove(&tHeap, zHandle));
+                abQueued[zHandle] = false;
+                zQueued--;
+                break;
+            default:
+            {
+                TEST_INDEXED_ELEM_T tOut = {0};
+                JUNO_POINTER_T tOutPtr = JunoMemory_PointerInit(&gtTestIndexedElemApi, TEST_INDEXED_ELEM_T, &tOut);
+                if(zQueued == 0)
+                {
+                    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, ptRoot->ptApi->Pop(ptRoot, tOutPtr));
+                    break;
+                }
+                size_t zRoot = gazHeap[0];
+                TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptRoot->ptApi->Pop(ptRoot, tOutPtr));
+                TEST_ASSERT_EQUAL_UINT32(zRoot, tOut.iTag);
+                TEST_ASSERT_EQUAL_UINT32(aiKeys[zRoot], tOut.iKey);
+                abQueued[zRoot] = false;
+                zQueued--;
+                break;
+            }
+        }
+        TEST_ASSERT_EQUAL(zQueued, ptRoot->zLength);
+        TestIndexed_CheckInvariants(&tHeap, abQueued, aiKeys);
+    }
+    // Keys edited in place are reordered by Heapify
+    for(size_t i = 0; i < TEST_CAPACITY; i++)
+    {
+        if(abQueued[i])
+        {
+            JUNO_RESULT_POINTER_T tElem = JunoDs_HeapIndexedGet(&tHeap, i);
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tElem.tStatus);
+            aiKeys[i] = TestIndexed_Rand() % 500u;
+            ((TEST_INDEXED_ELEM_T *)tElem.tOk.pvAddr)->iKey = aiKeys[i];
+        }
+    }
+    if(zQueued)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptRoot->ptApi->Heapify(ptRoot));
+        TestIndexed_CheckInvariants(&tHeap, abQueued, aiKeys);
+    }
+}
+
+// @{"verify": ["REQ-HEAP-011", "REQ-HEAP-012", "REQ-HEAP-013", "REQ-HEAP-014", "REQ-HEAP-015"]}
+static void test_heap_indexed_matches_reference(void)
+{
+    TestIndexed_RunReference(2);
+    TestIndexed_RunReference(4);
+    TestIndexed_RunReference(8);
+    // Ordering never swaps elements
+    TEST_ASSERT_EQUAL(0, gzSwaps);
+}
+
+// @{"verify": ["REQ-HEAP-011", "REQ-HEAP-012", "REQ-HEAP-013", "REQ-HEAP-014"]}
+static void test_heap_indexed_errors(void)
+{
+    JUNO_DS_HEAP_INDEXED_T tHeap;
+    TEST_INDEXED_ARRAY_T tArray;
+    TestIndexed_Init(&tHeap, &tArray);
+    JUNO_DS_HEAP_ROOT_T *ptRoot = &tHeap.tRoot;
+    TEST_INDEXED_ELEM_T tElem = {7, 3};
+    JUNO_POINTER_T tPtr = JunoMemory_PointerInit(&gtTestIndexedElemApi, TEST_INDEXED_ELEM_T, &tElem);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, ptRoot->ptApi->Heapify(ptRoot));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, JunoDs_HeapIndexedPeek(&tHeap).tStatus);
+    // Handles outside the array
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, JunoDs_HeapIndexedInsertHandle(&tHeap, TEST_CAPACITY, tPtr));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, JunoDs_HeapIndexedUpdate(&tHeap, TEST_CAPACITY, tPtr));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, JunoDs_HeapIndexedRemove(&tHeap, TEST_CAPACITY));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, JunoDs_HeapIndexedGet(&tHeap, TEST_CAPACITY).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, JunoDs_HeapIndexedContains(&tHeap, TEST_CAPACITY).tStatus);
+    // Elements of another type
+    uint64_t iWrong = 0;
+    JUNO_POINTER_T tWrong = JunoMemory_PointerInit(&gtTestIndexedElemApi, uint64_t, &iWrong);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, JunoDs_HeapIndexedInsertHandle(&tHeap, 3, tWrong));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, ptRoot->ptApi->Insert(ptRoot, tWrong));
+    TEST_ASSERT_EQUAL(0, ptRoot->zLength);
+    // Compare errors propagate and keep the handle arrays consistent
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_HeapIndexedInsertHandle(&tHeap, 3, tPtr));
+    ptRoot->ptHeapPointerApi = &gtTestIndexedFailApi;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, JunoDs_HeapIndexedInsertHandle(&tHeap, 5, tPtr));
+    TEST_ASSERT_EQUAL(2, ptRoot->zLength);
+    for(size_t i = 0; i < TEST_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(i, gazPositions[gazHeap[i]]);
+    }
+    // Non-contiguous arrays and missing storage are rejected
+    tArray.bSparse = true;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, JunoDs_HeapIndexedInit(&tHeap, &gtTestIndexedMinApi, &tArray.tRoot, gazHeap, gazPositions, NULL, NULL));
+    tArray.bSparse = false;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoDs_HeapIndexedInit(&tHeap, &gtTestIndexedMinApi, &tArray.tRoot, NULL, gazPositions, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoDs_HeapIndexedPeek(NULL).tStatus);
+    // The heap cannot be driven through a mismatched API
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_HeapIndexedInit(&tHeap, &gtTestIndexedMinApi, &tArray.tRoot, gazHeap, gazPositions, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_Heap_Init(ptRoot, &gtTestIndexedMinApi, &tArray.tRoot, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, JunoDs_HeapIndexedRemove(&tHeap, 0));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_heap_indexed_matches_reference);
+    RUN_TEST(test_heap_indexed_errors);
+    return UNITY_END();
+}
@@ -656,6 +656,22 @@ static void test_map_remove_null_map(void)
     TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
 }
 
+// @{"verify": ["REQ-MAP-008"]}
+static void test_map_remove_invalid_pointer(void)
+{
+    JUNO_STATUS_T tStatus = InitTestMap(&gtTestMap, TEST_MAP_CAPACITY);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    TEST_MAP_ENTRY_T tEntry = CreateTestEntry(42, 0);
+    tStatus = JunoDs_MapSet(&gtTestMap.tRoot, TestMapEntry_PointerInit(&tEntry));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    // A key without a pointer API is rejected before it is hashed
+    JUNO_POINTER_T tPointer = TestMapEntry_PointerInit(&tEntry);
+    tPointer.ptApi = NULL;
+    tStatus = JunoDs_MapRemove(&gtTestMap.tRoot, tPointer);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, tStatus);
+    TEST_ASSERT_FALSE(gtTestMapBuffer[42 % TEST_MAP_CAPACITY].bIsNull);
+}
+
 /* ============================================================================
  * Test Cases: Collision Handling & Linear Probing
  * ============================================================================ */
@@ -734,6 +750,143 @@ static void test_map_wraparound_probing(void)
     TEST_ASSERT_EQUAL(19, gtTestMapBuffer[0].iKey);
 }
 
+/* ============================================================================
+ * Test Cases: Power-of-Two Capacity
+ * ============================================================================ */
+
+// @{"verify": ["REQ-MAP-011"]}
+static void test_map_pow2_init_rejects_non_pow2(void)
+{
+    gtTestMap.tArray.ptBuffer = gtTestMapBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&gtTestMap.tArray.tRoot, &gtTestMapArrayApi, 6, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    tStatus = JunoDs_MapInitPow2(&gtTestMap.tRoot, &gtTestMapEntryHashablePointerApi, &gtTestMapEntryValuePointerApi, &gtTestMap.tArray.tRoot, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, tStatus);
+}
+
+// @{"verify": ["REQ-MAP-011", "REQ-MAP-026"]}
+static void test_map_pow2_wraparound_probing(void)
+{
+    gtTestMap.tArray.ptBuffer = gtTestMapBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&gtTestMap.tArray.tRoot, &gtTestMapArrayApi, 8, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    tStatus = JunoDs_MapInitPow2(&gtTestMap.tRoot, &gtTestMapEntryHashablePointerApi, &gtTestMapEntryValuePointerApi, &gtTestMap.tArray.tRoot, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    const JUNO_MAP_API_T *ptApi = gtTestMap.tRoot.ptApi;
+    // Keys 7 and 15 both hash to slot 7; the second wraps to slot 0
+    TEST_MAP_ENTRY_T tEntry1 = CreateTestEntry(7, 100);
+    TEST_MAP_ENTRY_T tEntry2 = CreateTestEntry(15, 200);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptApi->Set(&gtTestMap.tRoot, TestMapEntry_PointerInit(&tEntry1)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptApi->Set(&gtTestMap.tRoot, TestMapEntry_PointerInit(&tEntry2)));
+    TEST_ASSERT_EQUAL(7, gtTestMapBuffer[7].iKey);
+    TEST_ASSERT_EQUAL(15, gtTestMapBuffer[0].iKey);
+    TEST_MAP_ENTRY_T tKey = CreateTestEntry(15, 0);
+    JUNO_RESULT_POINTER_T tResult = ptApi->Get(&gtTestMap.tRoot, TestMapEntry_PointerInit(&tKey));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(200, ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iValue);
+    // The generic functions agree with the masked API
+    tResult = JunoDs_MapGet(&gtTestMap.tRoot, TestMapEntry_PointerInit(&tKey));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    // The wrapped key is one slot from home
+    JUNO_MAP_STATS_RESULT_T tStats = JunoDs_MapStats(&gtTestMap.tRoot);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStats.tStatus);
+    TEST_ASSERT_EQUAL(2, tStats.tOk.zOccupied);
+    TEST_ASSERT_EQUAL(1, tStats.tOk.zTotalProbe);
+    TEST_ASSERT_EQUAL(1, tStats.tOk.zMaxProbe);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, ptApi->Remove(&gtTestMap.tRoot, TestMapEntry_PointerInit(&tKey)));
+    TEST_ASSERT_TRUE(gtTestMapBuffer[0].bIsNull);
+    tResult = ptApi->Get(&gtTestMap.tRoot, TestMapEntry_PointerInit(&tKey));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, tResult.tStatus);
+}
+
+/* ============================================================================
+ * Test Cases: Iteration, Bulk Load and Statistics
+ * ============================================================================ */
+
+// @{"verify": ["REQ-MAP-024"]}
+static void test_map_next_visits_occupied_slots(void)
+{
+    JUNO_STATUS_T tStatus = InitTestMap(&gtTestMap, TEST_MAP_CAPACITY);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    // Keys 9 and 19 collide; 19 wraps to slot 0
+    uint32_t iKeys[] = {3, 9, 19, 6};
+    for (size_t i = 0; i < sizeof(iKeys) / sizeof(iKeys[0]); i++) {
+        TEST_MAP_ENTRY_T tEntry = CreateTestEntry(iKeys[i], iKeys[i] * 10);
+        tStatus = JunoDs_MapSet(&gtTestMap.tRoot, TestMapEntry_PointerInit(&tEntry));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    }
+    // Entries come back in slot order
+    uint32_t iExpected[] = {19, 3, 6, 9};
+    JUNO_MAP_CURSOR_T tCursor = {0};
+    for (size_t i = 0; i < sizeof(iExpected) / sizeof(iExpected[0]); i++) {
+        JUNO_RESULT_POINTER_T tResult = JunoDs_MapNext(&gtTestMap.tRoot, &tCursor);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+        TEST_ASSERT_EQUAL(iExpected[i], ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iKey);
+    }
+    JUNO_RESULT_POINTER_T tResult = JunoDs_MapNext(&gtTestMap.tRoot, &tCursor);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, tResult.tStatus);
+    tResult = JunoDs_MapNext(&gtTestMap.tRoot, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, tResult.tStatus);
+}
+
+// @{"verify": ["REQ-MAP-025"]}
+static void test_map_set_many(void)
+{
+    JUNO_STATUS_T tStatus = InitTestMap(&gtTestMap, TEST_MAP_CAPACITY);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    TEST_MAP_ENTRY_T tEntries[TEST_MAP_CAPACITY + 1];
+    JUNO_POINTER_T tItems[TEST_MAP_CAPACITY + 1];
+    for (uint32_t i = 0; i < TEST_MAP_CAPACITY + 1; i++) {
+        tEntries[i] = CreateTestEntry(i, i * 10);
+        tItems[i] = TestMapEntry_PointerInit(&tEntries[i]);
+    }
+    JUNO_RESULT_SIZE_T tResult = JunoDs_MapSetMany(&gtTestMap.tRoot, tItems, 4);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(4, tResult.tOk);
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(i * 10, gtTestMapBuffer[i].iValue);
+    }
+    // The entry that did not fit is reported by index
+    tResult = JunoDs_MapSetMany(&gtTestMap.tRoot, tItems, TEST_MAP_CAPACITY + 1);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_TABLE_FULL_ERROR, tResult.tStatus);
+    TEST_ASSERT_EQUAL(TEST_MAP_CAPACITY, tResult.tOk);
+    tResult = JunoDs_MapSetMany(&gtTestMap.tRoot, NULL, 1);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, tResult.tStatus);
+}
+
+// @{"verify": ["REQ-MAP-026"]}
+static void test_map_stats(void)
+{
+    JUNO_STATUS_T tStatus = InitTestMap(&gtTestMap, TEST_MAP_CAPACITY);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    // Keys 5, 15 and 25 share home slot 5 and land at distances 0, 1 and 2
+    uint32_t iKeys[] = {5, 15, 25, 1};
+    for (size_t i = 0; i < sizeof(iKeys) / sizeof(iKeys[0]); i++) {
+        TEST_MAP_ENTRY_T tEntry = CreateTestEntry(iKeys[i], 0);
+        tStatus = JunoDs_MapSet(&gtTestMap.tRoot, TestMapEntry_PointerInit(&tEntry));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    }
+    JUNO_MAP_STATS_RESULT_T tResult = JunoDs_MapStats(&gtTestMap.tRoot);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(TEST_MAP_CAPACITY, tResult.tOk.zCapacity);
+    TEST_ASSERT_EQUAL(4, tResult.tOk.zOccupied);
+    TEST_ASSERT_EQUAL(3, tResult.tOk.zTotalProbe);
+    TEST_ASSERT_EQUAL(2, tResult.tOk.zMaxProbe);
+    // 15 compares against 5, 25 compares against 5 and 15
+    TEST_ASSERT_EQUAL(3, tResult.tOk.zEqualsCalls);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_MapStatsReset(&gtTestMap.tRoot));
+    tResult = JunoDs_MapStats(&gtTestMap.tRoot);
+    TEST_ASSERT_EQUAL(0, tResult.tOk.zEqualsCalls);
+    TEST_ASSERT_EQUAL(4, tResult.tOk.zOccupied);
+    // Other map implementations have their own statistics function
+    JUNO_MAP_API_T tApi = *gtTestMap.tRoot.ptApi;
+    gtTestMap.tRoot.ptApi = &tApi;
+    tResult = JunoDs_MapStats(&gtTestMap.tRoot);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, tResult.tStatus);
+    tResult = JunoDs_MapStatsScan(&gtTestMap.tRoot, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, tResult.tStatus);
+}
+
 /* ============================================================================
  * Test Cases: Edge Cases
  * ============================================================================ */
@@ -964,10 +1117,18 @@ int main(void)
     RUN_TEST(test_map_remove_nonexistent_item);
     RUN_TEST(test_map_remove_after_collision);
     RUN_TEST(test_map_remove_null_map);
+    RUN_TEST(test_map_remove_invalid_pointer);
     
     // Collision handling tests
     RUN_TEST(test_map_multiple_collisions_linear_probing);
     RUN_TEST(test_map_wraparound_probing);
+    RUN_TEST(test_map_pow2_init_rejects_non_pow2);
+    RUN_TEST(test_map_pow2_wraparound_probing);
+    
+    // Iteration, bulk load and statistics tests
+    RUN_TEST(test_map_next_visits_occupied_slots);
+    RUN_TEST(test_map_set_many);
+    RUN_TEST(test_map_stats);
     
     // Edge case tests
     RUN_TEST(test_map_single_element_capacity);
@@ -0,0 +1,266 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_map_cached_hash.c
+ * @brief Unit tests for the cached-hash map
+ *
+ * The hash is the low 16 bits of the key, so small keys hash to themselves
+ * and keys that differ only above bit 16 share a full hash.
+ */
+
+#include "juno/ds/map_cached_hash.h"
+/* Keys above bit 16 collide on purpose */
+#define TEST_MAP_HASH(iKey) ((size_t)((iKey) & 0xFFFFu))
+#include "test_map_fixture.h"
+#include <string.h>
+
+typedef struct TEST_MAP_TAG
+{
+    JUNO_MAP_CACHED_HASH_T tMap;
+    TEST_ARRAY_T tArray;
+} TEST_MAP_T;
+
+/* ============================================================================
+ * Test Fixture Setup/Teardown
+ * ============================================================================ */
+
+#define TEST_MAP_CAPACITY 16
+static TEST_MAP_T gtTestMap;
+static TEST_MAP_ENTRY_T gtTestMapBuffer[TEST_MAP_CAPACITY];
+static size_t gzTestMapHashes[TEST_MAP_CAPACITY];
+
+static void ResetBuffer(void)
+{
+    memset(gtTestMapBuffer, 0, sizeof(gtTestMapBuffer));
+    for (size_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        gtTestMapBuffer[i].bIsNull = true;
+    }
+}
+
+void setUp(void)
+{
+    memset(&gtTestMap, 0, sizeof(gtTestMap));
+    memset(gzTestMapHashes, 0xFF, sizeof(gzTestMapHashes));
+    ResetBuffer();
+    gzEqualsCalls = 0;
+}
+
+void tearDown(void)
+{
+    /* No dynamic allocations to clean up */
+}
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+static JUNO_STATUS_T InitTestMap(TEST_MAP_T *ptMap, size_t *pzHashes)
+{
+    ptMap->tArray.ptBuffer = gtTestMapBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&ptMap->tArray.tRoot, &gtTestMapArrayApi, TEST_MAP_CAPACITY, NULL, NULL);
+    if (tStatus != JUNO_STATUS_SUCCESS) {
+        return tStatus;
+    }
+    return JunoDs_MapCachedHashInit(&ptMap->tMap, &gtTestMapEntryHashablePointerApi, &gtTestMapEntryValuePointerApi, &ptMap->tArray.tRoot, pzHashes, NULL, NULL);
+}
+
+static JUNO_STATUS_T SetKey(JUNO_MAP_ROOT_T *ptMap, uint32_t iKey, uint32_t iValue)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, iValue, false};
+    return ptMap->ptApi->Set(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static JUNO_RESULT_POINTER_T GetKey(JUNO_MAP_ROOT_T *ptMap, uint32_t iKey)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, 0, false};
+    return ptMap->ptApi->Get(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static JUNO_STATUS_T RemoveKey(JUNO_MAP_ROOT_T *ptMap, uint32_t iKey)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, 0, false};
+    return ptMap->ptApi->Remove(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static void AssertValue(JUNO_MAP_ROOT_T *ptMap, uint32_t iKey, uint32_t iValue)
+{
+    JUNO_RESULT_POINTER_T tResult = GetKey(ptMap, iKey);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(iKey, ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iKey);
+    TEST_ASSERT_EQUAL(iValue, ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iValue);
+}
+
+/* ============================================================================
+ * Test Cases
+ * ============================================================================ */
+
+// @{"verify": ["REQ-MAP-015"]}
+static void test_map_cached_hash_init(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapHashes));
+    for (size_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        TEST_ASSERT_EQUAL(0, gzTestMapHashes[i]);
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, InitTestMap(&gtTestMap, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoDs_MapCachedHashInit(NULL, &gtTestMapEntryHashablePointerApi, &gtTestMapEntryValuePointerApi, &gtTestMap.tArray.tRoot, gzTestMapHashes, NULL, NULL));
+}
+
+// @{"verify": ["REQ-MAP-016"]}
+static void test_map_cached_hash_set_get_update(void)
+{
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapHashes));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 3, 30));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 19, 190));
+    AssertValue(ptMap, 3, 30);
+    AssertValue(ptMap, 19, 190);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 19, 191));
+    AssertValue(ptMap, 19, 191);
+    TEST_ASSERT_EQUAL(19, gtTestMapBuffer[4].iKey);
+    TEST_ASSERT_TRUE(gtTestMapBuffer[5].bIsNull);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(ptMap, 35).tStatus);
+}
+
+// @{"verify": ["REQ-MAP-016"]}
+static void test_map_cached_hash_equals_only_on_hash_match(void)
+{
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapHashes));
+    // Four keys homed at slot 1 with distinct hashes
+    for (uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 1 + i * TEST_MAP_CAPACITY, i));
+    }
+    TEST_ASSERT_EQUAL(0, gzEqualsCalls);
+    AssertValue(ptMap, 1 + 3 * TEST_MAP_CAPACITY, 3);
+    TEST_ASSERT_EQUAL(1, gzEqualsCalls);
+    gzEqualsCalls = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(ptMap, 1 + 4 * TEST_MAP_CAPACITY).tStatus);
+    TEST_ASSERT_EQUAL(0, gzEqualsCalls);
+    // A full hash collision still compares the keys
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 0x10001, 100));
+    gzEqualsCalls = 0;
+    AssertValue(ptMap, 0x10001, 100);
+    TEST_ASSERT_EQUAL(2, gzEqualsCalls);
+    AssertValue(ptMap, 1, 0);
+}
+
+// @{"verify": ["REQ-MAP-016"]}
+static void test_map_cached_hash_fewer_equals_than_linear(void)
+{
+    // 14 keys (87.5% load) in clusters of two homes each
+    static const uint32_t iKeys = 14;
+    JUNO_MAP_ROOT_T tLinear = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapHashes));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_MapInit(&tLinear, &gtTestMapEntryHashablePointerApi, &gtTestMapEntryValuePointerApi, &gtTestMap.tArray.tRoot, NULL, NULL));
+    JUNO_MAP_ROOT_T *aptMaps[2] = {&tLinear, &gtTestMap.tMap.tRoot};
+    size_t zEquals[2] = {0};
+    for (size_t iMap = 0; iMap < 2; iMap++) {
+        ResetBuffer();
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapHashes));
+        for (uint32_t i = 0; i < iKeys; i++) {
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(aptMaps[iMap], i * TEST_MAP_CAPACITY + i / 2, i));
+        }
+        gzEqualsCalls = 0;
+        for (uint32_t i = 0; i < iKeys; i++) {
+            AssertValue(aptMaps[iMap], i * TEST_MAP_CAPACITY + i / 2, i);
+        }
+        zEquals[iMap] = gzEqualsCalls;
+    }
+    // One comparison per hit against one per probed slot
+    TEST_ASSERT_EQUAL(iKeys, zEquals[1]);
+    TEST_ASSERT_LESS_THAN(zEquals[0], 2 * zEquals[1]);
+}
+
+// @{"verify": ["REQ-MAP-017"]}
+static void test_map_cached_hash_remove_backward_shift(void)
+{
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapHashes));
+    // 15 and 31 wrap into slot 0, pushing 0 and 16 to slots 1 and 2
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 15, 150));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 31, 310));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 0, 0));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 16, 160));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 3, 30));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(ptMap, 15));
+    // The chain moved back, 3 stayed at its home slot
+    TEST_ASSERT_EQUAL(31, gtTestMapBuffer[15].iKey);
+    TEST_ASSERT_EQUAL(0, gtTestMapBuffer[0].iKey);
+    TEST_ASSERT_EQUAL(16, gtTestMapBuffer[1].iKey);
+    TEST_ASSERT_TRUE(gtTestMapBuffer[2].bIsNull);
+    TEST_ASSERT_EQUAL(0, gzTestMapHashes[2]);
+    TEST_ASSERT_EQUAL(3, gtTestMapBuffer[3].iKey);
+    gzEqualsCalls = 0;
+    AssertValue(ptMap, 31, 310);
+    AssertValue(ptMap, 0, 0);
+    AssertValue(ptMap, 16, 160);
+    AssertValue(ptMap, 3, 30);
+    TEST_ASSERT_EQUAL(4, gzEqualsCalls);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(ptMap, 15).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(ptMap, 15));
+}
+
+// @{"verify": ["REQ-MAP-016", "REQ-MAP-017"]}
+static void test_map_cached_hash_table_full(void)
+{
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapHashes));
+    for (uint32_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, i * 5, i));
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_TABLE_FULL_ERROR, SetKey(ptMap, 100, 0));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_TABLE_FULL_ERROR, GetKey(ptMap, 100).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 10, 11));
+    AssertValue(ptMap, 10, 11);
+    // Removing from a full table terminates and keeps the other keys
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(ptMap, 10));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 100, 1000));
+    for (uint32_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        if (i != 2) {
+            AssertValue(ptMap, i * 5, i);
+        }
+    }
+    AssertValue(ptMap, 100, 1000);
+}
+
+// @{"verify": ["REQ-MAP-026"]}
+static void test_map_cached_hash_stats(void)
+{
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapHashes));
+    // 15 at home, 31 wraps to slot 0, 0 and 16 are pushed to slots 1 and 2, 3 at home
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 15, 150));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 31, 310));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 0, 0));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 16, 160));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(ptMap, 3, 30));
+    TestMap_AssertStats(ptMap, JunoDs_MapCachedHashStats(&gtTestMap.tMap), 5, 4, 2);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_map_cached_hash_init);
+    RUN_TEST(test_map_cached_hash_set_get_update);
+    RUN_TEST(test_map_cached_hash_equals_only_on_hash_match);
+    RUN_TEST(test_map_cached_hash_fewer_equals_than_linear);
+    RUN_TEST(test_map_cached_hash_remove_backward_shift);
+    RUN_TEST(test_map_cached_hash_table_full);
+    RUN_TEST(test_map_cached_hash_stats);
+    return UNITY_END();
+}
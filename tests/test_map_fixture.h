@@ -0,0 +1,282 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+
+/**
+ * @file test_map_fixture.h
+ * @brief Fixture shared by the map implementation tests
+ *
+ * Provides the test entry type with its pointer, value and hashable pointer
+ * APIs, an array over a TEST_MAP_ENTRY_T buffer, an Equals call counter and
+ * a statistics check. Keys hash to themselves unless TEST_MAP_HASH is defined
+ * before this header is included.
+ */
+
+#ifndef TEST_MAP_FIXTURE_H
+#define TEST_MAP_FIXTURE_H
+
+#include "juno/ds/map_api.h"
+#include "juno/ds/array_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include "unity.h"
+#include "unity_internals.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef TEST_MAP_HASH
+#define TEST_MAP_HASH(iKey) ((size_t)(iKey))
+#endif
+
+/* ============================================================================
+ * Test Data Type Definition
+ * ============================================================================ */
+
+typedef struct TEST_MAP_ENTRY_TAG
+{
+    uint32_t iKey;
+    uint32_t iValue;
+    bool bIsNull; // Indicates if this entry is empty
+} TEST_MAP_ENTRY_T;
+
+/* ============================================================================
+ * Test Map Implementation (Custom Array-backed Hash Map)
+ * ============================================================================ */
+
+typedef struct TEST_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    TEST_MAP_ENTRY_T *ptBuffer;
+} TEST_ARRAY_T;
+
+/* Number of Equals calls */
+static size_t gzEqualsCalls;
+
+/* Forward declarations for array API functions */
+static JUNO_STATUS_T TestMap_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T TestMap_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T TestMap_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+/* Forward declarations for pointer API functions */
+static JUNO_STATUS_T TestMapEntry_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T TestMapEntry_Reset(JUNO_POINTER_T tPointer);
+static JUNO_RESULT_BOOL_T TestMapEntry_Equals(const JUNO_POINTER_T tLeft, const JUNO_POINTER_T tRight);
+
+/* Forward declarations for hashable pointer API functions */
+static JUNO_RESULT_SIZE_T TestMapEntry_Hash(JUNO_POINTER_T tItem);
+static JUNO_RESULT_BOOL_T TestMapEntry_IsNull(JUNO_POINTER_T tItem);
+
+/* Pointer API for TEST_MAP_ENTRY_T */
+static const JUNO_POINTER_API_T gtTestMapEntryPointerApi = {
+    TestMapEntry_Copy,
+    TestMapEntry_Reset
+};
+
+/* Value Pointer API for TEST_MAP_ENTRY_T */
+static const JUNO_VALUE_POINTER_API_T gtTestMapEntryValuePointerApi = {
+    TestMapEntry_Equals
+};
+
+/* Hashable Pointer API for TEST_MAP_ENTRY_T */
+static const JUNO_MAP_HASHABLE_POINTER_API_T gtTestMapEntryHashablePointerApi = {
+    TestMapEntry_Hash,
+    TestMapEntry_IsNull
+};
+
+/* Array API for TEST_MAP_T */
+static const JUNO_DS_ARRAY_API_T gtTestMapArrayApi = {
+    TestMap_SetAt,
+    TestMap_GetAt,
+    TestMap_RemoveAt
+};
+
+/* Macros to initialize and verify pointer types */
+#define TestMapEntry_PointerInit(addr) (JUNO_POINTER_T){&gtTestMapEntryPointerApi, addr, sizeof(TEST_MAP_ENTRY_T), alignof(TEST_MAP_ENTRY_T)}
+#define TEST_ARRAY_ASSERT_API(ptArray, ...)  if(ptArray->ptApi != &gtTestMapArrayApi) { __VA_ARGS__; }
+
+/* ============================================================================
+ * Pointer API Implementation
+ * ============================================================================ */
+
+static JUNO_STATUS_T TestMapEntry_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    if (!tDest.pvAddr || !tSrc.pvAddr) {
+        return JUNO_STATUS_ERR;
+    }
+    if (tDest.zSize != sizeof(TEST_MAP_ENTRY_T) || tSrc.zSize != sizeof(TEST_MAP_ENTRY_T)) {
+        return JUNO_STATUS_INVALID_SIZE_ERROR;
+    }
+    *(TEST_MAP_ENTRY_T *)tDest.pvAddr = *(TEST_MAP_ENTRY_T *)tSrc.pvAddr;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestMapEntry_Reset(JUNO_POINTER_T tPointer)
+{
+    if (!tPointer.pvAddr) {
+        return JUNO_STATUS_ERR;
+    }
+    if (tPointer.zSize != sizeof(TEST_MAP_ENTRY_T)) {
+        return JUNO_STATUS_INVALID_SIZE_ERROR;
+    }
+    TEST_MAP_ENTRY_T *ptEntry = (TEST_MAP_ENTRY_T *)tPointer.pvAddr;
+    ptEntry->iKey = 0;
+    ptEntry->iValue = 0;
+    ptEntry->bIsNull = true;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_RESULT_BOOL_T TestMapEntry_Equals(const JUNO_POINTER_T tLeft, const JUNO_POINTER_T tRight)
+{
+    JUNO_RESULT_BOOL_T tResult = {0};
+    if (!tLeft.pvAddr || !tRight.pvAddr) {
+        tResult.tStatus = JUNO_STATUS_ERR;
+        return tResult;
+    }
+    if (tLeft.zSize != sizeof(TEST_MAP_ENTRY_T) || tRight.zSize != sizeof(TEST_MAP_ENTRY_T)) {
+        tResult.tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        return tResult;
+    }
+    
+    gzEqualsCalls++;
+    TEST_MAP_ENTRY_T *ptLeft = (TEST_MAP_ENTRY_T *)tLeft.pvAddr;
+    TEST_MAP_ENTRY_T *ptRight = (TEST_MAP_ENTRY_T *)tRight.pvAddr;
+    
+    tResult.tOk = (ptLeft->iKey == ptRight->iKey);
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    return tResult;
+}
+
+/* ============================================================================
+ * Hashable Pointer API Implementation
+ * ============================================================================ */
+
+static JUNO_RESULT_SIZE_T TestMapEntry_Hash(JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_SIZE_T tResult = {0};
+    if (!tItem.pvAddr) {
+        tResult.tStatus = JUNO_STATUS_ERR;
+        return tResult;
+    }
+    if (tItem.zSize != sizeof(TEST_MAP_ENTRY_T)) {
+        tResult.tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        return tResult;
+    }
+    
+    TEST_MAP_ENTRY_T *ptEntry = (TEST_MAP_ENTRY_T *)tItem.pvAddr;
+    tResult.tOk = TEST_MAP_HASH(ptEntry->iKey);
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    return tResult;
+}
+
+static JUNO_RESULT_BOOL_T TestMapEntry_IsNull(JUNO_POINTER_T tItem)
+{
+    JUNO_RESULT_BOOL_T tResult = {0};
+    if (!tItem.pvAddr) {
+        tResult.tStatus = JUNO_STATUS_ERR;
+        return tResult;
+    }
+    if (tItem.zSize != sizeof(TEST_MAP_ENTRY_T)) {
+        tResult.tStatus = JUNO_STATUS_INVALID_SIZE_ERROR;
+        return tResult;
+    }
+    
+    TEST_MAP_ENTRY_T *ptEntry = (TEST_MAP_ENTRY_T *)tItem.pvAddr;
+    tResult.tOk = ptEntry->bIsNull;
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    return tResult;
+}
+
+/* ============================================================================
+ * Array API Implementation
+ * ============================================================================ */
+
+static JUNO_STATUS_T TestMap_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerify(ptArray);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_ARRAY_ASSERT_API(ptArray, return JUNO_STATUS_INVALID_TYPE_ERROR);
+    
+    if (tItem.zSize != sizeof(TEST_MAP_ENTRY_T)) {
+        return JUNO_STATUS_INVALID_SIZE_ERROR;
+    }
+    
+    tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    
+    // Cast to get the containing TEST_ARRAY_T structure
+    TEST_ARRAY_T *ptArrayImpl = (TEST_ARRAY_T *)ptArray;
+    JUNO_POINTER_T tIndexPointer = {tItem.ptApi, &ptArrayImpl->ptBuffer[iIndex], sizeof(TEST_MAP_ENTRY_T), alignof(TEST_MAP_ENTRY_T)};
+    tStatus = tItem.ptApi->Copy(tIndexPointer, tItem);
+    return tStatus;
+}
+
+static JUNO_RESULT_POINTER_T TestMap_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {0};
+    tResult.tStatus = JunoDs_ArrayVerify(ptArray);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    TEST_ARRAY_ASSERT_API(ptArray,
+        tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR;
+        return tResult
+    );
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    
+    // Cast to get the containing TEST_ARRAY_T structure
+    TEST_ARRAY_T *ptArrayImpl = (TEST_ARRAY_T *)ptArray;
+    tResult.tOk.ptApi = &gtTestMapEntryPointerApi;
+    tResult.tOk.pvAddr = &ptArrayImpl->ptBuffer[iIndex];
+    tResult.tOk.zSize = sizeof(TEST_MAP_ENTRY_T);
+    tResult.tOk.zAlignment = alignof(TEST_MAP_ENTRY_T);
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    return tResult;
+}
+
+static JUNO_STATUS_T TestMap_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerify(ptArray);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_ARRAY_ASSERT_API(ptArray, return JUNO_STATUS_INVALID_TYPE_ERROR);
+    tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    
+    // Cast to get the containing TEST_ARRAY_T structure
+    TEST_ARRAY_T *ptArrayImpl = (TEST_ARRAY_T *)ptArray;
+    JUNO_POINTER_T tIndexPointer = {&gtTestMapEntryPointerApi, &ptArrayImpl->ptBuffer[iIndex], sizeof(TEST_MAP_ENTRY_T), alignof(TEST_MAP_ENTRY_T)};
+    tStatus = tIndexPointer.ptApi->Reset(tIndexPointer);
+    return tStatus;
+}
+
+/* ============================================================================
+ * Statistics Check
+ * ============================================================================ */
+
+/* Check a map's statistics and that the linear-probing statistics reject it */
+static inline void TestMap_AssertStats(JUNO_MAP_ROOT_T *ptMap, JUNO_MAP_STATS_RESULT_T tResult, size_t zOccupied, size_t zTotalProbe, size_t zMaxProbe)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(ptMap->ptHashMap->zCapacity, tResult.tOk.zCapacity);
+    TEST_ASSERT_EQUAL(zOccupied, tResult.tOk.zOccupied);
+    TEST_ASSERT_EQUAL(zTotalProbe, tResult.tOk.zTotalProbe);
+    TEST_ASSERT_EQUAL(zMaxProbe, tResult.tOk.zMaxProbe);
+    TEST_ASSERT_EQUAL(ptMap->zEqualsCalls, tResult.tOk.zEqualsCalls);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, JunoDs_MapStats(ptMap).tStatus);
+}
+
+#endif // TEST_MAP_FIXTURE_H
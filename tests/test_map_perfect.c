@@ -0,0 +1,235 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_map_perfect.c
+ * @brief Unit tests for the perfect-hash map
+ *
+ * Keys hash to themselves, like message IDs. The table below was produced by
+ * scripts/create_perfect_hash.py.
+ */
+
+#include "juno/ds/map_perfect.h"
+#include "test_map_fixture.h"
+#include <string.h>
+
+typedef struct TEST_MAP_TAG
+{
+    JUNO_MAP_PERFECT_T tMap;
+    TEST_ARRAY_T tArray;
+} TEST_MAP_T;
+
+/* ============================================================================
+ * Generated Table
+ * python3 scripts/create_perfect_hash.py test_mids 0x1800 0x1801 0x1802 0x1810 0x1880 0x1881 0x18A0 0x0801 0x0802 0x1F00 0x1F01
+ * ============================================================================ */
+
+/// Number of keys and slots in the test_mids table.
+#define TEST_MIDS_PERFECT_KEYS (11u)
+
+static const uint32_t giTestMidsDisplacements[6] =
+{
+    0u,
+    0u,
+    0u,
+    2u,
+    1u,
+    4u
+};
+
+static const size_t gzTestMidsKeys[11] =
+{
+    0x18a0u,
+    0x1810u,
+    0x1801u,
+    0x801u,
+    0x1f00u,
+    0x1800u,
+    0x1881u,
+    0x1f01u,
+    0x1802u,
+    0x802u,
+    0x1880u
+};
+
+static const JUNO_MAP_PERFECT_TABLE_T gtTestMidsPerfectTable =
+{
+    giTestMidsDisplacements,
+    6,
+    gzTestMidsKeys,
+    11,
+    0u
+};
+
+static const uint32_t giTestMids[] = {0x1800, 0x1801, 0x1802, 0x1810, 0x1880, 0x1881, 0x18A0, 0x0801, 0x0802, 0x1F00, 0x1F01};
+#define TEST_MIDS_LENGTH (sizeof(giTestMids) / sizeof(giTestMids[0]))
+
+/* ============================================================================
+ * Test Fixture Setup/Teardown
+ * ============================================================================ */
+
+static TEST_MAP_T gtTestMap;
+static TEST_MAP_ENTRY_T gtTestMapBuffer[TEST_MIDS_PERFECT_KEYS];
+
+void setUp(void)
+{
+    memset(&gtTestMap, 0, sizeof(gtTestMap));
+    memset(gtTestMapBuffer, 0, sizeof(gtTestMapBuffer));
+    for (size_t i = 0; i < TEST_MIDS_PERFECT_KEYS; i++) {
+        gtTestMapBuffer[i].bIsNull = true;
+    }
+    gzEqualsCalls = 0;
+}
+
+void tearDown(void)
+{
+    /* No dynamic allocations to clean up */
+}
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+static JUNO_STATUS_T InitTestMap(TEST_MAP_T *ptMap, size_t zCapacity, const JUNO_MAP_PERFECT_TABLE_T *ptTable)
+{
+    ptMap->tArray.ptBuffer = gtTestMapBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&ptMap->tArray.tRoot, &gtTestMapArrayApi, zCapacity, NULL, NULL);
+    if (tStatus != JUNO_STATUS_SUCCESS) {
+        return tStatus;
+    }
+    return JunoDs_MapPerfectInit(&ptMap->tMap, &gtTestMapEntryHashablePointerApi, &gtTestMapEntryValuePointerApi, &ptMap->tArray.tRoot, ptTable, NULL, NULL);
+}
+
+static JUNO_STATUS_T SetKey(uint32_t iKey, uint32_t iValue)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, iValue, false};
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    return ptMap->ptApi->Set(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static JUNO_RESULT_POINTER_T GetKey(uint32_t iKey)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, 0, false};
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    return ptMap->ptApi->Get(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static JUNO_STATUS_T RemoveKey(uint32_t iKey)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, 0, false};
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    return ptMap->ptApi->Remove(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static void AssertValue(uint32_t iKey, uint32_t iValue)
+{
+    JUNO_RESULT_POINTER_T tResult = GetKey(iKey);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(iKey, ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iKey);
+    TEST_ASSERT_EQUAL(iValue, ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iValue);
+}
+
+/* ============================================================================
+ * Test Cases
+ * ============================================================================ */
+
+// @{"verify": ["REQ-MAP-022"]}
+static void test_map_perfect_init(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MIDS_PERFECT_KEYS, &gtTestMidsPerfectTable));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, InitTestMap(&gtTestMap, TEST_MIDS_PERFECT_KEYS, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, InitTestMap(&gtTestMap, TEST_MIDS_PERFECT_KEYS - 1, &gtTestMidsPerfectTable));
+}
+
+// @{"verify": ["REQ-MAP-021"]}
+static void test_map_perfect_slots_are_minimal_and_unique(void)
+{
+    bool bUsed[TEST_MIDS_PERFECT_KEYS] = {0};
+    TEST_ASSERT_EQUAL(TEST_MIDS_LENGTH, TEST_MIDS_PERFECT_KEYS);
+    for (size_t i = 0; i < TEST_MIDS_LENGTH; i++) {
+        size_t iSlot = JunoDs_MapPerfectSlot(&gtTestMidsPerfectTable, giTestMids[i]);
+        TEST_ASSERT_LESS_THAN(TEST_MIDS_PERFECT_KEYS, iSlot);
+        TEST_ASSERT_FALSE(bUsed[iSlot]);
+        TEST_ASSERT_EQUAL(giTestMids[i], gzTestMidsKeys[iSlot]);
+        bUsed[iSlot] = true;
+    }
+}
+
+// @{"verify": ["REQ-MAP-023"]}
+static void test_map_perfect_single_probe(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MIDS_PERFECT_KEYS, &gtTestMidsPerfectTable));
+    for (size_t i = 0; i < TEST_MIDS_LENGTH; i++) {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(giTestMids[i], (uint32_t)i));
+    }
+    TEST_ASSERT_EQUAL(0, gzEqualsCalls);
+    for (size_t i = 0; i < TEST_MIDS_LENGTH; i++) {
+        AssertValue(giTestMids[i], (uint32_t)i);
+    }
+    TEST_ASSERT_EQUAL(TEST_MIDS_LENGTH, gzEqualsCalls);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(0x1880, 100));
+    AssertValue(0x1880, 100);
+}
+
+// @{"verify": ["REQ-MAP-023"]}
+static void test_map_perfect_rejects_unknown_keys(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MIDS_PERFECT_KEYS, &gtTestMidsPerfectTable));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(0x1800, 1));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, SetKey(0x1803, 1));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(0x1803).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(0x1803));
+    TEST_ASSERT_EQUAL(0, gzEqualsCalls);
+    AssertValue(0x1800, 1);
+}
+
+// @{"verify": ["REQ-MAP-023"]}
+static void test_map_perfect_remove(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MIDS_PERFECT_KEYS, &gtTestMidsPerfectTable));
+    // A key of the set that has not been stored
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(0x0801).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(0x0801));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(0x0801, 8));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(0x0802, 9));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(0x0801));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(0x0801).tStatus);
+    AssertValue(0x0802, 9);
+}
+
+// @{"verify": ["REQ-MAP-026"]}
+static void test_map_perfect_stats(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MIDS_PERFECT_KEYS, &gtTestMidsPerfectTable));
+    for (size_t i = 0; i < TEST_MIDS_LENGTH; i++) {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(giTestMids[i], (uint32_t)i));
+    }
+    // Every key sits in its one slot
+    TestMap_AssertStats(&gtTestMap.tMap.tRoot, JunoDs_MapPerfectStats(&gtTestMap.tMap), TEST_MIDS_LENGTH, 0, 0);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_map_perfect_init);
+    RUN_TEST(test_map_perfect_slots_are_minimal_and_unique);
+    RUN_TEST(test_map_perfect_single_probe);
+    RUN_TEST(test_map_perfect_rejects_unknown_keys);
+    RUN_TEST(test_map_perfect_remove);
+    RUN_TEST(test_map_perfect_stats);
+    return UNITY_END();
+}
@@ -0,0 +1,256 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_map_robin_hood.c
+ * @brief Unit tests for the Robin Hood map
+ *
+ * Uses an identity hash so that home slots and collisions are explicit.
+ */
+
+#include "juno/ds/map_robin_hood.h"
+#include "test_map_fixture.h"
+#include <string.h>
+
+typedef struct TEST_MAP_TAG
+{
+    JUNO_MAP_ROBIN_HOOD_T tMap;
+    TEST_ARRAY_T tArray;
+} TEST_MAP_T;
+
+/* ============================================================================
+ * Test Fixture Setup/Teardown
+ * ============================================================================ */
+
+#define TEST_MAP_CAPACITY 8
+static TEST_MAP_T gtTestMap;
+static TEST_MAP_ENTRY_T gtTestMapBuffer[TEST_MAP_CAPACITY];
+static size_t gzTestMapDistances[TEST_MAP_CAPACITY];
+
+void setUp(void)
+{
+    memset(&gtTestMap, 0, sizeof(gtTestMap));
+    memset(gtTestMapBuffer, 0, sizeof(gtTestMapBuffer));
+    memset(gzTestMapDistances, 0xFF, sizeof(gzTestMapDistances));
+    for (size_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        gtTestMapBuffer[i].bIsNull = true;
+    }
+    gzEqualsCalls = 0;
+}
+
+void tearDown(void)
+{
+    /* No dynamic allocations to clean up */
+}
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+static JUNO_STATUS_T InitTestMap(TEST_MAP_T *ptMap, size_t *pzDistances)
+{
+    ptMap->tArray.ptBuffer = gtTestMapBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&ptMap->tArray.tRoot, &gtTestMapArrayApi, TEST_MAP_CAPACITY, NULL, NULL);
+    if (tStatus != JUNO_STATUS_SUCCESS) {
+        return tStatus;
+    }
+    return JunoDs_MapRobinHoodInit(&ptMap->tMap, &gtTestMapEntryHashablePointerApi, &gtTestMapEntryValuePointerApi, &ptMap->tArray.tRoot, pzDistances, NULL, NULL);
+}
+
+static JUNO_STATUS_T SetKey(uint32_t iKey, uint32_t iValue)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, iValue, false};
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    return ptMap->ptApi->Set(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static JUNO_RESULT_POINTER_T GetKey(uint32_t iKey)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, 0, false};
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    return ptMap->ptApi->Get(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static JUNO_STATUS_T RemoveKey(uint32_t iKey)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, 0, false};
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    return ptMap->ptApi->Remove(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static void AssertValue(uint32_t iKey, uint32_t iValue)
+{
+    JUNO_RESULT_POINTER_T tResult = GetKey(iKey);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(iKey, ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iKey);
+    TEST_ASSERT_EQUAL(iValue, ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iValue);
+}
+
+/* ============================================================================
+ * Test Cases
+ * ============================================================================ */
+
+// @{"verify": ["REQ-MAP-012"]}
+static void test_map_robin_hood_init(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapDistances));
+    TEST_ASSERT_EQUAL(0, gtTestMap.tMap.zLength);
+    for (size_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        TEST_ASSERT_EQUAL(0, gzTestMapDistances[i]);
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, InitTestMap(&gtTestMap, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoDs_MapRobinHoodInit(NULL, &gtTestMapEntryHashablePointerApi, &gtTestMapEntryValuePointerApi, &gtTestMap.tArray.tRoot, gzTestMapDistances, NULL, NULL));
+}
+
+// @{"verify": ["REQ-MAP-012"]}
+static void test_map_robin_hood_rejects_other_api(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapDistances));
+    const JUNO_MAP_API_T *ptApi = gtTestMap.tMap.tRoot.ptApi;
+    JUNO_MAP_API_T tOtherApi = *ptApi;
+    gtTestMap.tMap.tRoot.ptApi = &tOtherApi;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, ptApi->Set(&gtTestMap.tMap.tRoot, TestMapEntry_PointerInit(&gtTestMapBuffer[0])));
+}
+
+// @{"verify": ["REQ-MAP-013"]}
+static void test_map_robin_hood_set_get_update(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapDistances));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(3, 30));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(5, 50));
+    AssertValue(3, 30);
+    AssertValue(5, 50);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(3, 31));
+    AssertValue(3, 31);
+    TEST_ASSERT_EQUAL(2, gtTestMap.tMap.zLength);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(4).tStatus);
+}
+
+// @{"verify": ["REQ-MAP-013"]}
+static void test_map_robin_hood_orders_cluster_by_home(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapDistances));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(1, 10));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(2, 20));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(9, 90));
+    // 9 (home 1) steals slot 2 from the richer 2, which moves to slot 3
+    TEST_ASSERT_EQUAL(1, gtTestMapBuffer[1].iKey);
+    TEST_ASSERT_EQUAL(9, gtTestMapBuffer[2].iKey);
+    TEST_ASSERT_EQUAL(2, gtTestMapBuffer[3].iKey);
+    TEST_ASSERT_EQUAL(1, gzTestMapDistances[1]);
+    TEST_ASSERT_EQUAL(2, gzTestMapDistances[2]);
+    TEST_ASSERT_EQUAL(2, gzTestMapDistances[3]);
+    AssertValue(1, 10);
+    AssertValue(2, 20);
+    AssertValue(9, 90);
+}
+
+// @{"verify": ["REQ-MAP-013"]}
+static void test_map_robin_hood_miss_exits_early(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapDistances));
+    // Fill slots 0..5 with keys homed at 0..5
+    for (uint32_t i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(i, i));
+    }
+    gzEqualsCalls = 0;
+    // Key 8 is homed at 0; slot 1 holds a key at its home so the probe stops
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(8).tStatus);
+    TEST_ASSERT_EQUAL(1, gzEqualsCalls);
+}
+
+// @{"verify": ["REQ-MAP-014"]}
+static void test_map_robin_hood_remove_backward_shift(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapDistances));
+    // Cluster 7, 15, 23 homed at 7 wraps into slots 0 and 1, pushing 0 to slot 2
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(7, 70));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(15, 150));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(23, 230));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(0, 0));
+    TEST_ASSERT_EQUAL(23, gtTestMapBuffer[1].iKey);
+    TEST_ASSERT_EQUAL(0, gtTestMapBuffer[2].iKey);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(15));
+    // Followers moved one slot closer to home and no tombstone is left
+    TEST_ASSERT_EQUAL(23, gtTestMapBuffer[0].iKey);
+    TEST_ASSERT_EQUAL(0, gtTestMapBuffer[1].iKey);
+    TEST_ASSERT_EQUAL(2, gzTestMapDistances[0]);
+    TEST_ASSERT_EQUAL(2, gzTestMapDistances[1]);
+    TEST_ASSERT_EQUAL(0, gzTestMapDistances[2]);
+    TEST_ASSERT_TRUE(gtTestMapBuffer[2].bIsNull);
+    TEST_ASSERT_EQUAL(3, gtTestMap.tMap.zLength);
+    AssertValue(7, 70);
+    AssertValue(23, 230);
+    AssertValue(0, 0);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(15).tStatus);
+    // Removing a missing key succeeds
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(15));
+    TEST_ASSERT_EQUAL(3, gtTestMap.tMap.zLength);
+}
+
+// @{"verify": ["REQ-MAP-013", "REQ-MAP-014"]}
+static void test_map_robin_hood_table_full(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapDistances));
+    for (uint32_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(i * 3, i));
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_TABLE_FULL_ERROR, SetKey(100, 0));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(100).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(100));
+    // Updates still succeed on a full table
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(6, 60));
+    AssertValue(6, 60);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(6));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(100, 1000));
+    for (uint32_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        if (i != 2) {
+            AssertValue(i * 3, i);
+        }
+    }
+    AssertValue(100, 1000);
+}
+
+// @{"verify": ["REQ-MAP-026"]}
+static void test_map_robin_hood_stats(void)
+{
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, gzTestMapDistances));
+    // 7, 15 and 23 share home slot 7 and wrap to distances 0, 1 and 2; 0 is pushed to distance 2
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(7, 70));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(15, 150));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(23, 230));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(0, 0));
+    TestMap_AssertStats(ptMap, JunoDs_MapRobinHoodStats(&gtTestMap.tMap), 4, 5, 2);
+    // The backward shift brings 23 and 0 one slot closer
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(15));
+    TestMap_AssertStats(ptMap, JunoDs_MapRobinHoodStats(&gtTestMap.tMap), 3, 2, 1);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_map_robin_hood_init);
+    RUN_TEST(test_map_robin_hood_rejects_other_api);
+    RUN_TEST(test_map_robin_hood_set_get_update);
+    RUN_TEST(test_map_robin_hood_orders_cluster_by_home);
+    RUN_TEST(test_map_robin_hood_miss_exits_early);
+    RUN_TEST(test_map_robin_hood_remove_backward_shift);
+    RUN_TEST(test_map_robin_hood_table_full);
+    RUN_TEST(test_map_robin_hood_stats);
+    return UNITY_END();
+}
@@ -0,0 +1,227 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_map_swiss.c
+ * @brief Unit tests for the Swiss-table map
+ *
+ * Uses an identity hash: the low 7 bits of a key are its control byte and
+ * the remaining bits pick its first group.
+ */
+
+#include "juno/ds/map_swiss.h"
+#include "test_map_fixture.h"
+#include <string.h>
+
+typedef struct TEST_MAP_TAG
+{
+    JUNO_MAP_SWISS_T tMap;
+    TEST_ARRAY_T tArray;
+} TEST_MAP_T;
+
+/* ============================================================================
+ * Test Fixture Setup/Teardown
+ * ============================================================================ */
+
+#define TEST_MAP_CAPACITY (2 * JUNO_MAP_SWISS_GROUP_SIZE)
+/* Keys with this stride share a control byte and a first group */
+#define TEST_MAP_GROUP_STRIDE (128u * 2u)
+static TEST_MAP_T gtTestMap;
+static TEST_MAP_ENTRY_T gtTestMapBuffer[TEST_MAP_CAPACITY];
+static uint8_t giTestMapCtrl[TEST_MAP_CAPACITY];
+
+void setUp(void)
+{
+    memset(&gtTestMap, 0, sizeof(gtTestMap));
+    memset(gtTestMapBuffer, 0, sizeof(gtTestMapBuffer));
+    memset(giTestMapCtrl, 0, sizeof(giTestMapCtrl));
+    for (size_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        gtTestMapBuffer[i].bIsNull = true;
+    }
+    gzEqualsCalls = 0;
+}
+
+void tearDown(void)
+{
+    /* No dynamic allocations to clean up */
+}
+
+/* ============================================================================
+ * Helper Functions
+ * ============================================================================ */
+
+static JUNO_STATUS_T InitTestMap(TEST_MAP_T *ptMap, size_t zCapacity, uint8_t *piCtrl)
+{
+    ptMap->tArray.ptBuffer = gtTestMapBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&ptMap->tArray.tRoot, &gtTestMapArrayApi, zCapacity, NULL, NULL);
+    if (tStatus != JUNO_STATUS_SUCCESS) {
+        return tStatus;
+    }
+    return JunoDs_MapSwissInit(&ptMap->tMap, &gtTestMapEntryHashablePointerApi, &gtTestMapEntryValuePointerApi, &ptMap->tArray.tRoot, piCtrl, NULL, NULL);
+}
+
+static JUNO_STATUS_T SetKey(uint32_t iKey, uint32_t iValue)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, iValue, false};
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    return ptMap->ptApi->Set(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static JUNO_RESULT_POINTER_T GetKey(uint32_t iKey)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, 0, false};
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    return ptMap->ptApi->Get(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static JUNO_STATUS_T RemoveKey(uint32_t iKey)
+{
+    TEST_MAP_ENTRY_T tEntry = {iKey, 0, false};
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    return ptMap->ptApi->Remove(ptMap, TestMapEntry_PointerInit(&tEntry));
+}
+
+static void AssertValue(uint32_t iKey, uint32_t iValue)
+{
+    JUNO_RESULT_POINTER_T tResult = GetKey(iKey);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(iKey, ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iKey);
+    TEST_ASSERT_EQUAL(iValue, ((TEST_MAP_ENTRY_T *)tResult.tOk.pvAddr)->iValue);
+}
+
+/* ============================================================================
+ * Test Cases
+ * ============================================================================ */
+
+// @{"verify": ["REQ-MAP-018"]}
+static void test_map_swiss_init(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MAP_CAPACITY, giTestMapCtrl));
+    for (size_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        TEST_ASSERT_EQUAL(JUNO_MAP_SWISS_CTRL_EMPTY, giTestMapCtrl[i]);
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, InitTestMap(&gtTestMap, TEST_MAP_CAPACITY, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, InitTestMap(&gtTestMap, TEST_MAP_CAPACITY - 8, giTestMapCtrl));
+}
+
+// @{"verify": ["REQ-MAP-019"]}
+static void test_map_swiss_set_get_update(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MAP_CAPACITY, giTestMapCtrl));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(3, 30));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(131, 1310));
+    // 131 starts in group 1
+    TEST_ASSERT_EQUAL(131, gtTestMapBuffer[JUNO_MAP_SWISS_GROUP_SIZE].iKey);
+    TEST_ASSERT_EQUAL(3, giTestMapCtrl[JUNO_MAP_SWISS_GROUP_SIZE]);
+    AssertValue(3, 30);
+    AssertValue(131, 1310);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(3, 31));
+    AssertValue(3, 31);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(4).tStatus);
+}
+
+// @{"verify": ["REQ-MAP-019"]}
+static void test_map_swiss_equals_only_on_ctrl_match(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MAP_CAPACITY, giTestMapCtrl));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(5, 50));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(6, 60));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(5 + TEST_MAP_GROUP_STRIDE, 51));
+    // Only key 5 shares the new key's control byte
+    TEST_ASSERT_EQUAL(1, gzEqualsCalls);
+    gzEqualsCalls = 0;
+    AssertValue(5 + TEST_MAP_GROUP_STRIDE, 51);
+    TEST_ASSERT_EQUAL(2, gzEqualsCalls);
+    gzEqualsCalls = 0;
+    // The group has an empty slot so the miss stops after one group
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(5 + 2 * TEST_MAP_GROUP_STRIDE).tStatus);
+    TEST_ASSERT_EQUAL(2, gzEqualsCalls);
+    gzEqualsCalls = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(7).tStatus);
+    TEST_ASSERT_EQUAL(0, gzEqualsCalls);
+}
+
+// @{"verify": ["REQ-MAP-019", "REQ-MAP-020"]}
+static void test_map_swiss_group_overflow_and_tombstones(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MAP_CAPACITY, giTestMapCtrl));
+    // Fill group 0, the next key overflows into group 1
+    for (uint32_t i = 0; i <= JUNO_MAP_SWISS_GROUP_SIZE; i++) {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(i * TEST_MAP_GROUP_STRIDE, i));
+    }
+    uint32_t iOverflow = JUNO_MAP_SWISS_GROUP_SIZE * TEST_MAP_GROUP_STRIDE;
+    TEST_ASSERT_EQUAL(iOverflow, gtTestMapBuffer[JUNO_MAP_SWISS_GROUP_SIZE].iKey);
+    AssertValue(iOverflow, JUNO_MAP_SWISS_GROUP_SIZE);
+    // Group 0 has no empty slot, so removal leaves a tombstone
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(0));
+    TEST_ASSERT_EQUAL(JUNO_MAP_SWISS_CTRL_DELETED, giTestMapCtrl[0]);
+    TEST_ASSERT_TRUE(gtTestMapBuffer[0].bIsNull);
+    AssertValue(iOverflow, JUNO_MAP_SWISS_GROUP_SIZE);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(0).tStatus);
+    // Group 1 has empty slots, so removal frees the slot
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(iOverflow));
+    TEST_ASSERT_EQUAL(JUNO_MAP_SWISS_CTRL_EMPTY, giTestMapCtrl[JUNO_MAP_SWISS_GROUP_SIZE]);
+    // The tombstone is reused
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(iOverflow, 7));
+    TEST_ASSERT_EQUAL(iOverflow, gtTestMapBuffer[0].iKey);
+    AssertValue(iOverflow, 7);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(12345));
+}
+
+// @{"verify": ["REQ-MAP-019"]}
+static void test_map_swiss_table_full(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MAP_CAPACITY, giTestMapCtrl));
+    for (uint32_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(i * 37, i));
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_TABLE_FULL_ERROR, SetKey(1000, 0));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_DNE_ERROR, GetKey(1000).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(37, 100));
+    for (uint32_t i = 0; i < TEST_MAP_CAPACITY; i++) {
+        AssertValue(i * 37, i == 1 ? 100 : i);
+    }
+}
+
+// @{"verify": ["REQ-MAP-026"]}
+static void test_map_swiss_stats(void)
+{
+    JUNO_MAP_ROOT_T *ptMap = &gtTestMap.tMap.tRoot;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, InitTestMap(&gtTestMap, TEST_MAP_CAPACITY, giTestMapCtrl));
+    // Group 0 fills up and its last key overflows one group; 131 starts in group 1
+    for (uint32_t i = 0; i <= JUNO_MAP_SWISS_GROUP_SIZE; i++) {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(i * TEST_MAP_GROUP_STRIDE, i));
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, SetKey(131, 1310));
+    TestMap_AssertStats(ptMap, JunoDs_MapSwissStats(&gtTestMap.tMap), JUNO_MAP_SWISS_GROUP_SIZE + 2, 1, 1);
+    // Tombstones are not counted
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RemoveKey(0));
+    TEST_ASSERT_EQUAL(JUNO_MAP_SWISS_CTRL_DELETED, giTestMapCtrl[0]);
+    TestMap_AssertStats(ptMap, JunoDs_MapSwissStats(&gtTestMap.tMap), JUNO_MAP_SWISS_GROUP_SIZE + 1, 1, 1);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_map_swiss_init);
+    RUN_TEST(test_map_swiss_set_get_update);
+    RUN_TEST(test_map_swiss_equals_only_on_ctrl_match);
+    RUN_TEST(test_map_swiss_group_overflow_and_tombstones);
+    RUN_TEST(test_map_swiss_table_full);
+    RUN_TEST(test_map_swiss_stats);
+    return UNITY_END();
+}
@@ -46,6 +46,18 @@ static const JUNO_POINTER_API_T gtTestPtrApi = {
     TestPtr_Reset
 };
 
+/* A trivially-copyable type using the library Copy/Reset */
+typedef struct TEST_PTR_POD_TAG
+{
+    uint32_t aiWords[4];
+} TEST_PTR_POD_T;
+
+static const JUNO_POINTER_API_T gtTestPodApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+#define TestPod_Init(addr) JunoMemory_PointerInit(&gtTestPodApi, TEST_PTR_POD_T, addr)
 #define TestPtr_Init(addr) JunoMemory_PointerInit(&gtTestPtrApi, TEST_PTR_VALUE_T, addr)
 #define TestPtr_Verify(ptr) JunoMemory_PointerVerifyType(ptr, TEST_PTR_VALUE_T, gtTestPtrApi)
 
@@ -195,6 +207,61 @@ static void test_pointer_verify_type_wrong_alignment(void)
     TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
 }
 
+/* ============================================================================
+ * Test Cases: Trivially-Copyable Fast Path (REQ-POINTER-006)
+ * ============================================================================ */
+
+// @{"verify": ["REQ-POINTER-006"]}
+static void test_pointer_trivial_copy_and_reset(void)
+{
+    TEST_PTR_POD_T tSrc = {{1, 2, 3, 4}};
+    TEST_PTR_POD_T tDest = {{0}};
+    const TEST_PTR_POD_T tZero = {{0}};
+    TEST_ASSERT_TRUE(JunoMemory_PointerIsTrivial(&gtTestPodApi));
+    TEST_ASSERT_FALSE(JunoMemory_PointerIsTrivial(&gtTestPtrApi));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtTestPodApi.Copy(TestPod_Init(&tDest), TestPod_Init(&tSrc)));
+    TEST_ASSERT_EQUAL_MEMORY(&tSrc, &tDest, sizeof(tDest));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtTestPodApi.Reset(TestPod_Init(&tDest)));
+    TEST_ASSERT_EQUAL_MEMORY(&tZero, &tDest, sizeof(tDest));
+    /* The inline helpers take the same path */
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoMemory_PointerCopy(TestPod_Init(&tDest), TestPod_Init(&tSrc)));
+    TEST_ASSERT_EQUAL_MEMORY(&tSrc, &tDest, sizeof(tDest));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoMemory_PointerReset(TestPod_Init(&tDest)));
+    TEST_ASSERT_EQUAL_MEMORY(&tZero, &tDest, sizeof(tDest));
+}
+
+// @{"verify": ["REQ-POINTER-006"]}
+static void test_pointer_trivial_copy_size_mismatch(void)
+{
+    TEST_PTR_POD_T tSrc = {{1, 2, 3, 4}};
+    TEST_PTR_POD_T tDest = {{0}};
+    const TEST_PTR_POD_T tZero = {{0}};
+    JUNO_POINTER_T tDestPtr = TestPod_Init(&tDest);
+    tDestPtr.zSize = sizeof(uint32_t);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoMemory_PointerCopy(tDestPtr, TestPod_Init(&tSrc)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, gtTestPodApi.Copy(tDestPtr, TestPod_Init(&tSrc)));
+    TEST_ASSERT_EQUAL_MEMORY(&tZero, &tDest, sizeof(tDest));
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoMemory_PointerCopy(TestPod_Init(&tDest), TestPod_Init(NULL)));
+}
+
+// @{"verify": ["REQ-POINTER-002", "REQ-POINTER-006"]}
+static void test_pointer_copy_dispatches_non_trivial(void)
+{
+    gtValA.iData = 0xBEEF;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoMemory_PointerCopy(TestPtr_Init(&gtValB), TestPtr_Init(&gtValA)));
+    TEST_ASSERT_EQUAL_HEX32(0xBEEF, gtValB.iData);
+    /* Mixed APIs fall back to the destination's Copy, which rejects the source */
+    TEST_PTR_POD_T tPod = {{0}};
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoMemory_PointerCopy(TestPtr_Init(&gtValB), TestPod_Init(&tPod)));
+    /* CopyWith dispatches through the API it is given, e.g. the source's */
+    gtValA.iData = 0xCAFE;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoMemory_PointerCopyWith(&gtTestPtrApi, TestPtr_Init(&gtValB), TestPtr_Init(&gtValA)));
+    TEST_ASSERT_EQUAL_HEX32(0xCAFE, gtValB.iData);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoMemory_PointerCopyWith(&gtTestPodApi, TestPtr_Init(&gtValB), TestPod_Init(&tPod)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoMemory_PointerReset(TestPtr_Init(&gtValB)));
+    TEST_ASSERT_EQUAL_HEX32(0, gtValB.iData);
+}
+
 /* ============================================================================
  * Main
  * ============================================================================ */
@@ -217,5 +284,9 @@ int main(void)
     RUN_TEST(test_pointer_verify_type_match);
     RUN_TEST(test_pointer_verify_type_wrong_size);
     RUN_TEST(test_pointer_verify_type_wrong_alignment);
+    /* Trivially-Copyable Fast Path */
+    RUN_TEST(test_pointer_trivial_copy_and_reset);
+    RUN_TEST(test_pointer_trivial_copy_size_mismatch);
+    RUN_TEST(test_pointer_copy_dispatches_non_trivial);
     return UNITY_END();
 }
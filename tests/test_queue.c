@@ -602,6 +602,50 @@ static void test_queue_circular_wraparound(void)
     }
 }
 
+// @{"verify": ["REQ-QUEUE-015"]}
+static void test_queue_pow2_init_rejects_non_pow2(void)
+{
+    gtTestQueueArray.ptBuffer = gtTestQueueBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&gtTestQueueArray.tRoot, &gtTestQueueArrayApi, 5, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    tStatus = JunoDs_QueueInitPow2(&gtTestQueue, &gtTestQueueArray.tRoot, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, tStatus);
+}
+
+// @{"verify": ["REQ-QUEUE-003", "REQ-QUEUE-005", "REQ-QUEUE-015"]}
+static void test_queue_pow2_wraparound(void)
+{
+    gtTestQueueArray.ptBuffer = gtTestQueueBuffer;
+    JUNO_STATUS_T tStatus = JunoDs_ArrayInit(&gtTestQueueArray.tRoot, &gtTestQueueArrayApi, 4, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    tStatus = JunoDs_QueueInitPow2(&gtTestQueue, &gtTestQueueArray.tRoot, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    const JUNO_DS_QUEUE_API_T *ptApi = gtTestQueue.ptApi;
+    /* Run several laps so both indices wrap */
+    uint32_t iNext = 0;
+    uint32_t iExpected = 0;
+    for (uint32_t iLap = 0; iLap < 5; iLap++)
+    {
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            TEST_QUEUE_DATA_T tData = CreateTestData(iNext++, true, 0);
+            tStatus = ptApi->Enqueue(&gtTestQueue, TestQueueData_PointerInit(&tData));
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+        }
+        for (uint32_t i = 0; i < 3; i++)
+        {
+            TEST_QUEUE_DATA_T tPopData = {0};
+            tStatus = ptApi->Dequeue(&gtTestQueue, TestQueueData_PointerInit(&tPopData));
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+            TEST_ASSERT_EQUAL(iExpected++, tPopData.iValue);
+        }
+        TEST_ASSERT_LESS_THAN(4, gtTestQueue.iStartIndex);
+    }
+    TEST_QUEUE_DATA_T tPopData = {0};
+    tStatus = ptApi->Dequeue(&gtTestQueue, TestQueueData_PointerInit(&tPopData));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, tStatus);
+}
+
 // @{"verify": ["REQ-QUEUE-003", "REQ-QUEUE-005"]}
 static void test_queue_wraparound_at_boundary(void)
 {
@@ -930,6 +974,114 @@ static void test_queue_array_api_remove_at_out_of_bounds(void)
     TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, tStatus);
 }
 
+/* ============================================================================
+ * Test Cases: Trivially-Copyable Items (REQ-POINTER-006)
+ * ============================================================================ */
+
+typedef struct TEST_QUEUE_POD_TAG
+{
+    uint32_t aiWords[2];
+} TEST_QUEUE_POD_T;
+
+typedef struct TEST_QUEUE_POD_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    TEST_QUEUE_POD_T *ptBuffer;
+    size_t zSetAtCalls;
+} TEST_QUEUE_POD_ARRAY_T;
+
+static const JUNO_POINTER_API_T gtTestQueuePodPointerApi = {
+    JunoMemory_PointerCopyTrivial,
+    JunoMemory_PointerResetTrivial
+};
+
+#define TestQueuePod_PointerInit(addr) JunoMemory_PointerInit(&gtTestQueuePodPointerApi, TEST_QUEUE_POD_T, addr)
+
+static JUNO_STATUS_T TestQueuePod_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    TEST_QUEUE_POD_ARRAY_T *ptPodArray = (TEST_QUEUE_POD_ARRAY_T *)ptArray;
+    ptPodArray->zSetAtCalls += 1;
+    return JunoMemory_PointerCopy(TestQueuePod_PointerInit(&ptPodArray->ptBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T TestQueuePod_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    TEST_QUEUE_POD_ARRAY_T *ptPodArray = (TEST_QUEUE_POD_ARRAY_T *)ptArray;
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_SUCCESS, TestQueuePod_PointerInit(&ptPodArray->ptBuffer[iIndex])};
+    return tResult;
+}
+
+static JUNO_STATUS_T TestQueuePod_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    TEST_QUEUE_POD_ARRAY_T *ptPodArray = (TEST_QUEUE_POD_ARRAY_T *)ptArray;
+    return JunoMemory_PointerReset(TestQueuePod_PointerInit(&ptPodArray->ptBuffer[iIndex]));
+}
+
+static const JUNO_DS_ARRAY_API_T gtTestQueuePodArrayApi = {
+    TestQueuePod_SetAt,
+    TestQueuePod_GetAt,
+    TestQueuePod_RemoveAt
+};
+
+static JUNO_STATUS_T gtLastFailureStatus;
+static size_t gzFailureCalls;
+
+static void TestQueue_FailureHandler(JUNO_STATUS_T tStatus, const char *pcCustomMessage, JUNO_USER_DATA_T *pvUserData)
+{
+    (void)pcCustomMessage;
+    (void)pvUserData;
+    gtLastFailureStatus = tStatus;
+    gzFailureCalls += 1;
+}
+
+// @{"verify": ["REQ-QUEUE-003", "REQ-QUEUE-005", "REQ-POINTER-006"]}
+static void test_queue_trivial_push_skips_set_at(void)
+{
+    static TEST_QUEUE_POD_T atBuffer[4];
+    TEST_QUEUE_POD_ARRAY_T tArray = {0};
+    tArray.ptBuffer = atBuffer;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_ArrayInit(&tArray.tRoot, &gtTestQueuePodArrayApi, 4, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueInit(&gtTestQueue, &tArray.tRoot, NULL, NULL));
+
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        TEST_QUEUE_POD_T tItem = {{i, ~i}};
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueuePush(&gtTestQueue, TestQueuePod_PointerInit(&tItem)));
+    }
+    TEST_ASSERT_EQUAL(0, tArray.zSetAtCalls);
+
+    for(uint32_t i = 0; i < 3; i++)
+    {
+        TEST_QUEUE_POD_T tItem = {{0}};
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueuePop(&gtTestQueue, TestQueuePod_PointerInit(&tItem)));
+        TEST_ASSERT_EQUAL(i, tItem.aiWords[0]);
+        TEST_ASSERT_EQUAL(~i, tItem.aiWords[1]);
+    }
+}
+
+// @{"verify": ["REQ-QUEUE-003", "REQ-POINTER-006"]}
+static void test_queue_trivial_size_mismatch_calls_failure_handler(void)
+{
+    static TEST_QUEUE_POD_T atBuffer[4];
+    TEST_QUEUE_POD_ARRAY_T tArray = {0};
+    tArray.ptBuffer = atBuffer;
+    gtLastFailureStatus = JUNO_STATUS_SUCCESS;
+    gzFailureCalls = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_ArrayInit(&tArray.tRoot, &gtTestQueuePodArrayApi, 4, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueInit(&gtTestQueue, &tArray.tRoot, TestQueue_FailureHandler, NULL));
+
+    TEST_QUEUE_POD_T tItem = {{1, 2}};
+    JUNO_POINTER_T tShort = TestQueuePod_PointerInit(&tItem);
+    tShort.zSize = sizeof(uint32_t);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_QueuePush(&gtTestQueue, tShort));
+    TEST_ASSERT_EQUAL(1, gzFailureCalls);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, gtLastFailureStatus);
+
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueuePush(&gtTestQueue, TestQueuePod_PointerInit(&tItem)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_QueuePop(&gtTestQueue, tShort));
+    TEST_ASSERT_EQUAL(2, gzFailureCalls);
+}
+
 /* ============================================================================
  * Main Test Runner
  * ============================================================================ */
@@ -969,6 +1121,8 @@ int main(void)
     /* Circular Buffer Tests */
     RUN_TEST(test_queue_circular_wraparound);
     RUN_TEST(test_queue_wraparound_at_boundary);
+    RUN_TEST(test_queue_pow2_init_rejects_non_pow2);
+    RUN_TEST(test_queue_pow2_wraparound);
     
     /* Stress Tests */
     RUN_TEST(test_queue_stress_push_pop_cycles);
@@ -992,5 +1146,9 @@ int main(void)
     RUN_TEST(test_queue_array_api_get_at_out_of_bounds);
     RUN_TEST(test_queue_array_api_remove_at_out_of_bounds);
     
+    /* Trivially-Copyable Item Tests */
+    RUN_TEST(test_queue_trivial_push_skips_set_at);
+    RUN_TEST(test_queue_trivial_size_mismatch_calls_failure_handler);
+    
     return UNITY_END();
 }
@@ -0,0 +1,304 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_queue_mpmc.c
+ * @brief Unit tests for the lock-free MPMC queue.
+ * @details
+ *  These tests exercise the queue semantics from a single thread; the
+ *  multi-threaded behavior is exercised by benchmarks/bench_queue_mpmc.c.
+ */
+
+#include "juno/ds/queue_mpmc.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/mp/atomic.h"
+#include "juno/sb/broker_api.h"
+#include "juno/sb/pipe_mpmc.h"
+#include "juno/status.h"
+#include "unity.h"
+#include "unity_internals.h"
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* ============================================================================
+ * Test Data Type Definition
+ * ============================================================================ */
+
+typedef struct TEST_MPMC_DATA_TAG
+{
+    uint32_t iValue;
+} TEST_MPMC_DATA_T;
+
+typedef struct TEST_MPMC_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    TEST_MPMC_DATA_T *ptBuffer;
+} TEST_MPMC_ARRAY_T;
+
+static JUNO_STATUS_T TestMpmcData_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T TestMpmcData_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T TestMpmc_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T TestMpmc_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T TestMpmc_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+static const JUNO_POINTER_API_T gtTestMpmcDataPointerApi = {
+    TestMpmcData_Copy,
+    TestMpmcData_Reset
+};
+
+static const JUNO_DS_ARRAY_API_T gtTestMpmcArrayApi = {
+    TestMpmc_SetAt,
+    TestMpmc_GetAt,
+    TestMpmc_RemoveAt
+};
+
+#define TestMpmcData_PointerInit(addr) JunoMemory_PointerInit(&gtTestMpmcDataPointerApi, TEST_MPMC_DATA_T, addr)
+#define TestMpmcData_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, TEST_MPMC_DATA_T, gtTestMpmcDataPointerApi)
+
+static JUNO_STATUS_T TestMpmcData_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = TestMpmcData_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = TestMpmcData_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_MPMC_DATA_T *)tDest.pvAddr = *(TEST_MPMC_DATA_T *)tSrc.pvAddr;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestMpmcData_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = TestMpmcData_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_MPMC_DATA_T *)tPointer.pvAddr = (TEST_MPMC_DATA_T){0};
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestMpmc_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_MPMC_ARRAY_T *ptMpmcArray = (TEST_MPMC_ARRAY_T *)ptArray;
+    return TestMpmcData_Copy(TestMpmcData_PointerInit(&ptMpmcArray->ptBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T TestMpmc_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {0};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    TEST_MPMC_ARRAY_T *ptMpmcArray = (TEST_MPMC_ARRAY_T *)ptArray;
+    tResult.tOk = TestMpmcData_PointerInit(&ptMpmcArray->ptBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T TestMpmc_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_MPMC_ARRAY_T *ptMpmcArray = (TEST_MPMC_ARRAY_T *)ptArray;
+    return TestMpmcData_Reset(TestMpmcData_PointerInit(&ptMpmcArray->ptBuffer[iIndex]));
+}
+
+/* ============================================================================
+ * Test Fixture Setup/Teardown
+ * ============================================================================ */
+
+#define TEST_MPMC_CAPACITY 4
+#define TEST_MPMC_RETRY_LIMIT 2
+static JUNO_DS_QUEUE_ROOT_T gtQueue;
+static JUNO_DS_MPMC_RING_T gtRing;
+static TEST_MPMC_ARRAY_T gtArray;
+static TEST_MPMC_DATA_T gtBuffer[TEST_MPMC_CAPACITY];
+static atomic_size_t gazSequences[TEST_MPMC_CAPACITY];
+
+void setUp(void)
+{
+    memset(gtBuffer, 0, sizeof(gtBuffer));
+    gtArray.ptBuffer = gtBuffer;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_ArrayInit(&gtArray.tRoot, &gtTestMpmcArrayApi, TEST_MPMC_CAPACITY, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueMpmcInit(&gtQueue, &gtRing, &gtArray.tRoot, gazSequences, TEST_MPMC_RETRY_LIMIT, NULL, NULL));
+}
+
+void tearDown(void)
+{
+}
+
+static JUNO_STATUS_T Push(uint32_t iValue)
+{
+    TEST_MPMC_DATA_T tData = {iValue};
+    return gtQueue.ptApi->Enqueue(&gtQueue, TestMpmcData_PointerInit(&tData));
+}
+
+static JUNO_STATUS_T Pop(uint32_t *piValue)
+{
+    TEST_MPMC_DATA_T tData = {0};
+    JUNO_STATUS_T tStatus = gtQueue.ptApi->Dequeue(&gtQueue, TestMpmcData_PointerInit(&tData));
+    *piValue = tData.iValue;
+    return tStatus;
+}
+
+/* ============================================================================
+ * Test Cases
+ * ============================================================================ */
+
+// @{"verify": ["REQ-QUEUE-012"]}
+static void test_queue_mpmc_init(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueVerify(&gtQueue));
+    TEST_ASSERT_EQUAL_PTR(&gtRing.tRoot, gtQueue.ptQueueArray);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)&gtRing.zEnqueuePos % JUNO_MP_CACHE_LINE_SIZE);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)&gtRing.zDequeuePos % JUNO_MP_CACHE_LINE_SIZE);
+    for(size_t i = 0; i < TEST_MPMC_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(i << 1, atomic_load(&gazSequences[i]));
+    }
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueMpmcInit(&gtQueue, &gtRing, &gtArray.tRoot, NULL, 0, NULL, NULL));
+}
+
+// @{"verify": ["REQ-QUEUE-012"]}
+static void test_queue_mpmc_rejects_non_power_of_two(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_ArrayInit(&gtArray.tRoot, &gtTestMpmcArrayApi, 3, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_QueueMpmcInit(&gtQueue, &gtRing, &gtArray.tRoot, gazSequences, 0, NULL, NULL));
+    /* One slot cannot tell free from full */
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_ArrayInit(&gtArray.tRoot, &gtTestMpmcArrayApi, 1, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoDs_QueueMpmcInit(&gtQueue, &gtRing, &gtArray.tRoot, gazSequences, 0, NULL, NULL));
+}
+
+// @{"verify": ["REQ-QUEUE-013"]}
+static void test_queue_mpmc_fifo_order_with_wraparound(void)
+{
+    uint32_t iNext = 0;
+    uint32_t iExpected = 0;
+    for(size_t iRound = 0; iRound < 5 * TEST_MPMC_CAPACITY; iRound++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(iNext++));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(iNext++));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(iNext++));
+        for(size_t i = 0; i < 3; i++)
+        {
+            uint32_t iValue = 0;
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+            TEST_ASSERT_EQUAL_UINT32(iExpected++, iValue);
+        }
+    }
+}
+
+// @{"verify": ["REQ-QUEUE-014"]}
+static void test_queue_mpmc_full_and_empty(void)
+{
+    uint32_t iValue = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, Pop(&iValue));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, gtQueue.ptApi->Peek(&gtQueue).tStatus);
+    for(uint32_t i = 0; i < TEST_MPMC_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(i));
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, Push(99));
+    JUNO_RESULT_POINTER_T tPeek = gtQueue.ptApi->Peek(&gtQueue);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tPeek.tStatus);
+    TEST_ASSERT_EQUAL_UINT32(0, ((TEST_MPMC_DATA_T *)tPeek.tOk.pvAddr)->iValue);
+    for(uint32_t i = 0; i < TEST_MPMC_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+        TEST_ASSERT_EQUAL_UINT32(i, iValue);
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, Pop(&iValue));
+}
+
+// @{"verify": ["REQ-QUEUE-014"]}
+static void test_queue_mpmc_retry_limit_times_out(void)
+{
+    /* Make slot 0 look claimed by a producer that never advanced the position */
+    atomic_store(&gazSequences[0], (TEST_MPMC_CAPACITY + 1) << 1);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_TIMEOUT_ERROR, Push(1));
+    /* Make slot 0 look claimed by a consumer that never advanced the position */
+    atomic_store(&gazSequences[0], (TEST_MPMC_CAPACITY + 2) << 1);
+    uint32_t iValue = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_TIMEOUT_ERROR, Pop(&iValue));
+}
+
+// @{"verify": ["REQ-QUEUE-014"]}
+static void test_queue_mpmc_failed_store_is_reported_to_consumer(void)
+{
+    /* An item of another type makes the backing array's SetAt fail */
+    static const JUNO_POINTER_API_T tOtherApi = {JunoMemory_PointerCopyTrivial, JunoMemory_PointerResetTrivial};
+    TEST_MPMC_DATA_T tBad = {77};
+    uint32_t iValue = 0;
+    for(uint32_t iLap = 0; iLap < 2; iLap++)
+    {
+        /* Leave stale contents in every slot */
+        for(uint32_t i = 0; i < TEST_MPMC_CAPACITY; i++)
+        {
+            gtBuffer[i].iValue = 1000 + i;
+        }
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(1));
+        TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, gtQueue.ptApi->Enqueue(&gtQueue, JunoMemory_PointerInit(&tOtherApi, TEST_MPMC_DATA_T, &tBad)));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(2));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+        TEST_ASSERT_EQUAL_UINT32(1, iValue);
+        /* The consumer sees the failure, not the slot's stale contents */
+        TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_DATA_ERROR, gtQueue.ptApi->Peek(&gtQueue).tStatus);
+        iValue = 0;
+        TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_DATA_ERROR, Pop(&iValue));
+        TEST_ASSERT_EQUAL_UINT32(0, iValue);
+        /* The failed slot is consumed and the queue keeps going */
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+        TEST_ASSERT_EQUAL_UINT32(2, iValue);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, Pop(&iValue));
+    }
+}
+
+// @{"verify": ["REQ-QUEUE-012", "REQ-SB-005"]}
+static void test_queue_mpmc_backs_sb_pipe(void)
+{
+    JUNO_SB_BROKER_ROOT_T atBrokers[2] = {0};
+    JUNO_SB_PIPE_T *aptRegistry[2][1];
+    JUNO_SB_PIPE_T tPipe = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_PipeMpmcInit(&tPipe, 3, &gtRing, &gtArray.tRoot, gazSequences, 0, NULL, NULL));
+    /* One pipe shared by the brokers of two producer threads */
+    for(size_t i = 0; i < 2; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BrokerInit(&atBrokers[i], aptRegistry[i], 1, NULL, NULL));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, atBrokers[i].ptApi->RegisterSubscriber(&atBrokers[i], &tPipe));
+        TEST_MPMC_DATA_T tData = {(uint32_t)(40 + i)};
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, atBrokers[i].ptApi->Publish(&atBrokers[i], 3, TestMpmcData_PointerInit(&tData)));
+    }
+    TEST_MPMC_DATA_T tOut = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tPipe.tRoot.ptApi->Dequeue(&tPipe.tRoot, TestMpmcData_PointerInit(&tOut)));
+    TEST_ASSERT_EQUAL_UINT32(40, tOut.iValue);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tPipe.tRoot.ptApi->Dequeue(&tPipe.tRoot, TestMpmcData_PointerInit(&tOut)));
+    TEST_ASSERT_EQUAL_UINT32(41, tOut.iValue);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_queue_mpmc_init);
+    RUN_TEST(test_queue_mpmc_rejects_non_power_of_two);
+    RUN_TEST(test_queue_mpmc_fifo_order_with_wraparound);
+    RUN_TEST(test_queue_mpmc_full_and_empty);
+    RUN_TEST(test_queue_mpmc_retry_limit_times_out);
+    RUN_TEST(test_queue_mpmc_failed_store_is_reported_to_consumer);
+    RUN_TEST(test_queue_mpmc_backs_sb_pipe);
+    return UNITY_END();
+}
@@ -0,0 +1,289 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_queue_spsc.c
+ * @brief Unit tests for the lock-free SPSC queue.
+ * @details
+ *  These tests exercise the queue semantics from a single thread; the
+ *  cross-thread behavior is exercised by benchmarks/bench_queue_spsc.c.
+ */
+
+#include "juno/ds/queue_spsc.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/sb/broker_api.h"
+#include "juno/sb/pipe_spsc.h"
+#include "juno/status.h"
+#include "unity.h"
+#include "unity_internals.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* ============================================================================
+ * Test Data Type Definition
+ * ============================================================================ */
+
+typedef struct TEST_SPSC_DATA_TAG
+{
+    uint32_t iValue;
+} TEST_SPSC_DATA_T;
+
+typedef struct TEST_SPSC_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    TEST_SPSC_DATA_T *ptBuffer;
+} TEST_SPSC_ARRAY_T;
+
+static JUNO_STATUS_T TestSpscData_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T TestSpscData_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T TestSpsc_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T TestSpsc_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T TestSpsc_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+static const JUNO_POINTER_API_T gtTestSpscDataPointerApi = {
+    TestSpscData_Copy,
+    TestSpscData_Reset
+};
+
+static const JUNO_DS_ARRAY_API_T gtTestSpscArrayApi = {
+    TestSpsc_SetAt,
+    TestSpsc_GetAt,
+    TestSpsc_RemoveAt
+};
+
+#define TestSpscData_PointerInit(addr) JunoMemory_PointerInit(&gtTestSpscDataPointerApi, TEST_SPSC_DATA_T, addr)
+#define TestSpscData_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, TEST_SPSC_DATA_T, gtTestSpscDataPointerApi)
+
+static JUNO_STATUS_T TestSpscData_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = TestSpscData_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = TestSpscData_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_SPSC_DATA_T *)tDest.pvAddr = *(TEST_SPSC_DATA_T *)tSrc.pvAddr;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestSpscData_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = TestSpscData_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_SPSC_DATA_T *)tPointer.pvAddr = (TEST_SPSC_DATA_T){0};
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestSpsc_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_SPSC_ARRAY_T *ptSpscArray = (TEST_SPSC_ARRAY_T *)ptArray;
+    return TestSpscData_Copy(TestSpscData_PointerInit(&ptSpscArray->ptBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T TestSpsc_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {0};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    TEST_SPSC_ARRAY_T *ptSpscArray = (TEST_SPSC_ARRAY_T *)ptArray;
+    tResult.tOk = TestSpscData_PointerInit(&ptSpscArray->ptBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T TestSpsc_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_SPSC_ARRAY_T *ptSpscArray = (TEST_SPSC_ARRAY_T *)ptArray;
+    return TestSpscData_Reset(TestSpscData_PointerInit(&ptSpscArray->ptBuffer[iIndex]));
+}
+
+/* ============================================================================
+ * Test Fixture Setup/Teardown
+ * ============================================================================ */
+
+#define TEST_SPSC_CAPACITY 4
+static JUNO_DS_QUEUE_ROOT_T gtQueue;
+static JUNO_DS_SPSC_RING_T gtRing;
+static TEST_SPSC_ARRAY_T gtArray;
+static TEST_SPSC_DATA_T gtBuffer[TEST_SPSC_CAPACITY];
+
+void setUp(void)
+{
+    memset(gtBuffer, 0, sizeof(gtBuffer));
+    gtArray.ptBuffer = gtBuffer;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_ArrayInit(&gtArray.tRoot, &gtTestSpscArrayApi, TEST_SPSC_CAPACITY, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueSpscInit(&gtQueue, &gtRing, &gtArray.tRoot, NULL, NULL));
+}
+
+void tearDown(void)
+{
+}
+
+static JUNO_STATUS_T Push(uint32_t iValue)
+{
+    TEST_SPSC_DATA_T tData = {iValue};
+    return gtQueue.ptApi->Enqueue(&gtQueue, TestSpscData_PointerInit(&tData));
+}
+
+static JUNO_STATUS_T Pop(uint32_t *piValue)
+{
+    TEST_SPSC_DATA_T tData = {0};
+    JUNO_STATUS_T tStatus = gtQueue.ptApi->Dequeue(&gtQueue, TestSpscData_PointerInit(&tData));
+    *piValue = tData.iValue;
+    return tStatus;
+}
+
+/* ============================================================================
+ * Test Cases
+ * ============================================================================ */
+
+// @{"verify": ["REQ-QUEUE-009"]}
+static void test_queue_spsc_init(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueVerify(&gtQueue));
+    TEST_ASSERT_EQUAL_PTR(&gtRing.tRoot, gtQueue.ptQueueArray);
+    TEST_ASSERT_EQUAL(TEST_SPSC_CAPACITY, gtRing.tRoot.zCapacity);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)&gtRing.zTail % JUNO_MP_CACHE_LINE_SIZE);
+    TEST_ASSERT_EQUAL(0, (uintptr_t)&gtRing.zHead % JUNO_MP_CACHE_LINE_SIZE);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueSpscInit(NULL, &gtRing, &gtArray.tRoot, NULL, NULL));
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueSpscInit(&gtQueue, &gtRing, NULL, NULL, NULL));
+}
+
+// @{"verify": ["REQ-QUEUE-010"]}
+static void test_queue_spsc_fifo_order_with_wraparound(void)
+{
+    uint32_t iNext = 0;
+    uint32_t iExpected = 0;
+    /* Cycle through the position space several times */
+    for(size_t iRound = 0; iRound < 5 * TEST_SPSC_CAPACITY; iRound++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(iNext++));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(iNext++));
+        uint32_t iValue = 0;
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+        TEST_ASSERT_EQUAL_UINT32(iExpected++, iValue);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+        TEST_ASSERT_EQUAL_UINT32(iExpected++, iValue);
+    }
+}
+
+// @{"verify": ["REQ-QUEUE-011"]}
+static void test_queue_spsc_full_and_empty(void)
+{
+    uint32_t iValue = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, Pop(&iValue));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, gtQueue.ptApi->Peek(&gtQueue).tStatus);
+    for(uint32_t i = 0; i < TEST_SPSC_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(i));
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, Push(99));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+    TEST_ASSERT_EQUAL_UINT32(0, iValue);
+    /* One slot was freed */
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(4));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, Push(5));
+    for(uint32_t i = 1; i <= TEST_SPSC_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+        TEST_ASSERT_EQUAL_UINT32(i, iValue);
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, Pop(&iValue));
+}
+
+// @{"verify": ["REQ-QUEUE-010"]}
+static void test_queue_spsc_peek(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(7));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(8));
+    JUNO_RESULT_POINTER_T tResult = gtQueue.ptApi->Peek(&gtQueue);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL_UINT32(7, ((TEST_SPSC_DATA_T *)tResult.tOk.pvAddr)->iValue);
+    uint32_t iValue = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+    TEST_ASSERT_EQUAL_UINT32(7, iValue);
+    /* Dequeue resets the slot through the backing array */
+    TEST_ASSERT_EQUAL_UINT32(0, gtBuffer[0].iValue);
+}
+
+// @{"verify": ["REQ-QUEUE-010", "REQ-QUEUE-011"]}
+static void test_queue_spsc_available_and_drop(void)
+{
+    JUNO_RESULT_SIZE_T tAvailable = JunoDs_QueueSpscAvailable(&gtQueue);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tAvailable.tStatus);
+    TEST_ASSERT_EQUAL(0, tAvailable.tOk);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, JunoDs_QueueSpscDrop(&gtQueue));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(1));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(2));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Push(3));
+    tAvailable = JunoDs_QueueSpscAvailable(&gtQueue);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tAvailable.tStatus);
+    TEST_ASSERT_EQUAL(3, tAvailable.tOk);
+    /* Consume the front item in place */
+    JUNO_RESULT_POINTER_T tResult = JunoDs_QueueSpscPeek(&gtQueue);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL_UINT32(1, ((TEST_SPSC_DATA_T *)tResult.tOk.pvAddr)->iValue);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueSpscDrop(&gtQueue));
+    TEST_ASSERT_EQUAL_UINT32(0, gtBuffer[0].iValue);
+    TEST_ASSERT_EQUAL(2, JunoDs_QueueSpscAvailable(&gtQueue).tOk);
+    uint32_t iValue = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, Pop(&iValue));
+    TEST_ASSERT_EQUAL_UINT32(2, iValue);
+}
+
+// @{"verify": ["REQ-QUEUE-009"]}
+static void test_queue_spsc_rejects_base_queue(void)
+{
+    JUNO_DS_QUEUE_ROOT_T tQueue = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueueInit(&tQueue, &gtArray.tRoot, NULL, NULL));
+    TEST_SPSC_DATA_T tData = {1};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, JunoDs_QueueSpscPush(&tQueue, TestSpscData_PointerInit(&tData)));
+}
+
+// @{"verify": ["REQ-QUEUE-009", "REQ-SB-005"]}
+static void test_queue_spsc_backs_sb_pipe(void)
+{
+    JUNO_SB_BROKER_ROOT_T tBroker = {0};
+    JUNO_SB_PIPE_T *aptRegistry[1];
+    JUNO_SB_PIPE_T tPipe = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BrokerInit(&tBroker, aptRegistry, 1, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_PipeSpscInit(&tPipe, 3, &gtRing, &gtArray.tRoot, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tBroker.ptApi->RegisterSubscriber(&tBroker, &tPipe));
+    TEST_SPSC_DATA_T tData = {42};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tBroker.ptApi->Publish(&tBroker, 3, TestSpscData_PointerInit(&tData)));
+    TEST_SPSC_DATA_T tOut = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tPipe.tRoot.ptApi->Dequeue(&tPipe.tRoot, TestSpscData_PointerInit(&tOut)));
+    TEST_ASSERT_EQUAL_UINT32(42, tOut.iValue);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_queue_spsc_init);
+    RUN_TEST(test_queue_spsc_fifo_order_with_wraparound);
+    RUN_TEST(test_queue_spsc_full_and_empty);
+    RUN_TEST(test_queue_spsc_peek);
+    RUN_TEST(test_queue_spsc_available_and_drop);
+    RUN_TEST(test_queue_spsc_rejects_base_queue);
+    RUN_TEST(test_queue_spsc_backs_sb_pipe);
+    return UNITY_END();
+}
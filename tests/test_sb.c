@@ -329,6 +329,114 @@ static void test_sb_publish_skip_non_matching(void)
     TEST_ASSERT_EQUAL(0, gtPipeC.tRoot.zLength);
 }
 
+/* ============================================================================
+ * Test Cases: Batched Publish (REQ-SB-017, REQ-SB-018)
+ * ============================================================================ */
+
+// @{"verify": ["REQ-SB-017"]}
+static void test_sb_publish_batch_in_order(void)
+{
+    JunoSb_BrokerInit(&gtBroker, gptPipeRegistry,
+                       TEST_SB_REGISTRY_CAPACITY, NULL, NULL);
+    JunoSb_PipeInit(&gtPipeA, 1, &gtPipeArrayA.tRoot, NULL, NULL);
+    JunoSb_PipeInit(&gtPipeC, 2, &gtPipeArrayC.tRoot, NULL, NULL);
+    gtBroker.ptApi->RegisterSubscriber(&gtBroker, &gtPipeA);
+    gtBroker.ptApi->RegisterSubscriber(&gtBroker, &gtPipeC);
+
+    TEST_SB_MSG_T atMsgs[3] = {{0x10}, {0x20}, {0x11}};
+    JUNO_SB_PUBLISH_ENTRY_T atEntries[3] = {
+        {1, TestSbMsg_PointerInit(&atMsgs[0])},
+        {2, TestSbMsg_PointerInit(&atMsgs[1])},
+        {1, TestSbMsg_PointerInit(&atMsgs[2])},
+    };
+    JUNO_RESULT_SIZE_T tResult = gtBroker.ptApi->PublishBatch(&gtBroker, atEntries, 3);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(3, tResult.tOk);
+    TEST_ASSERT_EQUAL(2, gtPipeA.tRoot.zLength);
+    TEST_ASSERT_EQUAL(1, gtPipeC.tRoot.zLength);
+
+    /* Pipe A receives its messages in batch order */
+    TEST_SB_MSG_T tOut = {0};
+    JUNO_POINTER_T tOutPtr = TestSbMsg_PointerInit(&tOut);
+    JunoDs_QueuePop(&gtPipeA.tRoot, tOutPtr);
+    TEST_ASSERT_EQUAL_HEX32(0x10, tOut.iPayload);
+    JunoDs_QueuePop(&gtPipeA.tRoot, tOutPtr);
+    TEST_ASSERT_EQUAL_HEX32(0x11, tOut.iPayload);
+}
+
+// @{"verify": ["REQ-SB-017"]}
+static void test_sb_publish_batch_runs_of_same_mid(void)
+{
+    JunoSb_BrokerInit(&gtBroker, gptPipeRegistry,
+                       TEST_SB_REGISTRY_CAPACITY, NULL, NULL);
+    JunoSb_PipeInit(&gtPipeA, 1, &gtPipeArrayA.tRoot, NULL, NULL);
+    JunoSb_PipeInit(&gtPipeC, 2, &gtPipeArrayC.tRoot, NULL, NULL);
+    JunoSb_PipeInit(&gtPipeB, 1, &gtPipeArrayB.tRoot, NULL, NULL);
+    /* MID 1 pipes straddle the MID 2 pipe */
+    gtBroker.ptApi->RegisterSubscriber(&gtBroker, &gtPipeA);
+    gtBroker.ptApi->RegisterSubscriber(&gtBroker, &gtPipeC);
+    gtBroker.ptApi->RegisterSubscriber(&gtBroker, &gtPipeB);
+
+    TEST_SB_MSG_T atMsgs[5] = {{0x10}, {0x11}, {0x30}, {0x20}, {0x12}};
+    JUNO_SB_PUBLISH_ENTRY_T atEntries[5] = {
+        {1, TestSbMsg_PointerInit(&atMsgs[0])},
+        {1, TestSbMsg_PointerInit(&atMsgs[1])},
+        {3, TestSbMsg_PointerInit(&atMsgs[2])},
+        {2, TestSbMsg_PointerInit(&atMsgs[3])},
+        {1, TestSbMsg_PointerInit(&atMsgs[4])},
+    };
+    JUNO_RESULT_SIZE_T tResult = gtBroker.ptApi->PublishBatch(&gtBroker, atEntries, 5);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(5, tResult.tOk);
+    TEST_ASSERT_EQUAL(3, gtPipeA.tRoot.zLength);
+    TEST_ASSERT_EQUAL(3, gtPipeB.tRoot.zLength);
+    TEST_ASSERT_EQUAL(1, gtPipeC.tRoot.zLength);
+
+    TEST_SB_MSG_T tOut = {0};
+    JUNO_POINTER_T tOutPtr = TestSbMsg_PointerInit(&tOut);
+    JunoDs_QueuePop(&gtPipeC.tRoot, tOutPtr);
+    TEST_ASSERT_EQUAL_HEX32(0x20, tOut.iPayload);
+    for(size_t i = 0; i < 3; i++)
+    {
+        JunoDs_QueuePop(&gtPipeB.tRoot, tOutPtr);
+        TEST_ASSERT_EQUAL_HEX32(i < 2 ? 0x10 + i : 0x12, tOut.iPayload);
+    }
+}
+
+// @{"verify": ["REQ-SB-018"]}
+static void test_sb_publish_batch_reports_failed_index(void)
+{
+    JunoSb_BrokerInit(&gtBroker, gptPipeRegistry,
+                       TEST_SB_REGISTRY_CAPACITY, NULL, NULL);
+    JunoSb_PipeInit(&gtPipeA, 1, &gtPipeArrayA.tRoot, NULL, NULL);
+    gtBroker.ptApi->RegisterSubscriber(&gtBroker, &gtPipeA);
+
+    TEST_SB_MSG_T tMsg = {.iPayload = 1};
+    JUNO_SB_PUBLISH_ENTRY_T atEntries[TEST_SB_PIPE_CAPACITY + 2];
+    for(size_t i = 0; i < TEST_SB_PIPE_CAPACITY + 2; i++)
+    {
+        atEntries[i].tMid = 1;
+        atEntries[i].tMsg = TestSbMsg_PointerInit(&tMsg);
+    }
+    /* The pipe fills up after TEST_SB_PIPE_CAPACITY entries */
+    JUNO_RESULT_SIZE_T tResult = gtBroker.ptApi->PublishBatch(&gtBroker, atEntries, TEST_SB_PIPE_CAPACITY + 2);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(TEST_SB_PIPE_CAPACITY, tResult.tOk);
+    TEST_ASSERT_EQUAL(TEST_SB_PIPE_CAPACITY, gtPipeA.tRoot.zLength);
+}
+
+// @{"verify": ["REQ-SB-017"]}
+static void test_sb_publish_batch_empty_and_null(void)
+{
+    JunoSb_BrokerInit(&gtBroker, gptPipeRegistry,
+                       TEST_SB_REGISTRY_CAPACITY, NULL, NULL);
+    JUNO_RESULT_SIZE_T tResult = gtBroker.ptApi->PublishBatch(&gtBroker, NULL, 0);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(0, tResult.tOk);
+    tResult = gtBroker.ptApi->PublishBatch(&gtBroker, NULL, 1);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+}
+
 /* ============================================================================
  * Test Cases: Broker Verification (REQ-SB-010, REQ-SB-011, REQ-SB-012)
  * ============================================================================ */
@@ -398,6 +506,11 @@ int main(void)
     /* Publish */
     RUN_TEST(test_sb_publish_fan_out);
     RUN_TEST(test_sb_publish_skip_non_matching);
+    /* Batched Publish */
+    RUN_TEST(test_sb_publish_batch_in_order);
+    RUN_TEST(test_sb_publish_batch_runs_of_same_mid);
+    RUN_TEST(test_sb_publish_batch_reports_failed_index);
+    RUN_TEST(test_sb_publish_batch_empty_and_null);
     /* Verification */
     RUN_TEST(test_sb_broker_verify_null_api);
     RUN_TEST(test_sb_broker_verify_null_registry);
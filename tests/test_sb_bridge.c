@@ -0,0 +1,305 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_sb_bridge.c
+ * @brief Unit tests for the Software Bus broker bridge.
+ * @details
+ *  Both brokers are driven from one thread here; the bridge ring uses the
+ *  same protocol as the SPSC queue exercised in benchmarks/bench_queue_spsc.c.
+ */
+
+#include "juno/sb/bridge.h"
+#include "juno/app/app_api.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/sb/broker_api.h"
+#include "juno/status.h"
+#include "unity.h"
+#include "unity_internals.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* ============================================================================
+ * Test Data Type Definition
+ * ============================================================================ */
+
+typedef struct TEST_BRIDGE_DATA_TAG
+{
+    uint32_t iValue;
+} TEST_BRIDGE_DATA_T;
+
+typedef struct TEST_BRIDGE_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    TEST_BRIDGE_DATA_T *ptBuffer;
+} TEST_BRIDGE_ARRAY_T;
+
+static JUNO_STATUS_T TestBridgeData_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T TestBridgeData_Reset(JUNO_POINTER_T tPointer);
+static JUNO_STATUS_T TestBridge_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T TestBridge_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T TestBridge_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+
+static const JUNO_POINTER_API_T gtTestBridgeDataPointerApi = {
+    TestBridgeData_Copy,
+    TestBridgeData_Reset
+};
+
+static const JUNO_DS_ARRAY_API_T gtTestBridgeArrayApi = {
+    TestBridge_SetAt,
+    TestBridge_GetAt,
+    TestBridge_RemoveAt
+};
+
+#define TestBridgeData_PointerInit(addr) JunoMemory_PointerInit(&gtTestBridgeDataPointerApi, TEST_BRIDGE_DATA_T, addr)
+#define TestBridgeData_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, TEST_BRIDGE_DATA_T, gtTestBridgeDataPointerApi)
+
+static JUNO_STATUS_T TestBridgeData_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = TestBridgeData_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = TestBridgeData_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_BRIDGE_DATA_T *)tDest.pvAddr = *(TEST_BRIDGE_DATA_T *)tSrc.pvAddr;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestBridgeData_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = TestBridgeData_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_BRIDGE_DATA_T *)tPointer.pvAddr = (TEST_BRIDGE_DATA_T){0};
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestBridge_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_BRIDGE_ARRAY_T *ptBridgeArray = (TEST_BRIDGE_ARRAY_T *)ptArray;
+    return TestBridgeData_Copy(TestBridgeData_PointerInit(&ptBridgeArray->ptBuffer[iIndex]), tItem);
+}
+
+static JUNO_RESULT_POINTER_T TestBridge_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {0};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    TEST_BRIDGE_ARRAY_T *ptBridgeArray = (TEST_BRIDGE_ARRAY_T *)ptArray;
+    tResult.tOk = TestBridgeData_PointerInit(&ptBridgeArray->ptBuffer[iIndex]);
+    return tResult;
+}
+
+static JUNO_STATUS_T TestBridge_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_BRIDGE_ARRAY_T *ptBridgeArray = (TEST_BRIDGE_ARRAY_T *)ptArray;
+    return TestBridgeData_Reset(TestBridgeData_PointerInit(&ptBridgeArray->ptBuffer[iIndex]));
+}
+
+/* ============================================================================
+ * Test Fixture Setup/Teardown
+ * ============================================================================ */
+
+#define TEST_BRIDGE_CAPACITY 4
+#define TEST_DEST_CAPACITY 2
+#define TEST_ROUTES 2
+#define TEST_DEST_PIPES 3
+
+static JUNO_SB_BROKER_ROOT_T gtSrcBroker;
+static JUNO_SB_PIPE_T *gptSrcRegistry[TEST_ROUTES];
+static JUNO_SB_BRIDGE_ROUTE_T gatRoutes[TEST_ROUTES];
+
+static JUNO_SB_BRIDGE_T gtBridge;
+static TEST_BRIDGE_ARRAY_T gtBridgeArray;
+static TEST_BRIDGE_DATA_T gatBridgeBuffer[TEST_BRIDGE_CAPACITY];
+static JUNO_SB_MID_T gaiSlotMids[TEST_BRIDGE_CAPACITY];
+
+static JUNO_SB_BROKER_ROOT_T gtDestBroker;
+static JUNO_SB_PIPE_T *gptDestRegistry[TEST_DEST_PIPES];
+static JUNO_SB_PIPE_T gatDestPipes[TEST_DEST_PIPES];
+static TEST_BRIDGE_ARRAY_T gatDestArrays[TEST_DEST_PIPES];
+static TEST_BRIDGE_DATA_T gatDestBuffers[TEST_DEST_PIPES][TEST_DEST_CAPACITY];
+
+static void TestBridge_ArrayInit(TEST_BRIDGE_ARRAY_T *ptArray, TEST_BRIDGE_DATA_T *ptBuffer, size_t zCapacity)
+{
+    memset(ptBuffer, 0, zCapacity * sizeof(TEST_BRIDGE_DATA_T));
+    ptArray->ptBuffer = ptBuffer;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_ArrayInit(&ptArray->tRoot, &gtTestBridgeArrayApi, zCapacity, NULL, NULL));
+}
+
+static JUNO_STATUS_T TestBridge_Publish(JUNO_SB_MID_T iMid, uint32_t iValue)
+{
+    TEST_BRIDGE_DATA_T tData = {iValue};
+    return gtSrcBroker.ptApi->Publish(&gtSrcBroker, iMid, TestBridgeData_PointerInit(&tData));
+}
+
+static JUNO_STATUS_T TestBridge_Receive(size_t iPipe, uint32_t *piValue)
+{
+    TEST_BRIDGE_DATA_T tOut = {0};
+    JUNO_DS_QUEUE_ROOT_T *ptQueue = &gatDestPipes[iPipe].tRoot;
+    JUNO_STATUS_T tStatus = ptQueue->ptApi->Dequeue(ptQueue, TestBridgeData_PointerInit(&tOut));
+    *piValue = tOut.iValue;
+    return tStatus;
+}
+
+void setUp(void)
+{
+    TestBridge_ArrayInit(&gtBridgeArray, gatBridgeBuffer, TEST_BRIDGE_CAPACITY);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BrokerInit(&gtDestBroker, gptDestRegistry, TEST_DEST_PIPES, NULL, NULL));
+    for(size_t i = 0; i < TEST_DEST_PIPES; i++)
+    {
+        /* Destination pipes subscribe to MIDs 1, 2 and 3 */
+        TestBridge_ArrayInit(&gatDestArrays[i], gatDestBuffers[i], TEST_DEST_CAPACITY);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_PipeInit(&gatDestPipes[i], (JUNO_SB_MID_T)(i + 1), &gatDestArrays[i].tRoot, NULL, NULL));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtDestBroker.ptApi->RegisterSubscriber(&gtDestBroker, &gatDestPipes[i]));
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BridgeInit(&gtBridge, &gtDestBroker, &gtBridgeArray.tRoot, gaiSlotMids, 0, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BrokerInit(&gtSrcBroker, gptSrcRegistry, TEST_ROUTES, NULL, NULL));
+    for(size_t i = 0; i < TEST_ROUTES; i++)
+    {
+        /* The bridge forwards MIDs 1 and 2 only */
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BridgeRouteInit(&gatRoutes[i], &gtBridge, (JUNO_SB_MID_T)(i + 1)));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtSrcBroker.ptApi->RegisterSubscriber(&gtSrcBroker, &gatRoutes[i].tRoot));
+    }
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases
+ * ============================================================================ */
+
+// @{"verify": ["REQ-SB-023", "REQ-SB-024"]}
+static void test_sb_bridge_init(void)
+{
+    TEST_ASSERT_NOT_NULL(gtBridge.tRoot.ptApi);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtBridge.tRoot.ptApi->OnStart(&gtBridge.tRoot));
+    JUNO_SB_BRIDGE_T tBridge = {0};
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BridgeInit(&tBridge, NULL, &gtBridgeArray.tRoot, gaiSlotMids, 0, NULL, NULL));
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BridgeInit(&tBridge, &gtDestBroker, &gtBridgeArray.tRoot, NULL, 0, NULL, NULL));
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BridgeInit(&tBridge, &gtDestBroker, NULL, gaiSlotMids, 0, NULL, NULL));
+    JUNO_SB_BRIDGE_ROUTE_T tRoute = {0};
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_BridgeRouteInit(&tRoute, &tBridge, 1));
+}
+
+// @{"verify": ["REQ-SB-024", "REQ-SB-025"]}
+static void test_sb_bridge_forwards_matching_mids(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(1, 10));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(3, 30));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(2, 20));
+    /* Nothing reaches the destination until the drain app runs */
+    uint32_t iValue = 0;
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(0, &iValue));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtBridge.tRoot.ptApi->OnProcess(&gtBridge.tRoot));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(0, &iValue));
+    TEST_ASSERT_EQUAL_UINT32(10, iValue);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(1, &iValue));
+    TEST_ASSERT_EQUAL_UINT32(20, iValue);
+    /* MID 3 has no route */
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(2, &iValue));
+}
+
+// @{"verify": ["REQ-SB-025"]}
+static void test_sb_bridge_batch_limit(void)
+{
+    gtBridge.zBatchLimit = 2;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(1, 1));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(2, 2));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(1, 3));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtBridge.tRoot.ptApi->OnProcess(&gtBridge.tRoot));
+    uint32_t iValue = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(0, &iValue));
+    TEST_ASSERT_EQUAL_UINT32(1, iValue);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(0, &iValue));
+    JUNO_RESULT_SIZE_T tResult = JunoSb_BridgeDrain(&gtBridge, 0);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(1, tResult.tOk);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(0, &iValue));
+    TEST_ASSERT_EQUAL_UINT32(3, iValue);
+    tResult = JunoSb_BridgeDrain(&gtBridge, 0);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(0, tResult.tOk);
+}
+
+// @{"verify": ["REQ-SB-026"]}
+static void test_sb_bridge_full_ring(void)
+{
+    for(uint32_t i = 0; i < TEST_BRIDGE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(2 - (i % 2), i));
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_OOB_ERROR, TestBridge_Publish(1, 99));
+    JUNO_RESULT_SIZE_T tResult = JunoSb_BridgeDrain(&gtBridge, 1);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(1, tResult.tOk);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(1, 99));
+}
+
+// @{"verify": ["REQ-SB-024"]}
+static void test_sb_bridge_route_is_write_only(void)
+{
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(1, 5));
+    JUNO_DS_QUEUE_ROOT_T *ptQueue = &gatRoutes[0].tRoot.tRoot;
+    TEST_BRIDGE_DATA_T tOut = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, ptQueue->ptApi->Dequeue(ptQueue, TestBridgeData_PointerInit(&tOut)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_TYPE_ERROR, ptQueue->ptApi->Peek(ptQueue).tStatus);
+}
+
+// @{"verify": ["REQ-SB-026"]}
+static void test_sb_bridge_destination_failure(void)
+{
+    /* The MID 1 destination pipe holds two messages, the third publish fails */
+    for(uint32_t i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Publish(1, i));
+    }
+    JUNO_RESULT_SIZE_T tResult = JunoSb_BridgeDrain(&gtBridge, 0);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(3, tResult.tOk);
+    /* The failed message was dropped, the one after it is still queued */
+    uint32_t iValue = 0;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(0, &iValue));
+    TEST_ASSERT_EQUAL_UINT32(0, iValue);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(0, &iValue));
+    TEST_ASSERT_EQUAL_UINT32(1, iValue);
+    tResult = JunoSb_BridgeDrain(&gtBridge, 0);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(1, tResult.tOk);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestBridge_Receive(0, &iValue));
+    TEST_ASSERT_EQUAL_UINT32(3, iValue);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_sb_bridge_init);
+    RUN_TEST(test_sb_bridge_forwards_matching_mids);
+    RUN_TEST(test_sb_bridge_batch_limit);
+    RUN_TEST(test_sb_bridge_full_ring);
+    RUN_TEST(test_sb_bridge_route_is_write_only);
+    RUN_TEST(test_sb_bridge_destination_failure);
+    return UNITY_END();
+}
@@ -0,0 +1,409 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_sb_broker_indexed.c
+ * @brief Unit tests for the LibJuno topic-indexed Software Bus broker.
+ */
+
+#include "juno/sb/broker_indexed.h"
+#include "juno/sb/broker_api.h"
+#include "juno/ds/array_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/macros.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include "unity.h"
+#include "unity_internals.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* ============================================================================
+ * Test Message Type
+ * ============================================================================ */
+
+typedef struct TEST_SB_MSG_TAG
+{
+    uint32_t iPayload;
+} TEST_SB_MSG_T;
+
+/* ============================================================================
+ * Test Array Implementation (backing store for pipes/queues)
+ * ============================================================================ */
+
+#define TEST_SB_PIPE_CAPACITY 4
+
+typedef struct TEST_SB_ARRAY_TAG
+{
+    JUNO_DS_ARRAY_ROOT_T tRoot;
+    TEST_SB_MSG_T atBuffer[TEST_SB_PIPE_CAPACITY];
+} TEST_SB_ARRAY_T;
+
+/* Forward declarations */
+static JUNO_STATUS_T TestSb_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex);
+static JUNO_RESULT_POINTER_T TestSb_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T TestSb_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex);
+static JUNO_STATUS_T TestSbMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T TestSbMsg_Reset(JUNO_POINTER_T tPointer);
+
+/* Pointer API */
+const JUNO_POINTER_API_T gtTestSbMsgPointerApi = {
+    TestSbMsg_Copy,
+    TestSbMsg_Reset
+};
+
+#define TestSbMsg_PointerInit(addr) JunoMemory_PointerInit(&gtTestSbMsgPointerApi, TEST_SB_MSG_T, addr)
+#define TestSbMsg_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, TEST_SB_MSG_T, gtTestSbMsgPointerApi)
+#define TEST_SB_ASSERT_API(ptArray, ...) if(ptArray->ptApi != &gtTestSbArrayApi) { __VA_ARGS__; }
+
+/* Array API */
+static const JUNO_DS_ARRAY_API_T gtTestSbArrayApi = {
+    TestSb_SetAt,
+    TestSb_GetAt,
+    TestSb_RemoveAt
+};
+
+/* ============================================================================
+ * Pointer API Implementation
+ * ============================================================================ */
+
+static JUNO_STATUS_T TestSbMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = TestSbMsg_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = TestSbMsg_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_SB_MSG_T *)tDest.pvAddr = *(TEST_SB_MSG_T *)tSrc.pvAddr;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestSbMsg_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = TestSbMsg_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_SB_MSG_T *)tPointer.pvAddr = (TEST_SB_MSG_T){0};
+    return JUNO_STATUS_SUCCESS;
+}
+
+/* ============================================================================
+ * Array API Implementation
+ * ============================================================================ */
+
+static JUNO_STATUS_T TestSb_SetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, JUNO_POINTER_T tItem, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_SB_ASSERT_API(ptArray, return JUNO_STATUS_INVALID_TYPE_ERROR);
+    tStatus = TestSbMsg_PointerVerify(tItem);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_SB_ARRAY_T *ptTestArray = (TEST_SB_ARRAY_T *)ptArray;
+    JUNO_POINTER_T tDest = TestSbMsg_PointerInit(&ptTestArray->atBuffer[iIndex]);
+    return TestSbMsg_Copy(tDest, tItem);
+}
+
+static JUNO_RESULT_POINTER_T TestSb_GetAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_RESULT_POINTER_T tResult = {JUNO_STATUS_ERR, {0}};
+    tResult.tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tResult.tStatus, return tResult);
+    TEST_SB_ASSERT_API(ptArray, tResult.tStatus = JUNO_STATUS_INVALID_TYPE_ERROR; return tResult);
+    TEST_SB_ARRAY_T *ptTestArray = (TEST_SB_ARRAY_T *)ptArray;
+    tResult.tOk = TestSbMsg_PointerInit(&ptTestArray->atBuffer[iIndex]);
+    tResult.tStatus = JUNO_STATUS_SUCCESS;
+    return tResult;
+}
+
+static JUNO_STATUS_T TestSb_RemoveAt(JUNO_DS_ARRAY_ROOT_T *ptArray, size_t iIndex)
+{
+    JUNO_STATUS_T tStatus = JunoDs_ArrayVerifyIndex(ptArray, iIndex);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    TEST_SB_ASSERT_API(ptArray, return JUNO_STATUS_INVALID_TYPE_ERROR);
+    TEST_SB_ARRAY_T *ptTestArray = (TEST_SB_ARRAY_T *)ptArray;
+    JUNO_POINTER_T tSlot = TestSbMsg_PointerInit(&ptTestArray->atBuffer[iIndex]);
+    return TestSbMsg_Reset(tSlot);
+}
+
+
+/* ============================================================================
+ * Fixtures
+ * ============================================================================ */
+
+#define TEST_SB_REGISTRY_CAPACITY 4
+#define TEST_SB_TOPIC_CAPACITY 3
+
+static JUNO_SB_BROKER_INDEXED_T gtBroker;
+static JUNO_SB_PIPE_T          *gptPipeRegistry[TEST_SB_REGISTRY_CAPACITY];
+static JUNO_SB_TOPIC_T          gtTopicTable[TEST_SB_TOPIC_CAPACITY];
+
+static TEST_SB_ARRAY_T gtPipeArrays[TEST_SB_REGISTRY_CAPACITY];
+static JUNO_SB_PIPE_T  gtPipes[TEST_SB_REGISTRY_CAPACITY];
+
+static void InitTestArray(TEST_SB_ARRAY_T *ptArr)
+{
+    memset(ptArr, 0, sizeof(*ptArr));
+    JunoDs_ArrayInit(&ptArr->tRoot, &gtTestSbArrayApi, TEST_SB_PIPE_CAPACITY,
+                     NULL, NULL);
+}
+
+static void InitBroker(void)
+{
+    JUNO_STATUS_T tStatus = JunoSb_BrokerIndexedInit(&gtBroker, gptPipeRegistry,
+                                                      TEST_SB_REGISTRY_CAPACITY,
+                                                      gtTopicTable,
+                                                      TEST_SB_TOPIC_CAPACITY,
+                                                      NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+}
+
+static JUNO_STATUS_T RegisterPipe(size_t iPipe, JUNO_SB_MID_T iMid)
+{
+    JunoSb_PipeInit(&gtPipes[iPipe], iMid, &gtPipeArrays[iPipe].tRoot, NULL, NULL);
+    return gtBroker.tRoot.ptApi->RegisterSubscriber(&gtBroker.tRoot, &gtPipes[iPipe]);
+}
+
+void setUp(void)
+{
+    memset(&gtBroker, 0, sizeof(gtBroker));
+    memset(gptPipeRegistry, 0, sizeof(gptPipeRegistry));
+    memset(gtTopicTable, 0, sizeof(gtTopicTable));
+    memset(gtPipes, 0, sizeof(gtPipes));
+    for(size_t i = 0; i < TEST_SB_REGISTRY_CAPACITY; i++)
+    {
+        InitTestArray(&gtPipeArrays[i]);
+    }
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Initialization (REQ-SB-014)
+ * ============================================================================ */
+
+// @{"verify": ["REQ-SB-014"]}
+static void test_sb_indexed_init_success(void)
+{
+    InitBroker();
+    TEST_ASSERT_NOT_NULL(gtBroker.tRoot.ptApi);
+    TEST_ASSERT_EQUAL_PTR(gtTopicTable, gtBroker.ptTopicTable);
+    TEST_ASSERT_EQUAL(TEST_SB_TOPIC_CAPACITY, gtBroker.zTopicCapacity);
+    TEST_ASSERT_EQUAL(0, gtBroker.zTopicLength);
+    TEST_ASSERT_EQUAL(0, gtBroker.tRoot.zRegistryLength);
+}
+
+// @{"verify": ["REQ-SB-014"]}
+static void test_sb_indexed_init_null_topic_table(void)
+{
+    JUNO_STATUS_T tStatus = JunoSb_BrokerIndexedInit(&gtBroker, gptPipeRegistry,
+                                                      TEST_SB_REGISTRY_CAPACITY,
+                                                      NULL, TEST_SB_TOPIC_CAPACITY,
+                                                      NULL, NULL);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    tStatus = JunoSb_BrokerIndexedInit(&gtBroker, gptPipeRegistry,
+                                        TEST_SB_REGISTRY_CAPACITY,
+                                        gtTopicTable, 0,
+                                        NULL, NULL);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+}
+
+// @{"verify": ["REQ-SB-014"]}
+static void test_sb_indexed_verify_null_topic_table(void)
+{
+    InitBroker();
+    gtBroker.ptTopicTable = NULL;
+    TEST_SB_MSG_T tMsg = {.iPayload = 1};
+    JUNO_POINTER_T tMsgPtr = TestSbMsg_PointerInit(&tMsg);
+    JUNO_STATUS_T tStatus = gtBroker.tRoot.ptApi->Publish(&gtBroker.tRoot, 1, tMsgPtr);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+}
+
+/* ============================================================================
+ * Test Cases: Registration (REQ-SB-015)
+ * ============================================================================ */
+
+// @{"verify": ["REQ-SB-015"]}
+static void test_sb_indexed_register_groups_by_mid(void)
+{
+    InitBroker();
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RegisterPipe(0, 5));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RegisterPipe(1, 2));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RegisterPipe(2, 5));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RegisterPipe(3, 2));
+
+    TEST_ASSERT_EQUAL(4, gtBroker.tRoot.zRegistryLength);
+    TEST_ASSERT_EQUAL(2, gtBroker.zTopicLength);
+    /* Topics sorted ascending by MID */
+    TEST_ASSERT_EQUAL(2, gtTopicTable[0].iMsgId);
+    TEST_ASSERT_EQUAL(0, gtTopicTable[0].iStart);
+    TEST_ASSERT_EQUAL(2, gtTopicTable[0].zCount);
+    TEST_ASSERT_EQUAL(5, gtTopicTable[1].iMsgId);
+    TEST_ASSERT_EQUAL(2, gtTopicTable[1].iStart);
+    TEST_ASSERT_EQUAL(2, gtTopicTable[1].zCount);
+    /* Registry grouped by MID, registration order kept within a group */
+    TEST_ASSERT_EQUAL_PTR(&gtPipes[1], gptPipeRegistry[0]);
+    TEST_ASSERT_EQUAL_PTR(&gtPipes[3], gptPipeRegistry[1]);
+    TEST_ASSERT_EQUAL_PTR(&gtPipes[0], gptPipeRegistry[2]);
+    TEST_ASSERT_EQUAL_PTR(&gtPipes[2], gptPipeRegistry[3]);
+}
+
+// @{"verify": ["REQ-SB-015", "REQ-SB-009"]}
+static void test_sb_indexed_register_registry_full(void)
+{
+    InitBroker();
+    for(size_t i = 0; i < TEST_SB_REGISTRY_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RegisterPipe(i, 1));
+    }
+    JUNO_SB_PIPE_T tExtra = {0};
+    TEST_SB_ARRAY_T tExtraArray;
+    InitTestArray(&tExtraArray);
+    JunoSb_PipeInit(&tExtra, 1, &tExtraArray.tRoot, NULL, NULL);
+    JUNO_STATUS_T tStatus = gtBroker.tRoot.ptApi->RegisterSubscriber(&gtBroker.tRoot, &tExtra);
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+}
+
+// @{"verify": ["REQ-SB-015"]}
+static void test_sb_indexed_register_topic_table_full(void)
+{
+    InitBroker();
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RegisterPipe(0, 1));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RegisterPipe(1, 2));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RegisterPipe(2, 3));
+    /* A fourth distinct MID does not fit in the topic table */
+    TEST_ASSERT_EQUAL(JUNO_STATUS_TABLE_FULL_ERROR, RegisterPipe(3, 4));
+    TEST_ASSERT_EQUAL(3, gtBroker.tRoot.zRegistryLength);
+    /* An existing MID still registers */
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, RegisterPipe(3, 2));
+}
+
+/* ============================================================================
+ * Test Cases: Publish (REQ-SB-016)
+ * ============================================================================ */
+
+// @{"verify": ["REQ-SB-016", "REQ-SB-006", "REQ-SB-007"]}
+static void test_sb_indexed_publish_matching_only(void)
+{
+    InitBroker();
+    RegisterPipe(0, 7);
+    RegisterPipe(1, 3);
+    RegisterPipe(2, 7);
+    RegisterPipe(3, 9);
+
+    TEST_SB_MSG_T tMsg = {.iPayload = 0xCAFE};
+    JUNO_POINTER_T tMsgPtr = TestSbMsg_PointerInit(&tMsg);
+    JUNO_STATUS_T tStatus = gtBroker.tRoot.ptApi->Publish(&gtBroker.tRoot, 7, tMsgPtr);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+
+    TEST_ASSERT_EQUAL(1, gtPipes[0].tRoot.zLength);
+    TEST_ASSERT_EQUAL(0, gtPipes[1].tRoot.zLength);
+    TEST_ASSERT_EQUAL(1, gtPipes[2].tRoot.zLength);
+    TEST_ASSERT_EQUAL(0, gtPipes[3].tRoot.zLength);
+
+    TEST_SB_MSG_T tOut = {0};
+    JUNO_POINTER_T tOutPtr = TestSbMsg_PointerInit(&tOut);
+    tStatus = JunoDs_QueuePop(&gtPipes[2].tRoot, tOutPtr);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    TEST_ASSERT_EQUAL_HEX32(0xCAFE, tOut.iPayload);
+}
+
+// @{"verify": ["REQ-SB-016"]}
+static void test_sb_indexed_publish_no_subscribers(void)
+{
+    InitBroker();
+    RegisterPipe(0, 7);
+
+    TEST_SB_MSG_T tMsg = {.iPayload = 1};
+    JUNO_POINTER_T tMsgPtr = TestSbMsg_PointerInit(&tMsg);
+    /* MIDs below, between and above the registered topics */
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtBroker.tRoot.ptApi->Publish(&gtBroker.tRoot, 1, tMsgPtr));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtBroker.tRoot.ptApi->Publish(&gtBroker.tRoot, 100, tMsgPtr));
+    TEST_ASSERT_EQUAL(0, gtPipes[0].tRoot.zLength);
+}
+
+// @{"verify": ["REQ-SB-016"]}
+static void test_sb_indexed_publish_propagates_pipe_full(void)
+{
+    InitBroker();
+    RegisterPipe(0, 7);
+
+    TEST_SB_MSG_T tMsg = {.iPayload = 1};
+    JUNO_POINTER_T tMsgPtr = TestSbMsg_PointerInit(&tMsg);
+    for(size_t i = 0; i < TEST_SB_PIPE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, gtBroker.tRoot.ptApi->Publish(&gtBroker.tRoot, 7, tMsgPtr));
+    }
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, gtBroker.tRoot.ptApi->Publish(&gtBroker.tRoot, 7, tMsgPtr));
+}
+
+// @{"verify": ["REQ-SB-017", "REQ-SB-018"]}
+static void test_sb_indexed_publish_batch(void)
+{
+    InitBroker();
+    RegisterPipe(0, 7);
+    RegisterPipe(1, 3);
+
+    TEST_SB_MSG_T atMsgs[TEST_SB_PIPE_CAPACITY + 3];
+    JUNO_SB_PUBLISH_ENTRY_T atEntries[TEST_SB_PIPE_CAPACITY + 3];
+    /* A run of MID 7, one unsubscribed MID, then MID 7 until its pipe overflows */
+    for(size_t i = 0; i < TEST_SB_PIPE_CAPACITY + 3; i++)
+    {
+        atMsgs[i].iPayload = (uint32_t)i;
+        atEntries[i].tMid = 7;
+        atEntries[i].tMsg = TestSbMsg_PointerInit(&atMsgs[i]);
+    }
+    atEntries[1].tMid = 42;
+    atEntries[2].tMid = 3;
+    JUNO_RESULT_SIZE_T tResult = gtBroker.tRoot.ptApi->PublishBatch(&gtBroker.tRoot, atEntries, TEST_SB_PIPE_CAPACITY + 3);
+    /* Pipe 0 is full after entry TEST_SB_PIPE_CAPACITY + 1, so the last entry fails */
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(TEST_SB_PIPE_CAPACITY + 2, tResult.tOk);
+    TEST_ASSERT_EQUAL(TEST_SB_PIPE_CAPACITY, gtPipes[0].tRoot.zLength);
+    TEST_ASSERT_EQUAL(1, gtPipes[1].tRoot.zLength);
+
+    TEST_SB_MSG_T tOut = {0};
+    JUNO_POINTER_T tOutPtr = TestSbMsg_PointerInit(&tOut);
+    JunoDs_QueuePop(&gtPipes[0].tRoot, tOutPtr);
+    TEST_ASSERT_EQUAL(0, tOut.iPayload);
+    JunoDs_QueuePop(&gtPipes[0].tRoot, tOutPtr);
+    TEST_ASSERT_EQUAL(3, tOut.iPayload);
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    /* Init */
+    RUN_TEST(test_sb_indexed_init_success);
+    RUN_TEST(test_sb_indexed_init_null_topic_table);
+    RUN_TEST(test_sb_indexed_verify_null_topic_table);
+    /* Register */
+    RUN_TEST(test_sb_indexed_register_groups_by_mid);
+    RUN_TEST(test_sb_indexed_register_registry_full);
+    RUN_TEST(test_sb_indexed_register_topic_table_full);
+    /* Publish */
+    RUN_TEST(test_sb_indexed_publish_matching_only);
+    RUN_TEST(test_sb_indexed_publish_no_subscribers);
+    RUN_TEST(test_sb_indexed_publish_propagates_pipe_full);
+    RUN_TEST(test_sb_indexed_publish_batch);
+    return UNITY_END();
+}
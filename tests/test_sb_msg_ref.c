@@ -0,0 +1,268 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_sb_msg_ref.c
+ * @brief Unit tests for reference-counted Software Bus messages.
+ */
+
+#include "juno/sb/msg_ref.h"
+#include "juno/sb/broker_api.h"
+#include "juno/ds/queue_api.h"
+#include "juno/memory/memory_block.h"
+#include "juno/memory/pointer_api.h"
+#include "juno/status.h"
+#include "unity.h"
+#include "unity_internals.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* ============================================================================
+ * Test Message Type
+ * ============================================================================ */
+
+typedef struct TEST_REF_MSG_TAG
+{
+    uint32_t iSeq;
+    uint8_t aiPayload[60];
+} TEST_REF_MSG_T;
+
+static size_t gzPayloadCopies;
+
+static JUNO_STATUS_T TestRefMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc);
+static JUNO_STATUS_T TestRefMsg_Reset(JUNO_POINTER_T tPointer);
+
+static const JUNO_POINTER_API_T gtTestRefMsgPointerApi = {
+    TestRefMsg_Copy,
+    TestRefMsg_Reset
+};
+
+#define TestRefMsg_PointerInit(addr) JunoMemory_PointerInit(&gtTestRefMsgPointerApi, TEST_REF_MSG_T, addr)
+#define TestRefMsg_PointerVerify(tPointer) JunoMemory_PointerVerifyType(tPointer, TEST_REF_MSG_T, gtTestRefMsgPointerApi)
+
+static JUNO_STATUS_T TestRefMsg_Copy(JUNO_POINTER_T tDest, const JUNO_POINTER_T tSrc)
+{
+    JUNO_STATUS_T tStatus = TestRefMsg_PointerVerify(tDest);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    tStatus = TestRefMsg_PointerVerify(tSrc);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_REF_MSG_T *)tDest.pvAddr = *(TEST_REF_MSG_T *)tSrc.pvAddr;
+    gzPayloadCopies += 1;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T TestRefMsg_Reset(JUNO_POINTER_T tPointer)
+{
+    JUNO_STATUS_T tStatus = TestRefMsg_PointerVerify(tPointer);
+    JUNO_ASSERT_SUCCESS(tStatus, return tStatus);
+    *(TEST_REF_MSG_T *)tPointer.pvAddr = (TEST_REF_MSG_T){0};
+    return JUNO_STATUS_SUCCESS;
+}
+
+/* ============================================================================
+ * Fixtures
+ * ============================================================================ */
+
+#define TEST_POOL_LENGTH 4
+#define TEST_PIPES 3
+#define TEST_PIPE_CAPACITY 2
+
+static TEST_REF_MSG_T gatPoolMemory[TEST_POOL_LENGTH];
+static JUNO_MEMORY_BLOCK_METADATA_T gatPoolMetadata[TEST_POOL_LENGTH];
+static size_t gazRefCounts[TEST_POOL_LENGTH];
+static JUNO_MEMORY_ALLOC_BLOCK_T gtAlloc;
+static JUNO_SB_MSG_POOL_T gtPool;
+
+static JUNO_SB_BROKER_ROOT_T gtBroker;
+static JUNO_SB_PIPE_T *gptPipeRegistry[TEST_PIPES];
+static JUNO_SB_MSG_REF_T gatRefs[TEST_PIPES][TEST_PIPE_CAPACITY];
+static JUNO_SB_MSG_REF_ARRAY_T gatRefArrays[TEST_PIPES];
+static JUNO_SB_PIPE_T gatPipes[TEST_PIPES];
+
+void setUp(void)
+{
+    memset(gatPoolMemory, 0, sizeof(gatPoolMemory));
+    memset(gatPoolMetadata, 0, sizeof(gatPoolMetadata));
+    gzPayloadCopies = 0;
+    JUNO_STATUS_T tStatus = JunoMemory_BlockInit(&gtAlloc, &gtTestRefMsgPointerApi, gatPoolMemory, gatPoolMetadata,
+                                                 sizeof(TEST_REF_MSG_T), alignof(TEST_REF_MSG_T), TEST_POOL_LENGTH,
+                                                 NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    tStatus = JunoSb_MsgPoolInit(&gtPool, &gtAlloc, gazRefCounts, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    tStatus = JunoSb_BrokerInit(&gtBroker, gptPipeRegistry, TEST_PIPES, NULL, NULL);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    for(size_t i = 0; i < TEST_PIPES; i++)
+    {
+        tStatus = JunoSb_MsgRefArrayInit(&gatRefArrays[i], gatRefs[i], TEST_PIPE_CAPACITY, NULL, NULL);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+        /* Pipes 0 and 1 subscribe to MID 1, pipe 2 to MID 2 */
+        tStatus = JunoSb_PipeInit(&gatPipes[i], i < 2 ? 1 : 2, &gatRefArrays[i].tRoot, NULL, NULL);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+        tStatus = gtBroker.ptApi->RegisterSubscriber(&gtBroker, &gatPipes[i]);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    }
+}
+
+void tearDown(void)
+{
+}
+
+/* ============================================================================
+ * Test Cases: Pool (REQ-SB-019)
+ * ============================================================================ */
+
+// @{"verify": ["REQ-SB-019"]}
+static void test_sb_msg_pool_init(void)
+{
+    TEST_ASSERT_NOT_NULL(gtPool.ptApi);
+    TEST_ASSERT_EQUAL_PTR(&gtAlloc, gtPool.ptAlloc);
+    TEST_ASSERT_EQUAL(0, gazRefCounts[0]);
+    JUNO_SB_MSG_POOL_T tPool = {0};
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_MsgPoolInit(&tPool, &gtAlloc, NULL, NULL, NULL));
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_MsgPoolInit(&tPool, NULL, gazRefCounts, NULL, NULL));
+}
+
+/* ============================================================================
+ * Test Cases: Publish by reference (REQ-SB-020, REQ-SB-021, REQ-SB-022)
+ * ============================================================================ */
+
+// @{"verify": ["REQ-SB-020", "REQ-SB-022"]}
+static void test_sb_publish_ref_copies_payload_once(void)
+{
+    TEST_REF_MSG_T tMsg = {.iSeq = 7};
+    tMsg.aiPayload[59] = 0xAB;
+    JUNO_STATUS_T tStatus = JunoSb_PublishRef(&gtBroker, &gtPool, 1, TestRefMsg_PointerInit(&tMsg));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    TEST_ASSERT_EQUAL(1, gzPayloadCopies);
+    /* Two subscribers hold a reference, the publisher released its own */
+    TEST_ASSERT_EQUAL(1, gatPipes[0].tRoot.zLength);
+    TEST_ASSERT_EQUAL(1, gatPipes[1].tRoot.zLength);
+    TEST_ASSERT_EQUAL(0, gatPipes[2].tRoot.zLength);
+    TEST_ASSERT_EQUAL(2, gazRefCounts[0]);
+    TEST_ASSERT_EQUAL_PTR(gatRefs[0][0].tMsg.pvAddr, gatRefs[1][0].tMsg.pvAddr);
+    TEST_ASSERT_EQUAL(7, ((TEST_REF_MSG_T *)gatRefs[0][0].tMsg.pvAddr)->iSeq);
+    TEST_ASSERT_EQUAL_HEX8(0xAB, ((TEST_REF_MSG_T *)gatRefs[1][0].tMsg.pvAddr)->aiPayload[59]);
+}
+
+// @{"verify": ["REQ-SB-021"]}
+static void test_sb_msg_ref_last_release_returns_block(void)
+{
+    TEST_REF_MSG_T tMsg = {.iSeq = 9};
+    JunoSb_PublishRef(&gtBroker, &gtPool, 1, TestRefMsg_PointerInit(&tMsg));
+
+    JUNO_SB_MSG_REF_T tRefA = {0};
+    JUNO_SB_MSG_REF_T tRefB = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueuePop(&gatPipes[0].tRoot, JunoSb_MsgRefPointerInit(&gtPool, &tRefA)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoDs_QueuePop(&gatPipes[1].tRoot, JunoSb_MsgRefPointerInit(&gtPool, &tRefB)));
+    /* Dequeue hands the references over to the subscribers */
+    TEST_ASSERT_EQUAL(2, gazRefCounts[0]);
+    TEST_ASSERT_EQUAL(9, ((TEST_REF_MSG_T *)tRefA.tMsg.pvAddr)->iSeq);
+    TEST_ASSERT_EQUAL(1, gtAlloc.zUsed);
+
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_MsgRefRelease(&tRefA));
+    TEST_ASSERT_NULL(tRefA.ptPool);
+    TEST_ASSERT_EQUAL(1, gazRefCounts[0]);
+    TEST_ASSERT_EQUAL(1, gtAlloc.zUsed);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_MsgRefRelease(&tRefB));
+    TEST_ASSERT_EQUAL(0, gazRefCounts[0]);
+    TEST_ASSERT_EQUAL(0, gtAlloc.zUsed);
+    TEST_ASSERT_EQUAL(1, gzPayloadCopies);
+}
+
+// @{"verify": ["REQ-SB-020", "REQ-SB-021"]}
+static void test_sb_publish_ref_without_subscribers(void)
+{
+    TEST_REF_MSG_T tMsg = {.iSeq = 1};
+    JUNO_STATUS_T tStatus = JunoSb_PublishRef(&gtBroker, &gtPool, 99, TestRefMsg_PointerInit(&tMsg));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    /* Nobody took a reference so the block is already back in the pool */
+    TEST_ASSERT_EQUAL(0, gtAlloc.zUsed);
+}
+
+// @{"verify": ["REQ-SB-020"]}
+static void test_sb_publish_ref_pool_exhausted(void)
+{
+    TEST_REF_MSG_T tMsg = {.iSeq = 1};
+    /* Fill every pipe so each pool block stays referenced */
+    for(size_t i = 0; i < TEST_PIPE_CAPACITY; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_PublishRef(&gtBroker, &gtPool, 1, TestRefMsg_PointerInit(&tMsg)));
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_PublishRef(&gtBroker, &gtPool, 2, TestRefMsg_PointerInit(&tMsg)));
+    }
+    TEST_ASSERT_EQUAL(TEST_POOL_LENGTH, gtAlloc.zUsed);
+    /* No block is left, even for a MID without subscribers */
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_PublishRef(&gtBroker, &gtPool, 99, TestRefMsg_PointerInit(&tMsg)));
+}
+
+// @{"verify": ["REQ-SB-020", "REQ-SB-021"]}
+static void test_sb_publish_ref_pipe_full_releases_block(void)
+{
+    TEST_REF_MSG_T tMsg = {.iSeq = 1};
+    for(size_t i = 0; i < TEST_PIPE_CAPACITY; i++)
+    {
+        JunoSb_PublishRef(&gtBroker, &gtPool, 1, TestRefMsg_PointerInit(&tMsg));
+    }
+    /* Drain pipe 1 so only pipe 0 is full */
+    for(size_t i = 0; i < TEST_PIPE_CAPACITY; i++)
+    {
+        JUNO_SB_MSG_REF_T tRef = {0};
+        JunoDs_QueuePop(&gatPipes[1].tRoot, JunoSb_MsgRefPointerInit(&gtPool, &tRef));
+        JunoSb_MsgRefRelease(&tRef);
+    }
+    TEST_ASSERT_EQUAL(1, gazRefCounts[0]);
+    TEST_ASSERT_EQUAL(1, gazRefCounts[1]);
+    /* Pipe 0 rejects the handle; the publisher's reference is still released */
+    JUNO_STATUS_T tStatus = JunoSb_PublishRef(&gtBroker, &gtPool, 1, TestRefMsg_PointerInit(&tMsg));
+    TEST_ASSERT_NOT_EQUAL(JUNO_STATUS_SUCCESS, tStatus);
+    TEST_ASSERT_EQUAL(0, gazRefCounts[2]);
+    TEST_ASSERT_EQUAL(2, gtAlloc.zUsed);
+}
+
+// @{"verify": ["REQ-SB-021"]}
+static void test_sb_msg_ref_release_invalid(void)
+{
+    /* Releasing an empty handle is a no-op */
+    JUNO_SB_MSG_REF_T tRef = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoSb_MsgRefRelease(&tRef));
+    /* A handle to a block with no references is rejected */
+    tRef.ptPool = &gtPool;
+    tRef.tMsg = TestRefMsg_PointerInit(&gatPoolMemory[0]);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_REF_ERROR, JunoSb_MsgRefRelease(&tRef));
+    /* A handle to memory outside the pool is rejected */
+    TEST_REF_MSG_T tOutside = {0};
+    tRef.tMsg = TestRefMsg_PointerInit(&tOutside);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_REF_ERROR, JunoSb_MsgRefRelease(&tRef));
+}
+
+/* ============================================================================
+ * Main
+ * ============================================================================ */
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_sb_msg_pool_init);
+    RUN_TEST(test_sb_publish_ref_copies_payload_once);
+    RUN_TEST(test_sb_msg_ref_last_release_returns_block);
+    RUN_TEST(test_sb_publish_ref_without_subscribers);
+    RUN_TEST(test_sb_publish_ref_pool_exhausted);
+    RUN_TEST(test_sb_publish_ref_pipe_full_releases_block);
+    RUN_TEST(test_sb_msg_ref_release_invalid);
+    return UNITY_END();
+}
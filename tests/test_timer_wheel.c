@@ -0,0 +1,338 @@
+/*
+    MIT License
+
+    Copyright (c) 2025 Robin A. Onsay
+
+    Permission is hereby granted, free of charge, to any person obtaining
+    a copy of this software and associated documentation files
+    (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge,
+    publish, distribute, sublicense, and/or sell copies of the Software,
+    and to permit persons to whom the Software is furnished to do so,
+    subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be
+    included in all copies or substantial portions of the Software.
+*/
+
+/**
+ * @file test_timer_wheel.c
+ * @brief Unit tests for the timer wheel
+ *
+ * A fake clock drives a small wheel so that timers cascade through every
+ * level and past the wheel's range. Each expiry is checked against the clock:
+ * a timer must never fire before its expiry, and must fire on the first
+ * Advance whose time reaches the tick boundary after it.
+ */
+
+#include "juno/time/timer_wheel.h"
+#include "juno/time/time_api.h"
+#include "juno/module.h"
+#include "juno/status.h"
+#include "juno/types.h"
+#include "unity.h"
+#include "unity_internals.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define TEST_LEVEL_BITS 2
+#define TEST_LEVELS 3
+#define TEST_SLOTS JUNO_TIME_WHEEL_SLOTS(TEST_LEVEL_BITS, TEST_LEVELS)
+#define TEST_TIMERS 64
+/// About one millisecond
+#define TEST_TICK_SUBSECS 4194304u
+
+typedef struct TEST_TIMER_TAG
+{
+    JUNO_TIME_TIMER_T tTimer;
+    size_t zFired;
+    /// Restart from the callback while nonzero
+    size_t zRestarts;
+    JUNO_STATUS_T tReturn;
+    /// Timer to stop from the callback
+    JUNO_TIME_TIMER_T *ptStop;
+    /// The expiry was already in the past when started
+    bool bPast;
+} TEST_TIMER_T;
+
+static JUNO_TIMESTAMP_T gtNow = {0};
+static JUNO_TIMESTAMP_T gtPrevNow = {0};
+static JUNO_TIMESTAMP_T gtTick = {0};
+static JUNO_TIMESTAMP_T gtRestartDelay = {0};
+static JUNO_TIME_ROOT_T gtTime = {0};
+static JUNO_TIME_WHEEL_T gtWheel = {0};
+static JUNO_TIME_TIMER_T *gptSlots[TEST_SLOTS];
+static TEST_TIMER_T gatTimers[TEST_TIMERS];
+
+static JUNO_TIMESTAMP_RESULT_T Now(const JUNO_TIME_ROOT_T *ptTime)
+{
+    (void)ptTime;
+    JUNO_TIMESTAMP_RESULT_T tResult = {JUNO_STATUS_SUCCESS, gtNow};
+    return tResult;
+}
+
+static JUNO_STATUS_T SleepTo(const JUNO_TIME_ROOT_T *ptTime, JUNO_TIMESTAMP_T tTimeToWakeup)
+{
+    (void)ptTime; (void)tTimeToWakeup;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static JUNO_STATUS_T Sleep(const JUNO_TIME_ROOT_T *ptTime, JUNO_TIMESTAMP_T tDuration)
+{
+    (void)ptTime; (void)tDuration;
+    return JUNO_STATUS_SUCCESS;
+}
+
+static const JUNO_TIME_API_T gtTimeApi = JunoTime_TimeApiInit(Now, SleepTo, Sleep);
+
+static uint32_t giSeed = 2718;
+
+static uint32_t TestWheel_Rand(void)
+{
+    giSeed = giSeed * 1103515245u + 12345u;
+    return giSeed >> 8;
+}
+
+/// Duration of n ticks, built exactly so that test times land on tick boundaries
+static JUNO_TIMESTAMP_T TestWheel_Ticks(uint32_t iTicks)
+{
+    uint64_t iSubSeconds = (uint64_t)iTicks * TEST_TICK_SUBSECS;
+    JUNO_TIMESTAMP_T tTime = {0};
+    tTime.iSeconds = (JUNO_TIME_SECONDS_T)(iSubSeconds / UINT32_MAX);
+    tTime.iSubSeconds = (JUNO_TIME_SUBSECONDS_T)(iSubSeconds % UINT32_MAX);
+    return tTime;
+}
+
+/// Move the fake clock forward and advance the wheel to it
+static JUNO_RESULT_SIZE_T TestWheel_Step(uint32_t iTicks)
+{
+    gtPrevNow = gtNow;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_AddTime(&gtTime, &gtNow, TestWheel_Ticks(iTicks)));
+    return JunoTime_WheelPoll(&gtWheel);
+}
+
+static JUNO_STATUS_T TestWheel_Expired(JUNO_TIME_TIMER_T *ptTimer, JUNO_USER_DATA_T *pvUserData)
+{
+    TEST_TIMER_T *ptTest = (TEST_TIMER_T *) pvUserData;
+    TEST_ASSERT_EQUAL_PTR(&ptTest->tTimer, ptTimer);
+    TEST_ASSERT_FALSE(JunoTime_TimerIsActive(ptTimer));
+    // Never early
+    TEST_ASSERT_FALSE(JunoTime_TimestampLessThan(gtNow, ptTimer->tExpiry));
+    // Not late: the previous Advance had not reached the tick boundary after the expiry
+    JUNO_TIMESTAMP_T tLatest = ptTimer->tExpiry;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_AddTime(&gtTime, &tLatest, gtTick));
+    TEST_ASSERT_TRUE(ptTest->bPast || JunoTime_TimestampLessThan(gtPrevNow, tLatest));
+    ptTest->zFired += 1;
+    if(ptTest->ptStop)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStop(&gtWheel, ptTest->ptStop));
+    }
+    if(ptTest->zRestarts)
+    {
+        ptTest->zRestarts -= 1;
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerRestart(&gtWheel, ptTimer, gtRestartDelay));
+    }
+    return ptTest->tReturn;
+}
+
+void setUp(void)
+{
+    gtNow = (JUNO_TIMESTAMP_T){1000, 12345};
+    gtPrevNow = gtNow;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimeInit(&gtTime, &gtTimeApi, NULL, NULL));
+    gtTick = TestWheel_Ticks(1);
+    gtRestartDelay = TestWheel_Ticks(3);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_WheelInit(&gtWheel, &gtTime, gptSlots, TEST_SLOTS, TEST_LEVEL_BITS, TEST_LEVELS, gtTick, NULL, NULL));
+    for(size_t i = 0; i < TEST_TIMERS; i++)
+    {
+        gatTimers[i] = (TEST_TIMER_T){0};
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerInit(&gatTimers[i].tTimer, TestWheel_Expired, &gatTimers[i]));
+    }
+}
+
+void tearDown(void)
+{
+
+}
+
+/// Random starts, stops and restarts across every level and past the wheel's range
+// @{"verify": ["REQ-TIME-020", "REQ-TIME-021", "REQ-TIME-022", "REQ-TIME-023", "REQ-TIME-024"]}
+static void test_timer_wheel_fires_on_time(void)
+{
+    size_t zStarted = 0;
+    size_t zFired = 0;
+    for(size_t zStep = 0; zStep < 4000; zStep++)
+    {
+        TEST_TIMER_T *ptTest = &gatTimers[TestWheel_Rand() % TEST_TIMERS];
+        uint32_t iOp = TestWheel_Rand() % 8;
+        // Delays up to 200 ticks, the wheel covers 63
+        JUNO_TIMESTAMP_T tDelay = TestWheel_Ticks(TestWheel_Rand() % 200);
+        tDelay.iSubSeconds += TestWheel_Rand() % 1000;
+        bool bActive = JunoTime_TimerIsActive(&ptTest->tTimer);
+        if(iOp < 3 && !bActive)
+        {
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &ptTest->tTimer, tDelay));
+            zStarted += 1;
+        }
+        else if(iOp == 3)
+        {
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStop(&gtWheel, &ptTest->tTimer));
+            zStarted -= bActive;
+        }
+        else if(iOp == 4)
+        {
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerRestart(&gtWheel, &ptTest->tTimer, tDelay));
+            zStarted += !bActive;
+        }
+        else if(iOp == 5 && !bActive)
+        {
+            // Due now, fires on the next tick
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStartAt(&gtWheel, &ptTest->tTimer, gtNow));
+            zStarted += 1;
+        }
+        else
+        {
+            JUNO_RESULT_SIZE_T tResult = TestWheel_Step(TestWheel_Rand() % 8);
+            TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+            zFired += tResult.tOk;
+        }
+        TEST_ASSERT_EQUAL(zStarted - zFired, gtWheel.zActive);
+    }
+    // Every timer is due within 200 ticks
+    for(size_t zStep = 0; gtWheel.zActive && zStep < 1000; zStep++)
+    {
+        JUNO_RESULT_SIZE_T tResult = TestWheel_Step(TestWheel_Rand() % 8);
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+        zFired += tResult.tOk;
+    }
+    size_t zCallbacks = 0;
+    for(size_t i = 0; i < TEST_TIMERS; i++)
+    {
+        zCallbacks += gatTimers[i].zFired;
+    }
+    TEST_ASSERT_EQUAL(zStarted, zFired);
+    TEST_ASSERT_EQUAL(zFired, zCallbacks);
+}
+
+/// Expiries sharing a tick fire in one batch, stopped timers never fire
+// @{"verify": ["REQ-TIME-023", "REQ-TIME-024"]}
+static void test_timer_wheel_batch_and_stop(void)
+{
+    for(size_t i = 0; i < 10; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &gatTimers[i].tTimer, TestWheel_Ticks(40)));
+    }
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStop(&gtWheel, &gatTimers[3].tTimer));
+    // Stopping an inactive timer is a no-op
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStop(&gtWheel, &gatTimers[3].tTimer));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStop(&gtWheel, &gatTimers[20].tTimer));
+    TEST_ASSERT_EQUAL(9, gtWheel.zActive);
+    // An expiry in the past fires on the next tick
+    JUNO_TIMESTAMP_T tPast = {0};
+    gatTimers[30].bPast = true;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStartAt(&gtWheel, &gatTimers[30].tTimer, tPast));
+    JUNO_RESULT_SIZE_T tResult = TestWheel_Step(1);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(1, tResult.tOk);
+    tResult = TestWheel_Step(38);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(0, tResult.tOk);
+    tResult = TestWheel_Step(1);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(9, tResult.tOk);
+    TEST_ASSERT_EQUAL(0, gatTimers[3].zFired);
+    TEST_ASSERT_EQUAL(0, gtWheel.zActive);
+}
+
+/// Callbacks can restart their own timer and stop timers due on the same tick
+// @{"verify": ["REQ-TIME-023", "REQ-TIME-024"]}
+static void test_timer_wheel_callback_reentry(void)
+{
+    // Periodic timer: restarted from its own callback 5 times
+    gatTimers[0].zRestarts = 5;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &gatTimers[0].tTimer, gtRestartDelay));
+    // Timers 1 and 2 share a tick and stop each other, whichever fires first wins
+    gatTimers[1].ptStop = &gatTimers[2].tTimer;
+    gatTimers[2].ptStop = &gatTimers[1].tTimer;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &gatTimers[1].tTimer, TestWheel_Ticks(7)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &gatTimers[2].tTimer, TestWheel_Ticks(7)));
+    for(size_t i = 0; i < 40; i++)
+    {
+        TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestWheel_Step(1).tStatus);
+    }
+    TEST_ASSERT_EQUAL(6, gatTimers[0].zFired);
+    TEST_ASSERT_EQUAL(1, gatTimers[1].zFired + gatTimers[2].zFired);
+    TEST_ASSERT_EQUAL(0, gtWheel.zActive);
+}
+
+/// A failing callback stops Advance after its tick, the batch still completes
+// @{"verify": ["REQ-TIME-024"]}
+static void test_timer_wheel_callback_failure(void)
+{
+    gatTimers[0].tReturn = JUNO_STATUS_ERR;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &gatTimers[0].tTimer, TestWheel_Ticks(2)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &gatTimers[1].tTimer, TestWheel_Ticks(2)));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &gatTimers[2].tTimer, TestWheel_Ticks(4)));
+    JUNO_RESULT_SIZE_T tResult = TestWheel_Step(10);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_ERR, tResult.tStatus);
+    TEST_ASSERT_EQUAL(2, tResult.tOk);
+    TEST_ASSERT_EQUAL(0, gatTimers[2].zFired);
+    // The next call resumes from the following tick
+    tResult = JunoTime_WheelPoll(&gtWheel);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, tResult.tStatus);
+    TEST_ASSERT_EQUAL(1, tResult.tOk);
+}
+
+/// An idle wheel jumps over elapsed ticks and keeps its tick boundaries
+// @{"verify": ["REQ-TIME-024"]}
+static void test_timer_wheel_idle_fast_forward(void)
+{
+    JUNO_TIME_TICK_T iStart = gtWheel.iNowTick;
+    gtNow.iSeconds += 3600;
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, TestWheel_Step(0).tStatus);
+    TEST_ASSERT_EQUAL(3600ull * UINT32_MAX / TEST_TICK_SUBSECS, gtWheel.iNowTick - iStart);
+    TEST_ASSERT_TRUE(JunoTime_TimestampLessThan(gtNow, gtWheel.tNextTick));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &gatTimers[0].tTimer, TestWheel_Ticks(5)));
+    TEST_ASSERT_EQUAL(0, TestWheel_Step(4).tOk);
+    // The expiry falls mid-tick and fires on the boundary after it
+    TEST_ASSERT_EQUAL(1, TestWheel_Step(2).tOk);
+}
+
+// @{"verify": ["REQ-TIME-020", "REQ-TIME-022"]}
+static void test_timer_wheel_errors(void)
+{
+    JUNO_TIME_WHEEL_T tWheel = {0};
+    JUNO_TIMESTAMP_T tZero = {0};
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoTime_WheelInit(NULL, &gtTime, gptSlots, TEST_SLOTS, TEST_LEVEL_BITS, TEST_LEVELS, gtTick, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoTime_WheelInit(&tWheel, NULL, gptSlots, TEST_SLOTS, TEST_LEVEL_BITS, TEST_LEVELS, gtTick, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoTime_WheelInit(&tWheel, &gtTime, NULL, TEST_SLOTS, TEST_LEVEL_BITS, TEST_LEVELS, gtTick, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoTime_WheelInit(&tWheel, &gtTime, gptSlots, TEST_SLOTS - 1, TEST_LEVEL_BITS, TEST_LEVELS, gtTick, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoTime_WheelInit(&tWheel, &gtTime, gptSlots, TEST_SLOTS, 0, TEST_LEVELS, gtTick, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoTime_WheelInit(&tWheel, &gtTime, gptSlots, TEST_SLOTS, TEST_LEVEL_BITS, 0, gtTick, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoTime_WheelInit(&tWheel, &gtTime, gptSlots, TEST_SLOTS, 16, 4, gtTick, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_INVALID_SIZE_ERROR, JunoTime_WheelInit(&tWheel, &gtTime, gptSlots, TEST_SLOTS, TEST_LEVEL_BITS, TEST_LEVELS, tZero, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoTime_TimerInit(NULL, TestWheel_Expired, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoTime_TimerInit(&gatTimers[0].tTimer, NULL, NULL));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoTime_TimerStart(&gtWheel, NULL, gtTick));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoTime_TimerStart(NULL, &gatTimers[0].tTimer, gtTick));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoTime_WheelAdvance(NULL, gtNow).tStatus);
+    TEST_ASSERT_EQUAL(JUNO_STATUS_NULLPTR_ERROR, JunoTime_WheelPoll(NULL).tStatus);
+    // Starting an active timer is rejected, Restart is the way to move it
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerStart(&gtWheel, &gatTimers[0].tTimer, gtTick));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_REF_IN_USE_ERROR, JunoTime_TimerStart(&gtWheel, &gatTimers[0].tTimer, gtTick));
+    TEST_ASSERT_EQUAL(JUNO_STATUS_SUCCESS, JunoTime_TimerRestart(&gtWheel, &gatTimers[0].tTimer, gtTick));
+    TEST_ASSERT_EQUAL(1, gtWheel.zActive);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_timer_wheel_fires_on_time);
+    RUN_TEST(test_timer_wheel_batch_and_stop);
+    RUN_TEST(test_timer_wheel_callback_reentry);
+    RUN_TEST(test_timer_wheel_callback_failure);
+    RUN_TEST(test_timer_wheel_idle_fast_forward);
+    RUN_TEST(test_timer_wheel_errors);
+    return UNITY_END();
+}